@@ -4,22 +4,8 @@
 
 #include "Avatar.h"
 
-#ifndef PI
-#define PI 3.1415926535897932384626433832795
-#endif
-
 namespace m5avatar {
 
-unsigned int seed = 0;
-
-#ifndef rand_r
-#define init_rand() srand(seed)
-#define _rand() rand()
-#else
-#define init_rand() ;
-#define _rand() rand_r(&seed)
-#endif
-
 #ifdef SDL_h_
 #define TaskResult() return 0
 #define TaskDelay(ms) lgfx::delay(ms)
@@ -36,6 +22,12 @@ Avatar *DriveContext::getAvatar() { return avatar; }
 
 TaskHandle_t drawTaskHandle;
 
+static constexpr uint32_t IDLE_INTERVAL = 33;
+
+// 見た目が変わらない程度の変化は描画タスクに通知しない
+static constexpr int32_t GAZE_THRESHOLD = Q15_ONE / 32;
+static constexpr int32_t BREATH_THRESHOLD = Q15_ONE / 8;  // < 1px of 3px
+
 TaskResult_t drawLoop(void *args) {
   DriveContext *ctx = reinterpret_cast<DriveContext *>(args);
   Avatar *avatar = ctx->getAvatar();
@@ -44,62 +36,49 @@ TaskResult_t drawLoop(void *args) {
     if (avatar->isDrawing()) {
       avatar->draw();
     }
+#ifdef SDL_h_
     TaskDelay(10);
+#else
+    // requestDraw で起こされるまで待つ（何も変わらなければ描き直さない）
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#endif
   }
   TaskResult();
 }
 
+#ifdef SDL_h_
 TaskResult_t facialLoop(void *args) {
-  int count = 0;
   DriveContext *ctx = reinterpret_cast<DriveContext *>(args);
   Avatar *avatar = ctx->getAvatar();
-  uint32_t saccade_interval = 1000;
-  uint32_t blink_interval = 1000;
-  unsigned long last_saccade_millis = 0;
-  unsigned long last_blink_millis = 0;
-  bool eye_open = true;
-  float vertical = 0.0f;
-  float horizontal = 0.0f;
-  float breath = 0.0f;
-  init_rand();
   // update facial internal state
   while (avatar->isDrawing()) {
-    if ((lgfx::millis() - last_saccade_millis) > saccade_interval) {
-      vertical = _rand() / (RAND_MAX / 2.0) - 1;
-      horizontal = _rand() / (RAND_MAX / 2.0) - 1;
-      avatar->setRightGaze(vertical, horizontal);
-      avatar->setLeftGaze(vertical, horizontal);
-      saccade_interval = 500 + 100 * random(20);
-      last_saccade_millis = lgfx::millis();
-    }
-
-    if (avatar->getIsAutoBlink()) {
-      if ((lgfx::millis() - last_blink_millis) > blink_interval) {
-        if (eye_open) {
-          avatar->setEyeOpenRatio(1.0f);
-          blink_interval = 2500 + 100 * random(20);
-        } else {
-          avatar->setEyeOpenRatio(0.0f);
-          blink_interval = 300 + 10 * random(20);
-        }
-        eye_open = !eye_open;
-        last_blink_millis = lgfx::millis();
-      }
-    }
-
-    count = (count + 1) % 100;
-    breath = sin(count * 2 * PI / 100.0);
-    avatar->setBreath(breath);
-    TaskDelay(33);  // approx. 30fps
+    avatar->updateIdle(lgfx::millis());
+    TaskDelay(IDLE_INTERVAL);
   }
   TaskResult();
 }
+#else
+static void idleTimerCallback(void *arg) {
+  Avatar *avatar = reinterpret_cast<Avatar *>(arg);
+  if (avatar->isDrawing()) {
+    avatar->updateIdle(lgfx::millis());
+  }
+}
+#endif
 
-Avatar::Avatar() : Avatar(new Face()) {}
+static inline int32_t absDiff(int32_t a, int32_t b) {
+  return a > b ? a - b : b - a;
+}
+
+Avatar::Avatar() : Avatar(new Face()) { ownsFace = true; }
 
 Avatar::Avatar(Face *face)
     : face{face},
+      pendingFace{nullptr},
+      swappingFace{false},
+      ownsFace{false},
       _isDrawing{false},
+      animating{false},
       expression{Expression::Neutral},
       breath{0},
       leftEyeOpenRatio_{1.0f},
@@ -115,14 +94,57 @@ Avatar::Avatar(Face *face)
       palette{ColorPalette()},
       speechText{""},
       colorDepth{1},
-      batteryIconStatus{BatteryIconStatus::invisible} {}
+      batteryIconStatus{BatteryIconStatus::invisible},
+      idleBehavior{&defaultIdleBehavior},
+      lastIdleState{0, 0, Q15_ONE, 0} {
+  colorLUT.build(palette);
+#ifndef SDL_h_
+  idleTimer = nullptr;
+  idleLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+}
 
-Avatar::~Avatar() { delete face; }
+Avatar::~Avatar() {
+#ifndef SDL_h_
+  if (idleTimer != nullptr) {
+    esp_timer_stop(idleTimer);
+    esp_timer_delete(idleTimer);
+  }
+#endif
+  delete pendingFace;
+  delete face;
+}
+
+void Avatar::setFace(Face *face) {
+  this->face = face;
+  ownsFace = false;
+  requestDraw();
+}
 
-void Avatar::setFace(Face *face) { this->face = face; }
+bool Avatar::loadFace(const uint8_t *description, size_t length) {
+  ColorPalette cp = palette;
+  Face *next = FaceLoader::load(description, length, &cp);
+  if (next == nullptr) {
+    return false;
+  }
+  if (description[5] > 0) {
+    setColorPalette(cp);
+  }
+  // 描画タスクがまだ取り込んでいない前回の顔はここで解放する
+  Face *prev = __atomic_exchange_n(&pendingFace, next, __ATOMIC_ACQ_REL);
+  delete prev;
+  requestDraw();
+  return true;
+}
 
 Face *Avatar::getFace() const { return face; }
 
+bool Avatar::isFaceLoading() const {
+  // pendingFace が空になった時は描画タスクが swappingFace を立て終わっている
+  return __atomic_load_n(&pendingFace, __ATOMIC_SEQ_CST) != nullptr ||
+         __atomic_load_n(&swappingFace, __ATOMIC_SEQ_CST);
+}
+
 void Avatar::addTask(TaskFunction_t f, const char *name,
                      const uint32_t stack_size, UBaseType_t priority,
                      TaskHandle_t *const task_handle,
@@ -151,7 +173,14 @@ void Avatar::init(int colorDepth) {
   start(colorDepth);
 }
 
-void Avatar::stop() { _isDrawing = false; }
+void Avatar::stop() {
+  _isDrawing = false;
+#ifndef SDL_h_
+  if (idleTimer != nullptr) {
+    esp_timer_stop(idleTimer);
+  }
+#endif
+}
 
 void Avatar::suspend() {
 #ifndef SDL_h_
@@ -163,6 +192,8 @@ void Avatar::resume() {
 #ifndef SDL_h_
   vTaskResume(drawTaskHandle);
 #endif
+  // suspend 中に変えた設定を描く
+  requestDraw();
 }
 
 void Avatar::start(int colorDepth) {
@@ -171,6 +202,9 @@ void Avatar::start(int colorDepth) {
   _isDrawing = true;
 
   this->colorDepth = colorDepth;
+  if (idleBehavior != nullptr) {
+    idleBehavior->reset(lgfx::millis());
+  }
   DriveContext *ctx = new DriveContext(this);
 #ifdef SDL_h_
   drawTaskHandle =
@@ -186,17 +220,35 @@ void Avatar::start(int colorDepth) {
                        &drawTaskHandle, /* Task handle. */
                        APP_CPU_NUM);
 
-  xTaskCreateUniversal(facialLoop,   /* Function to implement the task */
-                       "facialLoop", /* Name of the task */
-                       1024,         /* Stack size in words */
-                       ctx,          /* Task input parameter */
-                       2,            /* Priority of the task */
-                       NULL,         /* Task handle. */
-                       APP_CPU_NUM);
+  // 表情の内部状態は専用タスクではなく esp_timer のコールバックで更新する
+  if (idleTimer == nullptr) {
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = idleTimerCallback;
+    timerArgs.arg = this;
+    timerArgs.name = "avatarIdle";
+    esp_timer_create(&timerArgs, &idleTimer);
+  }
+  if (idleTimer != nullptr) {
+    esp_timer_start_periodic(idleTimer, IDLE_INTERVAL * 1000);
+  }
 #endif
 }
 
 void Avatar::draw() {
+  // 読み込んだ顔を取り込んで描き終わるまで isFaceLoading() を true にしておく
+  __atomic_store_n(&swappingFace, true, __ATOMIC_SEQ_CST);
+  Face *next = __atomic_exchange_n(&pendingFace, static_cast<Face *>(nullptr),
+                                   __ATOMIC_SEQ_CST);
+  if (next != nullptr) {
+    // setPosition で調整した位置は新しい顔にも引き継ぐ
+    BoundingRect *rect = face->getBoundingRect();
+    next->getBoundingRect()->setPosition(rect->getTop(), rect->getLeft());
+    if (ownsFace) {
+      delete face;
+    }
+    face = next;
+    ownsFace = true;
+  }
   Gaze rightGaze = Gaze(this->rightGazeV_, this->rightGazeV_);
   Gaze leftGaze = Gaze(this->leftGazeV_, this->leftGazeH_);
   DrawContext *ctx = new DrawContext(
@@ -204,9 +256,13 @@ void Avatar::draw() {
       this->rightEyeOpenRatio_, leftGaze, this->leftEyeOpenRatio_,
       this->mouthOpenRatio, this->speechText, this->rotation, this->scale,
       this->colorDepth, this->batteryIconStatus, this->batteryLevel,
-      this->speechFont);
+      this->speechFont, &this->colorLUT, &this->effectLayer,
+      &this->statusOverlay);
   face->draw(ctx);
   delete ctx;
+  __atomic_store_n(&swappingFace, false, __ATOMIC_SEQ_CST);
+  // エフェクトが動いている間はアイドルのタイマーが描画タスクを起こす
+  animating = face->isAnimating();
 }
 
 bool Avatar::isDrawing() { return _isDrawing; }
@@ -219,23 +275,41 @@ void Avatar::setExpression(Expression expression) {
 
 Expression Avatar::getExpression() { return this->expression; }
 
-void Avatar::setBreath(float breath) { this->breath = breath; }
+void Avatar::setBreath(float breath) {
+  this->breath = breath;
+  requestDraw();
+}
 
 float Avatar::getBreath() { return this->breath; }
 
-void Avatar::setRotation(float radian) { this->rotation = radian; }
+void Avatar::setRotation(float radian) {
+  this->rotation = radian;
+  requestDraw();
+}
 
-void Avatar::setScale(float scale) { this->scale = scale; }
+void Avatar::setScale(float scale) {
+  this->scale = scale;
+  requestDraw();
+}
 
 void Avatar::setPosition(int top, int left) {
   this->getFace()->getBoundingRect()->setPosition(top, left);
+  requestDraw();
 }
 
-void Avatar::setColorPalette(ColorPalette cp) { palette = cp; }
+void Avatar::setColorPalette(ColorPalette cp) {
+  palette = cp;
+  // the LUT is only rebuilt here, not per frame
+  colorLUT.build(palette);
+  requestDraw();
+}
 
 ColorPalette Avatar::getColorPalette(void) const { return this->palette; }
 
-void Avatar::setMouthOpenRatio(float ratio) { this->mouthOpenRatio = ratio; }
+void Avatar::setMouthOpenRatio(float ratio) {
+  this->mouthOpenRatio = ratio;
+  requestDraw();
+}
 
 void Avatar::setEyeOpenRatio(float ratio) {
   setRightEyeOpenRatio(ratio);
@@ -244,23 +318,30 @@ void Avatar::setEyeOpenRatio(float ratio) {
 
 void Avatar::setLeftEyeOpenRatio(float ratio) {
   this->leftEyeOpenRatio_ = ratio;
+  requestDraw();
 }
 
 float Avatar::getLeftEyeOpenRatio() { return this->leftEyeOpenRatio_; }
 
 void Avatar::setRightEyeOpenRatio(float ratio) {
   this->rightEyeOpenRatio_ = ratio;
+  requestDraw();
 }
 
 float Avatar::getRightEyeOpenRatio() { return this->rightEyeOpenRatio_; }
 
-void Avatar::setIsAutoBlink(bool b) { this->isAutoBlink_ = b; }
+void Avatar::setIsAutoBlink(bool b) {
+  lockIdle();
+  this->isAutoBlink_ = b;
+  unlockIdle();
+}
 
 bool Avatar::getIsAutoBlink() { return this->isAutoBlink_; }
 
 void Avatar::setRightGaze(float vertical, float horizontal) {
   this->rightGazeV_ = vertical;
   this->rightGazeH_ = horizontal;
+  requestDraw();
 }
 
 void Avatar::getRightGaze(float *vertical, float *horizontal) {
@@ -271,6 +352,7 @@ void Avatar::getRightGaze(float *vertical, float *horizontal) {
 void Avatar::setLeftGaze(float vertical, float horizontal) {
   this->leftGazeV_ = vertical;
   this->leftGazeH_ = horizontal;
+  requestDraw();
 }
 
 void Avatar::getLeftGaze(float *vertical, float *horizontal) {
@@ -285,10 +367,12 @@ void Avatar::getGaze(float *vertical, float *horizontal){
 
 void Avatar::setSpeechText(const char *speechText) {
   this->speechText = String(speechText);
+  requestDraw();
 }
 
 void Avatar::setSpeechFont(const lgfx::IFont *speechFont) {
   this->speechFont = speechFont;
+  requestDraw();
 }
 
 void Avatar::setBatteryIcon(bool batteryIcon) {
@@ -297,6 +381,7 @@ void Avatar::setBatteryIcon(bool batteryIcon) {
   } else {
     batteryIconStatus = BatteryIconStatus::unknown;
   }
+  requestDraw();
 }
 
 void Avatar::setBatteryStatus(bool isCharging, int32_t batteryLevel) {
@@ -307,7 +392,127 @@ void Avatar::setBatteryStatus(bool isCharging, int32_t batteryLevel) {
       this->batteryIconStatus = BatteryIconStatus::discharging;
     }
     this->batteryLevel = batteryLevel;
+    requestDraw();
   }
 }
 
+int Avatar::addEffect(const AnimatedEffect &effect) {
+  suspend();
+  int id = effectLayer.add(effect, millis());
+  resume();
+  return id;
+}
+
+void Avatar::removeEffect(int id) {
+  suspend();
+  effectLayer.remove(id);
+  resume();
+}
+
+void Avatar::clearEffects() {
+  suspend();
+  effectLayer.clear();
+  resume();
+}
+
+void Avatar::setStatusRSSI(int8_t rssi) {
+  suspend();
+  statusOverlay.setRSSI(rssi);
+  resume();
+}
+
+void Avatar::hideStatusRSSI() {
+  suspend();
+  statusOverlay.hideRSSI();
+  resume();
+}
+
+void Avatar::setStatusClock(const char *text) {
+  suspend();
+  statusOverlay.setClockText(text);
+  resume();
+}
+
+void Avatar::setNotificationCount(uint8_t count) {
+  suspend();
+  statusOverlay.setNotificationCount(count);
+  resume();
+}
+
+void Avatar::setIdleBehavior(IdleBehavior *behavior) {
+  // アイドルのタイマーは描画タスクを止めても動き続けるので、ロックで
+  // update() と入れ替えが重ならないようにする（戻った後は前の動きを使わない）
+  uint32_t now = lgfx::millis();
+  lockIdle();
+  idleBehavior = behavior;
+  if (idleBehavior != nullptr) {
+    idleBehavior->reset(now);
+  }
+  unlockIdle();
+  requestDraw();
+}
+
+void Avatar::updateIdle(uint32_t now) {
+  lockIdle();
+  bool changed = applyIdle(now);
+  unlockIdle();
+  // 描画タスクは通知でしか起きないので、エフェクトの再生中は毎回起こす
+  if (changed || animating) {
+    requestDraw();
+  }
+}
+
+bool Avatar::applyIdle(uint32_t now) {
+  IdleBehavior *behavior = idleBehavior;
+  if (behavior == nullptr) {
+    return false;
+  }
+  IdleState state = lastIdleState;
+  behavior->update(now, &state);
+
+  bool changed = false;
+  if (absDiff(state.gazeV, lastIdleState.gazeV) >= GAZE_THRESHOLD ||
+      absDiff(state.gazeH, lastIdleState.gazeH) >= GAZE_THRESHOLD) {
+    float vertical = state.gazeV / static_cast<float>(Q15_ONE);
+    float horizontal = state.gazeH / static_cast<float>(Q15_ONE);
+    rightGazeV_ = leftGazeV_ = vertical;
+    rightGazeH_ = leftGazeH_ = horizontal;
+    lastIdleState.gazeV = state.gazeV;
+    lastIdleState.gazeH = state.gazeH;
+    changed = true;
+  }
+  if (isAutoBlink_ && state.eyeOpenRatio != lastIdleState.eyeOpenRatio) {
+    rightEyeOpenRatio_ = leftEyeOpenRatio_ =
+        state.eyeOpenRatio / static_cast<float>(Q15_ONE);
+    lastIdleState.eyeOpenRatio = state.eyeOpenRatio;
+    changed = true;
+  }
+  if (absDiff(state.breath, lastIdleState.breath) >= BREATH_THRESHOLD) {
+    breath = state.breath / static_cast<float>(Q15_ONE);
+    lastIdleState.breath = state.breath;
+    changed = true;
+  }
+  return changed;
+}
+
+void Avatar::lockIdle() {
+#ifndef SDL_h_
+  portENTER_CRITICAL(&idleLock);
+#endif
+}
+
+void Avatar::unlockIdle() {
+#ifndef SDL_h_
+  portEXIT_CRITICAL(&idleLock);
+#endif
+}
+
+void Avatar::requestDraw() {
+#ifndef SDL_h_
+  if (drawTaskHandle != nullptr) {
+    xTaskNotifyGive(drawTaskHandle);
+  }
+#endif
+}
+
 }  // namespace m5avatar
@@ -7,7 +7,11 @@
 #include <LovyanGFX.hpp>
 
 #include "ColorPalette.h"
+#include "EffectLayer.h"
 #include "Face.h"
+#include "FaceLoader.h"
+#include "IdleBehavior.h"
+#include "StatusOverlay.h"
 
 #ifdef SDL_h_
 typedef SDL_ThreadFunction TaskFunction_t;
@@ -17,6 +21,7 @@ typedef SDL_Thread *TaskHandle_t;
 typedef int TaskResult_t;
 #define APP_CPU_NUM (1)
 #else
+#include <esp_timer.h>
 typedef void TaskResult_t;
 #endif
 
@@ -33,7 +38,14 @@ namespace m5avatar {
 class Avatar {
  private:
   Face *face;
+  // face loaded by loadFace, swapped in by the draw task
+  Face *pendingFace;
+  // set by the draw task while it may be swapping in and drawing a loaded face
+  bool swappingFace;
+  bool ownsFace;
   bool _isDrawing;
+  // set by the draw task while effects are playing
+  volatile bool animating;
   Expression expression;
   float breath;
 
@@ -53,12 +65,32 @@ class Avatar {
   float rotation;
   float scale;
   ColorPalette palette;
+  ColorLUT colorLUT;
+  EffectLayer effectLayer;
+  StatusOverlay statusOverlay;
   String speechText;
   int colorDepth;
   BatteryIconStatus batteryIconStatus;
   int32_t batteryLevel;
   const lgfx::IFont *speechFont;
 
+  // idle behaviour
+  IdleBehavior *idleBehavior;
+  ProceduralIdleBehavior defaultIdleBehavior;
+  IdleState lastIdleState;
+#ifndef SDL_h_
+  esp_timer_handle_t idleTimer;
+  // guards idleBehavior, lastIdleState and isAutoBlink_ against the idle
+  // timer, which keeps running while the draw task is suspended
+  portMUX_TYPE idleLock;
+#endif
+
+  void lockIdle();
+  void unlockIdle();
+  // advance the idle behaviour with idleLock held. true if a visible value
+  // changed
+  bool applyIdle(uint32_t now);
+
  public:
   Avatar();
   explicit Avatar(Face *face);
@@ -69,6 +101,23 @@ class Avatar {
   ColorPalette getColorPalette() const;
   void setColorPalette(ColorPalette cp);
   void setFace(Face *face);
+
+  /**
+   * @brief build a face from a description (see FaceLoader) and switch to it
+   *
+   * The face is swapped in at the start of the next frame and the previous
+   * face is freed if it was also loaded with this method.
+   *
+   * @return false if the description is invalid or out of memory
+   */
+  bool loadFace(const uint8_t *description, size_t length);
+
+  /**
+   * @brief true until the face of the last loadFace has been swapped in and
+   * drawn once (the previous face is freed and the sprites are allocated by
+   * then)
+   */
+  bool isFaceLoading() const;
   void init(int colorDepth = 1);
   // expression i/o
   Expression getExpression();
@@ -122,6 +171,42 @@ class Avatar {
   void resume();
   void setBatteryIcon(bool iconStatus);
   void setBatteryStatus(bool isCharging, int32_t batteryLevel);
+
+  /**
+   * @brief add an animated effect on top of the face
+   *
+   * @return id for removeEffect or -1 if there are too many effects
+   */
+  int addEffect(const AnimatedEffect &effect);
+  void removeEffect(int id);
+  void clearEffects();
+
+  // status overlay (battery is taken from setBatteryStatus)
+  void setStatusRSSI(int8_t rssi);
+  void hideStatusRSSI();
+  void setStatusClock(const char *text);
+  void setNotificationCount(uint8_t count);
+
+  /**
+   * @brief replace the idle behaviour (gaze, blink, breath)
+   *
+   * @param behavior nullptr stops idle animation. the avatar does not take
+   * ownership. the previous behaviour is no longer used once this returns.
+   * update() and reset() run inside a critical section, so keep them short
+   */
+  void setIdleBehavior(IdleBehavior *behavior);
+
+  /**
+   * @brief advance the idle behaviour and apply changes that are visible.
+   * called from the idle timer
+   */
+  void updateIdle(uint32_t now);
+
+  /**
+   * @brief wake up the draw task. the draw task only redraws when woken;
+   * setters call this themselves
+   */
+  void requestDraw();
 };
 
 class DriveContext {
@@ -35,9 +35,8 @@ class Balloon final : public Drawable {
     if (text.length() == 0) {
       return;
     }
-    ColorPalette* cp = drawContext->getColorPalette();
-    uint16_t primaryColor = cp->get(COLOR_BALLOON_FOREGROUND);
-    uint16_t backgroundColor = cp->get(COLOR_BALLOON_BACKGROUND);
+    uint16_t primaryColor = drawContext->getColor(COLOR_BALLOON_FOREGROUND);
+    uint16_t backgroundColor = drawContext->getColor(COLOR_BALLOON_BACKGROUND);
     // M5.Lcd参照をspiに置き換え
     spi->setTextSize(TEXT_SIZE);
     spi->setTextColor(primaryColor, backgroundColor);
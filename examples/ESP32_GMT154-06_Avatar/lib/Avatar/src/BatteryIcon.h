@@ -35,11 +35,11 @@ class BatteryIcon final : public Drawable {
   BatteryIcon &operator=(const BatteryIcon &other) = default;
   void draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) override {
     if (ctx->getBatteryIconStatus() != BatteryIconStatus::invisible) {
-      uint16_t primaryColor = ctx->getColorDepth() == 1 ? 1 : ctx->getColorPalette()->get(COLOR_PRIMARY);
-      uint16_t bgColor = ctx->getColorDepth() == 1 ? ERACER_COLOR : ctx->getColorPalette()->get(COLOR_BACKGROUND);
+      uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
+      uint16_t bgColor = ctx->getColor(COLOR_BACKGROUND);
       float offset = ctx->getBreath();
       int32_t batteryLevel = ctx->getBatteryLevel();
-      drawBatteryIcon(spi, 285, 5, primaryColor, bgColor, -offset, ctx->getBatteryIconStatus(), batteryLevel);
+      drawBatteryIcon(spi, rect.getRight() - 35 - 5, 5, primaryColor, bgColor, -offset, ctx->getBatteryIconStatus(), batteryLevel);
     }
   };
 
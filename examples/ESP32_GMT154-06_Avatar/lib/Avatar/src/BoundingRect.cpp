@@ -28,6 +28,8 @@ int16_t BoundingRect::getWidth() { return width; }
 
 int16_t BoundingRect::getHeight() { return height; }
 
+bool BoundingRect::isEmpty() { return width <= 0 || height <= 0; }
+
 void BoundingRect::setPosition(int16_t top, int16_t left) {
   this->top = top;
   this->left = left;
@@ -37,4 +39,27 @@ void BoundingRect::setSize(int16_t width, int16_t height) {
   this->width = width;
   this->height = height;
 }
+
+BoundingRect unionRect(BoundingRect a, BoundingRect b) {
+  if (a.isEmpty()) return b;
+  if (b.isEmpty()) return a;
+  int16_t top = a.getTop() < b.getTop() ? a.getTop() : b.getTop();
+  int16_t left = a.getLeft() < b.getLeft() ? a.getLeft() : b.getLeft();
+  int16_t bottom =
+      a.getBottom() > b.getBottom() ? a.getBottom() : b.getBottom();
+  int16_t right = a.getRight() > b.getRight() ? a.getRight() : b.getRight();
+  return BoundingRect(top, left, right - left, bottom - top);
+}
+
+BoundingRect intersectRect(BoundingRect a, BoundingRect b) {
+  int16_t top = a.getTop() > b.getTop() ? a.getTop() : b.getTop();
+  int16_t left = a.getLeft() > b.getLeft() ? a.getLeft() : b.getLeft();
+  int16_t bottom =
+      a.getBottom() < b.getBottom() ? a.getBottom() : b.getBottom();
+  int16_t right = a.getRight() < b.getRight() ? a.getRight() : b.getRight();
+  if (right <= left || bottom <= top) {
+    return BoundingRect(0, 0, 0, 0);
+  }
+  return BoundingRect(top, left, right - left, bottom - top);
+}
 }  // namespace m5avatar
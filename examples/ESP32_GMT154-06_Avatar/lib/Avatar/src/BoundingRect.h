@@ -29,9 +29,20 @@ class BoundingRect {
   int16_t getCenterY();
   int16_t getWidth();
   int16_t getHeight();
+  bool isEmpty();
   void setPosition(int16_t top, int16_t left);
   void setSize(int16_t width, int16_t height);
 };
+
+/**
+ * @brief smallest rect that contains both (empty rects are ignored)
+ */
+BoundingRect unionRect(BoundingRect a, BoundingRect b);
+
+/**
+ * @brief overlapping part of both, or an empty rect
+ */
+BoundingRect intersectRect(BoundingRect a, BoundingRect b);
 }  // namespace m5avatar
 
 #endif  // BOUNDINGRECT_H_
@@ -0,0 +1,56 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#include "ColorLUT.h"
+
+namespace m5avatar {
+
+static inline uint16_t swapBytes(uint16_t c) { return (c << 8) | (c >> 8); }
+
+static const char *const namedColors[] = {
+    COLOR_BACKGROUND, COLOR_PRIMARY, COLOR_SECONDARY, COLOR_BALLOON_FOREGROUND,
+    COLOR_BALLOON_BACKGROUND};
+
+ColorLUT::ColorLUT() : lut{}, used{RESERVED_SLOTS}, version{1} {}
+
+void ColorLUT::build(const ColorPalette &palette) {
+  for (const char *key : namedColors) {
+    lut[ColorPalette::getIndex(key)] = swapBytes(palette.get(key));
+  }
+  version++;
+}
+
+uint8_t ColorLUT::indexOf(uint16_t rgb565, uint16_t limit) {
+  uint16_t swapped = swapBytes(rgb565);
+  for (uint16_t i = RESERVED_SLOTS; i < used; i++) {
+    if (lut[i] == swapped) {
+      return i < limit ? i : ColorPalette::getIndex(COLOR_PRIMARY);
+    }
+  }
+  if (used >= SIZE || used >= limit) {
+    return ColorPalette::getIndex(COLOR_PRIMARY);
+  }
+  lut[used] = swapped;
+  version++;
+  return used++;
+}
+
+uint16_t ColorLUT::get(uint8_t index) const { return lut[index]; }
+
+const uint16_t *ColorLUT::data() const { return lut; }
+
+uint32_t ColorLUT::getVersion() const { return version; }
+
+void ColorLUT::applyTo(M5Canvas *sprite, int colorDepth) const {
+  uint16_t count = colorDepth >= 8 ? SIZE : (1 << colorDepth);
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t c = swapBytes(lut[i]);
+    uint8_t r = ((c >> 11) & 0x1F) << 3;
+    uint8_t g = ((c >> 5) & 0x3F) << 2;
+    uint8_t b = (c & 0x1F) << 3;
+    sprite->setPaletteColor(i, r | (r >> 5), g | (g >> 6), b | (b >> 5));
+  }
+}
+
+}  // namespace m5avatar
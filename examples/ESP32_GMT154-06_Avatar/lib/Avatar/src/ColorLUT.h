@@ -0,0 +1,68 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef COLORLUT_H_
+#define COLORLUT_H_
+#include <stdint.h>
+
+#include "ColorPalette.h"
+#include "M5Canvas.h"
+
+namespace m5avatar {
+/**
+ * 256-entry palette index -> RGB565 lookup table for indexed face sprites.
+ *
+ * Slots [0, RESERVED_SLOTS) hold the named colors of the ColorPalette (see
+ * ColorPalette::getIndex). The remaining slots are handed out on demand for
+ * literal colors that parts draw directly (e.g. TFT_RED).
+ * Entries are stored byte-swapped so that they can be written straight into
+ * a 16-bit strip buffer that is sent to the panel.
+ */
+class ColorLUT {
+ public:
+  static constexpr uint16_t SIZE = 256;
+  static constexpr uint8_t RESERVED_SLOTS = 8;
+
+ private:
+  uint16_t lut[SIZE];
+  uint16_t used;
+  uint32_t version;
+
+ public:
+  ColorLUT();
+  ~ColorLUT() = default;
+  ColorLUT(const ColorLUT &other) = default;
+  ColorLUT &operator=(const ColorLUT &other) = default;
+
+  /**
+   * @brief rebuild the named slots from the palette. Literal slots are kept.
+   */
+  void build(const ColorPalette &palette);
+
+  /**
+   * @brief get (or allocate) the slot of a literal RGB565 color
+   *
+   * @param rgb565 color to look up
+   * @param limit number of slots the sprite can address (1 << colorDepth)
+   * @return slot index. falls back to the primary slot when the table is full
+   */
+  uint8_t indexOf(uint16_t rgb565, uint16_t limit = SIZE);
+
+  uint16_t get(uint8_t index) const;
+  const uint16_t *data() const;
+
+  /**
+   * @brief incremented on every change so that users can skip re-applying
+   */
+  uint32_t getVersion() const;
+
+  /**
+   * @brief copy the table into the palette of an indexed sprite so that
+   * LovyanGFX conversions (pushRotateZoom etc.) agree with the LUT
+   */
+  void applyTo(M5Canvas *sprite, int colorDepth) const;
+};
+}  // namespace m5avatar
+
+#endif  // COLORLUT_H_
@@ -31,4 +31,14 @@ void ColorPalette::set(const char* key, uint16_t value) {
   }
   itr->second = value;
 }
+
+uint8_t ColorPalette::getIndex(const char* key) {
+  if (strcmp(key, COLOR_BACKGROUND) == 0) return 0;
+  if (strcmp(key, COLOR_PRIMARY) == 0) return 1;
+  if (strcmp(key, COLOR_SECONDARY) == 0) return 2;
+  if (strcmp(key, COLOR_BALLOON_FOREGROUND) == 0) return 3;
+  if (strcmp(key, COLOR_BALLOON_BACKGROUND) == 0) return 4;
+  // NOTE: unknown keys are drawn with the primary color
+  return 1;
+}
 }  // namespace m5avatar
@@ -39,6 +39,14 @@ class ColorPalette {
   uint16_t get(const char *key) const;
   void set(const char *key, uint16_t value);
   void clear(void);
+
+  /**
+   * @brief fixed slot of a named color in indexed (palette) sprites
+   *
+   * The background is always slot 0 so that clearing an indexed sprite with
+   * 0 paints the background color.
+   */
+  static uint8_t getIndex(const char *key);
 };
 }  // namespace m5avatar
 
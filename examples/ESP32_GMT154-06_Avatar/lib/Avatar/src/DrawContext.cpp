@@ -22,7 +22,9 @@ DrawContext::DrawContext(Expression expression, float breath,
                          float leftEyeOpenRatio, float mouthOpenRatio,
                          String speechText, float rotation, float scale,
                          int colorDepth, BatteryIconStatus batteryIconStatus,
-                         int32_t batteryLevel, const lgfx::IFont* speechFont)
+                         int32_t batteryLevel, const lgfx::IFont* speechFont,
+                         ColorLUT* colorLUT, EffectLayer* effectLayer,
+                         StatusOverlay* statusOverlay)
     : expression{expression},
       breath{breath},
       rightGaze{rightGaze},
@@ -37,7 +39,10 @@ DrawContext::DrawContext(Expression expression, float breath,
       colorDepth{colorDepth},
       batteryIconStatus(batteryIconStatus),
       batteryLevel(batteryLevel),
-      speechFont{speechFont} {}
+      speechFont{speechFont},
+      colorLUT{colorLUT},
+      effectLayer{effectLayer},
+      statusOverlay{statusOverlay} {}
 
 Expression DrawContext::getExpression() const { return expression; }
 
@@ -71,4 +76,38 @@ BatteryIconStatus DrawContext::getBatteryIconStatus() const {
 
 int32_t DrawContext::getBatteryLevel() const { return batteryLevel; }
 
+ColorLUT* DrawContext::getColorLUT() const { return colorLUT; }
+
+EffectLayer* DrawContext::getEffectLayer() const { return effectLayer; }
+
+StatusOverlay* DrawContext::getStatusOverlay() const {
+  return statusOverlay;
+}
+
+bool DrawContext::isIndexedColor() const {
+  return colorLUT != nullptr && colorDepth <= 8;
+}
+
+uint16_t DrawContext::getColor(const char* key) const {
+  if (colorDepth == 1) {
+    // NOTE: 1-bit sprites can only tell the background from the ink
+    return palette->get(key) == palette->get(COLOR_BACKGROUND) ? ERACER_COLOR
+                                                               : 1;
+  }
+  if (isIndexedColor()) {
+    return ColorPalette::getIndex(key);
+  }
+  return palette->get(key);
+}
+
+uint16_t DrawContext::mapColor(uint16_t rgb565) const {
+  if (colorDepth == 1) {
+    return rgb565 == palette->get(COLOR_BACKGROUND) ? ERACER_COLOR : 1;
+  }
+  if (isIndexedColor()) {
+    return colorLUT->indexOf(rgb565, 1 << colorDepth);
+  }
+  return rgb565;
+}
+
 }  // namespace m5avatar
@@ -7,6 +7,7 @@
 
 #define ERACER_COLOR 0x0000
 
+#include "ColorLUT.h"
 #include "ColorPalette.h"
 #include "Expression.h"
 #include "Gaze.h"
@@ -18,6 +19,8 @@ typedef std::string String;
 #endif  // ARDUINO
 
 namespace m5avatar {
+class EffectLayer;
+class StatusOverlay;
 enum BatteryIconStatus { discharging, charging, invisible, unknown };
 class DrawContext {
  private:
@@ -42,6 +45,9 @@ class DrawContext {
   int32_t batteryLevel = 0;
   const lgfx::IFont* speechFont =
       nullptr;  // = &fonts::lgfxJapanGothicP_16; //  = &fonts::efontCN_10;
+  ColorLUT* colorLUT = nullptr;
+  EffectLayer* effectLayer = nullptr;
+  StatusOverlay* statusOverlay = nullptr;
 
  public:
   DrawContext() = delete;
@@ -55,7 +61,9 @@ class DrawContext {
               float leftEyeOpenRatio, float mouthOpenRatio, String speechText,
               float rotation, float scale, int colorDepth,
               BatteryIconStatus batteryIconStatus, int32_t batteryLevel,
-              const lgfx::IFont* speechFont);
+              const lgfx::IFont* speechFont, ColorLUT* colorLUT = nullptr,
+              EffectLayer* effectLayer = nullptr,
+              StatusOverlay* statusOverlay = nullptr);
   ~DrawContext() = default;
   DrawContext(const DrawContext& other) = delete;
   DrawContext& operator=(const DrawContext& other) = delete;
@@ -74,6 +82,26 @@ class DrawContext {
   BatteryIconStatus getBatteryIconStatus() const;
   int32_t getBatteryLevel() const;
   const lgfx::IFont* getSpeechFont() const;
+  ColorLUT* getColorLUT() const;
+  EffectLayer* getEffectLayer() const;
+  StatusOverlay* getStatusOverlay() const;
+
+  /**
+   * @brief true if parts draw palette indices instead of RGB565 colors
+   */
+  bool isIndexedColor() const;
+
+  /**
+   * @brief color value to draw a named palette color into the face sprite
+   *
+   * palette index for indexed sprites, RGB565 otherwise
+   */
+  uint16_t getColor(const char* key) const;
+
+  /**
+   * @brief color value to draw a literal RGB565 color into the face sprite
+   */
+  uint16_t mapColor(uint16_t rgb565) const;
 };
 }  // namespace m5avatar
 
@@ -8,114 +8,111 @@
 #include <LovyanGFX.hpp>
 #include "DrawContext.h"
 #include "Drawable.h"
+#include "EffectLayer.h"
 
 namespace m5avatar {
 
+/**
+ * Draws the marks for the current expression and the effects added through
+ * Avatar::addEffect. Positions are relative to the face bounds.
+ */
 class Effect final : public Drawable {
  private:
-  void drawBubbleMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                      uint16_t color) {
-    drawBubbleMark(spi, x, y, r, color, 0);
-  }
-
-  void drawBubbleMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                      uint16_t color, float offset) {
-    r = r + floor(r * 0.2 * offset);
-    spi->drawCircle(x, y, r, color);
-    spi->drawCircle(x - (r / 4), y - (r / 4), r / 4, color);
-  }
-
-  void drawSweatMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                 uint16_t color) {
-    drawSweatMark(spi, x, y, r, color, 0);
-  }
-
-  void drawSweatMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                 uint16_t color, float offset) {
-    y = y + floor(5 * offset);
-    r = r + floor(r * 0.2 * offset);
-    spi->fillCircle(x, y, r, color);
-    uint32_t a = (sqrt(3) * r) / 2;
-    spi->fillTriangle(x, y - r * 2, x - a, y - r * 0.5, x + a, y - r * 0.5,
-                      color);
-  }
-
-  void drawChillMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                     uint16_t color) {
-    drawChillMark(spi, x, y, r, color, 0);
-  }
-
-  void drawChillMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                     uint16_t color, float offset) {
-    uint32_t h = r + abs(r * 0.2 * offset);
-    spi->fillRect(x - (r / 2), y, 3, h / 2, color);
-    spi->fillRect(x, y, 3, h * 3 / 4, color);
-    spi->fillRect(x + (r / 2), y, 3, h, color);
-  }
-
-  void drawAngerMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                     uint16_t color, uint32_t bColor) {
-    drawAngerMark(spi, x, y, r, color, bColor, 0);
-  }
-
-  void drawAngerMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                     uint16_t color, uint16_t bColor, float offset) {
-    r = r + abs(r * 0.4 * offset);
-    spi->fillRect(x - (r / 3), y - r, (r * 2) / 3, r * 2, color);
-    spi->fillRect(x - r, y - (r / 3), r * 2, (r * 2) / 3, color);
-    spi->fillRect(x - (r / 3) + 2, y - r, ((r * 2) / 3) - 4, r * 2, bColor);
-    spi->fillRect(x - r, y - (r / 3) + 2, r * 2, ((r * 2) / 3) - 4, bColor);
-  }
-
-  void drawHeartMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                 uint16_t color) {
-    drawHeartMark(spi, x, y, r, color, 0);
-  }
-
-  void drawHeartMark(M5Canvas *spi, uint32_t x, uint32_t y, uint32_t r,
-                 uint16_t color, float offset) {
-    r = r + floor(r * 0.4 * offset);
-    spi->fillCircle(x - r / 2, y, r / 2, color);
-    spi->fillCircle(x + r / 2, y, r / 2, color);
-    float a = (sqrt(2) * r) / 4.0;
-    spi->fillTriangle(x, y, x - r / 2 - a, y + a, x + r / 2 + a, y + a, color);
-    spi->fillTriangle(x, y + (r / 2) + 2 * a, x - r / 2 - a, y + a,
-                      x + r / 2 + a, y + a, color);
-  }
+  EffectLayer presets;
+  // avatar's effect layer seen in the last update
+  EffectLayer *layer = nullptr;
+  BoundingRect dirtyRect{0, 0, 0, 0};
+  Expression lastExpression = Expression::Neutral;
+  bool initialized = false;
 
- public:
-  // constructor
-  Effect() = default;
-  ~Effect() = default;
-  Effect(const Effect &other) = default;
-  Effect &operator=(const Effect &other) = default;
-  void draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) override {
-    uint16_t primaryColor = ctx->getColorDepth() == 1 ? 1 : ctx->getColorPalette()->get(COLOR_PRIMARY);
-    uint16_t bgColor = ctx->getColorDepth() == 1 ? ERACER_COLOR : ctx->getColorPalette()->get(COLOR_BACKGROUND);
-    float offset = ctx->getBreath();
-    Expression exp = ctx->getExpression();
+  // 元の 320x240 座標 (290, 110) 等を顔の大きさに対する比率にしたもの
+  void setupPresets(Expression exp, uint32_t now) {
+    presets.clear();
     switch (exp) {
       case Expression::Doubt:
-        drawSweatMark(spi, 290, 110, 7, primaryColor, -offset);
+        presets.add(AnimatedEffect(EffectType::Sweat, 290 / 320.0f,
+                                   110 / 240.0f, 7, -1.0f),
+                    now);
         break;
       case Expression::Angry:
-        drawAngerMark(spi, 280, 50, 12, primaryColor, bgColor, offset);
+        presets.add(
+            AnimatedEffect(EffectType::Anger, 280 / 320.0f, 50 / 240.0f, 12),
+            now);
         break;
       case Expression::Happy:
-        drawHeartMark(spi, 280, 50, 12, primaryColor, offset);
+        presets.add(
+            AnimatedEffect(EffectType::Heart, 280 / 320.0f, 50 / 240.0f, 12),
+            now);
         break;
       case Expression::Sad:
-        drawChillMark(spi, 270, 0, 30, primaryColor, offset);
+        presets.add(
+            AnimatedEffect(EffectType::Chill, 270 / 320.0f, 0.0f, 30), now);
         break;
       case Expression::Sleepy:
-        drawBubbleMark(spi, 290, 40, 10, primaryColor, offset);
-        drawBubbleMark(spi, 270, 52, 6, primaryColor, -offset);
+        presets.add(
+            AnimatedEffect(EffectType::Bubble, 290 / 320.0f, 40 / 240.0f, 10),
+            now);
+        presets.add(AnimatedEffect(EffectType::Bubble, 270 / 320.0f,
+                                   52 / 240.0f, 6, -1.0f),
+                    now);
         break;
       default:
         // noop
         break;
     }
   }
+
+ public:
+  // constructor
+  Effect() = default;
+  ~Effect() = default;
+  Effect(const Effect &other) = default;
+  Effect &operator=(const Effect &other) = default;
+
+  /**
+   * @brief advance the expression presets and the avatar's effect layer
+   *
+   * Called once per frame before draw.
+   *
+   * @return true if any effect looks different from the last update
+   */
+  bool update(BoundingRect rect, DrawContext *ctx) {
+    uint32_t now = millis();
+    Expression exp = ctx->getExpression();
+    if (!initialized || exp != lastExpression) {
+      setupPresets(exp, now);
+      lastExpression = exp;
+      initialized = true;
+    }
+    bool changed = presets.update(now, rect);
+    dirtyRect = presets.getDirtyRect();
+
+    layer = ctx->getEffectLayer();
+    if (layer != nullptr && layer->update(now, rect)) {
+      dirtyRect = unionRect(dirtyRect, layer->getDirtyRect());
+      changed = true;
+    }
+    return changed;
+  }
+
+  /**
+   * @brief union of the areas changed by the last update (presets and layer)
+   */
+  BoundingRect getDirtyRect() const { return dirtyRect; }
+
+  /**
+   * @brief true while any effect is shown (they keep animating)
+   */
+  bool isAnimating() const {
+    return !presets.isEmpty() || (layer != nullptr && !layer->isEmpty());
+  }
+
+  void draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) override {
+    presets.draw(spi, ctx);
+    if (layer != nullptr) {
+      layer->draw(spi, ctx);
+    }
+  }
 };
 
 }  // namespace m5avatar
@@ -0,0 +1,271 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#include "EffectLayer.h"
+
+#include <math.h>
+
+namespace m5avatar {
+
+// used when an effect is created without its own timeline.
+// approximates the breath cycle (sin, 100 frames at 33ms)
+static const EffectKeyframe defaultKeyframes[] = {
+    {0, 0.0f}, {825, 1.0f}, {1650, 0.0f}, {2475, -1.0f}, {3300, 0.0f}};
+
+static void drawBubbleMark(M5Canvas *spi, int32_t x, int32_t y, int32_t r,
+                           uint16_t color, float offset) {
+  r = r + floor(r * 0.2 * offset);
+  spi->drawCircle(x, y, r, color);
+  spi->drawCircle(x - (r / 4), y - (r / 4), r / 4, color);
+}
+
+static void drawSweatMark(M5Canvas *spi, int32_t x, int32_t y, int32_t r,
+                          uint16_t color, float offset) {
+  y = y + floor(5 * offset);
+  r = r + floor(r * 0.2 * offset);
+  spi->fillCircle(x, y, r, color);
+  int32_t a = (sqrt(3) * r) / 2;
+  spi->fillTriangle(x, y - r * 2, x - a, y - r * 0.5, x + a, y - r * 0.5,
+                    color);
+}
+
+static void drawChillMark(M5Canvas *spi, int32_t x, int32_t y, int32_t r,
+                          uint16_t color, float offset) {
+  int32_t h = r + fabs(r * 0.2 * offset);
+  spi->fillRect(x - (r / 2), y, 3, h / 2, color);
+  spi->fillRect(x, y, 3, h * 3 / 4, color);
+  spi->fillRect(x + (r / 2), y, 3, h, color);
+}
+
+static void drawAngerMark(M5Canvas *spi, int32_t x, int32_t y, int32_t r,
+                          uint16_t color, uint16_t bColor, float offset) {
+  r = r + fabs(r * 0.4 * offset);
+  spi->fillRect(x - (r / 3), y - r, (r * 2) / 3, r * 2, color);
+  spi->fillRect(x - r, y - (r / 3), r * 2, (r * 2) / 3, color);
+  spi->fillRect(x - (r / 3) + 2, y - r, ((r * 2) / 3) - 4, r * 2, bColor);
+  spi->fillRect(x - r, y - (r / 3) + 2, r * 2, ((r * 2) / 3) - 4, bColor);
+}
+
+static void drawHeartMark(M5Canvas *spi, int32_t x, int32_t y, int32_t r,
+                          uint16_t color, float offset) {
+  r = r + floor(r * 0.4 * offset);
+  spi->fillCircle(x - r / 2, y, r / 2, color);
+  spi->fillCircle(x + r / 2, y, r / 2, color);
+  float a = (sqrt(2) * r) / 4.0;
+  spi->fillTriangle(x, y, x - r / 2 - a, y + a, x + r / 2 + a, y + a, color);
+  spi->fillTriangle(x, y + (r / 2) + 2 * a, x - r / 2 - a, y + a,
+                    x + r / 2 + a, y + a, color);
+}
+
+AnimatedEffect::AnimatedEffect()
+    : AnimatedEffect(EffectType::Heart, 0.0f, 0.0f, 0) {}
+
+AnimatedEffect::AnimatedEffect(EffectType type, float anchorX, float anchorY,
+                               uint16_t radius, float amplitude,
+                               const EffectKeyframe *keyframes,
+                               uint8_t keyframeCount)
+    : type{type},
+      anchorX{anchorX},
+      anchorY{anchorY},
+      radius{radius},
+      amplitude{amplitude},
+      keyframes{keyframes},
+      keyframeCount{keyframeCount},
+      startMillis{0},
+      x{0},
+      y{0},
+      offset{0.0f},
+      rect{0, 0, 0, 0},
+      dirtyRect{0, 0, 0, 0} {
+  if (this->keyframes == nullptr || this->keyframeCount == 0) {
+    this->keyframes = defaultKeyframes;
+    this->keyframeCount =
+        sizeof(defaultKeyframes) / sizeof(defaultKeyframes[0]);
+  }
+}
+
+void AnimatedEffect::start(uint32_t now) {
+  startMillis = now;
+  rect = BoundingRect(0, 0, 0, 0);
+}
+
+BoundingRect AnimatedEffect::computeBounds() const {
+  // 各マークの draw*Mark が塗る範囲 (+1px の余白)
+  int32_t r = radius;
+  int32_t top, left, right, bottom;
+  switch (type) {
+    case EffectType::Bubble:
+      r = r + floor(r * 0.2 * offset);
+      left = x - r;
+      right = x + r;
+      top = y - r;
+      bottom = y + r;
+      break;
+    case EffectType::Sweat: {
+      int32_t cy = y + floor(5 * offset);
+      r = r + floor(r * 0.2 * offset);
+      left = x - r;
+      right = x + r;
+      top = cy - r * 2;
+      bottom = cy + r;
+      break;
+    }
+    case EffectType::Chill: {
+      int32_t h = r + fabs(r * 0.2 * offset);
+      left = x - (r / 2);
+      right = x + (r / 2) + 3;
+      top = y;
+      bottom = y + h;
+      break;
+    }
+    case EffectType::Anger:
+      r = r + fabs(r * 0.4 * offset);
+      left = x - r;
+      right = x + r;
+      top = y - r;
+      bottom = y + r;
+      break;
+    case EffectType::Heart:
+    default: {
+      r = r + floor(r * 0.4 * offset);
+      int32_t a = ceil((sqrt(2) * r) / 4.0);
+      left = x - r / 2 - a;
+      right = x + r / 2 + a;
+      top = y - r / 2;
+      bottom = y + r / 2 + 2 * a;
+      break;
+    }
+  }
+  return BoundingRect(top - 1, left - 1, right - left + 3, bottom - top + 3);
+}
+
+bool AnimatedEffect::update(uint32_t now, BoundingRect faceRect) {
+  const EffectKeyframe &last = keyframes[keyframeCount - 1];
+  uint32_t t = last.time > 0 ? (now - startMillis) % last.time : 0;
+  float value = keyframes[0].offset;
+  for (uint8_t i = 1; i < keyframeCount; i++) {
+    const EffectKeyframe &k0 = keyframes[i - 1];
+    const EffectKeyframe &k1 = keyframes[i];
+    if (t < k1.time) {
+      float span = k1.time - k0.time;
+      float p = span > 0 ? (t - k0.time) / span : 1.0f;
+      value = k0.offset + (k1.offset - k0.offset) * p;
+      break;
+    }
+    value = k1.offset;
+  }
+
+  offset = value * amplitude;
+  x = faceRect.getLeft() + anchorX * faceRect.getWidth();
+  y = faceRect.getTop() + anchorY * faceRect.getHeight();
+
+  BoundingRect current = computeBounds();
+  bool changed = current.getTop() != rect.getTop() ||
+                 current.getLeft() != rect.getLeft() ||
+                 current.getWidth() != rect.getWidth() ||
+                 current.getHeight() != rect.getHeight();
+  // 前回の範囲も消す必要があるので和集合を dirty とする
+  dirtyRect = changed ? unionRect(rect, current) : BoundingRect(0, 0, 0, 0);
+  rect = current;
+  return changed;
+}
+
+void AnimatedEffect::draw(M5Canvas *canvas, uint16_t color,
+                          uint16_t bgColor) {
+  switch (type) {
+    case EffectType::Heart:
+      drawHeartMark(canvas, x, y, radius, color, offset);
+      break;
+    case EffectType::Sweat:
+      drawSweatMark(canvas, x, y, radius, color, offset);
+      break;
+    case EffectType::Anger:
+      drawAngerMark(canvas, x, y, radius, color, bgColor, offset);
+      break;
+    case EffectType::Chill:
+      drawChillMark(canvas, x, y, radius, color, offset);
+      break;
+    case EffectType::Bubble:
+      drawBubbleMark(canvas, x, y, radius, color, offset);
+      break;
+  }
+}
+
+BoundingRect AnimatedEffect::getDirtyRect() const { return dirtyRect; }
+
+BoundingRect AnimatedEffect::getBounds() const { return rect; }
+
+EffectType AnimatedEffect::getType() const { return type; }
+
+EffectLayer::EffectLayer()
+    : effects{}, active{}, dirtyRect{0, 0, 0, 0}, removedRect{0, 0, 0, 0} {}
+
+int EffectLayer::add(const AnimatedEffect &effect, uint32_t now) {
+  for (int i = 0; i < MAX_EFFECTS; i++) {
+    if (!active[i]) {
+      effects[i] = effect;
+      effects[i].start(now);
+      active[i] = true;
+      return i;
+    }
+  }
+  return -1;
+}
+
+void EffectLayer::remove(int id) {
+  if (id < 0 || id >= MAX_EFFECTS || !active[id]) {
+    return;
+  }
+  // 消えた範囲は次のフレームで描き直してもらう
+  removedRect = unionRect(removedRect, effects[id].getBounds());
+  active[id] = false;
+}
+
+void EffectLayer::clear() {
+  for (int i = 0; i < MAX_EFFECTS; i++) {
+    remove(i);
+  }
+}
+
+bool EffectLayer::isEmpty() const {
+  for (int i = 0; i < MAX_EFFECTS; i++) {
+    if (active[i]) return false;
+  }
+  return true;
+}
+
+bool EffectLayer::update(uint32_t now, BoundingRect faceRect) {
+  BoundingRect dirty = removedRect;
+  bool changed = dirty.getWidth() > 0;
+  removedRect = BoundingRect(0, 0, 0, 0);
+  for (int i = 0; i < MAX_EFFECTS; i++) {
+    if (active[i] && effects[i].update(now, faceRect)) {
+      dirty = unionRect(dirty, effects[i].getDirtyRect());
+      changed = true;
+    }
+  }
+  dirtyRect = dirty;
+  return changed;
+}
+
+void EffectLayer::draw(M5Canvas *canvas, DrawContext *ctx) {
+  uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
+  uint16_t bgColor = ctx->getColor(COLOR_BACKGROUND);
+  for (int i = 0; i < MAX_EFFECTS; i++) {
+    if (active[i]) {
+      effects[i].draw(canvas, primaryColor, bgColor);
+    }
+  }
+}
+
+BoundingRect EffectLayer::getDirtyRect() const { return dirtyRect; }
+
+BoundingRect EffectLayer::getDirtyRect(int id) const {
+  if (id < 0 || id >= MAX_EFFECTS || !active[id]) {
+    return BoundingRect(0, 0, 0, 0);
+  }
+  return effects[id].getDirtyRect();
+}
+
+}  // namespace m5avatar
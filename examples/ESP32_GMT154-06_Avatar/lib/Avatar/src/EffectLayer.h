@@ -0,0 +1,129 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef EFFECTLAYER_H_
+#define EFFECTLAYER_H_
+#include <stdint.h>
+
+#include "BoundingRect.h"
+#include "DrawContext.h"
+#include "M5Canvas.h"
+
+namespace m5avatar {
+
+enum class EffectType { Heart, Sweat, Anger, Chill, Bubble };
+
+/**
+ * One point of an effect timeline. Values between keyframes are linearly
+ * interpolated and the timeline loops after the last keyframe.
+ */
+struct EffectKeyframe {
+  uint16_t time;  // ms from the start of the cycle
+  float offset;   // size/position modulation in [-1, 1]
+};
+
+/**
+ * A single animated mark (heart, sweat, ...) with its own timeline.
+ *
+ * The position is relative to the face bounds (0.0 - 1.0) so that the mark
+ * follows the face whatever the canvas size is.
+ */
+class AnimatedEffect {
+ private:
+  EffectType type;
+  float anchorX;
+  float anchorY;
+  uint16_t radius;
+  float amplitude;
+  const EffectKeyframe *keyframes;
+  uint8_t keyframeCount;
+  uint32_t startMillis;
+
+  // caches for drawing
+  int16_t x;
+  int16_t y;
+  float offset;
+  BoundingRect rect;
+  BoundingRect dirtyRect;
+
+  BoundingRect computeBounds() const;
+
+ public:
+  AnimatedEffect();
+  AnimatedEffect(EffectType type, float anchorX, float anchorY,
+                 uint16_t radius, float amplitude = 1.0f,
+                 const EffectKeyframe *keyframes = nullptr,
+                 uint8_t keyframeCount = 0);
+  ~AnimatedEffect() = default;
+  AnimatedEffect(const AnimatedEffect &other) = default;
+  AnimatedEffect &operator=(const AnimatedEffect &other) = default;
+
+  void start(uint32_t now);
+
+  /**
+   * @brief advance the timeline and recompute the dirty rect
+   *
+   * @param now current time in ms
+   * @param faceRect bounds of the face the effect is anchored to
+   * @return true if the effect looks different from the last update
+   */
+  bool update(uint32_t now, BoundingRect faceRect);
+  void draw(M5Canvas *canvas, uint16_t color, uint16_t bgColor);
+
+  /**
+   * @brief union of the previous and the current bounds
+   */
+  BoundingRect getDirtyRect() const;
+  BoundingRect getBounds() const;
+  EffectType getType() const;
+};
+
+/**
+ * Set of effects that animate independently of each other.
+ */
+class EffectLayer {
+ public:
+  static constexpr uint8_t MAX_EFFECTS = 4;
+
+ private:
+  AnimatedEffect effects[MAX_EFFECTS];
+  bool active[MAX_EFFECTS];
+  BoundingRect dirtyRect;
+  // area of effects removed since the last update
+  BoundingRect removedRect;
+
+ public:
+  EffectLayer();
+  ~EffectLayer() = default;
+  EffectLayer(const EffectLayer &other) = default;
+  EffectLayer &operator=(const EffectLayer &other) = default;
+
+  /**
+   * @brief add an effect to the layer
+   *
+   * @return id of the effect or -1 if the layer is full
+   */
+  int add(const AnimatedEffect &effect, uint32_t now);
+  void remove(int id);
+  void clear();
+  bool isEmpty() const;
+
+  /**
+   * @brief advance all timelines
+   *
+   * @return true if any effect has to be redrawn
+   */
+  bool update(uint32_t now, BoundingRect faceRect);
+  void draw(M5Canvas *canvas, DrawContext *ctx);
+
+  /**
+   * @brief union of the dirty rects of all effects changed in the last update
+   */
+  BoundingRect getDirtyRect() const;
+  BoundingRect getDirtyRect(int id) const;
+};
+
+}  // namespace m5avatar
+
+#endif  // EFFECTLAYER_H_
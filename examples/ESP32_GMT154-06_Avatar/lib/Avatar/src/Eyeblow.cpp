@@ -12,7 +12,7 @@ void Eyeblow::draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) {
   Expression exp = ctx->getExpression();
   uint32_t x = rect.getLeft();
   uint32_t y = rect.getTop();
-  uint16_t primaryColor = ctx->getColorDepth() == 1 ? 1 : ctx->getColorPalette()->get(COLOR_PRIMARY);
+  uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
   if (width == 0 || height == 0) {
     return;
   }
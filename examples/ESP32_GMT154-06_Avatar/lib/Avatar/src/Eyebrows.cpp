@@ -14,13 +14,9 @@ void BaseEyebrow::update(M5Canvas *canvas, BoundingRect rect,
                          DrawContext *ctx) {
     // common process for all standard eyebrows
     // update drawing parameters
-    ColorPalette *cp = ctx->getColorPalette();
-    primary_color_ = ctx->getColorDepth() == 1 ? 1 : cp->get(COLOR_PRIMARY);
-    secondary_color_ = ctx->getColorDepth() == 1
-                           ? 1
-                           : ctx->getColorPalette()->get(COLOR_SECONDARY);
-    background_color_ =
-        ctx->getColorDepth() == 1 ? ERACER_COLOR : cp->get(COLOR_BACKGROUND);
+    primary_color_ = ctx->getColor(COLOR_PRIMARY);
+    secondary_color_ = ctx->getColor(COLOR_SECONDARY);
+    background_color_ = ctx->getColor(COLOR_BACKGROUND);
     center_x_ = rect.getCenterX();
     center_y_ = rect.getCenterY();
     expression_ = ctx->getExpression();
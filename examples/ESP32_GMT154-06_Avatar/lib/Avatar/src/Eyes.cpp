@@ -15,13 +15,9 @@ void BaseEye::update(M5Canvas *canvas, BoundingRect rect, DrawContext *ctx) {
     center_x_ = rect.getCenterX();
     center_y_ = rect.getCenterY();
     gaze_ = this->is_left_ ? ctx->getLeftGaze() : ctx->getRightGaze();
-    ColorPalette *cp = ctx->getColorPalette();
-    primary_color_ = ctx->getColorDepth() == 1 ? 1 : cp->get(COLOR_PRIMARY);
-    secondary_color_ = ctx->getColorDepth() == 1
-                           ? 1
-                           : ctx->getColorPalette()->get(COLOR_SECONDARY);
-    background_color_ =
-        ctx->getColorDepth() == 1 ? ERACER_COLOR : cp->get(COLOR_BACKGROUND);
+    primary_color_ = ctx->getColor(COLOR_PRIMARY);
+    secondary_color_ = ctx->getColor(COLOR_SECONDARY);
+    background_color_ = ctx->getColor(COLOR_BACKGROUND);
 
     // offset computed from gaze direction
     shifted_x_ = center_x_ + gaze_.getHorizontal() * 8;
@@ -11,6 +11,23 @@
 namespace m5avatar {
 BoundingRect br;
 
+// palette index of column x in a packed 1/4/8-bit sprite row (MSB first)
+template <int BITS>
+static inline uint8_t readIndex(const uint8_t *row, int x) {
+  if (BITS == 8) return row[x];
+  if (BITS == 4) return (row[x >> 1] >> ((~x & 1) << 2)) & 0x0F;
+  return (row[x >> 3] >> (~x & 7)) & 0x01;
+}
+
+template <int BITS>
+static void expandRow(const uint8_t *row, const int16_t *columnMap, int width,
+                      const uint16_t *lut, uint16_t *dst) {
+  for (int x = 0; x < width; x++) {
+    int16_t sx = columnMap[x];
+    dst[x] = sx < 0 ? lut[0] : lut[readIndex<BITS>(row, sx)];
+  }
+}
+
 Face::Face()
     : Face(new Mouth(50, 90, 4, 60), new BoundingRect(148, 163),
            new Eye(8, false), new BoundingRect(93, 90), new Eye(8, true),
@@ -38,6 +55,16 @@ Face::Face(Drawable *mouth, BoundingRect *mouthPos, Drawable *eyeR,
        Drawable *eyeblowR, BoundingRect *eyeblowRPos, Drawable *eyeblowL,
        BoundingRect *eyeblowLPos,
        BoundingRect *boundingRect, M5Canvas *spr, M5Canvas *tmpSpr)
+    : Face(mouth, mouthPos, eyeR, eyeRPos, eyeL, eyeLPos, eyeblowR,
+           eyeblowRPos, eyeblowL, eyeblowLPos, boundingRect, spr, tmpSpr,
+           new Balloon(), new Effect(), new BatteryIcon()) {}
+
+Face::Face(Drawable *mouth, BoundingRect *mouthPos, Drawable *eyeR,
+       BoundingRect *eyeRPos, Drawable *eyeL, BoundingRect *eyeLPos,
+       Drawable *eyeblowR, BoundingRect *eyeblowRPos, Drawable *eyeblowL,
+       BoundingRect *eyeblowLPos,
+       BoundingRect *boundingRect, M5Canvas *spr, M5Canvas *tmpSpr,
+       Balloon *balloon, Effect *effect, BatteryIcon *battery)
     : mouth{mouth},
       eyeR{eyeR},
       eyeL{eyeL},
@@ -50,24 +77,37 @@ Face::Face(Drawable *mouth, BoundingRect *mouthPos, Drawable *eyeR,
       eyeblowLPos{eyeblowLPos},
       boundingRect{boundingRect},
       sprite{spr},
-      tmpSprite{tmpSpr} {}
+      tmpSprite{tmpSpr},
+      spriteColorDepth{0},
+      spritePaletteVersion{0},
+      columnMap{nullptr},
+      b{balloon},
+      h{effect},
+      battery{battery},
+      lastFrame{},
+      lastSpeechText{""},
+      hasLastFrame{false} {}
 
 Face::~Face() {
-  delete mouth;
-  delete mouthPos;
-  delete eyeR;
-  delete eyeRPos;
-  delete eyeL;
-  delete eyeLPos;
-  delete eyeblowR;
-  delete eyeblowRPos;
-  delete eyeblowL;
-  delete eyeblowLPos;
-  delete sprite;
-  delete boundingRect;
-  delete b;
-  delete h;
-  delete battery;
+  if (ownsParts) {
+    delete mouth;
+    delete mouthPos;
+    delete eyeR;
+    delete eyeRPos;
+    delete eyeL;
+    delete eyeLPos;
+    delete eyeblowR;
+    delete eyeblowRPos;
+    delete eyeblowL;
+    delete eyeblowLPos;
+    delete sprite;
+    delete tmpSprite;
+    delete boundingRect;
+    delete b;
+    delete h;
+    delete battery;
+  }
+  delete[] columnMap;
 }
 
 void Face::setMouth(Drawable *mouth) { this->mouth = mouth; }
@@ -84,29 +124,191 @@ Drawable *Face::getRightEye() { return eyeR; }
 
 BoundingRect *Face::getBoundingRect() { return boundingRect; }
 
+bool Face::isAnimating() const { return h->isAnimating(); }
+
+bool Face::FrameState::operator==(const FrameState &other) const {
+  return expression == other.expression && breath == other.breath &&
+         rightGazeV == other.rightGazeV && rightGazeH == other.rightGazeH &&
+         rightEyeOpenRatio == other.rightEyeOpenRatio &&
+         leftGazeV == other.leftGazeV && leftGazeH == other.leftGazeH &&
+         leftEyeOpenRatio == other.leftEyeOpenRatio &&
+         mouthOpenRatio == other.mouthOpenRatio &&
+         rotation == other.rotation && scale == other.scale &&
+         batteryIconStatus == other.batteryIconStatus &&
+         batteryLevel == other.batteryLevel &&
+         speechFont == other.speechFont && lutVersion == other.lutVersion &&
+         top == other.top && left == other.left;
+}
+
+Face::FrameState Face::captureFrame(DrawContext *ctx) {
+  FrameState frame;
+  frame.expression = ctx->getExpression();
+  frame.breath = ctx->getBreath();
+  frame.rightGazeV = ctx->getRightGaze().getVertical();
+  frame.rightGazeH = ctx->getRightGaze().getHorizontal();
+  frame.rightEyeOpenRatio = ctx->getRightEyeOpenRatio();
+  frame.leftGazeV = ctx->getLeftGaze().getVertical();
+  frame.leftGazeH = ctx->getLeftGaze().getHorizontal();
+  frame.leftEyeOpenRatio = ctx->getLeftEyeOpenRatio();
+  frame.mouthOpenRatio = ctx->getMouthOpenRatio();
+  frame.rotation = ctx->getRotation();
+  frame.scale = ctx->getScale();
+  frame.batteryIconStatus = ctx->getBatteryIconStatus();
+  frame.batteryLevel = ctx->getBatteryLevel();
+  frame.speechFont = ctx->getSpeechFont();
+  ColorLUT *lut = ctx->getColorLUT();
+  frame.lutVersion = lut != nullptr ? lut->getVersion() : 0;
+  frame.top = boundingRect->getTop();
+  frame.left = boundingRect->getLeft();
+  return frame;
+}
+
+// 背景色で塗り潰す (clip が nullptr ならスプライト全体)
+void Face::clearSprite(DrawContext *ctx, BoundingRect *clip) {
+  uint32_t color;
+  if (ctx->isIndexedColor()) {
+    // slot 0 of the palette is always the background color
+    color = 0;
+  } else {
+    // NOTE: setting below for 1-bit color depth
+    sprite->setBitmapColor(ctx->getColorPalette()->get(COLOR_PRIMARY),
+      ctx->getColorPalette()->get(COLOR_BACKGROUND));
+    color = ctx->getColorDepth() != 1
+                ? ctx->getColorPalette()->get(COLOR_BACKGROUND)
+                : 0;
+  }
+  if (clip == nullptr) {
+    sprite->fillSprite(color);
+  } else {
+    sprite->fillRect(clip->getLeft(), clip->getTop(), clip->getWidth(),
+                     clip->getHeight(), color);
+  }
+}
+
+void Face::pushIndexedBand(DrawContext *ctx, int y, int height,
+                           uint16_t *dst) {
+  int width = boundingRect->getWidth();
+  int spriteHeight = boundingRect->getHeight();
+  float scale = ctx->getScale();
+  const uint16_t *lut = ctx->getColorLUT()->data();
+  const uint8_t *src = static_cast<const uint8_t *>(sprite->getBuffer());
+  size_t stride = (width * spriteColorDepth + 7) >> 3;
+
+  for (int r = 0; r < height; r++, dst += width) {
+    // same mapping as pushRotateZoom with the pivot at the sprite center
+    int sy = floorf((y + r + 0.5f - spriteHeight * 0.5f) / scale +
+                    spriteHeight * 0.5f);
+    if (sy < 0 || sy >= spriteHeight) {
+      std::fill(dst, dst + width, lut[0]);
+      continue;
+    }
+    const uint8_t *row = src + sy * stride;
+    switch (spriteColorDepth) {
+      case 8:
+        expandRow<8>(row, columnMap, width, lut, dst);
+        break;
+      case 4:
+        expandRow<4>(row, columnMap, width, lut, dst);
+        break;
+      default:
+        expandRow<1>(row, columnMap, width, lut, dst);
+        break;
+    }
+  }
+}
+
 void Face::draw(DrawContext *ctx) {
+  int16_t width = boundingRect->getWidth();
+  int16_t height = boundingRect->getHeight();
+  int colorDepth = ctx->getColorDepth();
+  bool indexed = ctx->isIndexedColor();
+  ColorLUT *lut = ctx->getColorLUT();
+
   // スプライトを作成
   if (sprite == nullptr) {
     sprite = new M5Canvas();
   }
-  // スプライトの作成と初期化
-  sprite->createSprite(boundingRect->getWidth(), boundingRect->getHeight());
-  sprite->setColorDepth(ctx->getColorDepth());
-  // NOTE: setting below for 1-bit color depth
-  sprite->setBitmapColor(ctx->getColorPalette()->get(COLOR_PRIMARY),
-    ctx->getColorPalette()->get(COLOR_BACKGROUND));
-  if (ctx->getColorDepth() != 1) {
-    sprite->fillSprite(ctx->getColorPalette()->get(COLOR_BACKGROUND));
-  } else {
-    sprite->fillSprite(0);
+  // スプライトはフレーム間で保持し、形式が変わった時だけ作り直す
+  bool recreated = false;
+  if (sprite->getBuffer() == nullptr || spriteColorDepth != colorDepth ||
+      sprite->width() != width || sprite->height() != height) {
+    recreated = true;
+    sprite->deleteSprite();
+    sprite->setColorDepth(colorDepth);
+    sprite->createSprite(width, height);
+    if (indexed) {
+      sprite->createPalette();
+    }
+    spriteColorDepth = colorDepth;
+    spritePaletteVersion = 0;
   }
-  
-  // 一時スプライトの初期化
-  if (tmpSprite == nullptr) {
-    tmpSprite = new M5Canvas();
+  // エフェクト以外が前のフレームと同じなら、エフェクトが変わった範囲だけを描き直す
+  FrameState frame = captureFrame(ctx);
+  String speechText = ctx->getspeechText();
+  bool full = recreated || !hasLastFrame || lut == nullptr ||
+              !(frame == lastFrame) || speechText != lastSpeechText;
+
+  // エフェクトはスプライト座標 (顔全体) を基準に配置する
+  BoundingRect spriteRect(0, 0, width, height);
+  h->update(spriteRect, ctx);
+  BoundingRect clip =
+      full ? spriteRect : intersectRect(h->getDirtyRect(), spriteRect);
+
+  StatusOverlay *overlay = ctx->getStatusOverlay();
+  bool overlayChanged = false;
+  if (overlay != nullptr) {
+    // パネルに映る範囲 (短冊の座標) の右上に並べる
+    int16_t left = boundingRect->getLeft();
+    int16_t top = boundingRect->getTop();
+    int16_t visibleRight =
+        ((lgfx::LGFX_Device *)&lcd)->width() - left;
+    overlayChanged = overlay->update(ctx, left < 0 ? -left : 0,
+                                     top < 0 ? -top : 0,
+                                     visibleRight < width ? visibleRight : width);
+  }
+  if (clip.isEmpty() && !overlayChanged) {
+    // 何も変わっていないので転送しない
+    return;
+  }
+
+  if (!clip.isEmpty()) {
+    drawSprite(ctx, full ? nullptr : &clip);
   }
-  tmpSprite->createSprite(boundingRect->getWidth(), boundingRect->getHeight());
-  tmpSprite->setColorDepth(ctx->getColorDepth());
+  lastFrame = frame;
+  lastFrame.lutVersion = lut != nullptr ? lut->getVersion() : 0;
+  lastSpeechText = speechText;
+  hasLastFrame = true;
+
+  // TODO(meganetaaan): rethink responsibility for transform function
+  float scale = ctx->getScale();
+  float rotation = ctx->getRotation();
+
+  // 転送する短冊の範囲 (回転ありやオーバーレイの変更時はすべて)
+  int pushTop = 0;
+  int pushBottom = height;
+  if (!full && !overlayChanged && rotation == 0.0f) {
+    // clip の行を pushRotateZoom と同じ拡大縮小で画面の行に写す (端の丸めに 2px の余裕)
+    float center = height * 0.5f;
+    pushTop = floorf((clip.getTop() - center) * scale + center) - 2;
+    pushBottom = ceilf((clip.getBottom() - center) * scale + center) + 2;
+    pushTop = pushTop < 0 ? 0 : pushTop;
+    pushBottom = pushBottom > height ? height : pushBottom;
+  }
+  pushBands(ctx, overlay, pushTop, pushBottom);
+}
+
+void Face::drawSprite(DrawContext *ctx, BoundingRect *clip) {
+  int colorDepth = ctx->getColorDepth();
+  bool indexed = ctx->isIndexedColor();
+  ColorLUT *lut = ctx->getColorLUT();
+
+  // clip の外はスプライトに前のフレームのまま残っている
+  if (clip != nullptr) {
+    sprite->setClipRect(clip->getLeft(), clip->getTop(), clip->getWidth(),
+                        clip->getHeight());
+  }
+  clearSprite(ctx, clip);
+
   float breath = _min(1.0f, ctx->getBreath());
 
   // TODO(meganetaaan): unify drawing process of each parts
@@ -133,42 +335,89 @@ void Face::draw(DrawContext *ctx) {
 
   // TODO(meganetaaan): make balloons and effects selectable
   b->draw(sprite, br, ctx);
-  h->draw(sprite, br, ctx);
-  battery->draw(sprite, br, ctx);
+  // エフェクトはスプライト座標 (顔全体) を基準に配置する
+  h->draw(sprite,
+          BoundingRect(0, 0, boundingRect->getWidth(),
+                       boundingRect->getHeight()),
+          ctx);
+  // ステータスオーバーレイがある場合、電池は転送時にタイルとして合成する
+  if (ctx->getStatusOverlay() == nullptr) {
+    battery->draw(sprite,
+                  BoundingRect(0, 0, boundingRect->getWidth(),
+                               boundingRect->getHeight()),
+                  ctx);
+  }
   // drawAccessory(sprite, position, ctx);
+  if (clip != nullptr) {
+    sprite->clearClipRect();
+  }
 
-  // TODO(meganetaaan): rethink responsibility for transform function
+  // パーツ描画中にリテラル色のスロットが追加されることがあるので、転送直前に反映する
+  if (indexed && spritePaletteVersion != lut->getVersion()) {
+    lut->applyTo(sprite, colorDepth);
+    spritePaletteVersion = lut->getVersion();
+  }
+}
+
+void Face::pushBands(DrawContext *ctx, StatusOverlay *overlay, int top,
+                     int bottom) {
+  int16_t width = boundingRect->getWidth();
+  int16_t height = boundingRect->getHeight();
+  bool indexed = ctx->isIndexedColor();
   float scale = ctx->getScale();
   float rotation = ctx->getRotation();
 
-// ▼▼▼▼ここから▼▼▼▼
   static constexpr uint8_t y_step = 8;
 
+  // 一時スプライトの初期化
+  if (tmpSprite == nullptr) {
+    tmpSprite = new M5Canvas();
+  }
   if (tmpSprite->getBuffer() == nullptr) {
     // 出力先と同じcolorDepthを指定することで、DMA転送が可能になる。
     // Display自体は16bit or 24bitしか指定できないが、細長なので1bitではなくても大丈夫。
     tmpSprite->setColorDepth(16); // 16bitカラー深度を使用
 
     // 確保するメモリは高さ8ピクセルの横長の細長い短冊状とする。
-    tmpSprite->createSprite(boundingRect->getWidth(), y_step);
+    tmpSprite->createSprite(width, y_step);
+  }
+
+  // インデックスカラーで回転なしの場合は、LUTで直接RGB565に展開する
+  // (回転ありの場合はpushRotateZoomのパレット変換に任せる)
+  bool useLUT = indexed && rotation == 0.0f;
+  if (useLUT) {
+    if (columnMap == nullptr) {
+      columnMap = new int16_t[width];
+    }
+    for (int x = 0; x < width; x++) {
+      int sx = floorf((x + 0.5f - width * 0.5f) / scale + width * 0.5f);
+      columnMap[x] = (sx < 0 || sx >= width) ? -1 : sx;
+    }
   }
 
   // 背景クリア用の色を設定
   tmpSprite->setBaseColor(ctx->getColorPalette()->get(COLOR_BACKGROUND));
-  int y = 0;
+  int y = top - top % y_step;
   do {
-    // 背景色で塗り潰し
-    tmpSprite->clear();
-
-    // 傾きとズームを反映してspriteからtmpSpriteに転写
-    sprite->pushRotateZoom(tmpSprite, boundingRect->getWidth()>>1, (boundingRect->getHeight()>>1) - y, rotation, scale, scale);
+    if (useLUT) {
+      pushIndexedBand(ctx, y, y_step,
+                      static_cast<uint16_t *>(tmpSprite->getBuffer()));
+    } else {
+      // 背景色で塗り潰し
+      tmpSprite->clear();
+
+      // 傾きとズームを反映してspriteからtmpSpriteに転写
+      sprite->pushRotateZoom(tmpSprite, width>>1, (height>>1) - y, rotation, scale, scale);
+    }
+    if (overlay != nullptr) {
+      overlay->composite(static_cast<uint16_t *>(tmpSprite->getBuffer()),
+                         width, y, y_step);
+    }
 
     // tmpSpriteから画面に転写
     // M5.Display.startWrite();
 
     // 事前にstartWriteしておくことで、pushSprite はDMA転送を開始するとすぐに処理を終えて戻ってくる。
-    // LovyanGFXでは、スプライトをディスプレイに描画する方法が異なります
-    // LovyanGFXではスプライトの描画方法が異なる
     // 親ディスプレイに描画するために、親ディスプレイを取得して使用する
     tmpSprite->pushSprite((lgfx::LGFX_Device*)&lcd, boundingRect->getLeft(), boundingRect->getTop() + y);
 
@@ -178,12 +427,9 @@ void Face::draw(DrawContext *ctx) {
     // endWriteは不要になりました
     // M5.Display.endWrite();
 
-  } while ((y += y_step) < boundingRect->getHeight());
+  } while ((y += y_step) < bottom);
 
 // 削除するのが良いかどうか要検討 (次回メモリ確保できない場合は描画できなくなるので、維持しておいても良いかも？)
 // tmpSprite->deleteSprite();
-// ▲▲▲▲ここまで▲▲▲▲
-
-  sprite->deleteSprite();
 }
-}  // namespace m5avatar
\ No newline at end of file
+}  // namespace m5avatar
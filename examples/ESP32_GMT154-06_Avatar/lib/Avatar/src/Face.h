@@ -11,6 +11,7 @@
 #include "Eyeblow.h"
 #include "Mouth.h"
 #include "Effect.h"
+#include "StatusOverlay.h"
 #include "BatteryIcon.h"
 #include "M5Canvas.h"
 
@@ -31,10 +32,50 @@ class Face {
   BoundingRect *boundingRect;
   M5Canvas *sprite;
   M5Canvas *tmpSprite;
+  int spriteColorDepth;
+  uint32_t spritePaletteVersion;
+  // source column of each destination column for the LUT push
+  int16_t *columnMap;
   Balloon *b;
   Effect *h;
   BatteryIcon *battery;
 
+  // everything but the effects that the last frame was drawn from. when it is
+  // unchanged only the effect dirty rects are redrawn and pushed
+  struct FrameState {
+    Expression expression;
+    float breath;
+    float rightGazeV, rightGazeH, rightEyeOpenRatio;
+    float leftGazeV, leftGazeH, leftEyeOpenRatio;
+    float mouthOpenRatio;
+    float rotation, scale;
+    BatteryIconStatus batteryIconStatus;
+    int32_t batteryLevel;
+    const lgfx::IFont *speechFont;
+    uint32_t lutVersion;
+    int16_t top, left;
+
+    bool operator==(const FrameState &other) const;
+  };
+  FrameState lastFrame;
+  String lastSpeechText;
+  bool hasLastFrame;
+
+  FrameState captureFrame(DrawContext *ctx);
+
+ protected:
+  // false if the parts and the objects passed to the constructor are not
+  // allocated with new. the subclass destroys them (see ArenaFace)
+  bool ownsParts = true;
+
+  // for subclasses that place every object in their own storage
+  Face(Drawable *mouth, BoundingRect *mouthPos, Drawable *eyeR,
+       BoundingRect *eyeRPos, Drawable *eyeL, BoundingRect *eyeLPos,
+       Drawable *eyeblowR, BoundingRect *eyeblowRPos, Drawable *eyeblowL,
+       BoundingRect *eyeblowLPos,
+       BoundingRect *boundingRect, M5Canvas *spr, M5Canvas *tmpSpr,
+       Balloon *balloon, Effect *effect, BatteryIcon *battery);
+
  public:
   // constructor
   Face();
@@ -50,7 +91,7 @@ class Face {
        Drawable *eyeblowR, BoundingRect *eyeblowRPos, Drawable *eyeblowL,
        BoundingRect *eyeblowLPos,
        BoundingRect *boundingRect, M5Canvas *spr, M5Canvas *tmpSpr);
-  ~Face();
+  virtual ~Face();
   Face(const Face &other) = default;
   Face &operator=(const Face &other) = default;
 
@@ -69,7 +110,28 @@ class Face {
   void setLeftEyeblow();
   void setRightEyeblow();
 
+  /**
+   * @brief draw the face and push the changed bands to the panel
+   *
+   * When only effects changed since the last frame, the sprite is redrawn
+   * inside the union of the effect dirty rects and only the bands that
+   * overlap it are pushed. Nothing is pushed if nothing changed.
+   */
   void draw(DrawContext *ctx);
+
+  /**
+   * @brief true while effects are shown and the face has to keep redrawing
+   */
+  bool isAnimating() const;
+
+ private:
+  void pushIndexedBand(DrawContext *ctx, int y, int height, uint16_t *dst);
+  // clip: redraw only inside this rect of the sprite (nullptr: whole sprite)
+  void clearSprite(DrawContext *ctx, BoundingRect *clip);
+  void drawSprite(DrawContext *ctx, BoundingRect *clip);
+  // push the bands covering panel rows [top, bottom) of the face
+  void pushBands(DrawContext *ctx, StatusOverlay *overlay, int top,
+                 int bottom);
 };
 }  // namespace m5avatar
 
@@ -0,0 +1,256 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#include "FaceLoader.h"
+
+#include <stdlib.h>
+
+#include <new>
+
+#include "Eye.h"
+#include "Eyeblow.h"
+#include "Eyebrows.hpp"
+#include "Eyes.hpp"
+#include "Mouth.h"
+#include "Mouths.hpp"
+
+namespace m5avatar {
+
+// ColorPalette::getIndex の逆引き
+static const char *const paletteKeys[] = {
+    COLOR_BACKGROUND, COLOR_PRIMARY, COLOR_SECONDARY, COLOR_BALLOON_FOREGROUND,
+    COLOR_BALLOON_BACKGROUND};
+
+static constexpr size_t ARENA_ALIGN = alignof(max_align_t);
+
+static constexpr size_t alignUp(size_t size) {
+  return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+// 顔ごとに1つずつ必要な、パーツ以外のオブジェクトの大きさ
+static constexpr size_t frameSize() {
+  return alignUp(sizeof(BoundingRect)) + alignUp(sizeof(M5Canvas)) * 2 +
+         alignUp(sizeof(Balloon)) + alignUp(sizeof(Effect)) +
+         alignUp(sizeof(BatteryIcon));
+}
+
+static inline int16_t readI16(const uint8_t *p) {
+  return static_cast<int16_t>(p[0] | (p[1] << 8));
+}
+
+static inline uint16_t readU16(const uint8_t *p) {
+  return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static size_t partSize(uint8_t type) {
+  switch (type) {
+    case FACE_PART_MOUTH:
+      return sizeof(Mouth);
+    case FACE_PART_RECT_MOUTH:
+      return sizeof(RectMouth);
+    case FACE_PART_OMEGA_MOUTH:
+      return sizeof(OmegaMouth);
+    case FACE_PART_USHAPE_MOUTH:
+      return sizeof(UShapeMouth);
+    case FACE_PART_DOGGY_MOUTH:
+      return sizeof(DoggyMouth);
+    case FACE_PART_EYE:
+      return sizeof(Eye);
+    case FACE_PART_ELLIPSE_EYE:
+      return sizeof(EllipseEye);
+    case FACE_PART_GIRLY_EYE:
+      return sizeof(GirlyEye);
+    case FACE_PART_PINK_DEMON_EYE:
+      return sizeof(PinkDemonEye);
+    case FACE_PART_DOGGY_EYE:
+      return sizeof(DoggyEye);
+    case FACE_PART_EYEBLOW:
+      return sizeof(Eyeblow);
+    case FACE_PART_ELLIPSE_EYEBROW:
+      return sizeof(EllipseEyebrow);
+    case FACE_PART_BOW_EYEBROW:
+      return sizeof(BowEyebrow);
+    case FACE_PART_RECT_EYEBROW:
+      return sizeof(RectEyebrow);
+    default:
+      return 0;
+  }
+}
+
+static Drawable *createPart(void *mem, uint8_t type, bool isLeft,
+                            const uint16_t *p) {
+  switch (type) {
+    case FACE_PART_MOUTH:
+      return new (mem) Mouth(p[0], p[1], p[2], p[3]);
+    case FACE_PART_RECT_MOUTH:
+      return new (mem) RectMouth(p[0], p[1], p[2], p[3]);
+    case FACE_PART_OMEGA_MOUTH:
+      return new (mem) OmegaMouth(p[0], p[1], p[2], p[3]);
+    case FACE_PART_USHAPE_MOUTH:
+      return new (mem) UShapeMouth(p[0], p[1], p[2], p[3]);
+    case FACE_PART_DOGGY_MOUTH:
+      return new (mem) DoggyMouth(p[0], p[1], p[2], p[3]);
+    case FACE_PART_EYE:
+      return new (mem) Eye(p[0], isLeft);
+    case FACE_PART_ELLIPSE_EYE:
+      return new (mem) EllipseEye(p[0], p[1], isLeft);
+    case FACE_PART_GIRLY_EYE:
+      return new (mem) GirlyEye(p[0], p[1], isLeft);
+    case FACE_PART_PINK_DEMON_EYE:
+      return new (mem) PinkDemonEye(p[0], p[1], isLeft);
+    case FACE_PART_DOGGY_EYE:
+      return new (mem) DoggyEye(p[0], p[1], isLeft);
+    case FACE_PART_EYEBLOW:
+      return new (mem) Eyeblow(p[0], p[1], isLeft);
+    case FACE_PART_ELLIPSE_EYEBROW:
+      return new (mem) EllipseEyebrow(p[0], p[1], isLeft);
+    case FACE_PART_BOW_EYEBROW:
+      return new (mem) BowEyebrow(p[0], p[1], isLeft);
+    case FACE_PART_RECT_EYEBROW:
+      return new (mem) RectEyebrow(p[0], p[1], isLeft);
+    default:
+      return nullptr;
+  }
+}
+
+ArenaFace::ArenaFace(Drawable *const *parts, BoundingRect *const *positions,
+                     const ArenaFaceFrame &frame, uint8_t *arena)
+    : Face(parts[FACE_SLOT_MOUTH], positions[FACE_SLOT_MOUTH],
+           parts[FACE_SLOT_EYE_R], positions[FACE_SLOT_EYE_R],
+           parts[FACE_SLOT_EYE_L], positions[FACE_SLOT_EYE_L],
+           parts[FACE_SLOT_EYEBROW_R], positions[FACE_SLOT_EYEBROW_R],
+           parts[FACE_SLOT_EYEBROW_L], positions[FACE_SLOT_EYEBROW_L],
+           frame.boundingRect, frame.sprite, frame.tmpSprite, frame.balloon,
+           frame.effect, frame.battery),
+      arena{arena},
+      frame(frame) {
+  for (int i = 0; i < FACE_SLOT_COUNT; i++) {
+    this->parts[i] = parts[i];
+  }
+  // パーツなどはアリーナ上にあるので Face 側では delete しない
+  ownsParts = false;
+}
+
+ArenaFace::~ArenaFace() {
+  for (Drawable *part : parts) {
+    part->~Drawable();
+  }
+  // スプライトの画素のバッファはここで解放される
+  frame.sprite->~M5Canvas();
+  frame.tmpSprite->~M5Canvas();
+  frame.balloon->~Balloon();
+  frame.effect->~Effect();
+  frame.battery->~BatteryIcon();
+  // BoundingRect is trivially destructible
+  free(arena);
+}
+
+size_t FaceLoader::getArenaSize(const uint8_t *data, size_t length) {
+  if (data == nullptr || length < HEADER_SIZE || data[0] != 'A' ||
+      data[1] != 'V' || data[2] != 'F' || data[3] != AVF_VERSION) {
+    return 0;
+  }
+  uint8_t partCount = data[4];
+  uint8_t colorCount = data[5];
+  if (partCount != FACE_SLOT_COUNT ||
+      length < HEADER_SIZE + partCount * PART_SIZE + colorCount * COLOR_SIZE) {
+    return 0;
+  }
+  size_t size = frameSize() + alignUp(sizeof(BoundingRect)) * FACE_SLOT_COUNT;
+  bool seen[FACE_SLOT_COUNT] = {};
+  const uint8_t *p = data + HEADER_SIZE;
+  for (uint8_t i = 0; i < partCount; i++, p += PART_SIZE) {
+    size_t s = partSize(p[1]);
+    if (p[0] >= FACE_SLOT_COUNT || seen[p[0]] || s == 0) {
+      return 0;
+    }
+    seen[p[0]] = true;
+    size += alignUp(s);
+  }
+  return size;
+}
+
+Face *FaceLoader::load(const uint8_t *data, size_t length,
+                       ColorPalette *palette) {
+  size_t arenaSize = getArenaSize(data, length);
+  if (arenaSize == 0) {
+    return nullptr;
+  }
+  uint8_t *arena = static_cast<uint8_t *>(malloc(arenaSize));
+  if (arena == nullptr) {
+    return nullptr;
+  }
+
+  Drawable *parts[FACE_SLOT_COUNT];
+  BoundingRect *positions[FACE_SLOT_COUNT];
+  ArenaFaceFrame frame;
+  uint8_t *cursor = arena;
+  frame.boundingRect = new (cursor) BoundingRect(0, 0, 320, 240);
+  cursor += alignUp(sizeof(BoundingRect));
+  frame.sprite = new (cursor) M5Canvas();
+  cursor += alignUp(sizeof(M5Canvas));
+  frame.tmpSprite = new (cursor) M5Canvas();
+  cursor += alignUp(sizeof(M5Canvas));
+  frame.balloon = new (cursor) Balloon();
+  cursor += alignUp(sizeof(Balloon));
+  frame.effect = new (cursor) Effect();
+  cursor += alignUp(sizeof(Effect));
+  frame.battery = new (cursor) BatteryIcon();
+  cursor += alignUp(sizeof(BatteryIcon));
+  for (int i = 0; i < FACE_SLOT_COUNT; i++) {
+    positions[i] = new (cursor) BoundingRect(0, 0);
+    cursor += alignUp(sizeof(BoundingRect));
+  }
+
+  const uint8_t *p = data + HEADER_SIZE;
+  for (uint8_t i = 0; i < FACE_SLOT_COUNT; i++, p += PART_SIZE) {
+    uint8_t slot = p[0];
+    uint8_t type = p[1];
+    uint16_t params[4];
+    for (int j = 0; j < 4; j++) {
+      params[j] = readU16(p + 6 + j * 2);
+    }
+    bool isLeft = slot == FACE_SLOT_EYE_L || slot == FACE_SLOT_EYEBROW_L;
+    positions[slot]->setPosition(readI16(p + 2), readI16(p + 4));
+    parts[slot] = createPart(cursor, type, isLeft, params);
+    cursor += alignUp(partSize(type));
+  }
+
+  if (palette != nullptr) {
+    uint8_t colorCount = data[5];
+    for (uint8_t i = 0; i < colorCount; i++, p += COLOR_SIZE) {
+      for (const char *key : paletteKeys) {
+        if (ColorPalette::getIndex(key) == p[0]) {
+          palette->set(key, readU16(p + 2));
+          break;
+        }
+      }
+    }
+  }
+
+  return new ArenaFace(parts, positions, frame, arena);
+}
+
+#ifdef ARDUINO
+Face *FaceLoader::load(fs::FS &fs, const char *path, ColorPalette *palette) {
+  File file = fs.open(path, "r");
+  if (!file) {
+    return nullptr;
+  }
+  size_t length = file.size();
+  // 記述は数十バイトなので一時バッファで読み込んで解析後すぐに解放する
+  uint8_t *buffer = static_cast<uint8_t *>(malloc(length));
+  if (buffer == nullptr) {
+    file.close();
+    return nullptr;
+  }
+  size_t read = file.read(buffer, length);
+  file.close();
+  Face *face = read == length ? load(buffer, length, palette) : nullptr;
+  free(buffer);
+  return face;
+}
+#endif
+
+}  // namespace m5avatar
@@ -0,0 +1,132 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef FACELOADER_H_
+#define FACELOADER_H_
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ColorPalette.h"
+#include "Face.h"
+
+#ifdef ARDUINO
+#include <FS.h>
+#endif
+
+// Face description format (little endian)
+//
+//   header : 'A' 'V' 'F' version partCount colorCount 0 0
+//   part   : slot type top(i16) left(i16) p0 p1 p2 p3 (u16)   x partCount
+//   color  : paletteIndex 0 rgb565(u16)                       x colorCount
+//
+// slot is one of FaceSlot. p0-p3 are the constructor arguments of the part
+// (mouth: min/max width, min/max height, eye/eyebrow: width, height, eye:
+// radius). paletteIndex follows ColorPalette::getIndex.
+#define AVF_VERSION 1
+#define AVF_I16(v) \
+  static_cast<uint8_t>((v) & 0xFF), static_cast<uint8_t>(((v) >> 8) & 0xFF)
+#define AVF_HEADER(partCount, colorCount) \
+  'A', 'V', 'F', AVF_VERSION, (partCount), (colorCount), 0, 0
+#define AVF_PART(slot, type, top, left, p0, p1, p2, p3)                 \
+  static_cast<uint8_t>(slot), static_cast<uint8_t>(type), AVF_I16(top), \
+      AVF_I16(left), AVF_I16(p0), AVF_I16(p1), AVF_I16(p2), AVF_I16(p3)
+#define AVF_COLOR(index, rgb565) (index), 0, AVF_I16(rgb565)
+
+namespace m5avatar {
+
+enum FaceSlot : uint8_t {
+  FACE_SLOT_MOUTH = 0,
+  FACE_SLOT_EYE_R,
+  FACE_SLOT_EYE_L,
+  FACE_SLOT_EYEBROW_R,
+  FACE_SLOT_EYEBROW_L,
+  FACE_SLOT_COUNT
+};
+
+enum FacePartType : uint8_t {
+  // mouths
+  FACE_PART_MOUTH = 0x01,
+  FACE_PART_RECT_MOUTH,
+  FACE_PART_OMEGA_MOUTH,
+  FACE_PART_USHAPE_MOUTH,
+  FACE_PART_DOGGY_MOUTH,
+  // eyes
+  FACE_PART_EYE = 0x10,
+  FACE_PART_ELLIPSE_EYE,
+  FACE_PART_GIRLY_EYE,
+  FACE_PART_PINK_DEMON_EYE,
+  FACE_PART_DOGGY_EYE,
+  // eyebrows
+  FACE_PART_EYEBLOW = 0x20,
+  FACE_PART_ELLIPSE_EYEBROW,
+  FACE_PART_BOW_EYEBROW,
+  FACE_PART_RECT_EYEBROW,
+};
+
+/**
+ * Objects every face needs besides the parts
+ */
+struct ArenaFaceFrame {
+  BoundingRect *boundingRect;
+  M5Canvas *sprite;
+  M5Canvas *tmpSprite;
+  Balloon *balloon;
+  Effect *effect;
+  BatteryIcon *battery;
+};
+
+/**
+ * Face built from a description. The parts, their positions and the objects
+ * of ArenaFaceFrame live in one arena that is freed with the face.
+ *
+ * The pixel buffers of the two sprites are allocated by LovyanGFX when the
+ * face is first drawn, and the column map of the LUT push when it is first
+ * pushed. They stay on the heap and are freed with the face.
+ */
+class ArenaFace final : public Face {
+ private:
+  uint8_t *arena;
+  Drawable *parts[FACE_SLOT_COUNT];
+  ArenaFaceFrame frame;
+
+ public:
+  ArenaFace(Drawable *const *parts, BoundingRect *const *positions,
+            const ArenaFaceFrame &frame, uint8_t *arena);
+  ~ArenaFace() override;
+  ArenaFace(const ArenaFace &other) = delete;
+  ArenaFace &operator=(const ArenaFace &other) = delete;
+};
+
+class FaceLoader {
+ public:
+  static constexpr size_t HEADER_SIZE = 8;
+  static constexpr size_t PART_SIZE = 14;
+  static constexpr size_t COLOR_SIZE = 4;
+
+  /**
+   * @brief build a face from a description in memory (RAM or flash)
+   *
+   * @param palette colors in the description are written here if not null
+   * @return new face or nullptr if the description is invalid
+   */
+  static Face *load(const uint8_t *data, size_t length,
+                    ColorPalette *palette = nullptr);
+
+#ifdef ARDUINO
+  /**
+   * @brief read a description from a file (e.g. LittleFS) and build a face
+   */
+  static Face *load(fs::FS &fs, const char *path,
+                    ColorPalette *palette = nullptr);
+#endif
+
+  /**
+   * @brief size of the arena needed for a description. 0 if invalid
+   */
+  static size_t getArenaSize(const uint8_t *data, size_t length);
+};
+
+}  // namespace m5avatar
+
+#endif  // FACELOADER_H_
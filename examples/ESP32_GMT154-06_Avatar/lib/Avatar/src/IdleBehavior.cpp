@@ -0,0 +1,139 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#include "IdleBehavior.h"
+
+namespace m5avatar {
+
+// sin(2 * PI * i / 64) in Q15
+static const int16_t breathTable[64] = {
+    0,      3212,   6393,   9512,   12539,  15446,  18204,  20787,
+    23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+    32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,
+    23170,  20787,  18204,  15446,  12539,  9512,   6393,   3212,
+    0,      -3212,  -6393,  -9512,  -12539, -15446, -18204, -20787,
+    -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329,
+    -23170, -20787, -18204, -15446, -12539, -9512,  -6393,  -3212};
+
+// -ln((i + 0.5) / 32) in Q8. mean is about 1.0
+static const uint16_t expTable[32] = {
+    1065, 783, 653, 567, 502, 451, 408, 371, 339, 311, 285,
+    262,  241, 221, 203, 186, 170, 155, 140, 127, 114, 102,
+    90,   79,  68,  58,  48,  39,  30,  21,  12,  4};
+
+// gaze dynamics per tick (Q8)
+static constexpr int32_t SACCADE_GAIN = 160;   // fast approach to the target
+static constexpr int32_t FIXATION_GAIN = 24;   // mean reversion while fixating
+static constexpr int32_t FIXATION_NOISE = 6;   // micro saccade amplitude
+static constexpr int32_t SACCADE_DONE = 1024;  // |target - gaze| in Q15
+
+ProceduralIdleBehavior::ProceduralIdleBehavior(uint32_t seed)
+    : rngState{seed != 0 ? seed : 1},
+      gazeState{GazeState::Fixating},
+      blinkState{BlinkState::Open},
+      nextSaccadeMillis{0},
+      nextBlinkMillis{0},
+      startMillis{0},
+      targetV{0},
+      targetH{0},
+      gazeV{0},
+      gazeH{0} {}
+
+// xorshift32
+uint32_t ProceduralIdleBehavior::nextRandom() {
+  uint32_t x = rngState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rngState = x;
+  return x;
+}
+
+// uniform in [-1, 1) as Q15
+int32_t ProceduralIdleBehavior::randomQ15() {
+  return static_cast<int32_t>(nextRandom() >> 16) - 32768;
+}
+
+uint32_t ProceduralIdleBehavior::randomRange(uint32_t range) {
+  return ((nextRandom() >> 16) * range) >> 16;
+}
+
+uint32_t ProceduralIdleBehavior::poissonInterval(uint32_t mean) {
+  uint32_t interval = (mean * expTable[nextRandom() >> 27]) >> 8;
+  return interval < MIN_BLINK_INTERVAL ? MIN_BLINK_INTERVAL : interval;
+}
+
+void ProceduralIdleBehavior::reset(uint32_t now) {
+  startMillis = now;
+  gazeState = GazeState::Fixating;
+  blinkState = BlinkState::Open;
+  nextSaccadeMillis = now + 1000;
+  nextBlinkMillis = now + poissonInterval(MEAN_BLINK_INTERVAL);
+}
+
+void ProceduralIdleBehavior::update(uint32_t now, IdleState *state) {
+  // gaze
+  if (gazeState == GazeState::Fixating &&
+      static_cast<int32_t>(now - nextSaccadeMillis) >= 0) {
+    targetV = randomQ15();
+    targetH = randomQ15();
+    gazeState = GazeState::Saccading;
+  }
+  int32_t gain =
+      gazeState == GazeState::Saccading ? SACCADE_GAIN : FIXATION_GAIN;
+  gazeV += ((targetV - gazeV) * gain) >> 8;
+  gazeH += ((targetH - gazeH) * gain) >> 8;
+  if (gazeState == GazeState::Saccading) {
+    int32_t dv = targetV - gazeV;
+    int32_t dh = targetH - gazeH;
+    if (dv < SACCADE_DONE && dv > -SACCADE_DONE && dh < SACCADE_DONE &&
+        dh > -SACCADE_DONE) {
+      gazeState = GazeState::Fixating;
+      nextSaccadeMillis = now + 500 + randomRange(2000);
+    }
+  } else {
+    gazeV += (randomQ15() * FIXATION_NOISE) >> 8;
+    gazeH += (randomQ15() * FIXATION_NOISE) >> 8;
+  }
+  if (gazeV > Q15_ONE) gazeV = Q15_ONE;
+  if (gazeV < -Q15_ONE) gazeV = -Q15_ONE;
+  if (gazeH > Q15_ONE) gazeH = Q15_ONE;
+  if (gazeH < -Q15_ONE) gazeH = -Q15_ONE;
+  state->gazeV = gazeV;
+  state->gazeH = gazeH;
+
+  // blink
+  if (static_cast<int32_t>(now - nextBlinkMillis) >= 0) {
+    if (blinkState == BlinkState::Open) {
+      blinkState = BlinkState::Closed;
+      nextBlinkMillis = now + 300 + randomRange(200);
+    } else {
+      blinkState = BlinkState::Open;
+      nextBlinkMillis = now + poissonInterval(MEAN_BLINK_INTERVAL);
+    }
+  }
+  state->eyeOpenRatio = blinkState == BlinkState::Open ? Q15_ONE : 0;
+
+  // breath: 64 entries per period with linear interpolation (Q8 phase)
+  uint32_t phase = (((now - startMillis) % BREATH_PERIOD) << 14) /
+                   BREATH_PERIOD;
+  uint32_t index = phase >> 8;
+  int32_t frac = phase & 0xFF;
+  int32_t a = breathTable[index];
+  int32_t b = breathTable[(index + 1) & 63];
+  state->breath = a + (((b - a) * frac) >> 8);
+}
+
+ProceduralIdleBehavior::GazeState ProceduralIdleBehavior::getGazeState()
+    const {
+  return gazeState;
+}
+
+ProceduralIdleBehavior::BlinkState ProceduralIdleBehavior::getBlinkState()
+    const {
+  return blinkState;
+}
+
+}  // namespace m5avatar
@@ -0,0 +1,86 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef IDLEBEHAVIOR_H_
+#define IDLEBEHAVIOR_H_
+#include <stdint.h>
+
+namespace m5avatar {
+
+// Q15 fixed point: 32767 = 1.0
+typedef int16_t q15_t;
+static constexpr q15_t Q15_ONE = 32767;
+
+/**
+ * Facial parameters driven while the avatar is idle. All values are Q15.
+ */
+struct IdleState {
+  q15_t gazeV;
+  q15_t gazeH;
+  q15_t eyeOpenRatio;
+  q15_t breath;
+};
+
+/**
+ * Interface of idle behaviours. update() is called periodically from a timer
+ * callback, so it must not block or allocate.
+ */
+class IdleBehavior {
+ public:
+  virtual ~IdleBehavior() = default;
+  virtual void reset(uint32_t now) = 0;
+  virtual void update(uint32_t now, IdleState *state) = 0;
+};
+
+/**
+ * Default idle behaviour.
+ *
+ * - gaze: fixation / saccade state machine. The gaze follows the saccade
+ *   target with an Ornstein-Uhlenbeck process so that it jitters a little
+ *   while fixating.
+ * - blink: Poisson process (exponential intervals)
+ * - breath: sine lookup table
+ */
+class ProceduralIdleBehavior final : public IdleBehavior {
+ public:
+  enum class GazeState { Fixating, Saccading };
+  enum class BlinkState { Open, Closed };
+
+ private:
+  uint32_t rngState;
+  GazeState gazeState;
+  BlinkState blinkState;
+  uint32_t nextSaccadeMillis;
+  uint32_t nextBlinkMillis;
+  uint32_t startMillis;
+  int32_t targetV;
+  int32_t targetH;
+  int32_t gazeV;
+  int32_t gazeH;
+
+  uint32_t nextRandom();
+  int32_t randomQ15();
+  uint32_t randomRange(uint32_t range);
+  uint32_t poissonInterval(uint32_t mean);
+
+ public:
+  static constexpr uint32_t BREATH_PERIOD = 3300;  // ms
+  static constexpr uint32_t MEAN_BLINK_INTERVAL = 3500;
+  static constexpr uint32_t MIN_BLINK_INTERVAL = 600;
+
+  explicit ProceduralIdleBehavior(uint32_t seed = 0x12345678);
+  ~ProceduralIdleBehavior() = default;
+  ProceduralIdleBehavior(const ProceduralIdleBehavior &other) = default;
+  ProceduralIdleBehavior &operator=(const ProceduralIdleBehavior &other) =
+      default;
+
+  void reset(uint32_t now) override;
+  void update(uint32_t now, IdleState *state) override;
+  GazeState getGazeState() const;
+  BlinkState getBlinkState() const;
+};
+
+}  // namespace m5avatar
+
+#endif  // IDLEBEHAVIOR_H_
@@ -18,7 +18,7 @@ Mouth::Mouth(uint16_t minWidth, uint16_t maxWidth, uint16_t minHeight,
       maxHeight{maxHeight} {}
 
 void Mouth::draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) {
-  uint16_t primaryColor = ctx->getColorDepth() == 1 ? 1 : ctx->getColorPalette()->get(COLOR_PRIMARY);
+  uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
   float breath = _min(1.0f, ctx->getBreath());
   float openRatio = ctx->getMouthOpenRatio();
   int h = minHeight + (maxHeight - minHeight) * openRatio;
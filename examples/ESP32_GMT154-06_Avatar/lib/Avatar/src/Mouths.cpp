@@ -14,15 +14,9 @@ BaseMouth::BaseMouth(uint16_t min_width, uint16_t max_width,
       max_height_{max_height} {}
 
 void BaseMouth::update(M5Canvas *canvas, BoundingRect rect, DrawContext *ctx) {
-    primary_color_ = ctx->getColorDepth() == 1
-                         ? 1
-                         : ctx->getColorPalette()->get(COLOR_PRIMARY);
-    background_color_ = ctx->getColorDepth() == 1
-                            ? ERACER_COLOR
-                            : ctx->getColorPalette()->get(COLOR_BACKGROUND);
-    secondary_color_ = ctx->getColorDepth() == 1
-                           ? 1
-                           : ctx->getColorPalette()->get(COLOR_SECONDARY);
+    primary_color_ = ctx->getColor(COLOR_PRIMARY);
+    background_color_ = ctx->getColor(COLOR_BACKGROUND);
+    secondary_color_ = ctx->getColor(COLOR_SECONDARY);
     center_x_ = rect.getCenterX();
     center_y_ = rect.getCenterY();
     open_ratio_ = ctx->getMouthOpenRatio();
@@ -103,7 +97,7 @@ void DoggyMouth::draw(M5Canvas *canvas, BoundingRect rect, DrawContext *ctx) {
     if (h > min_height_) {
         canvas->fillEllipse(center_x_, center_y_, w / 2, h / 2, primary_color_);
         canvas->fillEllipse(center_x_, center_y_, w / 2 - 4, h / 2 - 4,
-                            TFT_RED);
+                            ctx->mapColor(TFT_RED));
         canvas->fillRect(center_x_ - w / 2, center_y_ - h / 2, w, h / 2,
                          background_color_);
     }
@@ -0,0 +1,215 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#include "StatusOverlay.h"
+
+#include <string.h>
+
+namespace m5avatar {
+
+static const int16_t tileWidths[StatusOverlay::MAX_WIDGETS] = {
+    36,  // Battery
+    20,  // WiFi
+    44,  // Clock
+    16,  // Notification
+};
+static const int16_t TILE_HEIGHT = 16;
+
+// RSSI (dBm) -> 0..4 bars
+static uint8_t rssiToBars(int8_t rssi) {
+  if (rssi >= -55) return 4;
+  if (rssi >= -67) return 3;
+  if (rssi >= -78) return 2;
+  if (rssi >= -89) return 1;
+  return 0;
+}
+
+StatusOverlay::StatusOverlay()
+    : widgets{},
+      rssi{0},
+      isRSSIVisible{false},
+      clockText{""},
+      notificationCount{0},
+      tileForeground{0},
+      tileBackground{0} {}
+
+StatusOverlay::~StatusOverlay() {
+  for (Widget &w : widgets) {
+    delete w.tile;
+  }
+}
+
+void StatusOverlay::setRSSI(int8_t rssi) {
+  this->rssi = rssi;
+  isRSSIVisible = true;
+}
+
+void StatusOverlay::hideRSSI() { isRSSIVisible = false; }
+
+void StatusOverlay::setClockText(const char *text) {
+  strncpy(clockText, text, sizeof(clockText) - 1);
+  clockText[sizeof(clockText) - 1] = '\0';
+}
+
+void StatusOverlay::setNotificationCount(uint8_t count) {
+  notificationCount = count;
+}
+
+// value shown by the tile. 0 means hidden
+uint32_t StatusOverlay::getKey(StatusWidgetType type, DrawContext *ctx) const {
+  static constexpr uint32_t VISIBLE = 0x80000000;
+  switch (type) {
+    case StatusWidgetType::Battery: {
+      BatteryIconStatus status = ctx->getBatteryIconStatus();
+      if (status == BatteryIconStatus::invisible) return 0;
+      // 表示上の段階 (ゲージのピクセル幅) が変わった時だけ描き直す
+      int32_t width = 30 * (ctx->getBatteryLevel() / 100.0f);
+      return VISIBLE | (status == BatteryIconStatus::charging ? 0x100 : 0) |
+             (width & 0xFF);
+    }
+    case StatusWidgetType::WiFi:
+      return isRSSIVisible ? VISIBLE | rssiToBars(rssi) : 0;
+    case StatusWidgetType::Clock: {
+      if (clockText[0] == '\0') return 0;
+      // FNV-1a
+      uint32_t hash = 2166136261u;
+      for (const char *p = clockText; *p; p++) {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+      }
+      return VISIBLE | (hash & 0x7FFFFFFF);
+    }
+    case StatusWidgetType::Notification:
+      return notificationCount > 0 ? VISIBLE | notificationCount : 0;
+  }
+  return 0;
+}
+
+void StatusOverlay::render(StatusWidgetType type, M5Canvas *tile,
+                           DrawContext *ctx) {
+  uint16_t fg = tileForeground;
+  uint16_t bg = tileBackground;
+  tile->fillSprite(bg);
+  switch (type) {
+    case StatusWidgetType::Battery: {
+      int32_t level = ctx->getBatteryLevel();
+      tile->drawRect(0, 5, 5, 5, fg);
+      tile->drawRect(5, 0, 30, 15, fg);
+      int battery_width = 30 * (float)(level / 100.0f);
+      tile->fillRect(5 + 30 - battery_width, 0, battery_width, 15, fg);
+      if (ctx->getBatteryIconStatus() == BatteryIconStatus::charging) {
+        tile->fillTriangle(20, 0, 15, 8, 20, 8, bg);
+        tile->fillTriangle(18, 7, 18, 15, 23, 7, bg);
+        tile->drawLine(20, 0, 15, 8, fg);
+        tile->drawLine(20, 0, 20, 7, fg);
+        tile->drawLine(18, 15, 23, 7, fg);
+        tile->drawLine(18, 8, 18, 15, fg);
+      }
+      break;
+    }
+    case StatusWidgetType::WiFi: {
+      uint8_t bars = rssiToBars(rssi);
+      for (int i = 0; i < 4; i++) {
+        int16_t h = 4 + i * 3;
+        if (i < bars) {
+          tile->fillRect(i * 5, 15 - h, 3, h, fg);
+        } else {
+          tile->drawRect(i * 5, 15 - h, 3, h, fg);
+        }
+      }
+      break;
+    }
+    case StatusWidgetType::Clock:
+      tile->setFont(&fonts::Font2);
+      tile->setTextColor(fg, bg);
+      tile->setTextDatum(MR_DATUM);
+      tile->drawString(clockText, tile->width() - 1, TILE_HEIGHT / 2);
+      break;
+    case StatusWidgetType::Notification:
+      tile->fillCircle(8, 8, 7, fg);
+      tile->setFont(&fonts::Font0);
+      tile->setTextColor(bg, fg);
+      tile->setTextDatum(MC_DATUM);
+      tile->drawNumber(notificationCount > 9 ? 9 : notificationCount, 8, 8);
+      break;
+  }
+}
+
+bool StatusOverlay::update(DrawContext *ctx, int16_t visibleLeft,
+                           int16_t visibleTop, int16_t visibleRight) {
+  // タイルは RGB565 で持つので、パレット番号ではなく実際の色で描く
+  ColorPalette *palette = ctx->getColorPalette();
+  uint16_t fg = palette->get(COLOR_PRIMARY);
+  uint16_t bg = palette->get(COLOR_BACKGROUND);
+  bool colorChanged = fg != tileForeground || bg != tileBackground;
+  tileForeground = fg;
+  tileBackground = bg;
+
+  bool changed = false;
+  int16_t right = visibleRight - MARGIN;
+  for (uint8_t i = 0; i < MAX_WIDGETS; i++) {
+    StatusWidgetType type = static_cast<StatusWidgetType>(i);
+    Widget &w = widgets[i];
+    Widget last = w;
+    uint32_t key = getKey(type, ctx);
+    w.visible = key != 0;
+    if (!w.visible) {
+      changed |= last.visible;
+      continue;
+    }
+    if (w.tile == nullptr) {
+      w.tile = new M5Canvas();
+      w.tile->setColorDepth(16);
+      w.tile->setPsram(false);
+      if (w.tile->createSprite(tileWidths[i], TILE_HEIGHT) == nullptr) {
+        delete w.tile;
+        w.tile = nullptr;
+        w.visible = false;
+        changed |= last.visible;
+        continue;
+      }
+      w.renderedKey = 0;
+    }
+    if (colorChanged || key != w.renderedKey) {
+      render(type, w.tile, ctx);
+      w.renderedKey = key;
+      changed = true;
+    }
+    w.x = right - tileWidths[i];
+    w.y = visibleTop + MARGIN;
+    right = w.x - MARGIN;
+    if (w.x < visibleLeft) {
+      // 入りきらないものは表示しない
+      w.visible = false;
+    }
+    changed |= w.visible != last.visible ||
+               (w.visible && (w.x != last.x || w.y != last.y));
+  }
+  return changed;
+}
+
+void StatusOverlay::composite(uint16_t *band, int16_t width, int16_t y,
+                              int16_t height) const {
+  for (uint8_t i = 0; i < MAX_WIDGETS; i++) {
+    const Widget &w = widgets[i];
+    if (!w.visible) continue;
+    int16_t top = w.y > y ? w.y : y;
+    int16_t bottom = w.y + TILE_HEIGHT < y + height ? w.y + TILE_HEIGHT
+                                                    : y + height;
+    if (top >= bottom) continue;
+    int16_t left = w.x < 0 ? 0 : w.x;
+    int16_t right =
+        w.x + tileWidths[i] > width ? width : w.x + tileWidths[i];
+    if (left >= right) continue;
+
+    // タイルも短冊もバイトスワップ済みの RGB565 なので行単位でコピーできる
+    const uint16_t *src = static_cast<const uint16_t *>(w.tile->getBuffer());
+    for (int16_t row = top; row < bottom; row++) {
+      memcpy(band + (row - y) * width + left,
+             src + (row - w.y) * tileWidths[i] + (left - w.x),
+             (right - left) * sizeof(uint16_t));
+    }
+  }
+}
+
+}  // namespace m5avatar
@@ -0,0 +1,96 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef STATUSOVERLAY_H_
+#define STATUSOVERLAY_H_
+#include <stdint.h>
+
+#include "DrawContext.h"
+#include "M5Canvas.h"
+
+namespace m5avatar {
+
+enum class StatusWidgetType { Battery, WiFi, Clock, Notification };
+
+/**
+ * Status icons (battery, WiFi RSSI, clock, notification) drawn on top of the
+ * face.
+ *
+ * Each icon is rasterized into a small RGB565 tile that is only re-rendered
+ * when the value it shows changes. The tiles are copied into the 16-bit strip
+ * right before it is sent to the panel, so they are not scaled or rotated
+ * with the face and cost nothing to redraw on frames where they are unchanged.
+ */
+class StatusOverlay {
+ public:
+  static constexpr uint8_t MAX_WIDGETS = 4;
+  static constexpr int16_t MARGIN = 4;
+
+ private:
+  struct Widget {
+    M5Canvas *tile;
+    uint32_t renderedKey;  // 0: not rendered yet
+    bool visible;
+    int16_t x;  // position in strip coordinates
+    int16_t y;
+  };
+  Widget widgets[MAX_WIDGETS];
+
+  int8_t rssi;
+  bool isRSSIVisible;
+  char clockText[8];
+  uint8_t notificationCount;
+  uint16_t tileForeground;
+  uint16_t tileBackground;
+
+  uint32_t getKey(StatusWidgetType type, DrawContext *ctx) const;
+  void render(StatusWidgetType type, M5Canvas *tile, DrawContext *ctx);
+
+ public:
+  StatusOverlay();
+  ~StatusOverlay();
+  StatusOverlay(const StatusOverlay &other) = delete;
+  StatusOverlay &operator=(const StatusOverlay &other) = delete;
+
+  /**
+   * @brief show the WiFi icon with the given RSSI (dBm)
+   */
+  void setRSSI(int8_t rssi);
+  void hideRSSI();
+  /**
+   * @brief show a short text (e.g. "12:34"). empty string hides the clock
+   */
+  void setClockText(const char *text);
+  /**
+   * @brief 0 hides the notification icon
+   */
+  void setNotificationCount(uint8_t count);
+
+  /**
+   * @brief re-render tiles whose value changed and lay them out
+   *
+   * Called once per frame before the strip push. Icons are right-aligned to
+   * visibleRight so that they stay on the panel when the face is wider.
+   *
+   * @param visibleLeft first strip column that is on the panel
+   * @param visibleTop first face row that is on the panel
+   * @param visibleRight strip column next to the last one on the panel
+   * @return true if any tile was re-rendered, moved, shown or hidden
+   */
+  bool update(DrawContext *ctx, int16_t visibleLeft, int16_t visibleTop,
+              int16_t visibleRight);
+
+  /**
+   * @brief copy the tiles into a byte-swapped RGB565 strip
+   *
+   * @param band strip buffer (width * height pixels)
+   * @param y row of the face the strip starts at
+   */
+  void composite(uint16_t *band, int16_t width, int16_t y,
+                 int16_t height) const;
+};
+
+}  // namespace m5avatar
+
+#endif  // STATUSOVERLAY_H_
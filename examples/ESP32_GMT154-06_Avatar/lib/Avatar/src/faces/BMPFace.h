@@ -19,7 +19,7 @@ class BMPEye : public Drawable
 {
   void draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx)
   {
-    uint16_t color = ctx->getColorDepth() == 1 ? 1 : ctx->getColorPalette()->get(COLOR_PRIMARY);
+    uint16_t color = ctx->getColor(COLOR_PRIMARY);
     uint16_t cx = rect.getCenterX();
     uint16_t cy = rect.getCenterY();
     float openRatio = ctx->getEyeOpenRatio();
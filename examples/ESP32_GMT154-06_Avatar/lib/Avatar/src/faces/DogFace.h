@@ -18,12 +18,8 @@ class DogEye : public Drawable {
         uint32_t cx = rect.getCenterX();
         uint32_t cy = rect.getCenterY();
         Gaze g = ctx->getLeftGaze();
-        ColorPalette *cp = ctx->getColorPalette();
-        uint16_t primaryColor =
-            ctx->getColorDepth() == 1 ? 1 : cp->get(COLOR_PRIMARY);
-        uint16_t backgroundColor = ctx->getColorDepth() == 1
-                                       ? ERACER_COLOR
-                                       : cp->get(COLOR_BACKGROUND);
+        uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
+        uint16_t backgroundColor = ctx->getColor(COLOR_BACKGROUND);
         uint32_t offsetX = g.getHorizontal() * 8;
         uint32_t offsetY = g.getVertical() * 5;
         float eor = ctx->getLeftEyeOpenRatio();
@@ -58,14 +54,8 @@ class DogMouth : public Drawable {
           minHeight{minHeight},
           maxHeight{maxHeight} {}
     void draw(M5Canvas *spi, BoundingRect rect, DrawContext *ctx) {
-        uint16_t primaryColor =
-            ctx->getColorDepth() == 1
-                ? 1
-                : ctx->getColorPalette()->get(COLOR_PRIMARY);
-        uint16_t backgroundColor =
-            ctx->getColorDepth() == 1
-                ? ERACER_COLOR
-                : ctx->getColorPalette()->get(COLOR_BACKGROUND);
+        uint16_t primaryColor = ctx->getColor(COLOR_PRIMARY);
+        uint16_t backgroundColor = ctx->getColor(COLOR_BACKGROUND);
         uint32_t cx = rect.getCenterX();
         uint32_t cy = rect.getCenterY();
         float openRatio = ctx->getMouthOpenRatio();
@@ -73,7 +63,8 @@ class DogMouth : public Drawable {
         uint32_t w = minWidth + (maxWidth - minWidth) * (1 - openRatio);
         if (h > minHeight) {
             spi->fillEllipse(cx, cy, w / 2, h / 2, primaryColor);
-            spi->fillEllipse(cx, cy, w / 2 - 4, h / 2 - 4, TFT_RED);
+            spi->fillEllipse(cx, cy, w / 2 - 4, h / 2 - 4,
+                             ctx->mapColor(TFT_RED));
             spi->fillRect(cx - w / 2, cy - h / 2, w, h / 2, backgroundColor);
         }
         spi->fillEllipse(cx, cy - 15, 10, 6, primaryColor);
@@ -0,0 +1,99 @@
+// Copyright (c) Shinya Ishikawa. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full
+// license information.
+
+#ifndef M5AVATAR_FACE_DESCRIPTIONS_H_
+#define M5AVATAR_FACE_DESCRIPTIONS_H_
+
+#include "../FaceLoader.h"
+
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+// Descriptions of the faces in FaceTemplates.hpp for FaceLoader.
+// They stay in flash and are only parsed when the face is selected.
+// positions are (top, left) like BoundingRect
+namespace m5avatar {
+
+static const uint8_t DEFAULT_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_MOUTH, 148, 163, 50, 90, 4, 60),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_EYE, 93, 90, 8, 0, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_EYE, 96, 230, 8, 0, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_EYEBLOW, 67, 96, 32, 0, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_EYEBLOW, 72, 230, 32, 0, 0, 0),
+};
+
+static const uint8_t SIMPLE_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_RECT_MOUTH, 148, 163, 50, 90, 4, 60),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_ELLIPSE_EYE, 93, 90, 16, 16, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_ELLIPSE_EYE, 96, 230, 16, 16, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_ELLIPSE_EYEBROW, 67, 96, 0, 0, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_ELLIPSE_EYEBROW, 72, 230, 0, 0, 0,
+             0),
+};
+
+static const uint8_t OMEGA_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_OMEGA_MOUTH, 225, 160, 80, 80, 15, 30),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_ELLIPSE_EYE, 165, 84, 36, 70, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_ELLIPSE_EYE, 165, 238, 36, 70, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_ELLIPSE_EYEBROW, 67, 96, 0, 0, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_ELLIPSE_EYEBROW, 72, 230, 0, 0, 0,
+             0),
+};
+
+static const uint8_t GIRLY_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_USHAPE_MOUTH, 222, 160, 44, 44, 0, 16),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_GIRLY_EYE, 163, 64, 84, 84, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_GIRLY_EYE, 163, 256, 84, 84, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_ELLIPSE_EYEBROW, 107, 102, 36, 20,
+             0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_ELLIPSE_EYEBROW, 107, 218, 36, 20,
+             0, 0),
+};
+
+static const uint8_t GIRLY_FACE2_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_USHAPE_MOUTH, 222, 160, 44, 44, 0, 16),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_GIRLY_EYE, 163, 64, 84, 84, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_GIRLY_EYE, 163, 256, 84, 84, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_BOW_EYEBROW, 163, 64, 160, 160, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_BOW_EYEBROW, 163, 256, 160, 160, 0,
+             0),
+};
+
+static const uint8_t PINK_DEMON_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_USHAPE_MOUTH, 214, 160, 64, 64, 0, 16),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_PINK_DEMON_EYE, 134, 106, 52, 134, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_PINK_DEMON_EYE, 134, 218, 52, 134, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_ELLIPSE_EYEBROW, 67, 96, 15, 0, 0,
+             0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_ELLIPSE_EYEBROW, 72, 230, 15, 0, 0,
+             0),
+};
+
+static const uint8_t DOGGY_FACE_DESC[] PROGMEM = {
+    AVF_HEADER(5, 0),
+    AVF_PART(FACE_SLOT_MOUTH, FACE_PART_DOGGY_MOUTH, 168, 163, 50, 90, 4, 60),
+    AVF_PART(FACE_SLOT_EYE_R, FACE_PART_DOGGY_EYE, 103, 80, 36, 70, 0, 0),
+    AVF_PART(FACE_SLOT_EYE_L, FACE_PART_DOGGY_EYE, 106, 240, 36, 70, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_R, FACE_PART_RECT_EYEBROW, 67, 96, 15, 2, 0, 0),
+    AVF_PART(FACE_SLOT_EYEBROW_L, FACE_PART_RECT_EYEBROW, 72, 230, 15, 2, 0,
+             0),
+};
+
+}  // namespace m5avatar
+
+#endif  // M5AVATAR_FACE_DESCRIPTIONS_H_
@@ -1,7 +1,7 @@
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
 #include <Avatar.h>
-#include <faces/FaceTemplates.hpp>
+#include <faces/FaceDescriptions.h>
 
 // バックライト設定
 #define BACKLIGHT_CHANNEL 0
@@ -126,9 +126,20 @@ unsigned long touchStartTime = 0;
 bool touchDetected = false;
 bool expressionChanged = false;
 
-// 顔の種類変更用
-Face* faces[5];
+// 顔の種類変更用（記述はフラッシュに置き、選択された時だけ読み込む）
+struct FaceEntry {
+  const uint8_t* description;
+  size_t length;
+};
+const FaceEntry faces[] = {
+  {DEFAULT_FACE_DESC, sizeof(DEFAULT_FACE_DESC)},
+  {DOGGY_FACE_DESC, sizeof(DOGGY_FACE_DESC)},
+  {OMEGA_FACE_DESC, sizeof(OMEGA_FACE_DESC)},
+  {GIRLY_FACE_DESC, sizeof(GIRLY_FACE_DESC)},
+  {PINK_DEMON_FACE_DESC, sizeof(PINK_DEMON_FACE_DESC)}
+};
 int faceIndex = 0;
+int loadedFaceIndex = -1;
 const char* faceNames[] = {
   "Default",
   "Doggy",
@@ -136,7 +147,7 @@ const char* faceNames[] = {
   "Girly",
   "PinkDemon"
 };
-const int faceCount = sizeof(faces) / sizeof(Face*);
+const int faceCount = sizeof(faces) / sizeof(faces[0]);
 
 // 色パレット変更用
 ColorPalette* colorPalettes[3];
@@ -160,6 +171,44 @@ const unsigned long faceInterval = 15000; // 15秒ごとに顔切り替え
 unsigned long paletteTimer = 0;
 const unsigned long paletteInterval = 30000; // 30秒ごとに色切り替え
 
+// 顔の切り替えで増えたヒープ（描画タスクが前の顔を解放して新しい顔を描いてから測る）
+uint32_t faceHeapBefore = 0;
+bool faceHeapPending = false;
+
+// 顔を読み込んで切り替える（前の顔のメモリは解放される）
+void loadFace(int index) {
+  if (index == loadedFaceIndex) {
+    return;
+  }
+  // 前の切り替えがまだ終わっていなければ、その前の値から測る
+  if (!faceHeapPending) {
+    faceHeapBefore = ESP.getFreeHeap();
+  }
+  unsigned long start = micros();
+  if (!avatar.loadFace(faces[index].description, faces[index].length)) {
+    Serial.print("Failed to load face: ");
+    Serial.println(faceNames[index]);
+    return;
+  }
+  unsigned long elapsed = micros() - start;
+  loadedFaceIndex = index;
+
+  faceHeapPending = true;
+
+  // 情報表示
+  Serial.printf("Face: %s (load %luus)\n", faceNames[index], elapsed);
+}
+
+// 切り替えが終わっていればヒープの増減を表示
+void reportFaceHeap() {
+  if (!faceHeapPending || avatar.isFaceLoading()) {
+    return;
+  }
+  faceHeapPending = false;
+  Serial.printf("Face heap: %+d bytes\n",
+                (int)(faceHeapBefore - ESP.getFreeHeap()));
+}
+
 void setup() {
   // シリアル通信初期化
   Serial.begin(115200);
@@ -176,13 +225,6 @@ void setup() {
   // LCDの初期化
   M5.begin();
   
-  // 顔の種類を初期化
-  faces[0] = avatar.getFace();  // デフォルトの顔
-  faces[1] = new DoggyFace();
-  faces[2] = new OmegaFace();
-  faces[3] = new GirlyFace();
-  faces[4] = new PinkDemonFace();
-  
   // 色パレットを初期化
   colorPalettes[0] = new ColorPalette();  // デフォルトの色
   colorPalettes[1] = new ColorPalette();
@@ -211,7 +253,7 @@ void setup() {
   avatar.setExpression(expressions[expressionIndex]);  // Happyがデフォルト
   
   // 初期顔を設定
-  avatar.setFace(faces[0]);
+  loadFace(faceIndex);
   
   // 初期色パレットを設定
   avatar.setColorPalette(*colorPalettes[0]);
@@ -272,11 +314,7 @@ void loop() {
     
     // Default顔に固定
     faceIndex = 0; // Default顔のインデックス
-    avatar.setFace(faces[faceIndex]);
-    
-    // 情報表示
-    Serial.print("Face: ");
-    Serial.println(faceNames[faceIndex]);
+    loadFace(faceIndex);
   }
   
   // 色パレットをデフォルトに固定
@@ -305,6 +343,8 @@ void loop() {
     Serial.println(mouthOpenRatio);
   }
   
+  reportFaceHeap();
+
   // 適度な遅延
   delay(50);
 }
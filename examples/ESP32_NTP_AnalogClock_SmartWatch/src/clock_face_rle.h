@@ -0,0 +1,935 @@
+// このファイルは tools/convert_face.py で生成（直接編集しない）
+// 元画像: clock_face.h (240x240)
+// 22004 bytes（非圧縮 115200 bytes）
+#ifndef CLOCK_FACE_RLE_H
+#define CLOCK_FACE_RLE_H
+
+#include "face_decoder.h" // PROGMEM の定義を含む
+
+const uint16_t clockFacePalette[256] PROGMEM = {
+    0x0000,0xBEF7,0xFFFF,0xDFFF,0x00F8,0xFFF7,0xDFF7,0x9EF7,0x7DEF,0x3CE7,0x5DEF,0xFBDE,
+    0x1CE7,0xDBDE,0xF7BD,0xBAD6,0x9AD6,0xBFF7,0x38C6,0x79CE,0xB6B5,0x18C6,0x59CE,0x34A5,
+    0xD7BD,0x75AD,0xEF7B,0xF39C,0x55AD,0x6D6B,0xAE73,0x718C,0x96B5,0xB294,0x00E0,0x3084,
+    0xD39C,0x14A5,0x2C63,0x518C,0x9294,0x1084,0x9EEF,0xCF7B,0x4D6B,0x8E73,0xEB5A,0x5DE7,
+    0x1CDF,0x0C63,0xAA52,0x9ACE,0x00E8,0xCF73,0xDEFF,0x928C,0xDBD6,0x0802,0x694A,0xCB5A,
+    0x0100,0xC701,0xE400,0x149D,0x18BE,0xC0F8,0xBEFF,0x55A5,0x8601,0x59C6,0x5184,0xE801,
+    0xD394,0x4501,0x2501,0x8A52,0x8E6B,0x96AD,0xBDFF,0x9DFF,0x2842,0x7CFF,0xD7B5,0xE739,
+    0xCB52,0xA300,0x107C,0x00F9,0x6601,0xA701,0x0098,0x80F8,0x5BFF,0x0842,0x0C5B,0xB8FE,
+    0xA0F8,0x40F8,0x20F8,0x0401,0x494A,0x8300,0x3BFF,0x1AFF,0x4D63,0x00F0,0x00A8,0x60F8,
+    0xE0F8,0x2902,0x40F9,0x0070,0x7DE7,0x5CFF,0x7EEF,0xBACE,0x8A4A,0x0088,0x00B8,0x0080,
+    0xC400,0x0501,0x20F9,0x0090,0xA631,0x97FE,0x00B0,0x4902,0xFCDE,0xC739,0x3184,0xFAF6,
+    0xD9F6,0xAF73,0x6529,0x6200,0x4529,0x0068,0x00A0,0x4200,0x4922,0x10F5,0x76AD,0xE318,
+    0x083A,0x307C,0xD8FE,0x14FE,0x0078,0x0060,0xD9FE,0x9CFF,0xBEEF,0x6D63,0x4D5B,0x2421,
+    0xF9FE,0x80FA,0x40FA,0x00C8,0x0058,0x0200,0x6300,0x8A2A,0xF8BD,0x8200,0x79C6,0x56FE,
+    0xBBD6,0x3AFF,0xD3FD,0x20FA,0x00F1,0x39C6,0x0030,0x4300,0x0040,0xE701,0x35FE,0x0048,
+    0x00FB,0x38BE,0x728C,0x31F5,0xE0FA,0xF394,0x71FD,0x60FB,0xB7FE,0x491A,0x2200,0x60F9,
+    0x0812,0x40FB,0xCFF4,0xC731,0x3CDF,0xFAFE,0x7DFF,0x51F5,0xEC5A,0x2C5B,0x3DE7,0x91FD,
+    0x15FE,0x2FFD,0x00D0,0xB6AD,0xE0E0,0xE0F9,0xFEFF,0x50FD,0x6E6B,0x20FB,0x7ACE,0x8A32,
+    0x60FA,0x35A5,0xB394,0x7184,0x77FE,0x92FD,0xC0E8,0x1074,0xC0F9,0x0050,0xF3FD,0xADFC,
+    0x6BFC,0x2100,0xEDFC,0xC300,0x96A5,0xF4FD,0x4521,0xAE6B,0x8E63,0x8629,0x1BFF,0x8631,
+    0x4942,0xDEF7,0xCF6B,0xEB52,0xF49C,0x2D63,0x9EFF,0xE0E8,0xAB52,0x98FE,0xB7B5,0xF7B5,
+    0x00FA,0x80E0,0x76FE,0xB3FD,
+};
+
+const uint16_t clockFaceRowOffsets[240] PROGMEM = {
+    0,4,8,12,16,20,41,60,99,155,217,293,375,461,556,658,
+    757,853,957,1058,1155,1250,1339,1427,1513,1612,1708,1813,1916,2009,2103,2204,
+    2313,2410,2522,2629,2717,2816,2918,3055,3181,3299,3426,3541,3656,3803,3924,4028,
+    4151,4263,4375,4511,4637,4763,4873,4974,5067,5168,5271,5367,5466,5568,5678,5775,
+    5860,5955,6053,6158,6266,6373,6488,6609,6709,6811,6919,7020,7127,7224,7314,7418,
+    7519,7613,7705,7791,7877,7960,8039,8119,8211,8288,8366,8423,8500,8568,8627,8698,
+    8772,8832,8891,8978,9056,9122,9190,9272,9332,9387,9464,9534,9586,9654,9751,9808,
+    9864,9928,10020,10095,10181,10262,10350,10428,10524,10633,10779,10859,10942,11038,11112,11182,
+    11265,11344,11405,11468,11560,11640,11699,11767,11846,11912,11974,12045,12119,12178,12245,12321,
+    12398,12458,12522,12600,12671,12729,12798,12875,12938,13023,13099,13176,13260,13347,13427,13492,
+    13577,13671,13750,13843,13934,14022,14122,14214,14310,14410,14509,14618,14730,14849,14969,15067,
+    15159,15258,15358,15447,15558,15659,15754,15842,15936,16032,16120,16211,16313,16413,16529,16655,
+    16783,16894,17017,17121,17237,17380,17496,17607,17724,17854,17977,18128,18227,18322,18410,18502,
+    18603,18704,18800,18906,19002,19091,19191,19293,19394,19484,19579,19667,19751,19836,19927,20021,
+    20118,20221,20321,20421,20516,20607,20695,20768,20842,20903,20947,20963,20996,21000,21004,21008,
+};
+
+const uint8_t clockFaceData[21012] PROGMEM = {
+    0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,0x6A,0x00,0xA4,0x96,
+    0x8E,0x02,0x18,0x05,0x0E,0x01,0x18,0x05,0x0E,0x01,0x18,0x00,0xA4,0x92,0xA0,0x6B,0x00,0x64,0x00,0xA4,0x8A,0x01,0x0F,0x8B,
+    0x88,0x83,0x17,0x02,0x87,0x89,0x8B,0x8D,0x8C,0x92,0x65,0x00,0x5D,0x00,0xAB,0x9A,0xA7,0x89,0x0B,0x02,0x83,0x01,0x02,0x88,
+    0x83,0x82,0xAF,0x91,0x82,0x00,0x96,0xD1,0x82,0xAF,0x01,0x02,0x88,0x01,0x02,0x83,0x0B,0x02,0x87,0xA4,0x9A,0xA9,0xFF,0x08,
+    0x41,0x5D,0x00,0x59,0x00,0xA4,0x98,0x8E,0x89,0x09,0x02,0x89,0x8A,0x82,0x94,0x96,0x82,0xA0,0x8B,0x82,0x9F,0x90,0x82,0x9F,
+    0xC5,0x00,0x97,0xFF,0xE9,0x80,0xFF,0xFD,0x31,0x00,0x98,0xC6,0x8B,0x83,0xB7,0x8B,0x82,0xA5,0x89,0x81,0x97,0x87,0x82,0x8D,
+    0x01,0x02,0x83,0x06,0x02,0x88,0x92,0x95,0xA5,0x5A,0x00,0x56,0x00,0xCB,0x01,0x0C,0x07,0x02,0x88,0x8D,0x82,0x95,0x8E,0x82,
+    0x9C,0x99,0x82,0x9F,0xA8,0x82,0x9B,0x92,0x82,0x9A,0x92,0x82,0xD6,0x00,0xB5,0xD1,0xFF,0xF0,0xE0,0xFF,0xFC,0xF0,0x88,0xB5,
+    0xB8,0x87,0x9E,0x8B,0x87,0xB5,0x89,0x90,0xB2,0x87,0x8C,0x9A,0x83,0xAF,0x9B,0x82,0x87,0x8B,0x07,0x02,0x8A,0x89,0x9F,0x57,
+    0x00,0x52,0x00,0xB1,0xA9,0x01,0x01,0x04,0x02,0x83,0x88,0x82,0x90,0xA3,0x82,0x8D,0x9A,0x82,0x98,0xA8,0x82,0x98,0x9F,0x82,
+    0x99,0xAD,0x83,0x97,0x94,0x82,0xD6,0x8E,0x82,0x9A,0xFF,0xB5,0xF8,0xDC,0xB4,0xFF,0xFC,0xEF,0xF0,0x00,0xEB,0x8D,0x88,0xCC,
+    0x8C,0x89,0x9E,0x87,0x94,0xAC,0x82,0x92,0x9A,0x82,0x92,0x9A,0x82,0x96,0xA5,0x82,0x94,0xA4,0x82,0x83,0x87,0x05,0x02,0x81,
+    0x97,0xB1,0xBA,0x52,0x00,0x4F,0x00,0x9B,0x97,0x8B,0x05,0x02,0x83,0x90,0x83,0x8D,0x9F,0x83,0x8F,0xDD,0x88,0x89,0xAC,0x88,
+    0x90,0x9A,0x82,0x96,0x9A,0x82,0x95,0xB2,0x86,0xCD,0x00,0xD9,0x82,0xC6,0x00,0x8E,0x82,0xFF,0x73,0xEF,0xD2,0xDC,0xB4,0x00,
+    0xC2,0xAF,0x00,0xEC,0x8B,0x89,0xCC,0xAF,0x8D,0x9E,0x83,0x9B,0xB5,0x82,0x00,0x8E,0x9F,0x82,0x99,0x9F,0x82,0x94,0x9C,0x82,
+    0xA7,0xC6,0x82,0xA0,0x97,0x82,0x01,0x0C,0x05,0x02,0x81,0x99,0xA0,0x50,0x00,0x4D,0x00,0x9D,0x90,0x06,0x02,0x8E,0x8A,0x81,
+    0xA9,0x93,0x88,0x9E,0x8D,0x8A,0xB2,0x95,0x87,0x9E,0x90,0x8C,0xAD,0x88,0x8D,0x9D,0x83,0x96,0xFC,0x81,0x98,0xA1,0x82,0xB7,
+    0xBF,0x83,0xFF,0x73,0xEF,0xFF,0xAD,0xB7,0xE6,0xB4,0xFF,0xF4,0xCE,0x89,0x00,0x99,0x8B,0x8D,0xCC,0x88,0x96,0xAD,0x82,0x9F,
+    0x9A,0x82,0x00,0xDA,0x9B,0x82,0xA1,0x97,0x82,0x9B,0x95,0x8A,0xB1,0xA0,0x81,0xA3,0x98,0x82,0xA4,0xA0,0x82,0x95,0x89,0x05,
+    0x02,0x8B,0xA5,0x4E,0x00,0x4A,0x00,0xFC,0x92,0x88,0x05,0x02,0x9B,0x96,0x82,0xA3,0xA0,0x82,0xA8,0xA0,0x83,0x9A,0x94,0x82,
+    0x9D,0xA4,0x82,0xA3,0xA0,0x87,0xAD,0x8F,0x89,0xAC,0x89,0x93,0x00,0xED,0x87,0x95,0xA3,0x82,0xC8,0xA1,0x86,0x9A,0xFF,0xA5,
+    0x76,0x00,0xEE,0xB4,0xFF,0xF4,0xAE,0xB0,0x00,0x9A,0x00,0x80,0xB3,0x9D,0x81,0xC0,0xB5,0x82,0x01,0x23,0x82,0xA9,0x94,0x83,
+    0x9E,0x95,0x81,0xA9,0x01,0x0F,0x00,0x81,0x8F,0x89,0x9D,0x8D,0x88,0xAD,0x90,0x8A,0xAC,0x89,0x83,0x9F,0x8A,0x04,0x02,0x81,
+    0x8A,0xD3,0x4B,0x00,0x47,0x00,0x00,0x81,0xA4,0x92,0x05,0x02,0x01,0x10,0x82,0xA3,0xA7,0x82,0x99,0xA7,0x82,0x94,0xA1,0x82,
+    0x9B,0xA1,0x83,0xA9,0x9A,0x82,0xA4,0xA1,0x81,0xAB,0x98,0x81,0x9D,0x93,0x8D,0x00,0xC3,0xB0,0x93,0xA7,0x83,0xCD,0xBF,0x83,
+    0x97,0xFF,0xB5,0xF8,0xE7,0xB4,0xFF,0xF4,0x8D,0x00,0xC4,0xFF,0x8C,0xB2,0x8A,0x90,0xB7,0x83,0x8E,0xB7,0x82,0x9E,0x9B,0x81,
+    0xB1,0x96,0x8A,0xBB,0x90,0x8C,0x9D,0x8C,0x92,0x00,0x81,0x8C,0x90,0x9D,0x88,0x90,0xAD,0x88,0x92,0x9E,0x82,0x93,0xDD,0x87,
+    0x81,0xA0,0x83,0x04,0x02,0x90,0x9B,0x9A,0x48,0x00,0x46,0x00,0x92,0x8B,0x04,0x02,0x88,0xA0,0x82,0x90,0xA7,0x83,0x96,0xDD,
+    0x8A,0x8B,0xAC,0x89,0x8C,0x9A,0x87,0x95,0xAC,0x88,0x94,0xD0,0x8A,0xA0,0x9A,0xAA,0x9F,0x9C,0x82,0x9C,0x8F,0x8A,0xAE,0x96,
+    0x81,0x8C,0x83,0x01,0x2A,0x82,0x81,0x85,0x00,0xC5,0xA2,0xFF,0xEC,0x6C,0x82,0x81,0x82,0x81,0x88,0x82,0x8A,0x89,0x83,0x9D,
+    0x8E,0x87,0xA4,0x89,0x8D,0xAE,0x8C,0x93,0xA6,0x89,0xA4,0x9D,0x81,0x9C,0xA7,0x82,0x9C,0x9F,0x82,0xA8,0x97,0x82,0x00,0x82,
+    0xA3,0x82,0x98,0xA3,0x82,0x8F,0x92,0x04,0x02,0x81,0x90,0x47,0x00,0x43,0x00,0x00,0xA5,0x97,0x89,0x03,0x02,0x83,0x94,0x87,
+    0x81,0x9D,0x8F,0x81,0xAD,0x8D,0x87,0xBA,0x8E,0x83,0xAB,0x95,0x83,0xAB,0x8B,0x89,0xB2,0x8D,0x8F,0x80,0x90,0x8C,0x94,0x87,
+    0x01,0x0A,0x83,0x81,0x83,0x81,0x9E,0xA0,0x07,0x02,0x00,0x83,0xA2,0xFF,0xEC,0x4C,0x07,0x02,0x87,0xA6,0x90,0x82,0x81,0x83,
+    0x87,0x8C,0x83,0x8F,0x94,0x88,0xAC,0xA1,0x82,0xA9,0xA0,0x83,0x9A,0x98,0x87,0xA6,0x8D,0x88,0xD0,0x95,0x82,0x9A,0x8E,0x82,
+    0xA4,0x95,0x82,0x92,0x8D,0x03,0x02,0x81,0x90,0x00,0x8F,0x44,0x00,0x41,0x00,0xE4,0xA4,0x83,0x03,0x02,0xA0,0x8D,0x82,0xC6,
+    0x94,0x82,0x97,0xA1,0x82,0x01,0x1B,0x82,0xA8,0xAD,0x82,0x9C,0xA3,0x82,0xA4,0x99,0x83,0x9C,0x8B,0x87,0xBA,0x98,0x01,0x02,
+    0x83,0x82,0x03,0x03,0x82,0xA9,0xA5,0x01,0x02,0x01,0x03,0x03,0x02,0x00,0x83,0xA2,0xFF,0xEC,0x4C,0x03,0x02,0x02,0x03,0x82,
+    0x8A,0xB1,0x8D,0x82,0x01,0x03,0x01,0x02,0x83,0x01,0x02,0x89,0xAE,0x95,0x83,0x99,0x89,0x8B,0xE8,0x8A,0x93,0x9D,0x83,0x94,
+    0x00,0xEF,0x87,0x90,0xB1,0x88,0x8B,0xA9,0x88,0x8C,0xAD,0x8D,0x81,0xA0,0x8C,0x03,0x02,0xA0,0xAB,0x42,0x00,0x40,0x00,0x92,
+    0x8A,0x02,0x02,0x8A,0x8B,0x82,0x00,0xB6,0xA3,0x82,0x92,0xAB,0x81,0x8D,0xA6,0x8C,0x90,0x9D,0x8A,0x92,0xFC,0x8D,0x8F,0x9A,
+    0x88,0x8C,0x8D,0x83,0x81,0x83,0x82,0x9A,0xA1,0x08,0x03,0xB7,0xA8,0x01,0x02,0x02,0x03,0x02,0x02,0x00,0x83,0xA2,0xFF,0xEC,
+    0x4C,0x02,0x02,0x03,0x03,0x82,0x8B,0x9D,0x8B,0x82,0x05,0x03,0x82,0x93,0xBB,0x8C,0x82,0x81,0x83,0x8A,0x90,0x82,0x98,0x9C,
+    0x81,0x9E,0xA9,0x83,0xA4,0x9F,0x82,0x9C,0xA8,0x82,0x99,0xA3,0x83,0x95,0xBA,0x89,0x83,0x8D,0x03,0x02,0x90,0xFF,0x19,0x25,
+    0x40,0x00,0x3E,0x00,0x94,0x88,0x02,0x02,0x81,0x82,0x90,0xD6,0x87,0x90,0x00,0xEF,0x8F,0x87,0xB1,0x92,0x83,0xAD,0x94,0x88,
+    0xAC,0x95,0x88,0xDD,0xA0,0x82,0x8C,0x81,0x82,0x03,0x03,0x82,0xA5,0x9D,0x87,0x07,0x03,0x96,0x92,0x04,0x03,0x02,0x02,0x00,
+    0x83,0xA2,0xFF,0xEC,0x4C,0x01,0x02,0x04,0x03,0x82,0x8A,0x8E,0x88,0x06,0x03,0x82,0x99,0xA6,0x87,0x82,0x03,0x03,0x82,0x8A,
+    0x87,0x8C,0x00,0x8F,0x98,0x88,0xAE,0x95,0x81,0x9D,0x98,0x87,0xAD,0x8E,0x83,0x9E,0x9F,0x82,0x8E,0x9F,0x04,0x02,0x83,0x00,
+    0x80,0x3F,0x00,0x3C,0x00,0xAB,0x04,0x02,0x81,0xA8,0x8B,0x82,0xD6,0x93,0x82,0xA6,0xA8,0x82,0xA4,0xC6,0x82,0x9C,0xA9,0x87,
+    0x99,0xA0,0x83,0xA8,0xA3,0x81,0x82,0x05,0x03,0x82,0x96,0xAC,0x8A,0x83,0x01,0x06,0x91,0x01,0x06,0x08,0x03,0x02,0x02,0xD1,
+    0xFF,0xEB,0xE9,0xFF,0xF5,0xD4,0x02,0x02,0x07,0x03,0x01,0x06,0x02,0x01,0x86,0x01,0x03,0x9B,0xA1,0x81,0x06,0x03,0x82,0x8E,
+    0xBA,0x89,0x8B,0x9F,0x88,0x93,0xBB,0x8A,0x92,0xAC,0x87,0x90,0x00,0x81,0x8F,0x81,0xAB,0x95,0x82,0x9B,0xB3,0x04,0x02,0xA0,
+    0x3D,0x00,0x3A,0x00,0x00,0xF0,0xB3,0x03,0x02,0x92,0x8B,0x82,0x9B,0xC8,0x82,0x92,0xA7,0x82,0x98,0xFC,0x89,0x8B,0xBA,0x8D,
+    0x8C,0xA4,0x88,0x01,0x07,0x82,0x95,0xCB,0x8B,0x82,0x06,0x03,0x88,0xB3,0x87,0x06,0x01,0x86,0x06,0x03,0x03,0x02,0xCF,0xC2,
+    0x02,0x02,0x06,0x03,0x86,0x07,0x01,0x8D,0x8B,0x83,0x86,0x06,0x03,0x9F,0xA9,0x82,0x81,0x88,0x82,0x8E,0x97,0x81,0xA3,0x97,
+    0x82,0xA7,0x9E,0x82,0x8E,0x9E,0x83,0xB3,0xE8,0x87,0x83,0x8E,0x81,0x02,0x02,0x8D,0xA7,0x3B,0x00,0x39,0x00,0x8B,0xAF,0x01,
+    0x02,0x00,0xC6,0x00,0x84,0x82,0xD2,0x00,0xDB,0x86,0x89,0xE8,0xB8,0x82,0xDE,0xB3,0x82,0xDD,0x97,0x82,0xA1,0x8E,0x82,0x87,
+    0x02,0x03,0x82,0x89,0xB2,0x94,0x02,0x03,0x0F,0x01,0x05,0x03,0x0A,0x02,0x04,0x03,0x86,0x0F,0x01,0x86,0x01,0x03,0x8C,0xB2,
+    0x8E,0x82,0x02,0x03,0x87,0x86,0x89,0x9F,0x89,0x8B,0x00,0x9B,0x93,0x81,0xB5,0x8E,0x82,0xC6,0xCD,0x82,0x98,0xD6,0x82,0xF1,
+    0x00,0x84,0x01,0x02,0x83,0x89,0xFF,0x08,0xC3,0x39,0x00,0x37,0x00,0x9D,0x8F,0x03,0x02,0xFF,0xF5,0xF5,0xA2,0x00,0xDC,0x81,
+    0xB5,0xC0,0x82,0x9B,0xA8,0x82,0x97,0xA3,0x82,0x99,0xBA,0x8A,0x81,0x87,0x83,0x82,0x04,0x03,0xA8,0x9B,0x81,0x83,0x10,0x01,
+    0x86,0x03,0x03,0x0C,0x02,0x03,0x03,0x86,0x11,0x01,0x83,0x90,0x9D,0x89,0x82,0x03,0x03,0x82,0x81,0x88,0x83,0x00,0xDA,0xA6,
+    0x87,0x8E,0x9D,0x87,0x8F,0xCC,0xF2,0x88,0x00,0x99,0x00,0xA6,0xCE,0xFF,0xEA,0xE0,0xFF,0xE3,0x45,0x03,0x02,0xAA,0x9A,0x38,
+    0x00,0x35,0x00,0xD0,0x99,0x03,0x02,0xC5,0xB0,0x00,0xEE,0xFF,0xE9,0x00,0xFF,0xEB,0x00,0xCF,0xC0,0x00,0x85,0x88,0xB0,0xDE,
+    0xB3,0x89,0xE8,0x8B,0x87,0xB2,0x98,0x01,0x02,0x06,0x03,0x89,0x8C,0x12,0x01,0x86,0x01,0x03,0x01,0x02,0x8B,0x9B,0xC6,0x9B,
+    0x8D,0x02,0x02,0x90,0xC8,0xA7,0x9C,0x89,0x82,0x02,0x03,0x86,0x11,0x01,0x83,0x88,0x8B,0x81,0x06,0x03,0x82,0x8C,0xAE,0x98,
+    0x81,0xA7,0x99,0x86,0x00,0xDA,0x99,0x82,0x97,0xD6,0x00,0xF1,0x00,0xC7,0xB4,0x00,0xDD,0x82,0x96,0x88,0x02,0x02,0x90,0xFF,
+    0x4A,0x6A,0x36,0x00,0x34,0x00,0xA8,0xB0,0x02,0x02,0x81,0x82,0x94,0xD6,0x87,0x00,0xB7,0xA2,0xFF,0xF5,0x71,0x88,0x00,0xF2,
+    0x99,0x82,0xC8,0x00,0x82,0x87,0x8B,0x88,0x82,0xA5,0x9E,0x88,0x82,0x03,0x03,0x17,0x01,0x02,0x03,0x82,0x8D,0x04,0x00,0x8D,
+    0x82,0x96,0x03,0x00,0xCB,0x8A,0x82,0x01,0x03,0x86,0x13,0x01,0x83,0x02,0x01,0x86,0x04,0x03,0x99,0x00,0xC8,0x8A,0x83,0x8B,
+    0x87,0x8F,0xE8,0x01,0x0C,0x00,0xF3,0xB3,0xE6,0x00,0xDE,0xFF,0xEA,0x60,0xCF,0xFF,0xC6,0x7A,0xB5,0x91,0x82,0x81,0x01,0x02,
+    0x88,0x95,0x35,0x00,0x32,0x00,0xD3,0xA1,0x83,0x02,0x02,0x8B,0xA9,0xAF,0x83,0x9A,0x00,0xA4,0xF1,0xFF,0xEA,0xA0,0xB4,0x00,
+    0x96,0xC5,0x00,0xC9,0x8B,0x00,0xCA,0xC5,0x81,0x02,0x02,0x8C,0xE4,0x8E,0x82,0x01,0x03,0x19,0x01,0x01,0x03,0x82,0x87,0xCB,
+    0x01,0x00,0xA4,0x01,0x00,0xA6,0x88,0x00,0x86,0x80,0xBA,0xB7,0x01,0x00,0xFF,0x83,0xEF,0x83,0x82,0x83,0x86,0x19,0x01,0x01,
+    0x03,0x82,0x8C,0xB1,0x99,0x82,0x83,0x01,0x02,0x8C,0x93,0x81,0xB7,0xFF,0x8C,0xB2,0xB6,0xFF,0xEC,0x2B,0xA2,0x00,0xA7,0xFF,
+    0xE7,0x7E,0xCC,0xC0,0x82,0x97,0xA0,0x03,0x02,0x95,0xB2,0x33,0x00,0x31,0x00,0xBB,0x87,0x02,0x02,0xC5,0xAF,0x82,0xC8,0x9F,
+    0x82,0xB0,0x00,0xEB,0xFF,0xDF,0x5D,0xFF,0xF6,0x56,0xA2,0xFF,0xEC,0x09,0xFF,0xF7,0x9D,0xD2,0x8F,0x03,0x02,0x83,0x01,0x02,
+    0xC3,0x94,0x01,0x03,0x19,0x01,0x86,0x01,0x03,0x82,0x8C,0x01,0x00,0xC3,0x8D,0x02,0x00,0x8E,0x01,0x00,0xB3,0x95,0x02,0x00,
+    0x88,0x82,0x83,0x86,0x91,0x19,0x01,0x01,0x03,0x8D,0xA4,0x8A,0x82,0x01,0x03,0x02,0x02,0xAA,0xCD,0xF0,0xFF,0xFE,0x36,0xA2,
+    0xFF,0xEC,0x6B,0x82,0x00,0xF4,0x00,0xDB,0x82,0x92,0x9D,0x88,0x82,0x96,0x81,0x02,0x02,0xA1,0x32,0x00,0x30,0x00,0x9C,0x88,
+    0x03,0x02,0x99,0x00,0x82,0x91,0x81,0xA6,0xC0,0x82,0xB7,0xFF,0x94,0xF4,0x81,0xFF,0xEC,0x08,0xA2,0xFF,0xF6,0x15,0x04,0x02,
+    0x03,0x03,0x81,0x87,0x83,0x86,0x19,0x01,0x86,0x01,0x03,0x82,0x8F,0x01,0x00,0x9E,0x03,0x00,0xA9,0x01,0x00,0x00,0x85,0x03,
+    0x00,0x8D,0x82,0x83,0x01,0x06,0x19,0x01,0x86,0x83,0x81,0x87,0x03,0x03,0x04,0x02,0xFF,0xF7,0x7C,0xFF,0xE9,0xC0,0xA2,0xF1,
+    0xF3,0xFF,0x4A,0xCB,0xAF,0x88,0x9D,0x92,0x82,0x8E,0xAB,0x81,0x03,0x02,0x98,0x31,0x00,0x2F,0x00,0x89,0x83,0x01,0x02,0x8B,
+    0x9F,0xAA,0x82,0x9E,0xA0,0x82,0x96,0xAE,0xAF,0x8C,0xFF,0x53,0x0C,0xF3,0x00,0xC5,0xA2,0xFF,0xEA,0x60,0xF1,0x02,0x02,0x06,
+    0x03,0x86,0x1A,0x01,0x01,0x06,0x83,0x82,0x8F,0x03,0x00,0x9F,0x01,0x00,0xA3,0x02,0x00,0x00,0x90,0xE8,0x01,0x00,0x8B,0x82,
+    0x83,0x01,0x06,0x19,0x01,0x91,0x07,0x03,0x03,0x02,0xFF,0xF5,0x0F,0xA2,0x00,0xC7,0x00,0x98,0xFF,0x6B,0xAF,0xC3,0x82,0x99,
+    0x00,0x82,0x82,0x8B,0xE8,0x90,0x82,0xA0,0x9C,0x02,0x02,0x81,0xD3,0x2F,0x00,0x2D,0x00,0xFF,0x08,0x61,0x8F,0x01,0x02,0x83,
+    0x82,0x83,0xA6,0xA1,0x82,0x8D,0xD4,0x8F,0x82,0xA7,0x9F,0x81,0x93,0xB8,0x82,0xFF,0xEC,0xEF,0xA2,0xFF,0xED,0x30,0x83,0x01,
+    0x02,0x06,0x03,0x86,0x19,0x01,0x02,0x06,0x83,0x82,0x8C,0x02,0x00,0x89,0xCD,0x01,0x00,0xC0,0x01,0x00,0xD4,0x88,0xA9,0x01,
+    0x00,0xAA,0x82,0x83,0x02,0x06,0x18,0x01,0x86,0x07,0x03,0x02,0x02,0x00,0x84,0xA2,0xFF,0xE1,0xA0,0xD1,0xAA,0x8E,0xF2,0x00,
+    0xA8,0x00,0xF5,0x8B,0x81,0x9A,0xBF,0x82,0x96,0x00,0x81,0x96,0x82,0x83,0x01,0x02,0x81,0xA6,0x2E,0x00,0x2C,0x00,0x92,0x8B,
+    0x02,0x02,0x96,0xA4,0x81,0x8D,0xFF,0x21,0x25,0x94,0x82,0xC3,0x9D,0xAA,0x8C,0x9E,0x8C,0x02,0x02,0xFF,0xF7,0x3B,0xFF,0xE1,
+    0x20,0xA2,0x00,0x84,0x02,0x02,0x06,0x03,0x86,0x17,0x01,0x91,0x02,0x06,0x83,0x82,0xAA,0xFF,0x3A,0x69,0x01,0x00,0x00,0xD9,
+    0x01,0x00,0x00,0x99,0x88,0xCA,0x80,0xFF,0x3A,0x49,0x97,0x01,0x00,0x00,0x91,0x01,0x02,0x83,0x02,0x06,0x91,0x17,0x01,0x86,
+    0x06,0x03,0x02,0x02,0xC2,0xFF,0xEC,0x2A,0xA2,0xFF,0xF5,0xD4,0x03,0x02,0x00,0xD9,0xBF,0x82,0xC3,0xAC,0x87,0x89,0xBA,0x9B,
+    0x82,0xB3,0xA5,0x02,0x02,0x83,0x95,0x2D,0x00,0x2B,0x00,0x96,0x81,0x01,0x02,0x81,0x82,0x87,0x9E,0xA0,0x82,0x99,0x00,0x8F,
+    0x8D,0x83,0xAC,0x9B,0x83,0x88,0x91,0x03,0x02,0xFF,0xF5,0x72,0xA2,0xFF,0xEC,0x4B,0xC2,0x02,0x02,0x05,0x03,0x86,0x16,0x01,
+    0x04,0x06,0x02,0x02,0xB3,0x04,0x00,0x00,0xA8,0x82,0x8E,0x03,0x00,0xFF,0x21,0xE7,0xAF,0x01,0x02,0x85,0x04,0x06,0x15,0x01,
+    0x86,0x05,0x03,0x04,0x02,0xFF,0xF6,0x77,0xA2,0xFF,0xEB,0x00,0xB6,0x03,0x02,0xF2,0x86,0xB3,0xF4,0x8F,0x83,0x9A,0xA6,0x83,
+    0x8A,0x9D,0x8E,0x82,0x81,0x02,0x02,0x8A,0x2C,0x00,0x2A,0x00,0x98,0x03,0x02,0xA8,0x9C,0x82,0x00,0x80,0x9D,0x8D,0x82,0xAB,
+    0xAE,0x87,0x8B,0x94,0x81,0x05,0x02,0x00,0xF6,0xFF,0xEB,0x20,0x00,0xF7,0x00,0xEE,0x04,0x02,0x01,0x01,0x02,0x03,0x86,0x13,
+    0x01,0x91,0x04,0x06,0x01,0x05,0x02,0x02,0xB3,0xFF,0x7C,0x31,0x00,0x9A,0xFF,0x7C,0x71,0xF3,0x02,0x02,0x00,0xB5,0x00,0xDF,
+    0xFF,0x5B,0x6E,0xFF,0x8C,0xD3,0x00,0xC4,0x02,0x02,0x01,0x05,0x05,0x06,0x12,0x01,0x86,0x03,0x03,0x07,0x02,0xFF,0xF4,0x6C,
+    0xB4,0xFF,0xF6,0xB8,0x06,0x02,0x90,0xC0,0x82,0xC3,0xFF,0x19,0x04,0x8B,0x83,0xA7,0xA1,0x82,0x8D,0xAD,0x89,0x02,0x02,0x8C,
+    0x2B,0x00,0x29,0x00,0x94,0x01,0x02,0x83,0x8C,0x82,0x8C,0xA6,0x8E,0x82,0x98,0x9D,0x01,0x08,0x00,0x81,0x9B,0x02,0x02,0x02,
+    0x03,0x03,0x02,0xE7,0xFF,0xF6,0x36,0xC2,0x03,0x02,0x90,0x00,0x85,0xA5,0x81,0x82,0x01,0x03,0x86,0x0F,0x01,0x91,0x06,0x06,
+    0x02,0x05,0x04,0x02,0x85,0x06,0x02,0x85,0x03,0x02,0x03,0x05,0x07,0x06,0x91,0x0D,0x01,0x01,0x06,0x01,0x03,0x82,0x91,0x8B,
+    0x98,0x8E,0x87,0x03,0x02,0x00,0x84,0xFF,0xF6,0x57,0x83,0x01,0x02,0x04,0x03,0x01,0x02,0x93,0xFF,0x10,0xC3,0x98,0x82,0x97,
+    0xAD,0x87,0x88,0x9D,0x98,0x82,0x88,0x8A,0x01,0x02,0x8C,0x2A,0x00,0x28,0x00,0x98,0x02,0x02,0x87,0xAB,0x92,0x82,0x93,0xAE,
+    0x90,0x83,0xA3,0x9F,0x83,0x90,0x00,0x90,0xC5,0x82,0x04,0x03,0x07,0x02,0x88,0xA8,0x02,0x00,0x89,0x82,0x01,0x03,0x01,0x06,
+    0x0A,0x01,0x91,0x08,0x06,0x05,0x05,0x10,0x02,0x05,0x05,0x08,0x06,0x91,0x09,0x01,0x01,0x06,0x01,0x03,0x82,0x81,0xA1,0x02,
+    0x00,0xFF,0x08,0x00,0x8F,0x07,0x02,0x04,0x03,0x82,0x89,0x9D,0xA1,0x83,0x8E,0xB2,0x8F,0x82,0x01,0x21,0x82,0x88,0x9A,0x92,
+    0x02,0x02,0x8A,0x29,0x00,0x26,0x00,0xD0,0x92,0x01,0x02,0x8D,0x96,0x82,0x8B,0xA6,0x95,0x82,0x95,0xBB,0x8F,0x8A,0x9B,0x8B,
+    0x82,0x98,0x00,0x90,0x90,0x82,0x03,0x03,0x06,0x02,0xA4,0x02,0x00,0x9A,0x90,0x88,0x86,0x82,0x01,0x03,0x02,0x06,0x91,0x03,
+    0x01,0x91,0x09,0x06,0x08,0x05,0x10,0x02,0x09,0x05,0x08,0x06,0x04,0x11,0x03,0x06,0x01,0x03,0x82,0xA1,0x01,0x00,0x00,0x90,
+    0x00,0xA5,0x01,0x00,0x89,0x06,0x02,0x04,0x03,0x8A,0x01,0x1A,0x81,0x87,0x9C,0x92,0x81,0x9B,0xA9,0x83,0x8A,0x9D,0x9C,0x82,
+    0x8C,0x8E,0x01,0x02,0x8A,0xAE,0x27,0x00,0x25,0x00,0x9F,0x8B,0x02,0x02,0x90,0xE4,0x98,0x82,0x96,0xAE,0x96,0x82,0x97,0xA9,
+    0x87,0x81,0x83,0x82,0x83,0xB7,0xAD,0x88,0x03,0x03,0x03,0x02,0x87,0x8A,0x82,0x00,0xF8,0x01,0x00,0x8E,0x97,0xD4,0xFF,0x08,
+    0x41,0x9B,0x88,0x82,0x83,0x0E,0x06,0x0C,0x05,0x01,0x02,0x85,0x0A,0x02,0x85,0x01,0x02,0x0D,0x05,0x0D,0x06,0x83,0x82,0xB0,
+    0x01,0x00,0xA9,0x8C,0xA0,0x01,0x00,0xB3,0x82,0x8D,0x8B,0x03,0x02,0x04,0x03,0xA0,0xBB,0x8C,0x82,0x83,0x81,0x83,0x8E,0xBB,
+    0x8B,0x87,0xAB,0xA8,0x82,0x8C,0xAE,0xA4,0x02,0x02,0x88,0x9B,0x26,0x00,0x24,0x00,0x97,0x8A,0x01,0x02,0x8C,0x8B,0x82,0x94,
+    0x00,0x81,0x95,0x82,0xA0,0xAE,0x8F,0x87,0x92,0x88,0x82,0x01,0x03,0x82,0x8A,0x98,0x88,0x03,0x03,0x01,0x02,0x83,0x93,0xCB,
+    0xDD,0x8C,0xD2,0x01,0x00,0xBB,0x03,0x00,0xA3,0x81,0x82,0x0A,0x06,0x0F,0x05,0x82,0x00,0x97,0xDC,0xE7,0xFF,0xFE,0xF8,0x01,
+    0x5F,0x00,0xF9,0xFF,0xFE,0x78,0xFF,0xFE,0x78,0xFF,0xFE,0x78,0xFF,0xFE,0x78,0x00,0xF9,0xDF,0x00,0x92,0x00,0x9C,0x00,0xA9,
+    0xD1,0xB6,0x0F,0x05,0x09,0x06,0x83,0x01,0x02,0xA1,0x01,0x00,0xDD,0xD0,0x02,0x00,0x92,0x8B,0x00,0x87,0x80,0x99,0x87,0x01,
+    0x02,0x03,0x03,0x86,0x93,0x90,0x82,0x01,0x03,0x82,0x83,0x93,0x8F,0x81,0xB7,0x9A,0x81,0x8A,0xFF,0x6B,0x2D,0x9E,0x01,0x03,
+    0x93,0x01,0x02,0x81,0x98,0x25,0x00,0x23,0x00,0xA8,0x81,0x02,0x02,0x8F,0x9E,0x8D,0x82,0xA5,0xD3,0x93,0x83,0x9B,0xA3,0x88,
+    0x82,0x0A,0x03,0x82,0x83,0x8D,0x9A,0x02,0x00,0x8B,0xAA,0xE5,0x02,0x00,0x00,0xF4,0xFF,0x4A,0x6A,0x01,0x00,0x8B,0x82,0x85,
+    0x05,0x06,0x0C,0x05,0x00,0xF1,0xC2,0xF1,0xDF,0x00,0xAA,0xFF,0xFD,0x2E,0xFF,0xFC,0x4A,0xFF,0xFB,0x63,0x00,0x9D,0xFF,0xF9,
+    0xA0,0xEB,0x0B,0x04,0xEE,0x00,0xAB,0x00,0xB8,0xFF,0xFB,0xC7,0xFF,0xFC,0xCC,0x00,0xCB,0x00,0xA7,0x00,0xEE,0xCF,0xB6,0x0D,
+    0x05,0x03,0x06,0x85,0x01,0x02,0xAA,0x07,0x00,0x8D,0x9A,0x02,0x00,0x00,0x88,0x95,0x81,0x82,0x0B,0x03,0x82,0x8E,0xB1,0x8A,
+    0x87,0xAB,0xA6,0x87,0x83,0xA4,0xA7,0x02,0x02,0x83,0x98,0x24,0x00,0x22,0x00,0xAD,0x87,0x01,0x02,0x8C,0x8A,0x82,0x98,0xAD,
+    0x8B,0x83,0xA1,0xDD,0x8F,0x87,0x90,0x87,0x0B,0x03,0x82,0x95,0x02,0x00,0x00,0x85,0x93,0x88,0x82,0x97,0x01,0x00,0xC5,0x82,
+    0xB8,0x01,0x00,0xC5,0x01,0x02,0x0E,0x05,0x00,0xF1,0xE6,0x00,0xA7,0xFF,0xFD,0x72,0xFF,0xFC,0x2A,0x00,0xB8,0xE0,0x1B,0x04,
+    0x00,0x9E,0xFF,0xFB,0xA5,0xFF,0xFC,0xF0,0x00,0xCC,0x00,0x92,0xD1,0x0E,0x05,0x01,0x02,0xAA,0xBC,0x80,0xA1,0x89,0x97,0x01,
+    0x00,0xA1,0x94,0x01,0x00,0x9A,0x02,0x00,0x99,0x82,0x02,0x03,0x03,0x06,0x04,0x03,0x82,0x01,0x0B,0x87,0xA3,0xE4,0x89,0x83,
+    0x9B,0xAB,0x88,0x83,0x8B,0x01,0x02,0x81,0x9F,0x23,0x00,0x22,0x00,0x8D,0x02,0x02,0x92,0x9E,0x8B,0x82,0x97,0x9D,0x8C,0x87,
+    0x9A,0xBA,0x8B,0x82,0x04,0x03,0x86,0x02,0x01,0x86,0x02,0x03,0x82,0xA4,0x01,0x00,0xBF,0x94,0xA6,0xFF,0x19,0x25,0x9F,0x93,
+    0x9F,0x00,0xFA,0xB3,0x8C,0x00,0x82,0x01,0x00,0x89,0x01,0x02,0x0B,0x05,0xD1,0xFD,0x00,0xCD,0xFF,0xFB,0xC7,0x00,0xE0,0x25,
+    0x04,0x00,0xB8,0xFF,0xFC,0x8C,0x00,0x93,0x00,0xA9,0xB6,0x0A,0x05,0x02,0x02,0x00,0x9A,0x80,0xFF,0x3A,0x69,0x9F,0x01,0x00,
+    0xFF,0x29,0xC7,0x92,0x02,0x00,0x9B,0x92,0x9A,0x80,0x9C,0x82,0x01,0x03,0x86,0x91,0x03,0x01,0x86,0x03,0x03,0x82,0x81,0xA8,
+    0xFF,0x08,0x61,0x8F,0x83,0xA4,0xAC,0x8A,0x82,0xA5,0xA1,0x02,0x02,0x87,0x00,0xEF,0x22,0x00,0x21,0x00,0x92,0x01,0x02,0x87,
+    0x83,0x82,0x9C,0xA6,0x8B,0x83,0xA1,0x9D,0x8C,0x8A,0x01,0x1E,0x89,0x02,0x03,0x86,0x05,0x01,0x86,0x01,0x03,0x82,0x8D,0x01,
+    0x00,0xB1,0x03,0x00,0xA3,0x88,0x00,0x85,0x03,0x00,0xFF,0x9D,0x35,0x02,0x02,0x08,0x05,0xD1,0xFF,0xFE,0x55,0xFF,0xFC,0x8B,
+    0x00,0xAB,0x2C,0x04,0xC1,0xFF,0xFB,0xA3,0x00,0xCB,0xE7,0x00,0xF1,0x07,0x05,0x02,0x02,0xB3,0x04,0x00,0x00,0xA8,0x8C,0xF4,
+    0x02,0x00,0xCB,0xFF,0xE6,0xFB,0x8A,0x88,0x02,0x03,0x86,0x06,0x01,0x02,0x03,0x81,0x99,0xDD,0x96,0x83,0xA5,0xBB,0x8C,0x82,
+    0x99,0xAB,0x8A,0x82,0x88,0x01,0x02,0x8A,0xFF,0x21,0x04,0x21,0x00,0x20,0x00,0x98,0x02,0x02,0x94,0x9F,0x88,0x82,0x97,0xAD,
+    0x89,0x87,0x9F,0xA5,0x83,0x8A,0xAD,0xA3,0x89,0x83,0x07,0x01,0x91,0x02,0x03,0x86,0xAB,0x02,0x00,0xA1,0xA3,0x01,0x00,0xB8,
+    0x00,0xB9,0x01,0x00,0xFF,0x2A,0x69,0x00,0xFB,0x85,0x02,0x02,0x05,0x05,0xCF,0xFD,0xFF,0xFC,0xAC,0x00,0xFC,0x33,0x04,0xFF,
+    0xFB,0xC4,0x00,0xAA,0xE7,0xB6,0x04,0x05,0x03,0x02,0xB8,0x00,0xDB,0xFF,0x63,0x6E,0x00,0xB9,0xB0,0xC5,0xB5,0xCD,0x8F,0x8E,
+    0x01,0x00,0xA8,0x01,0x02,0x01,0x03,0x86,0x08,0x01,0x91,0x83,0x8E,0xD3,0x96,0x82,0x90,0x9D,0x8D,0x82,0x99,0xB1,0x8C,0x82,
+    0x94,0xA3,0x87,0x01,0x02,0x8C,0x21,0x00,0x1F,0x00,0x94,0x01,0x02,0x88,0x82,0x81,0x9F,0x9A,0x89,0x82,0x9B,0x9E,0x8C,0x87,
+    0x89,0x83,0x82,0x8C,0xB1,0xA5,0x87,0x83,0x07,0x01,0x86,0x01,0x03,0x82,0xFF,0xD6,0x79,0x01,0x00,0xC6,0x82,0x86,0x01,0x00,
+    0xC0,0x82,0x01,0x30,0xAA,0x04,0x02,0x02,0x05,0x82,0xE7,0x00,0xBA,0xFF,0xFB,0x44,0x12,0x04,0xC1,0xEC,0x00,0xAC,0xFF,0xE9,
+    0x00,0x00,0xFD,0xFF,0xD8,0x00,0x00,0xCE,0x04,0x9F,0x01,0xCE,0xFF,0xD8,0x20,0x00,0xDE,0x00,0xAC,0x01,0x57,0xE1,0x11,0x04,
+    0xFF,0xF9,0x80,0xFF,0xFC,0x4B,0x00,0xFE,0xCE,0x02,0x05,0x05,0x02,0x86,0x01,0x02,0x00,0xCF,0x01,0x00,0x88,0x82,0xFF,0x42,
+    0x69,0x80,0xFF,0x18,0xC3,0x01,0x02,0x01,0x03,0x86,0x08,0x01,0x83,0x8B,0xAC,0x94,0x01,0x03,0x88,0x89,0x81,0x9C,0xBB,0x8D,
+    0x83,0x99,0xAC,0x8D,0x82,0x88,0x01,0x02,0x8C,0x20,0x00,0x1E,0x00,0x98,0x8A,0x01,0x02,0x9F,0xA8,0x81,0x83,0xA1,0x9E,0x8C,
+    0x87,0xA7,0x9C,0x83,0x82,0x02,0x03,0x8D,0x93,0x87,0x08,0x01,0x01,0x06,0x83,0x82,0x81,0x97,0xA1,0x00,0xAD,0x8F,0x94,0x01,
+    0x00,0xB0,0x09,0x02,0x83,0xDF,0xFF,0xFC,0x6A,0xEE,0x10,0x04,0x00,0xAC,0xFF,0xD1,0x40,0xFF,0xA8,0x40,0xF5,0x00,0x89,0x00,
+    0xAE,0x0F,0x00,0x00,0xE1,0xEF,0xDA,0xFF,0xC1,0x00,0xFF,0xE9,0x20,0x11,0x04,0x00,0xBB,0x00,0xE2,0xCF,0x09,0x02,0xF3,0x01,
+    0x00,0x00,0x99,0x9F,0x01,0x00,0x9A,0x01,0x02,0x83,0x86,0x09,0x01,0x86,0x89,0x93,0x81,0x02,0x03,0x82,0x8F,0xA6,0x8F,0x83,
+    0x9C,0xAC,0x8B,0x82,0x95,0x9D,0x8B,0x01,0x02,0x89,0x1F,0x00,0x1D,0x00,0x8E,0x83,0x02,0x02,0x88,0x9E,0xA6,0x8B,0x82,0x94,
+    0xE4,0x93,0x83,0x81,0x03,0x03,0x81,0x01,0x03,0x0A,0x01,0x86,0x01,0x03,0x01,0x02,0x9A,0x03,0x00,0xC0,0x08,0x02,0xFF,0xFF,
+    0x7B,0x00,0xFF,0x00,0x9D,0x0D,0x04,0xE9,0xFF,0xD8,0x40,0xF6,0xF5,0x1E,0x00,0xEF,0xEA,0x00,0x9F,0xFF,0xE8,0x40,0x0E,0x04,
+    0x00,0xE3,0x00,0x9C,0x08,0x02,0xF3,0xFF,0x0A,0x08,0x02,0x00,0xFF,0x19,0x65,0xAF,0x82,0x83,0x01,0x06,0x0B,0x01,0x83,0x81,
+    0x04,0x03,0x81,0x87,0xA1,0xAB,0x88,0x81,0x9B,0x00,0x81,0x96,0x03,0x02,0x8C,0xFF,0x10,0xA2,0x1D,0x00,0x1C,0x00,0xBA,0x83,
+    0x01,0x02,0x01,0x20,0x82,0x81,0xA3,0xDD,0x93,0x82,0x94,0xA4,0x81,0x82,0x02,0x03,0x0E,0x01,0x01,0x06,0x83,0x01,0x02,0xC5,
+    0xFF,0x5B,0x2D,0xBC,0xFF,0x63,0xAE,0xF3,0x07,0x02,0x00,0x97,0x00,0xBA,0x00,0x9D,0x0B,0x04,0xC1,0x00,0xD0,0xFE,0xF7,0xFF,
+    0x20,0x00,0x0D,0x00,0xFF,0x01,0x46,0x02,0x00,0xFF,0xB6,0x18,0xFF,0x43,0x4D,0x01,0x00,0xD9,0x0E,0x00,0x00,0xA0,0x00,0x8A,
+    0xFF,0xD0,0x20,0xD7,0x0C,0x04,0xFF,0xFC,0x6C,0x00,0xBC,0x07,0x02,0xF0,0xFF,0xB6,0x18,0xFF,0x7C,0x51,0xCD,0x89,0x82,0x83,
+    0x02,0x06,0x0E,0x01,0x03,0x03,0x82,0x93,0xA9,0x89,0x88,0xA9,0xDD,0x8F,0x82,0x90,0xA4,0x87,0x01,0x02,0xA5,0x1D,0x00,0x1C,
+    0x00,0x8B,0x02,0x02,0x8A,0xAD,0xA8,0x81,0x83,0x9F,0x80,0x95,0x83,0x87,0x03,0x03,0x0F,0x01,0x02,0x06,0x83,0x01,0x02,0x85,
+    0x86,0x08,0x02,0xFF,0xFE,0x34,0xFF,0xFA,0xC0,0x0B,0x04,0xD7,0xFF,0xA8,0xE0,0xFF,0x38,0x00,0x0A,0x00,0xF8,0x01,0x00,0xFF,
+    0x01,0x46,0xC7,0x01,0x00,0xB9,0xE5,0x01,0x00,0xF0,0xFF,0x74,0x51,0x01,0x00,0x00,0x7F,0x01,0x00,0x00,0xA1,0xB9,0x02,0x00,
+    0xF8,0x0A,0x00,0xF7,0xFF,0xE1,0x20,0xE2,0x0B,0x04,0xFF,0xFC,0x49,0x00,0xA9,0x0B,0x02,0x03,0x06,0x0F,0x01,0x03,0x03,0x01,
+    0x01,0x8C,0xA6,0xE4,0x8C,0x82,0x95,0xBB,0x8E,0x02,0x02,0x83,0xD3,0x1C,0x00,0x1B,0x00,0x8F,0x01,0x02,0x8B,0x93,0x82,0x88,
+    0xA9,0xAB,0x89,0x82,0xA5,0x80,0x8E,0x82,0x02,0x03,0x10,0x01,0x03,0x06,0x85,0x09,0x02,0x00,0x92,0xFF,0xFB,0xC5,0x0A,0x04,
+    0xDB,0x00,0x9F,0x00,0x89,0x09,0x00,0xB9,0x02,0x00,0xC7,0x01,0x00,0xC4,0xB9,0x01,0x00,0xB9,0xF8,0x01,0x00,0xF0,0xFF,0x7C,
+    0x51,0x01,0x00,0x00,0xBD,0x01,0x00,0xE5,0xED,0x01,0x00,0xBD,0xD8,0x01,0x00,0xD8,0xCA,0x09,0x00,0xFE,0xB4,0x0A,0x04,0x00,
+    0xD1,0x00,0xAA,0xCE,0x08,0x02,0x85,0x03,0x06,0x10,0x01,0x02,0x03,0x82,0x8A,0xAC,0xBB,0x89,0x83,0x9C,0xAE,0x96,0x82,0x8A,
+    0x92,0x01,0x02,0x81,0xB2,0x1B,0x00,0x1A,0x00,0x90,0x02,0x02,0x8C,0xAD,0x99,0x83,0x81,0x9B,0xB1,0x8F,0x82,0x98,0x00,0x81,
+    0x94,0x01,0x03,0x11,0x01,0x03,0x06,0x01,0x05,0x06,0x02,0x00,0xA9,0xFF,0xFC,0xCD,0x09,0x04,0xE0,0xFF,0xE0,0xA0,0x00,0x8A,
+    0x00,0xAE,0x07,0x00,0xD9,0x00,0xAF,0x01,0x00,0xC7,0xBE,0x01,0x00,0xFF,0x12,0x49,0xD5,0x80,0xC9,0xBD,0x01,0x00,0xCA,0xBC,
+    0x01,0x00,0x88,0xFF,0x7C,0x51,0x01,0x00,0xD8,0x01,0x00,0x00,0xA5,0xB9,0x01,0x00,0xFF,0x22,0x69,0xD8,0x01,0x00,0xB9,0x00,
+    0xA2,0x01,0x00,0x00,0x7F,0x08,0x00,0xEF,0xFF,0xC0,0x00,0xEC,0x09,0x04,0xFF,0xFB,0x83,0x00,0xA7,0x05,0x02,0x03,0x05,0x02,
+    0x06,0x11,0x01,0x01,0x03,0x8C,0xAB,0xA9,0x01,0x08,0xA8,0xAC,0x8B,0x82,0x8F,0x9D,0x97,0x02,0x02,0x8A,0xDD,0x1A,0x00,0x19,
+    0x00,0xB2,0x81,0x82,0x81,0x8A,0x82,0x87,0xAC,0x9F,0x87,0x82,0x9C,0xB1,0x8C,0x82,0x96,0x00,0x81,0xA0,0x11,0x01,0x91,0x02,
+    0x06,0x04,0x05,0x02,0x02,0x00,0xD2,0xFF,0xFD,0xD2,0x00,0xFC,0x08,0x04,0xE2,0xFF,0xE1,0x40,0xEF,0x06,0x00,0xC9,0xC7,0x01,
+    0x00,0xBE,0xC4,0x01,0x00,0x01,0x59,0x01,0x00,0xBE,0x08,0x00,0x00,0x8B,0xAA,0xC6,0x08,0x00,0xE3,0xBC,0x80,0x00,0x87,0xFF,
+    0x22,0x69,0x01,0x00,0xE5,0xB9,0x01,0x00,0xF9,0xC7,0x06,0x00,0x00,0xB0,0xFF,0xC1,0x00,0xC1,0x09,0x04,0x00,0xE4,0xDC,0x02,
+    0x02,0x04,0x05,0x02,0x06,0x91,0x10,0x01,0x83,0x8B,0xAE,0xAB,0x87,0x81,0xA4,0xAD,0x89,0x82,0x8E,0xB2,0x8E,0x82,0x83,0x8A,
+    0x01,0x02,0xA5,0x1A,0x00,0x18,0x00,0xD0,0x8A,0x01,0x02,0x8C,0xAC,0x8E,0x83,0x88,0xA9,0xAC,0x8B,0x81,0x89,0x81,0x83,0x82,
+    0x92,0xA3,0x8C,0x83,0x0F,0x01,0x03,0x06,0x04,0x05,0x01,0x02,0xE7,0xFF,0xFB,0xE5,0x08,0x04,0xE2,0x00,0xFD,0x00,0x89,0x05,
+    0x00,0xC4,0x01,0x00,0x00,0x8B,0xFF,0x1A,0x6A,0x01,0x00,0xBC,0xFF,0x1A,0x28,0x02,0x00,0xBC,0x0B,0x00,0x00,0xE5,0x8D,0x00,
+    0xDF,0x0C,0x00,0x00,0xA5,0x01,0x00,0xC4,0xBD,0x01,0x00,0x00,0xB1,0xC4,0x01,0x00,0xCA,0x00,0xA2,0x05,0x00,0xFF,0xC0,0x40,
+    0xEB,0x08,0x04,0x00,0xAB,0x00,0xCC,0x01,0x02,0x05,0x05,0x02,0x06,0x11,0x01,0x99,0xA7,0x87,0x82,0x83,0x89,0x01,0x07,0x9B,
+    0xB2,0x93,0x82,0x89,0x9A,0x99,0x02,0x02,0xA3,0x19,0x00,0x18,0x00,0x8B,0x01,0x02,0x83,0x82,0x8F,0x9D,0xA1,0x01,0x01,0xA5,
+    0xBB,0x8B,0x82,0x03,0x03,0x88,0x10,0x01,0x03,0x06,0x05,0x05,0x82,0x00,0xAA,0xFF,0xF9,0xA0,0x07,0x04,0xDB,0xFF,0xD8,0x60,
+    0xF7,0x07,0x00,0xFF,0x12,0x49,0xF8,0x01,0x00,0x00,0xA3,0xFF,0x01,0x65,0x01,0x00,0x00,0xE5,0x10,0x00,0xFF,0x3A,0x29,0xE3,
+    0x12,0x00,0xBC,0x00,0x8C,0xBC,0x01,0x00,0x00,0x7F,0x00,0xA2,0x06,0x00,0x00,0xB0,0xF6,0xC1,0x08,0x04,0x00,0xE4,0xE6,0x06,
+    0x05,0x02,0x06,0x10,0x01,0x88,0x87,0x02,0x03,0x82,0x87,0xA1,0xAD,0x8B,0x82,0x93,0xAC,0x99,0x01,0x02,0x83,0x82,0x83,0x19,
+    0x00,0x17,0x00,0xA1,0x01,0x02,0x8A,0xA9,0x92,0x82,0x88,0xA7,0x9A,0x89,0x83,0x8F,0x8A,0x03,0x03,0x11,0x01,0x91,0x02,0x06,
+    0x05,0x05,0x00,0x97,0x00,0xE6,0x08,0x04,0xFA,0xF7,0x05,0x00,0xD8,0xD9,0x01,0x00,0x00,0xB1,0xFF,0x0A,0x08,0x01,0x00,0x00,
+    0xE7,0x2A,0x00,0xD5,0x01,0x00,0xCA,0x00,0x8C,0x02,0x00,0xBD,0x05,0x00,0x00,0xB0,0xFF,0xC9,0x20,0xEC,0x07,0x04,0xFF,0xFA,
+    0xA0,0xFF,0xFE,0x55,0x05,0x05,0x03,0x06,0x0F,0x01,0x83,0x81,0x03,0x03,0x81,0x8F,0x88,0x81,0x99,0xBA,0x95,0x82,0x89,0xA7,
+    0x94,0x01,0x02,0x96,0x18,0x00,0x16,0x00,0xA9,0x83,0x02,0x02,0x94,0xCB,0x9F,0x89,0x81,0xA5,0xA6,0x90,0x01,0x02,0x02,0x03,
+    0x11,0x01,0x91,0x02,0x06,0x04,0x05,0x82,0xFD,0x00,0xB8,0x07,0x04,0xDB,0xEA,0x04,0x00,0xF9,0x02,0x00,0xFF,0x22,0x6A,0xE5,
+    0x01,0x00,0xE5,0x31,0x00,0x00,0xBE,0x01,0x00,0xC7,0xC4,0x01,0x00,0xBE,0x00,0xAF,0x03,0x00,0x00,0xB0,0xFF,0xD8,0x20,0x08,
+    0x04,0x00,0xD3,0xCE,0x04,0x05,0x03,0x06,0x11,0x01,0x03,0x03,0x82,0x88,0x9F,0x9E,0x8D,0x81,0x98,0xBA,0xA7,0x88,0x02,0x02,
+    0x94,0x17,0x00,0x16,0x00,0x88,0x01,0x02,0x92,0x8B,0x82,0xB0,0xAB,0xDD,0x8E,0x81,0x93,0x8D,0x03,0x03,0x86,0x10,0x01,0x91,
+    0x02,0x06,0x04,0x05,0xCE,0x00,0xD3,0x07,0x04,0xDB,0xFF,0xC8,0x80,0xFF,0x18,0x00,0x01,0x00,0x00,0xAF,0xBC,0x01,0x00,0xB9,
+    0xC9,0x01,0x00,0xF9,0xF8,0x37,0x00,0xC4,0x02,0x00,0xFF,0x1A,0x8A,0x02,0x00,0xC4,0x02,0x00,0xDA,0xFF,0xF0,0xA0,0x07,0x04,
+    0xFF,0xFB,0xE5,0x00,0xC5,0x04,0x05,0x03,0x06,0x11,0x01,0x02,0x03,0x82,0x8A,0x92,0x88,0x8A,0x9F,0xFF,0x42,0x29,0xC0,0x82,
+    0x87,0x95,0x87,0x82,0xAA,0xD3,0x16,0x00,0x15,0x00,0x94,0x83,0x01,0x02,0x8E,0xAC,0x00,0x8E,0x01,0x01,0x97,0x80,0x97,0x81,
+    0x82,0x03,0x03,0x10,0x01,0x91,0x02,0x06,0x04,0x05,0xF1,0xFF,0xFC,0x4A,0x07,0x04,0x00,0xAC,0x00,0x94,0x03,0x00,0xFF,0x84,
+    0xB3,0x00,0xE8,0x00,0x8B,0x80,0xBC,0x00,0xA3,0x3E,0x00,0xB9,0xD9,0x01,0x00,0xFF,0x6C,0x10,0xFF,0xC6,0x7A,0xFF,0x00,0x03,
+    0x02,0x00,0x00,0xAE,0xFF,0xC0,0x80,0xE0,0x06,0x04,0x00,0x9D,0x00,0xFE,0x04,0x05,0x03,0x06,0x10,0x01,0x03,0x03,0x01,0x02,
+    0x93,0xB2,0x00,0xF8,0x8B,0x82,0x90,0xB5,0xA1,0x83,0x01,0x02,0x8C,0x16,0x00,0x14,0x00,0xA5,0x8A,0x01,0x02,0x83,0x82,0x8D,
+    0x9E,0x9A,0x8D,0x82,0x96,0xD3,0xA7,0x89,0x03,0x03,0x0F,0x01,0x91,0x02,0x06,0x04,0x05,0xFF,0xFF,0x19,0x00,0xBB,0x06,0x04,
+    0xEB,0xFF,0xC8,0xC0,0x05,0x00,0xFF,0x3B,0x2C,0xAF,0x00,0xDF,0x01,0x00,0x00,0xE7,0x3E,0x00,0xD5,0x01,0x00,0xC7,0xF0,0xFF,
+    0x9D,0x55,0x05,0x00,0xFB,0xEC,0x06,0x04,0xE0,0x00,0xE2,0x04,0x05,0x03,0x06,0x0F,0x01,0x86,0x02,0x03,0x87,0x94,0x00,0x90,
+    0xA3,0xAF,0x87,0xC3,0xBB,0x94,0x01,0x02,0x81,0x01,0x02,0x00,0xD4,0x15,0x00,0x14,0x00,0xC5,0x01,0x02,0x00,0xAD,0x00,0x82,
+    0x90,0x82,0xAA,0xBF,0xAE,0x94,0x81,0x8B,0x9A,0xAE,0x96,0x81,0x83,0x86,0x0E,0x01,0x91,0x02,0x06,0x04,0x05,0xFD,0xFF,0xFA,
+    0xA0,0x06,0x04,0xC1,0xDA,0x03,0x00,0xF8,0xE3,0x01,0x00,0x00,0xE8,0x8B,0xC7,0x43,0x00,0xFF,0xAD,0xD7,0xB0,0xCA,0x01,0x00,
+    0xC9,0x03,0x00,0x00,0xE1,0xFF,0xE0,0xA0,0x07,0x04,0xFF,0xFD,0x70,0xB6,0x03,0x05,0x03,0x06,0x0E,0x01,0x86,0x01,0x03,0x8B,
+    0xA3,0xD3,0x99,0x88,0x8F,0x01,0x35,0x8D,0x82,0x8A,0x9B,0xA4,0x01,0x02,0x87,0xF4,0x14,0x00,0x13,0x00,0x9A,0x02,0x02,0x83,
+    0x8E,0x00,0xF5,0x9B,0xAF,0x82,0x96,0x9E,0x90,0x82,0xAA,0x9C,0xD4,0x90,0x83,0x86,0x0D,0x01,0x91,0x02,0x06,0x04,0x05,0x00,
+    0xB2,0x00,0xFC,0x06,0x04,0x00,0xD0,0x00,0xA0,0x04,0x00,0x00,0xA1,0xFF,0x1A,0x6A,0x01,0x00,0x00,0xB1,0x8B,0x00,0x8E,0x42,
+    0x00,0x00,0xEC,0x88,0x00,0x91,0x01,0x00,0xD9,0xB9,0x05,0x00,0xF6,0xC1,0x06,0x04,0x00,0xE6,0xCE,0x03,0x05,0x03,0x06,0x0D,
+    0x01,0x86,0x01,0x03,0xA9,0xAB,0x8F,0x86,0x88,0x00,0xF4,0xA8,0x8A,0x86,0x00,0xA4,0xE8,0x9B,0x8A,0x02,0x02,0x8E,0x14,0x00,
+    0x12,0x00,0x00,0xA5,0x89,0x01,0x02,0x92,0x88,0x82,0x89,0xC6,0x00,0xC9,0x95,0x02,0x01,0x83,0x82,0x83,0x8B,0x88,0x83,0x86,
+    0x0C,0x01,0x91,0x02,0x06,0x04,0x05,0x00,0xB2,0xFA,0x06,0x04,0xFF,0xE1,0x20,0x03,0x00,0x00,0xBE,0x02,0x00,0xFF,0x01,0xA6,
+    0xBD,0x01,0x00,0x00,0x91,0xB8,0xFF,0x3A,0x69,0x40,0x00,0xBC,0xCD,0xC5,0xC9,0x80,0xBC,0x00,0x8C,0x02,0x00,0x00,0xAF,0x03,
+    0x00,0xFB,0xEC,0x06,0x04,0xFF,0xFC,0xAB,0xCE,0x04,0x05,0x02,0x06,0x91,0x0B,0x01,0x02,0x03,0x8D,0xB6,0x02,0x02,0x83,0x8A,
+    0x93,0x9A,0x00,0xC9,0xC5,0x01,0x02,0x96,0x8B,0x82,0x83,0xAB,0x13,0x00,0x12,0x00,0x8A,0x02,0x02,0x97,0xCC,0xC0,0x81,0x86,
+    0xD2,0x00,0xF3,0x99,0x91,0x82,0x06,0x03,0x86,0x0A,0x01,0x91,0x02,0x06,0x04,0x05,0xDF,0xFA,0x05,0x04,0xE2,0xFF,0xC8,0x80,
+    0x04,0x00,0xD9,0xFF,0x1A,0x6A,0x06,0x00,0xFF,0x3A,0x29,0x00,0x87,0x41,0x00,0xFF,0x29,0xE7,0xFF,0x19,0xA6,0x05,0x00,0xBD,
+    0xFF,0x0A,0x49,0x04,0x00,0x00,0x89,0xDB,0x06,0x04,0xFF,0xFC,0x8B,0xCE,0x04,0x05,0x02,0x06,0x91,0x09,0x01,0x86,0x05,0x03,
+    0x03,0x02,0xA8,0x9A,0x89,0x82,0x8B,0x9F,0xB5,0xB0,0x01,0x02,0x86,0x13,0x00,0x11,0x00,0x9F,0x8A,0x82,0xCE,0xDC,0xC2,0x93,
+    0x9E,0xA3,0x90,0x83,0x8B,0x8F,0x81,0x82,0x08,0x03,0x86,0x07,0x01,0x03,0x06,0x04,0x05,0xDF,0x00,0x9E,0x05,0x04,0xC1,0xFE,
+    0x06,0x00,0xFF,0x22,0x69,0xE3,0x51,0x00,0x00,0x8C,0x00,0xA1,0x05,0x00,0x00,0x89,0x00,0xAC,0x06,0x04,0xFF,0xFC,0xCD,0x82,
+    0x04,0x05,0x03,0x06,0x91,0x05,0x01,0x01,0x06,0x06,0x03,0x03,0x02,0xAF,0x8D,0xB0,0x97,0xDE,0x00,0x8E,0xAA,0xCE,0xF1,0x01,
+    0x02,0x94,0x12,0x00,0x11,0x00,0x8E,0x01,0x02,0xFF,0xE5,0x32,0xFF,0xE9,0x40,0xFF,0xF5,0x0F,0xD1,0xAA,0xC3,0xFF,0x4A,0xAB,
+    0x9B,0xAA,0x02,0x02,0x09,0x03,0x02,0x06,0x02,0x11,0x04,0x06,0x04,0x05,0x00,0x96,0x00,0x9D,0x05,0x04,0xFA,0xDA,0x03,0x00,
+    0xBD,0xC4,0x58,0x00,0x00,0x8B,0xED,0x03,0x00,0x00,0xB3,0xFF,0xF1,0x40,0x06,0x04,0xFF,0xFD,0x70,0x82,0x04,0x05,0x09,0x06,
+    0x04,0x03,0x00,0xF6,0x02,0x03,0x04,0x02,0xC3,0xF4,0x9A,0x00,0x80,0x82,0x00,0xDC,0xFF,0xF3,0x42,0xFF,0xEA,0xE0,0xCF,0x82,
+    0x8A,0x12,0x00,0x10,0x00,0xC6,0x02,0x02,0xE6,0xFF,0xF4,0x8D,0xB4,0xFF,0xE9,0x80,0xFF,0xF5,0x92,0xF1,0xB8,0xC3,0x89,0x02,
+    0x02,0x0B,0x03,0x07,0x06,0x04,0x05,0xDF,0x00,0x9E,0x05,0x04,0xD7,0xEF,0x05,0x00,0xFF,0x3A,0xCB,0xC4,0x56,0x00,0x00,0x8B,
+    0xFF,0x3A,0xAB,0xBE,0x05,0x00,0xFF,0xD9,0x20,0xE1,0x05,0x04,0xFF,0xFD,0x70,0x82,0x04,0x05,0x07,0x06,0x02,0x03,0x81,0xAA,
+    0x87,0xC2,0x83,0x05,0x02,0x86,0xB7,0x00,0x8E,0xFF,0xEF,0x5C,0xFF,0xF6,0x78,0xFF,0xEB,0x62,0xB4,0xFF,0xEA,0x80,0x00,0xE9,
+    0x02,0x02,0xC5,0x11,0x00,0x10,0x00,0xB3,0x01,0x02,0x95,0xB0,0x82,0x00,0xF9,0xFF,0xEB,0x00,0xA2,0xFF,0xEA,0x20,0xFF,0xF5,
+    0xF4,0xC2,0x03,0x02,0x04,0x03,0x04,0x02,0x02,0x03,0x05,0x06,0x04,0x05,0xFF,0xFE,0xF8,0x00,0x9E,0x05,0x04,0x00,0xAC,0x00,
+    0x95,0x02,0x00,0xD5,0xC9,0x02,0x00,0xBE,0x56,0x00,0xBC,0xE5,0x02,0x00,0xD8,0x03,0x00,0xFF,0xC9,0x00,0xE2,0x05,0x04,0xFF,
+    0xFD,0x70,0x82,0x05,0x05,0x04,0x06,0x02,0x03,0x81,0xB3,0x99,0x95,0xAF,0x06,0x02,0xAA,0x93,0xFF,0xE6,0x16,0xFF,0xE3,0xC9,
+    0x01,0x22,0xFF,0xF5,0x52,0xCF,0x86,0x92,0x8A,0x82,0x88,0xF4,0x10,0x00,0x0F,0x00,0xD4,0x02,0x02,0x94,0x00,0xC8,0xC8,0xAF,
+    0xCF,0xFF,0xF5,0xB3,0x01,0x22,0xFF,0xEA,0xE0,0xFF,0xF6,0x77,0x83,0x06,0x02,0x81,0x90,0xA5,0x94,0x88,0x82,0x02,0x03,0x02,
+    0x06,0x05,0x05,0xD1,0x00,0xD5,0x05,0x04,0x00,0xBF,0x00,0xE1,0x04,0x00,0xED,0xE3,0x5D,0x00,0xFF,0x1A,0x69,0xCA,0x04,0x00,
+    0xFF,0xD1,0x20,0xEB,0x05,0x04,0x00,0xBA,0x82,0x07,0x05,0x86,0x82,0x83,0x01,0x02,0x88,0xA0,0x00,0xE5,0x80,0xA4,0x8C,0x05,
+    0x02,0xFF,0xCD,0xF7,0xFF,0xC3,0x05,0x00,0xCE,0xFF,0xD8,0x00,0xFF,0xEC,0x4B,0xE6,0x83,0x93,0xB5,0x9F,0xAA,0x01,0x02,0x97,
+    0x10,0x00,0x0F,0x00,0x89,0x03,0x02,0x89,0x9F,0xDE,0x8E,0x00,0x98,0xE6,0xFF,0xEC,0x6B,0x01,0x22,0xFF,0xEC,0x2A,0xFF,0xF7,
+    0x1A,0x83,0x03,0x02,0xAA,0xAE,0x03,0x00,0xA5,0xF2,0x02,0x02,0x06,0x05,0xB6,0xFF,0xFB,0xE8,0x05,0x04,0xFA,0x00,0xA0,0x05,
+    0x00,0xBC,0xFF,0x22,0x29,0x5C,0x00,0xC4,0xBD,0x06,0x00,0xFF,0xD9,0x60,0x06,0x04,0x00,0xBA,0x82,0x06,0x05,0x86,0x01,0x2F,
+    0x01,0x06,0x89,0x97,0x02,0x00,0x8E,0xFF,0xF7,0x3C,0x01,0x02,0xB6,0xC2,0xFF,0xC4,0xF1,0xEA,0xF6,0xFF,0xD2,0x20,0xFF,0xEE,
+    0x36,0x81,0xB8,0xA3,0x00,0xF3,0x98,0x04,0x02,0x00,0xEA,0x0F,0x00,0x0E,0x00,0xC6,0x01,0x02,0x8D,0xA8,0x93,0x83,0x82,0x93,
+    0x01,0x4C,0x8B,0x82,0xFF,0xF6,0x98,0xFF,0xEB,0x86,0x01,0x22,0xFF,0xF5,0x72,0xC2,0x02,0x02,0x9C,0x05,0x00,0x00,0xD4,0x8C,
+    0x02,0x02,0x04,0x05,0x82,0x00,0xE6,0x05,0x04,0xC1,0xEF,0x02,0x00,0xBE,0xB9,0xBC,0x63,0x00,0xD9,0xC7,0x03,0x00,0xFF,0xD9,
+    0x00,0x06,0x04,0x00,0xBA,0x82,0x03,0x05,0x81,0x82,0xAF,0xFF,0xA5,0x76,0xC8,0xB3,0x93,0xA5,0xB2,0x02,0x00,0xC3,0x88,0xCE,
+    0x82,0xFF,0xE6,0xDA,0xFF,0xB2,0xE5,0x00,0x8A,0xF6,0xFF,0xD4,0xF0,0xFF,0xEF,0x3C,0xFF,0xE7,0x7E,0xC8,0xF4,0xC3,0xF2,0x82,
+    0x8C,0x97,0x94,0x01,0x02,0xA0,0x0F,0x00,0x0E,0x00,0x8F,0x01,0x02,0x83,0x95,0x9D,0xB5,0xC5,0x82,0xAA,0x92,0xB0,0x01,0x02,
+    0x00,0xF6,0xFF,0xF6,0x16,0xFF,0xE9,0x80,0xB4,0xE6,0x01,0x02,0x83,0xD0,0x80,0xBF,0x94,0x03,0x00,0xB5,0x81,0x01,0x02,0x04,
+    0x05,0x00,0xAA,0x05,0x04,0xC1,0xF5,0x04,0x00,0xE3,0xFF,0x0A,0x08,0xBC,0x61,0x00,0xD9,0xB9,0x05,0x00,0xFF,0xE9,0x40,0x06,
+    0x04,0x00,0xBA,0x82,0x01,0x05,0x82,0x81,0x83,0xF0,0xFF,0x7C,0x31,0x80,0xFF,0x52,0xEC,0xFF,0x4A,0xCB,0x02,0x00,0x00,0x90,
+    0x00,0xDA,0x90,0x81,0x82,0x8F,0xFF,0xAB,0x28,0xEA,0xFF,0xC3,0x8A,0xFF,0xD6,0x58,0x00,0xCA,0xAA,0xAF,0x95,0x8C,0x82,0x88,
+    0x97,0xDE,0x97,0x8A,0x01,0x02,0x91,0x0F,0x00,0x0D,0x00,0xA1,0x01,0x02,0x87,0x81,0x82,0x86,0xA0,0xFF,0x4A,0xAA,0xD6,0x8D,
+    0x05,0x02,0x00,0xC6,0xE6,0x83,0x01,0x02,0x83,0xCB,0x80,0xA7,0x90,0x80,0xCC,0xB7,0x01,0x00,0xF3,0x02,0x02,0x02,0x05,0x00,
+    0x92,0x00,0xBF,0x05,0x04,0xFF,0xB8,0xE0,0x72,0x00,0x00,0xAE,0xFA,0x06,0x04,0x00,0xCB,0x82,0x85,0x02,0x01,0x86,0x00,0xCF,
+    0x03,0x00,0x00,0xC8,0xBF,0x93,0xAF,0x83,0x81,0x8F,0xD2,0xFF,0xC5,0xD6,0xFF,0xCD,0xF6,0x8D,0x89,0x88,0x87,0x91,0x82,0x88,
+    0x00,0x8E,0xF4,0xA3,0x89,0x01,0x02,0x88,0x01,0x02,0x93,0x0E,0x00,0x0D,0x00,0x96,0x01,0x02,0x98,0x9E,0x00,0xFA,0x8A,0x82,
+    0xF2,0xBF,0xA3,0x00,0xCA,0x0A,0x02,0x97,0x01,0x00,0xA9,0x80,0x00,0xC8,0x8D,0x01,0x00,0xD2,0x04,0x02,0xCE,0x00,0xBB,0x05,
+    0x04,0xFF,0xD9,0x20,0x03,0x00,0xB9,0xBD,0x68,0x00,0xCA,0xFF,0x0A,0x49,0x00,0xAF,0x02,0x00,0xEF,0xEE,0x06,0x04,0x00,0xCB,
+    0x82,0x02,0x01,0xC2,0x00,0xC4,0xFF,0x5B,0x8E,0x80,0xBE,0xC3,0x8F,0x8A,0x83,0x82,0x8C,0x95,0xC0,0x96,0x8F,0x8B,0x89,0xAF,
+    0xAA,0x81,0x01,0x03,0xCD,0x9E,0x93,0x82,0x86,0x93,0x00,0x82,0x9F,0x87,0x82,0x8A,0xD3,0x0D,0x00,0x0C,0x00,0xFC,0x03,0x02,
+    0x8F,0xA7,0xAE,0xA5,0x89,0x83,0xAA,0x81,0x01,0x02,0x83,0x05,0x02,0x8F,0x88,0x8A,0xCB,0x03,0x00,0xFF,0x63,0x6E,0x01,0x00,
+    0xFF,0xD6,0xFB,0x04,0x02,0x00,0xD3,0x05,0x04,0xFF,0xF1,0x20,0xFF,0x28,0x00,0x04,0x00,0x00,0xBD,0xC4,0x66,0x00,0xE5,0xFF,
+    0x3A,0xAA,0xBE,0x04,0x00,0xFF,0xB9,0x20,0x00,0xBF,0x06,0x04,0x00,0xCB,0x82,0x02,0x01,0x85,0x00,0xCF,0xC9,0x00,0x91,0x8D,
+    0xB6,0x82,0x8F,0xFF,0x7B,0xF0,0xAE,0xA3,0x93,0x8B,0xB0,0x89,0x8A,0xAA,0x81,0x86,0x83,0x82,0x87,0x81,0x82,0x92,0x9E,0x9D,
+    0x8E,0x87,0x02,0x02,0xBF,0x0D,0x00,0x0C,0x00,0x8C,0x82,0x83,0xA0,0x92,0x87,0x83,0x8B,0xA1,0xDE,0x9C,0x81,0x82,0x03,0x03,
+    0x03,0x02,0x95,0x80,0x9D,0x01,0x01,0xBF,0x04,0x00,0xC3,0x85,0x03,0x02,0x00,0xBC,0xEC,0x04,0x04,0xE0,0x00,0xE1,0x6F,0x00,
+    0x00,0xE5,0x02,0x00,0x00,0xA2,0x02,0x00,0xFF,0xB9,0x20,0x00,0xBF,0x06,0x04,0x00,0xCB,0x02,0x01,0x82,0x00,0xC4,0xA7,0xFF,
+    0xAC,0xD2,0xFF,0xF7,0x7D,0x00,0x80,0xFF,0x52,0xEC,0x03,0x00,0xDE,0x8D,0x01,0x08,0x87,0x81,0x86,0x83,0x02,0x02,0x8D,0xB5,
+    0x9E,0x92,0x87,0x83,0x8D,0xA0,0x8B,0x82,0x83,0xD0,0x0C,0x00,0x0B,0x00,0x9D,0x8C,0x01,0x02,0x9C,0xBB,0xBA,0x9C,0x8C,0x83,
+    0x89,0xB3,0x81,0x05,0x03,0x01,0x02,0x88,0xFF,0x18,0xC3,0x80,0xA1,0x89,0x9C,0xC8,0x00,0xD9,0xC6,0xB5,0x00,0xDF,0x00,0xB5,
+    0x85,0x03,0x02,0xD1,0x00,0xD5,0x04,0x04,0xD7,0xEF,0x03,0x00,0xFF,0x1A,0x69,0xC7,0x6C,0x00,0xC9,0xFF,0x32,0xAB,0xBD,0x03,
+    0x00,0xFF,0xB9,0x20,0x00,0xBF,0x05,0x04,0xE1,0x82,0x03,0x01,0xFF,0xEF,0x1B,0x00,0x98,0xCD,0x02,0x00,0xFF,0x39,0xE8,0xA6,
+    0x01,0x00,0xA5,0x02,0x01,0x86,0x83,0x03,0x02,0x8C,0x93,0x81,0x87,0x92,0xCC,0xD0,0xA7,0x89,0x01,0x02,0x9A,0x0C,0x00,0x0B,
+    0x00,0x8F,0x83,0x82,0x83,0x82,0x88,0x8E,0xAE,0x00,0xED,0xA7,0x90,0x83,0x82,0x05,0x03,0x01,0x02,0x9B,0x01,0x00,0xB3,0xB2,
+    0x02,0x00,0xB5,0xAF,0x06,0x02,0x00,0xCD,0x04,0x04,0xE1,0xFE,0x04,0x00,0x00,0xA2,0xFF,0x1A,0x29,0x6C,0x00,0xC7,0x00,0xB1,
+    0x01,0x00,0xD8,0x02,0x00,0xFF,0xB9,0x20,0x00,0xBF,0x05,0x04,0xFF,0xFD,0xB2,0x03,0x01,0xFF,0xEF,0xDF,0x00,0xE8,0x03,0x00,
+    0xA3,0xC0,0x00,0xC3,0x80,0xAB,0x81,0x06,0x03,0x01,0x02,0x88,0xA0,0xD4,0xFF,0x31,0xA7,0xBF,0x8B,0x03,0x02,0x8A,0x0C,0x00,
+    0x0B,0x00,0x96,0x82,0x88,0xA8,0x99,0x89,0x82,0x81,0x96,0x9D,0x00,0x9B,0xC6,0x8F,0x81,0x04,0x03,0x82,0xAA,0x01,0x00,0x94,
+    0xA1,0x04,0x00,0xCD,0x05,0x02,0xDF,0xEE,0x04,0x04,0x00,0xD0,0x02,0x00,0xE5,0x73,0x00,0xFF,0x4B,0x2D,0x04,0x00,0xFF,0xB9,
+    0x20,0xC1,0x04,0x04,0xC1,0x82,0x02,0x01,0xFF,0xB6,0x38,0xFF,0x53,0x6D,0x01,0x00,0xFF,0x21,0xE7,0x04,0x00,0xFF,0x9C,0xB2,
+    0x82,0x06,0x03,0x8A,0x99,0xD4,0xD3,0x9C,0x8A,0x82,0x87,0x8E,0x9F,0x92,0x01,0x02,0x0C,0x00,0x0A,0x00,0x9B,0x83,0x01,0x02,
+    0x90,0x9F,0xB1,0x9F,0x90,0x87,0x81,0x90,0x9F,0xE4,0xD6,0x8D,0x03,0x03,0x82,0x8F,0x01,0x00,0xD3,0x01,0x00,0xB3,0xAA,0xFF,
+    0x32,0x29,0x80,0xFF,0x84,0x72,0x04,0x02,0xB6,0xFF,0xFB,0xC5,0x04,0x04,0xE0,0x00,0x95,0x02,0x00,0xCA,0xFF,0x43,0x0C,0xBE,
+    0x6F,0x00,0xFF,0x1A,0x08,0x07,0x00,0xFA,0xC1,0x04,0x04,0xFF,0xFD,0xB2,0x02,0x01,0x00,0xA6,0xFF,0x63,0xAF,0x80,0x00,0x9A,
+    0x8B,0xCD,0x03,0x00,0xB8,0x82,0x04,0x03,0x88,0x97,0xBA,0xA6,0xA0,0x8C,0x83,0x8C,0x9C,0xAC,0x9E,0x94,0x87,0x01,0x02,0x8B,
+    0x0B,0x00,0x09,0x00,0x00,0x9B,0x93,0x01,0x02,0x88,0x01,0x02,0x8B,0x9C,0xA6,0x00,0xD4,0x96,0x82,0x83,0x90,0xA5,0x92,0x86,
+    0x02,0x03,0x82,0x87,0x9F,0x03,0x00,0x88,0x82,0x00,0xEC,0x80,0xBF,0x04,0x02,0xFF,0xFD,0xD2,0x04,0x04,0xDB,0xFF,0xB0,0x80,
+    0x04,0x00,0xE5,0xC9,0x72,0x00,0x00,0xA2,0xED,0xBD,0x03,0x00,0xD7,0xEE,0x03,0x04,0xC1,0x02,0x01,0xFF,0xD7,0x1C,0x00,0xCF,
+    0x01,0x00,0xFF,0x3A,0x49,0x03,0x00,0x8E,0x01,0x02,0x04,0x03,0x8C,0x9B,0x95,0x88,0x82,0x88,0xA8,0xAE,0xA8,0x93,0x81,0x82,
+    0x01,0x07,0x82,0x88,0xA6,0x0A,0x00,0x09,0x00,0xB2,0x87,0x82,0x87,0x9A,0xA7,0x92,0x87,0x82,0x88,0x95,0x96,0x81,0x82,0x83,
+    0x01,0x01,0x05,0x03,0x81,0x95,0x01,0x00,0x00,0x85,0x8E,0xB5,0x01,0x00,0xB8,0x03,0x02,0xDC,0xFF,0xFA,0xC0,0x04,0x04,0x00,
+    0xD0,0x02,0x00,0x00,0xA1,0x75,0x00,0xFF,0x1A,0x28,0xC7,0xBD,0x04,0x00,0xEE,0xEC,0x04,0x04,0x03,0x01,0xFF,0xDF,0x3D,0xFF,
+    0x8C,0xD3,0x03,0x00,0xAE,0x90,0x01,0x02,0x05,0x03,0x01,0x01,0x01,0x03,0x82,0x89,0x94,0x8C,0x01,0x03,0x8F,0xA5,0x9E,0x8E,
+    0x01,0x02,0x97,0x0A,0x00,0x09,0x00,0x9A,0x83,0x01,0x02,0x89,0x9C,0x9D,0xA6,0xA5,0x8B,0x81,0x05,0x03,0x02,0x06,0x02,0x03,
+    0x01,0x02,0x89,0xA1,0x8E,0x02,0x00,0xFF,0x8C,0xD3,0x85,0x03,0x02,0x00,0xD3,0x04,0x04,0xC1,0x00,0x89,0x02,0x00,0x00,0x7F,
+    0xFF,0x2A,0xAA,0xBC,0x73,0x00,0xFF,0x22,0x28,0x07,0x00,0xD7,0xDB,0xC1,0x02,0x04,0xFF,0xFD,0xB2,0x02,0x01,0x00,0x98,0xF0,
+    0xC0,0xC8,0x9B,0x00,0xA8,0x81,0x82,0x04,0x03,0x02,0x06,0x06,0x03,0x8A,0x8E,0x9E,0xB1,0xA8,0x90,0x83,0x01,0x02,0x98,0x0A,
+    0x00,0x09,0x00,0x88,0x01,0x02,0x8D,0x87,0x82,0x81,0x96,0xA1,0xD4,0x94,0x04,0x03,0x03,0x01,0x86,0x03,0x03,0x01,0x02,0x88,
+    0x00,0x91,0x00,0x9A,0xCD,0x00,0x98,0x03,0x02,0x00,0xA9,0x00,0x9E,0x04,0x04,0xFF,0xC8,0xA0,0x04,0x00,0xC9,0xBD,0x76,0x00,
+    0xE5,0xED,0xBD,0x02,0x00,0xFA,0xC1,0x03,0x04,0xEB,0x02,0x01,0x86,0x85,0x04,0x02,0x03,0x03,0x01,0x06,0x03,0x01,0x86,0x03,
+    0x03,0x8D,0x9D,0xAB,0x94,0x89,0x82,0x83,0x8C,0x89,0x01,0x02,0xB1,0x09,0x00,0x09,0x00,0x89,0x82,0x81,0xA8,0xAD,0xA5,0x90,
+    0x81,0x83,0x01,0x09,0x03,0x03,0x06,0x01,0x86,0x03,0x03,0x82,0x01,0x01,0x05,0x02,0xFF,0xFD,0x0E,0x04,0x04,0xC1,0x00,0xB0,
+    0x01,0x00,0x00,0x7F,0x79,0x00,0xFF,0x1A,0x28,0xC7,0xBD,0x03,0x00,0xFF,0xAA,0x23,0xB4,0xE2,0x03,0x04,0xFF,0xEF,0x1B,0xFF,
+    0xEF,0xFF,0x02,0x05,0x04,0x02,0x01,0x03,0x01,0x06,0x06,0x01,0x86,0x02,0x03,0x87,0x8C,0x87,0x82,0x8C,0x94,0xA9,0x9D,0x95,
+    0x01,0x02,0xA6,0x09,0x00,0x08,0x00,0x8D,0x02,0x02,0x83,0x8D,0x9C,0x9E,0x9D,0xA8,0x8D,0x03,0x03,0x86,0x07,0x01,0x01,0x06,
+    0x01,0x03,0x06,0x02,0x85,0x00,0x9C,0xEE,0x04,0x04,0xFE,0x01,0x00,0x00,0x7F,0xFF,0xCE,0xDB,0x00,0xA6,0xFF,0x63,0xAF,0xBE,
+    0x76,0x00,0xFF,0x22,0x28,0x06,0x00,0xFF,0xE8,0x40,0xDB,0x03,0x04,0xFF,0xFD,0x30,0x02,0x05,0x04,0x02,0x83,0x02,0x06,0x08,
+    0x01,0x02,0x03,0x82,0x88,0x9C,0xAD,0x9D,0xA1,0x96,0x88,0x02,0x02,0x81,0x09,0x00,0x08,0x00,0x90,0x82,0x88,0xA5,0x98,0x8A,
+    0x01,0x02,0x8D,0x9B,0x8E,0x03,0x03,0x09,0x01,0x03,0x06,0x03,0x05,0x02,0x02,0xFF,0xFC,0x48,0x04,0x04,0xD7,0x03,0x00,0xBD,
+    0xC0,0x00,0x98,0xB3,0x00,0xEB,0x78,0x00,0x00,0x87,0xED,0xBD,0x01,0x00,0xFF,0xA0,0x20,0xE2,0x03,0x04,0x00,0xD1,0xDC,0x85,
+    0x01,0x02,0x02,0x05,0x03,0x06,0x0A,0x01,0x02,0x03,0x8D,0xA4,0x92,0x81,0x82,0x87,0x8F,0x97,0x95,0x82,0x83,0x09,0x00,0x07,
+    0x00,0xA1,0x88,0x82,0x81,0xA0,0xA6,0xFF,0x20,0xE4,0xA9,0xCD,0x8C,0x02,0x02,0x01,0x03,0x0A,0x01,0x91,0x02,0x06,0x05,0x05,
+    0x00,0x92,0xEC,0x04,0x04,0xFE,0x05,0x00,0x00,0x9A,0xB3,0x00,0xD6,0xFF,0x31,0xE8,0x76,0x00,0x00,0xC0,0x05,0x00,0xFF,0xF0,
+    0xE0,0x04,0x04,0x00,0xCD,0x01,0x02,0x03,0x05,0x02,0x06,0x91,0x0A,0x01,0x02,0x03,0x01,0x02,0x87,0x95,0xA1,0xBA,0x00,0x86,
+    0xA7,0x90,0x01,0x02,0x95,0x08,0x00,0x07,0x00,0x9C,0x03,0x02,0x83,0x8D,0xC6,0x00,0x88,0x80,0xB1,0x95,0x89,0x86,0x83,0x0B,
+    0x01,0x02,0x06,0x04,0x05,0x82,0xFF,0xFC,0xCD,0x04,0x04,0xFF,0xF0,0xC0,0xFF,0x20,0x00,0x80,0xBC,0xFF,0x12,0x8A,0xF9,0x02,
+    0x00,0xE3,0xFF,0x32,0x28,0x76,0x00,0xD5,0x01,0x00,0x00,0x8B,0xFF,0x02,0x28,0xD9,0x01,0x00,0x00,0x8A,0xDB,0x03,0x04,0x00,
+    0xAB,0xD1,0x04,0x05,0x02,0x06,0x0B,0x01,0x86,0x83,0x88,0x90,0xA7,0xFF,0x18,0xC3,0xFF,0x00,0x20,0xB1,0x95,0x88,0x03,0x02,
+    0x8C,0x08,0x00,0x07,0x00,0x95,0x01,0x02,0x00,0x8E,0x99,0xB8,0x81,0x82,0x81,0x95,0xA1,0xB1,0xD3,0x9A,0x92,0x0B,0x01,0x02,
+    0x06,0x04,0x05,0xE6,0x00,0xAB,0x04,0x04,0xF6,0x03,0x00,0xFF,0x3A,0xCB,0xFF,0x2A,0x49,0x7C,0x00,0xC4,0x00,0xD7,0xC9,0x02,
+    0x00,0x00,0xB3,0xEE,0x04,0x04,0x00,0xFF,0x04,0x05,0x02,0x06,0x0A,0x01,0x83,0x8A,0xA5,0xCB,0xE4,0xA3,0xA0,0x89,0x82,0x83,
+    0x8A,0x92,0x97,0x8B,0x82,0x8A,0x08,0x00,0x06,0x00,0xAD,0x81,0x01,0x02,0x90,0xA5,0xAD,0xA6,0xA4,0x95,0x8A,0x82,0x88,0x8F,
+    0xA5,0xA0,0x87,0x0A,0x01,0x91,0x01,0x06,0x04,0x05,0x00,0xDD,0x04,0x04,0xC1,0x00,0xE1,0x04,0x00,0x00,0xA5,0x7C,0x00,0x00,
+    0x87,0x05,0x00,0xFF,0xD1,0x20,0xE2,0x03,0x04,0xFF,0xFB,0x62,0xB6,0x03,0x05,0x02,0x06,0x0A,0x01,0x86,0x8B,0xA4,0x95,0x89,
+    0x83,0x81,0x90,0x99,0xAB,0xAE,0xA3,0x8E,0x81,0x01,0x02,0x9C,0x07,0x00,0x06,0x00,0xA6,0x83,0x03,0x02,0x81,0x8D,0xA5,0xCB,
+    0xA7,0x88,0x02,0x03,0x0C,0x01,0x91,0x01,0x06,0x03,0x05,0xB6,0x00,0xD5,0x04,0x04,0xFF,0xD0,0x80,0x7F,0x00,0x0A,0x00,0xF7,
+    0xC1,0x04,0x04,0xFD,0x03,0x05,0x02,0x06,0x0D,0x01,0x83,0x82,0x83,0x8E,0xE4,0xA9,0x92,0x8A,0x04,0x02,0x94,0x07,0x00,0x06,
+    0x00,0x9B,0x01,0x02,0xA0,0xA8,0x98,0x8B,0x81,0x82,0x83,0x88,0x02,0x03,0x86,0x0C,0x01,0x91,0x01,0x06,0x03,0x05,0x00,0x9C,
+    0x04,0x04,0xC1,0xEF,0x01,0x00,0xCA,0xFF,0x32,0xCB,0xB9,0x7F,0x00,0x80,0xFF,0x01,0x87,0x00,0xA3,0xFF,0x0A,0x8A,0x02,0x00,
+    0xFF,0xE9,0x20,0x04,0x04,0x00,0xE3,0x03,0x05,0x02,0x06,0x0D,0x01,0x02,0x03,0x87,0x81,0x82,0x83,0x88,0x93,0x97,0xA8,0x88,
+    0x82,0x90,0x07,0x00,0x06,0x00,0x81,0x01,0x02,0x8A,0x98,0xA1,0x9D,0xA6,0xA4,0x92,0x87,0x82,0x01,0x03,0x0D,0x01,0x02,0x06,
+    0x03,0x05,0x00,0xCD,0x04,0x04,0xFF,0xE8,0xA0,0x04,0x00,0xB9,0xE5,0x7F,0x00,0x00,0xC0,0xBE,0x03,0x00,0xEA,0xE0,0x03,0x04,
+    0x00,0xE0,0x00,0x97,0x02,0x05,0x02,0x06,0x0D,0x01,0x03,0x03,0x8D,0x9C,0xAB,0xAE,0x9A,0x9C,0x8F,0x02,0x02,0xAB,0x06,0x00,
+    0x06,0x00,0x88,0x01,0x02,0x83,0x01,0x02,0x87,0x8F,0x97,0x9A,0x89,0x02,0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0x82,0x00,0xB4,
+    0x04,0x04,0xFB,0x7F,0x00,0x0D,0x00,0xD7,0x04,0x04,0x00,0xE9,0x03,0x05,0x01,0x06,0x0D,0x01,0x86,0x01,0x03,0x81,0x99,0xA7,
+    0x96,0x89,0x83,0x01,0x02,0x83,0x01,0x02,0x9E,0x06,0x00,0x05,0x00,0xB1,0x81,0x82,0x92,0x9E,0xAB,0xA4,0x92,0x8A,0x87,0x04,
+    0x03,0x0D,0x01,0x01,0x06,0x03,0x05,0xFD,0x04,0x04,0xFF,0xF0,0xE0,0x02,0x00,0x00,0x7F,0xD9,0xE5,0x7F,0x00,0x03,0x00,0xC9,
+    0xFF,0x0A,0x6A,0xF9,0x01,0x00,0xFF,0xC0,0x80,0x04,0x04,0x00,0xBB,0x03,0x05,0x01,0x06,0x91,0x0D,0x01,0x03,0x03,0x81,0x88,
+    0x8D,0xA0,0xA3,0x9D,0x9B,0x01,0x02,0x9B,0x06,0x00,0x05,0x00,0x88,0x02,0x02,0x8A,0x92,0x9C,0xA9,0xBB,0xCC,0x8F,0x82,0x01,
+    0x03,0x0D,0x01,0x91,0x01,0x06,0x03,0x05,0xFF,0xFC,0xEE,0x04,0x04,0xF6,0x03,0x00,0x00,0xB1,0xFF,0x22,0x29,0x7F,0x00,0x02,
+    0x00,0xC4,0xFF,0x22,0x69,0xD5,0x02,0x00,0x00,0xA0,0xC1,0x04,0x04,0x00,0xA9,0x02,0x05,0x02,0x06,0x0D,0x01,0x02,0x03,0x8A,
+    0xA1,0xBB,0xAC,0xA1,0x98,0x8B,0x83,0x01,0x02,0x83,0x06,0x00,0x05,0x00,0x8B,0x82,0x81,0x90,0x8D,0x81,0x82,0x81,0x89,0x93,
+    0x89,0x02,0x03,0x0D,0x01,0x91,0x01,0x06,0x02,0x05,0xC2,0x00,0xD5,0x03,0x04,0xE2,0xF7,0x7F,0x00,0x0F,0x00,0x00,0xF7,0x04,
+    0x04,0x00,0x93,0x02,0x05,0x02,0x06,0x0D,0x01,0x02,0x03,0x87,0x90,0x8D,0x88,0x01,0x02,0x8C,0x93,0x8B,0x01,0x02,0x06,0x00,
+    0x05,0x00,0x8D,0x82,0x8D,0xB1,0xD0,0xB1,0xAB,0xA5,0x8B,0x88,0x81,0x02,0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0x00,0x96,0x04,
+    0x04,0xFF,0xF0,0x40,0x7F,0x00,0x10,0x00,0xFE,0x04,0x04,0x00,0xE3,0x03,0x05,0x01,0x06,0x0D,0x01,0x86,0x01,0x03,0x81,0x87,
+    0x89,0x8E,0x9F,0x9D,0xBA,0xDD,0x97,0x01,0x02,0x06,0x00,0x04,0x00,0xAB,0x88,0x01,0x02,0x87,0x8D,0x99,0xA8,0x9D,0x80,0x00,
+    0x86,0xA9,0x9C,0x8E,0x8D,0x87,0x0C,0x01,0x01,0x06,0x03,0x05,0xFF,0xFD,0xB4,0x04,0x04,0xFF,0xC8,0x40,0x01,0x00,0xBC,0xFF,
+    0x1A,0x8A,0xFF,0x0A,0x29,0x00,0xB1,0x7F,0x00,0x04,0x00,0xCA,0xB9,0xFF,0x1A,0x6A,0xBD,0x01,0x00,0x00,0x94,0xE1,0x03,0x04,
+    0x00,0xC1,0xCE,0x02,0x05,0x01,0x06,0x91,0x0C,0x01,0x89,0x92,0xA0,0xA1,0xB2,0x80,0xBA,0xA9,0x9B,0x96,0x88,0x02,0x02,0xA5,
+    0x05,0x00,0x04,0x00,0x95,0x01,0x02,0x8C,0x8D,0x8A,0x81,0x82,0x81,0x8B,0x90,0x94,0xA7,0xBB,0xA9,0x89,0x0B,0x01,0x91,0x01,
+    0x06,0x03,0x05,0xFF,0xFC,0x29,0x03,0x04,0xE1,0xF5,0x03,0x00,0xD5,0xC4,0x7F,0x00,0x04,0x00,0xBE,0xFF,0x01,0xA6,0x04,0x00,
+    0xFF,0xF0,0x80,0x03,0x04,0xD7,0x00,0x9C,0x02,0x05,0x02,0x06,0x0B,0x01,0x87,0xA0,0xB2,0xAB,0x97,0x96,0x8D,0x8A,0x01,0x02,
+    0x88,0x8B,0x8F,0x81,0x82,0x88,0x05,0x00,0x04,0x00,0xA0,0x01,0x02,0xA0,0x9D,0xA6,0x9E,0x9F,0x9C,0x8F,0x81,0x01,0x03,0x87,
+    0x8A,0x0C,0x01,0x02,0x06,0x02,0x05,0xB6,0x00,0xFC,0x03,0x04,0xE0,0xFF,0x20,0x00,0x7F,0x00,0x11,0x00,0xFF,0xD0,0xE0,0x04,
+    0x04,0x00,0x93,0x02,0x05,0x02,0x06,0x0C,0x01,0x01,0x08,0x81,0x01,0x03,0x89,0x8E,0x9B,0xA9,0xAC,0xA6,0xA7,0x8A,0x82,0x8A,
+    0x05,0x00,0x04,0x00,0x94,0x02,0x02,0x87,0x8C,0x95,0xA5,0xA3,0xAB,0x8C,0x82,0x02,0x03,0x0C,0x01,0x02,0x06,0x02,0x05,0x00,
+    0x96,0x04,0x04,0xA2,0x02,0x00,0xD9,0xF8,0x7F,0x00,0x08,0x00,0x00,0xBE,0xC4,0xCA,0x01,0x00,0xDA,0x04,0x04,0xFF,0xFC,0xAE,
+    0x03,0x05,0x01,0x06,0x91,0x0B,0x01,0x03,0x03,0x87,0x9B,0xAD,0xA8,0xA0,0x8F,0x88,0x83,0x01,0x02,0x88,0x05,0x00,0x04,0x00,
+    0x90,0x82,0x87,0x90,0x8B,0x89,0x87,0x01,0x03,0x88,0x81,0x02,0x03,0x0D,0x01,0x01,0x06,0x03,0x05,0xFF,0xFD,0x90,0x04,0x04,
+    0xFF,0xB0,0x20,0x01,0x00,0x00,0xA1,0xC7,0xFF,0x12,0x29,0xFF,0x1A,0x08,0x7F,0x00,0x06,0x00,0x00,0xE7,0xFF,0x2A,0x6A,0xB9,
+    0xD8,0x01,0x00,0x00,0xE1,0xD7,0x03,0x04,0x00,0xD5,0xB6,0x02,0x05,0x01,0x06,0x91,0x0C,0x01,0x03,0x03,0x88,0x81,0x82,0x81,
+    0x8A,0x8C,0x90,0x8C,0x82,0x81,0x05,0x00,0x03,0x00,0xA3,0x83,0x82,0x89,0x9F,0x9D,0xA6,0xAD,0xA3,0xA4,0x90,0x03,0x03,0x0C,
+    0x01,0x91,0x01,0x06,0x03,0x05,0xFF,0xFB,0xE4,0x04,0x04,0x00,0x89,0x7F,0x00,0x13,0x00,0xE0,0x03,0x04,0xC1,0xF1,0x02,0x05,
+    0x02,0x06,0x0C,0x01,0x86,0x02,0x03,0x89,0x99,0xA8,0x9A,0x01,0x2C,0xAB,0x95,0x01,0x02,0x95,0x04,0x00,0x03,0x00,0xA9,0x05,
+    0x02,0x8A,0x93,0x9C,0x95,0x81,0x02,0x03,0x0C,0x01,0x02,0x06,0x02,0x05,0xCE,0xFF,0xF9,0xA0,0x03,0x04,0xEC,0x7F,0x00,0x14,
+    0x00,0xFF,0xD0,0x40,0x04,0x04,0x00,0xB2,0x03,0x05,0x01,0x06,0x0D,0x01,0x01,0x03,0x82,0x8B,0xA5,0x98,0x8D,0x83,0x04,0x02,
+    0x92,0x04,0x00,0x03,0x00,0x9A,0x01,0x02,0x93,0xD2,0xC5,0x90,0x8B,0x88,0x83,0x82,0x03,0x03,0x0B,0x01,0x91,0x02,0x06,0x02,
+    0x05,0xFF,0xFE,0xF8,0x04,0x04,0xFF,0xD8,0xC0,0x02,0x00,0xC7,0xFF,0x1A,0x69,0x00,0x8C,0x7F,0x00,0x08,0x00,0xD8,0xFF,0x32,
+    0xAB,0xED,0xF9,0x01,0x00,0xFB,0x04,0x04,0xFF,0xFD,0x0E,0x03,0x05,0x02,0x06,0x0C,0x01,0x02,0x03,0x01,0x02,0x81,0x89,0x8F,
+    0x93,0x8E,0x98,0x81,0x82,0x92,0x04,0x00,0x03,0x00,0xA9,0x01,0x02,0x8F,0x9B,0xAB,0xB1,0xBA,0xB2,0x9D,0x90,0x03,0x03,0x0B,
+    0x01,0x02,0x06,0x03,0x05,0x00,0xCC,0x04,0x04,0xFE,0x03,0x00,0xCA,0xFF,0x01,0x65,0x7F,0x00,0x08,0x00,0xE5,0xC4,0xBC,0x02,
+    0x00,0x00,0xB3,0x04,0x04,0xFF,0xFB,0xE7,0x03,0x05,0x02,0x06,0x0B,0x01,0x91,0x02,0x03,0x8A,0xA1,0xBB,0xBA,0xB2,0xAD,0x9F,
+    0x8E,0x83,0x82,0x96,0x04,0x00,0x03,0x00,0x9F,0x05,0x02,0x81,0x8B,0x92,0x8A,0x03,0x03,0x0A,0x01,0x03,0x06,0x03,0x05,0xFF,
+    0xFD,0x10,0x03,0x04,0xE2,0xDA,0x7F,0x00,0x15,0x00,0xD7,0x03,0x04,0x00,0x9D,0xCE,0x02,0x05,0x03,0x06,0x0A,0x01,0x86,0x02,
+    0x03,0x87,0x01,0x13,0x88,0x05,0x02,0x90,0x04,0x00,0x03,0x00,0x93,0x82,0x81,0x00,0xF4,0xA5,0x95,0x93,0xB3,0x8F,0x8C,0x87,
+    0x01,0x03,0x82,0x83,0x91,0x08,0x01,0x03,0x06,0x03,0x05,0x82,0xFF,0xFC,0x49,0x03,0x04,0xE0,0x00,0x94,0x7F,0x00,0x15,0x00,
+    0xFF,0xE9,0x40,0x03,0x04,0xEE,0x00,0xA9,0x03,0x05,0x03,0x06,0x09,0x01,0x86,0x02,0x03,0x81,0x8A,0x8D,0x90,0x93,0x96,0x99,
+    0xA1,0x8F,0x82,0x89,0x04,0x00,0x02,0x00,0x00,0x8F,0x01,0x02,0x83,0x94,0xA9,0xB2,0xFF,0x10,0xC3,0x01,0x00,0xFF,0x21,0x25,
+    0xB1,0xAD,0xFF,0x7B,0xF0,0xA4,0x89,0x83,0x05,0x01,0x91,0x05,0x06,0x03,0x05,0x00,0xD2,0x00,0xBB,0x03,0x04,0xE9,0xFF,0x38,
+    0x00,0x01,0x00,0xD8,0xFF,0x43,0x0C,0xFF,0x5B,0x6D,0xC9,0x7F,0x00,0x09,0x00,0xFF,0x4A,0xEB,0xFF,0x5B,0x6D,0xED,0x02,0x00,
+    0xFF,0xC0,0x80,0x04,0x04,0x00,0xBC,0x03,0x05,0x05,0x06,0x06,0x01,0x83,0x87,0x94,0xA3,0x9E,0xA6,0xD0,0x02,0x00,0xD3,0x9D,
+    0x9B,0x89,0x01,0x02,0xA7,0x03,0x00,0x03,0x00,0x81,0x03,0x02,0x02,0x03,0x87,0x8D,0x92,0x99,0xA1,0xA7,0x8B,0x83,0x0B,0x06,
+    0x04,0x05,0xC2,0x00,0x9D,0x03,0x04,0xB4,0x7F,0x00,0x16,0x00,0xEA,0x04,0x04,0x00,0xB2,0x04,0x05,0x08,0x06,0x01,0x11,0x86,
+    0x83,0x87,0x97,0xA7,0x97,0x8E,0x90,0x89,0x86,0x01,0x03,0x04,0x02,0x9F,0x03,0x00,0x03,0x00,0x81,0x82,0xAF,0x99,0x94,0x95,
+    0x93,0xB8,0x8D,0x89,0x03,0x02,0x0C,0x03,0x05,0x05,0xF1,0x00,0xBF,0x03,0x04,0xA2,0x7F,0x00,0x16,0x00,0xDA,0xE1,0x03,0x04,
+    0xFF,0xFD,0x72,0x05,0x05,0x01,0x06,0x0A,0x03,0x03,0x02,0x87,0x8B,0x8D,0x90,0x92,0x98,0x9C,0x96,0x01,0x02,0xA7,0x03,0x00,
+    0x03,0x00,0x81,0x82,0xF2,0xC0,0xC3,0xA1,0x9A,0xA6,0xFF,0x4A,0x6A,0xA8,0x81,0x82,0x0A,0x03,0x05,0x02,0x03,0x05,0x00,0x96,
+    0x04,0x04,0xFF,0xD8,0xA0,0x7F,0x00,0x16,0x00,0xFB,0xC1,0x03,0x04,0xFF,0xFC,0xEE,0x82,0x03,0x05,0x02,0x02,0x01,0x03,0x02,
+    0x02,0x09,0x03,0x93,0xDE,0xAE,0xAD,0xA7,0xBF,0x94,0x8D,0x01,0x02,0xA7,0x03,0x00,0x03,0x00,0x81,0x02,0x02,0x83,0x91,0x81,
+    0x87,0xAA,0x81,0x08,0x03,0x01,0x08,0x01,0x03,0x90,0xA1,0x00,0xB6,0x92,0x81,0x04,0x02,0x00,0xDC,0x04,0x04,0xFF,0xC0,0x80,
+    0x01,0x00,0x00,0xBE,0xFF,0x12,0x6A,0xFF,0x32,0xAA,0x00,0xC0,0x7F,0x00,0x0A,0x00,0xC9,0x00,0xD7,0x00,0xA3,0xBD,0x01,0x00,
+    0x00,0x89,0xEC,0x03,0x04,0xFF,0xFC,0x6A,0x03,0x02,0x85,0x00,0xA6,0xD2,0x81,0x01,0x02,0xAA,0x94,0x99,0x8A,0x07,0x03,0x82,
+    0x81,0x01,0x07,0x01,0x01,0x86,0x83,0x02,0x02,0x9F,0x03,0x00,0x03,0x00,0x91,0x82,0x93,0x01,0x1F,0xC8,0xBF,0xC3,0xCD,0x90,
+    0x07,0x03,0x82,0xFC,0x80,0x89,0x92,0x03,0x00,0xB7,0x86,0x03,0x02,0x00,0xB2,0x04,0x04,0xFF,0xB0,0x40,0x7F,0x00,0x16,0x00,
+    0x00,0xB3,0xE0,0x03,0x04,0xFF,0xFB,0xE6,0x03,0x02,0x86,0xD8,0x80,0x89,0x01,0x02,0x8A,0x00,0xEF,0x80,0x9F,0x01,0x02,0x05,
+    0x03,0x82,0x88,0x8E,0x99,0xBF,0xC8,0xB7,0xC6,0x9C,0x01,0x02,0xB7,0x03,0x00,0x03,0x00,0x91,0x82,0x88,0x90,0xC5,0x8E,0xCD,
+    0x97,0xA1,0x00,0xA4,0x83,0x82,0x05,0x03,0x82,0x01,0x00,0xB8,0xFF,0x00,0x41,0x04,0x00,0xF3,0x03,0x02,0x00,0xE9,0x04,0x04,
+    0x00,0x8A,0x7F,0x00,0x16,0x00,0xFF,0x20,0x00,0xFF,0xF0,0x80,0x03,0x04,0xFF,0xFB,0x81,0xB6,0x85,0x01,0x02,0x86,0xD5,0x80,
+    0x9F,0xBF,0x01,0x1B,0xFF,0x39,0xA6,0x01,0x00,0x8B,0x82,0x05,0x03,0x82,0x00,0xCA,0xBF,0x9B,0x99,0xD2,0x92,0x93,0x00,0x80,
+    0x01,0x02,0xB7,0x03,0x00,0x03,0x00,0x91,0x04,0x02,0x83,0x86,0x81,0x86,0x01,0x02,0x05,0x03,0x82,0x01,0x00,0x93,0x01,0x00,
+    0x90,0x86,0xDE,0x80,0xCD,0x03,0x02,0xFF,0xFD,0xB4,0x04,0x04,0xFB,0x01,0x00,0xB9,0x00,0xA3,0x00,0xD7,0xBE,0x7F,0x00,0x0B,
+    0x00,0x00,0x8C,0x00,0xA3,0xFF,0x12,0x6A,0xBC,0x01,0x00,0xB4,0x03,0x04,0x00,0xD5,0xB6,0x02,0x02,0x85,0xC9,0x07,0x00,0x8E,
+    0x82,0x04,0x03,0x02,0x02,0x91,0x81,0x86,0x83,0x04,0x02,0xA8,0x03,0x00,0x03,0x00,0x86,0x82,0xC0,0x02,0x46,0x00,0x82,0xC6,
+    0x9F,0xC5,0x02,0x02,0x03,0x03,0x01,0x02,0x01,0x00,0x96,0x01,0x00,0x8D,0x82,0x00,0xF2,0x80,0xFF,0x9D,0x35,0x03,0x02,0xFF,
+    0xFD,0x94,0x04,0x04,0xF5,0x02,0x00,0xBC,0xBE,0x7F,0x00,0x0C,0x00,0xBE,0x00,0x87,0xBC,0x02,0x00,0xB4,0x03,0x04,0x00,0xB8,
+    0xFF,0xFF,0xDD,0x02,0x02,0x85,0xC4,0x07,0x00,0x92,0x82,0x04,0x03,0x01,0x02,0x88,0x00,0xD9,0x01,0x46,0xA3,0x00,0x82,0xD6,
+    0x9B,0x83,0x82,0xB7,0x03,0x00,0x03,0x00,0x81,0x82,0x89,0x00,0xD6,0xC5,0x00,0xAD,0xC0,0xFF,0xB6,0x18,0xD2,0xB8,0x04,0x02,
+    0x83,0x02,0x02,0x04,0x00,0x9B,0x92,0x01,0x00,0x00,0xA6,0x03,0x02,0xFF,0xFD,0x74,0x04,0x04,0xF7,0x7F,0x00,0x17,0x00,0xB4,
+    0x03,0x04,0xFF,0xFA,0xA0,0xCE,0x02,0x02,0x85,0xC9,0x80,0xD2,0x01,0x33,0x02,0x13,0xB3,0x87,0x07,0x02,0xAA,0xC0,0x00,0xFB,
+    0xC0,0x00,0xB5,0xC5,0x93,0x00,0xA8,0x01,0x02,0xB7,0x03,0x00,0x03,0x00,0x81,0x82,0x83,0xDC,0x01,0x66,0x01,0x67,0x00,0xC5,
+    0x02,0x83,0x01,0x84,0x00,0x83,0x00,0xF6,0x02,0x02,0xD3,0x03,0x00,0xC6,0xC8,0x80,0x00,0xF2,0x81,0x03,0x02,0xFF,0xFD,0x74,
+    0x04,0x04,0x00,0x94,0x04,0x00,0xBC,0x00,0xA5,0x7F,0x00,0x08,0x00,0x00,0xA5,0x00,0xE5,0x05,0x00,0xA2,0x03,0x04,0x00,0xD8,
+    0xCE,0x02,0x02,0x85,0x00,0x91,0xFF,0x3A,0x49,0xAA,0x08,0x02,0x83,0xFF,0xF7,0x3C,0x01,0x84,0x01,0x83,0x00,0xC5,0x00,0x83,
+    0x00,0xC5,0x01,0x67,0x01,0x66,0xCF,0x01,0x02,0xB7,0x03,0x00,0x03,0x00,0x81,0x82,0xFF,0xEC,0x6C,0xFF,0xE8,0x60,0x05,0x34,
+    0x04,0x22,0xFF,0xF5,0x92,0x02,0x02,0x89,0x93,0x92,0x98,0x99,0x8F,0x8E,0xBF,0xAA,0x04,0x02,0xFF,0xFD,0x74,0x04,0x04,0xEF,
+    0x80,0x00,0xA2,0x00,0xCF,0xFF,0xCE,0xDB,0x00,0xA8,0x8F,0x8B,0x9C,0xD5,0x7F,0x00,0x05,0x00,0xFF,0x4A,0xAA,0x8F,0xB8,0x8F,
+    0xFF,0xCE,0xBB,0xFF,0xC6,0x7A,0xFF,0x43,0x4D,0x01,0x00,0xA2,0x03,0x04,0x00,0xD8,0xCE,0x03,0x02,0xF0,0xBF,0xC3,0xAF,0xC6,
+    0xA8,0x97,0xA0,0x00,0xAD,0x88,0x01,0x02,0x00,0x84,0xFF,0xE9,0x00,0x04,0x22,0x05,0x34,0xFF,0xEA,0x20,0xCF,0x82,0xB7,0x03,
+    0x00,0x03,0x00,0x81,0x82,0xFF,0xFE,0x57,0x00,0x8D,0x02,0xC2,0xFF,0xF4,0xAE,0xFF,0xF4,0x8E,0xFF,0xF4,0x8D,0xFF,0xEC,0x6D,
+    0xFF,0xEC,0x4D,0xFF,0xEC,0x4D,0xFF,0xEC,0x2C,0xFF,0xEC,0x6D,0xFF,0xF6,0x98,0x06,0x02,0x87,0x96,0xC9,0xB5,0x8B,0x85,0x03,
+    0x02,0xFF,0xFD,0x74,0x04,0x04,0x00,0x94,0x01,0x00,0xFF,0x6C,0x31,0xFF,0x95,0x14,0xFF,0x95,0x14,0xBF,0xC3,0xD6,0x7F,0x00,
+    0x06,0x00,0xFF,0x29,0xE7,0xBF,0xFF,0x9D,0x34,0xBF,0xFF,0x95,0x14,0xFF,0x8C,0xD3,0xED,0x01,0x00,0xA2,0x03,0x04,0x00,0xD8,
+    0xCE,0x03,0x02,0x00,0xB5,0x80,0xCA,0x00,0xD6,0x04,0x00,0x92,0x01,0x02,0xF1,0x00,0x8D,0xFF,0xEC,0x2C,0xFF,0xEC,0x4D,0xFF,
+    0xEC,0x4D,0xFF,0xEC,0x6D,0xFF,0xF4,0x6D,0xFF,0xF4,0x8E,0xFF,0xF4,0xAE,0xFF,0xF4,0xAE,0x02,0xC2,0xFF,0xF5,0x73,0x83,0x82,
+    0xB7,0x03,0x00,0x03,0x00,0x81,0x02,0x02,0x01,0x36,0xC2,0x87,0xFF,0xF7,0x7D,0x87,0x04,0x42,0x01,0x03,0x04,0x02,0x93,0x00,
+    0xA2,0x03,0x00,0xF3,0x03,0x02,0xFF,0xFD,0x74,0x04,0x04,0x00,0x94,0x7F,0x00,0x17,0x00,0xA2,0x03,0x04,0x00,0x9D,0xCE,0x02,
+    0x02,0x85,0xFF,0x4A,0xEB,0x80,0xB7,0x00,0x80,0x04,0x00,0x98,0x82,0x83,0x82,0xFF,0xFF,0xBF,0x04,0x42,0xFF,0xF7,0x7D,0xFF,
+    0xF7,0x7D,0x01,0x42,0x01,0x36,0x02,0x02,0xB7,0x03,0x00,0x03,0x00,0x81,0x82,0x8E,0xD6,0xB5,0x00,0x85,0x01,0x4C,0xE8,0x00,
+    0xFA,0x01,0x02,0x05,0x03,0x82,0x96,0xB0,0x82,0x95,0x04,0x00,0xC5,0x03,0x02,0xFF,0xFD,0x94,0x04,0x04,0xF7,0x7F,0x00,0x17,
+    0x00,0xB4,0x03,0x04,0xFF,0xFA,0xC0,0xCE,0x02,0x02,0xAA,0x01,0x00,0x89,0x82,0x00,0x99,0x80,0xC0,0xE8,0x80,0x98,0x82,0x03,
+    0x03,0x02,0x02,0xAF,0x00,0xDB,0x00,0x99,0xFF,0x63,0x6E,0x00,0xEB,0x00,0x85,0xB5,0xC8,0x83,0x82,0xB7,0x03,0x00,0x03,0x00,
+    0x86,0x82,0xAA,0x01,0x0C,0x02,0x09,0xAF,0x81,0x01,0x02,0x05,0x03,0x82,0x01,0x00,0xAC,0xA0,0xC0,0x00,0xB6,0x01,0x00,0xD2,
+    0x81,0x03,0x02,0xFF,0xFD,0xB4,0x04,0x04,0xF5,0x01,0x00,0xD9,0x00,0x7F,0xFF,0x2A,0x69,0xBE,0x7F,0x00,0x0B,0x00,0xFF,0x22,
+    0x29,0xFF,0x12,0x49,0xFF,0x02,0x28,0x02,0x00,0xB4,0x03,0x04,0x00,0xB8,0xB6,0x02,0x02,0x86,0xCA,0x80,0x94,0x8F,0x01,0x00,
+    0x8E,0xAB,0x80,0xD2,0x82,0x04,0x03,0x02,0x02,0xF2,0x00,0xCA,0x01,0x09,0x8C,0xB0,0x89,0x01,0x02,0xA8,0x03,0x00,0x03,0x00,
+    0x91,0x01,0x02,0x83,0x87,0xAF,0x8B,0x90,0x92,0xB8,0x83,0x82,0x05,0x03,0x82,0xCC,0x02,0x00,0xFF,0x31,0xE7,0x00,0xF0,0x80,
+    0xBE,0x88,0x04,0x02,0xFF,0xFD,0xD4,0x04,0x04,0xDA,0x7F,0x00,0x17,0x00,0xE9,0x03,0x04,0x00,0xC1,0xB6,0x85,0x02,0x02,0xFF,
+    0x8C,0xB2,0x04,0x00,0x8C,0xAD,0x80,0x98,0x82,0x05,0x03,0x82,0xAA,0xC5,0x96,0xB8,0x8C,0x88,0x81,0x02,0x02,0xA8,0x03,0x00,
+    0x03,0x00,0x91,0x82,0x8E,0xA6,0x01,0x54,0x01,0xF3,0x00,0xF8,0x97,0x08,0x03,0x81,0x92,0x00,0x88,0x04,0x00,0xAF,0x04,0x02,
+    0x00,0xCC,0x04,0x04,0xEA,0x7F,0x00,0x16,0x00,0x00,0xB0,0xDB,0x03,0x04,0xFF,0xFB,0xA4,0x00,0xD2,0x03,0x02,0xAF,0xFF,0x21,
+    0xE7,0x02,0x00,0x97,0x82,0xC3,0x80,0x90,0x82,0x05,0x03,0x82,0x8B,0x9E,0x04,0x54,0xB7,0x01,0x02,0x9F,0x03,0x00,0x03,0x00,
+    0x81,0x82,0x81,0x89,0xAF,0x88,0x87,0x81,0x02,0x02,0x08,0x03,0x01,0x02,0x93,0x00,0x85,0x01,0x00,0xFF,0x42,0x6A,0xF0,0x04,
+    0x02,0x00,0xA7,0x04,0x04,0xFF,0xB8,0x60,0x02,0x00,0xC4,0xBD,0xC9,0x7F,0x00,0x0A,0x00,0xE5,0x01,0x3D,0xF8,0x01,0x00,0x00,
+    0x95,0xC1,0x03,0x04,0xFF,0xFC,0x28,0x05,0x02,0xAF,0xD2,0x97,0xB3,0x86,0x82,0x87,0x8A,0x81,0x06,0x03,0x02,0x02,0x83,0x87,
+    0x88,0x8A,0x89,0x8A,0x01,0x02,0x9F,0x03,0x00,0x03,0x00,0x81,0x01,0x02,0x81,0xAF,0x8D,0x93,0x8E,0xCD,0x95,0x81,0x0A,0x03,
+    0x82,0x83,0xB0,0x93,0x8B,0x86,0x82,0x03,0x05,0xDF,0x04,0x04,0xFF,0xD0,0xA0,0x02,0x00,0xFF,0x02,0x28,0x00,0xBD,0xBD,0x7F,
+    0x00,0x0A,0x00,0xE3,0x00,0x8C,0x00,0x7F,0xD8,0x01,0x00,0xF7,0xC1,0x03,0x04,0xFF,0xFC,0xAC,0x82,0x03,0x05,0x02,0x02,0x83,
+    0x01,0x02,0x0B,0x03,0xB0,0xA0,0x98,0x92,0x90,0x8C,0x87,0x02,0x02,0x9F,0x03,0x00,0x03,0x00,0x81,0x82,0xB8,0x9D,0xAE,0x01,
+    0x5E,0xA6,0xCC,0x9C,0x81,0x82,0x03,0x03,0x02,0x06,0x04,0x03,0x01,0x02,0x83,0x05,0x05,0xE7,0xEB,0x03,0x04,0x00,0xFD,0x7F,
+    0x00,0x16,0x00,0xDA,0xE0,0x03,0x04,0xFF,0xFD,0x30,0x05,0x05,0x86,0x0F,0x03,0x8D,0xC6,0x9D,0xDE,0x01,0x2E,0x00,0xC8,0x9C,
+    0x01,0x02,0xA7,0x03,0x00,0x03,0x00,0x81,0x01,0x02,0x8A,0x88,0x81,0x02,0x02,0x83,0x87,0x88,0x8A,0x89,0x87,0x01,0x06,0x01,
+    0x11,0x08,0x06,0x04,0x05,0x00,0xC6,0x00,0xD1,0x03,0x04,0xB4,0x7F,0x00,0x16,0x00,0x00,0x8A,0x04,0x04,0xFF,0xFD,0xD4,0x04,
+    0x05,0x0C,0x06,0x81,0x8A,0x89,0x8A,0x87,0x81,0x02,0x02,0x83,0xAA,0x89,0x87,0x01,0x02,0xA7,0x03,0x00,0x02,0x00,0xFF,0x10,
+    0xA2,0x83,0x01,0x02,0x87,0x8F,0x95,0x94,0x99,0x97,0x9F,0x9E,0xD4,0x00,0x90,0xBB,0x8D,0x83,0x05,0x01,0x06,0x06,0x03,0x05,
+    0xB6,0x00,0xB4,0x03,0x04,0xE9,0x02,0x00,0x00,0xAF,0x00,0xA3,0xFF,0x42,0xEC,0xBE,0x7F,0x00,0x09,0x00,0xFF,0x32,0x6A,0xFF,
+    0x42,0xEC,0xFF,0x01,0x87,0x02,0x00,0xF6,0x04,0x04,0x00,0xFE,0x04,0x05,0x04,0x06,0x91,0x05,0x01,0x83,0x88,0x9F,0x00,0xED,
+    0xFF,0x4A,0x6A,0xAC,0xA9,0xC8,0x9C,0xA0,0x8E,0x93,0x89,0x02,0x02,0xB7,0x03,0x00,0x02,0x00,0x00,0x8F,0x83,0x82,0x88,0xAC,
+    0xD0,0x01,0x64,0xF4,0xA6,0x9F,0x92,0x8D,0x8C,0x89,0x09,0x01,0x91,0x03,0x06,0x03,0x05,0x82,0xFF,0xFB,0xC5,0x03,0x04,0xE1,
+    0x00,0xA0,0x01,0x00,0xCA,0xC9,0xD8,0x7F,0x00,0x0A,0x00,0xE3,0xD8,0xC9,0x02,0x00,0xFF,0xD1,0x00,0x04,0x04,0xFF,0xFE,0xF8,
+    0x03,0x05,0x03,0x06,0x91,0x09,0x01,0x8A,0x8C,0x8B,0x93,0xC3,0xAB,0xD4,0x01,0xF0,0xD0,0xBA,0x95,0x82,0x81,0x9D,0x03,0x00,
+    0x03,0x00,0x9B,0x01,0x02,0x88,0x87,0x02,0x02,0x81,0x8A,0x81,0x03,0x03,0x0A,0x01,0x03,0x06,0x03,0x05,0xFF,0xFC,0xCE,0x03,
+    0x04,0xEB,0xFB,0x7F,0x00,0x15,0x00,0xEE,0x03,0x04,0x00,0xAB,0x00,0x97,0x03,0x05,0x02,0x06,0x0A,0x01,0x86,0x03,0x03,0x01,
+    0x08,0x83,0x01,0x02,0x81,0x8A,0x83,0x82,0x8F,0x04,0x00,0x03,0x00,0xA9,0x01,0x02,0x88,0x96,0xD2,0x97,0xA1,0xAB,0x9D,0x8F,
+    0x02,0x03,0x86,0x0B,0x01,0x02,0x06,0x03,0x05,0x00,0xFF,0x04,0x04,0xEA,0x04,0x00,0xD5,0x7F,0x00,0x09,0x00,0x00,0xE7,0x03,
+    0x00,0x00,0xAE,0xEB,0x03,0x04,0xFF,0xFB,0x64,0x03,0x05,0x02,0x06,0x91,0x0B,0x01,0x02,0x03,0x8A,0xA1,0xAC,0xA7,0xA5,0xA0,
+    0x95,0x8B,0x01,0x02,0x93,0x04,0x00,0x03,0x00,0x9A,0x01,0x02,0x98,0xA3,0xA8,0x97,0x94,0x96,0x8B,0x81,0x02,0x03,0x86,0x0B,
+    0x01,0x91,0x01,0x06,0x03,0x05,0x00,0xBC,0x04,0x04,0xFF,0xC8,0x40,0x02,0x00,0xED,0xFF,0x22,0x69,0x00,0xC0,0x7F,0x00,0x08,
+    0x00,0xCA,0xFF,0x2A,0x6A,0xFF,0x12,0x69,0xCA,0x01,0x00,0x00,0x94,0x04,0x04,0xFF,0xFC,0xAB,0x03,0x05,0x02,0x06,0x0C,0x01,
+    0x03,0x03,0x8A,0xB8,0x95,0x9C,0xA4,0xA3,0xA1,0x87,0x82,0x92,0x04,0x00,0x03,0x00,0xAB,0x05,0x02,0x83,0x88,0x8C,0x00,0xCA,
+    0x02,0x03,0x86,0x0C,0x01,0x02,0x06,0x02,0x05,0xDC,0xD7,0x03,0x04,0x00,0xAC,0x02,0x00,0x00,0x8B,0x7F,0x00,0x0C,0x00,0x00,
+    0xA1,0x02,0x00,0xFF,0xB8,0x80,0x04,0x04,0xFF,0xFD,0xD2,0x03,0x05,0x01,0x06,0x91,0x0C,0x01,0x02,0x03,0x87,0x8C,0x8A,0x87,
+    0x02,0x02,0x83,0x01,0x02,0x95,0x04,0x00,0x03,0x00,0xA3,0x01,0x02,0x83,0x90,0x98,0x97,0xA7,0xAC,0xBB,0x99,0x81,0x02,0x03,
+    0x0C,0x01,0x02,0x06,0x03,0x05,0x00,0xB8,0x03,0x04,0xE1,0x00,0xAE,0x7F,0x00,0x13,0x00,0xFF,0xE8,0x40,0x04,0x04,0x00,0x9C,
+    0x02,0x05,0x02,0x06,0x0D,0x01,0x01,0x03,0x82,0x8F,0xA6,0xBB,0xAB,0x9B,0xA0,0x92,0x8A,0x01,0x02,0x96,0x04,0x00,0x03,0x00,
+    0xAE,0x8A,0x82,0x8C,0x01,0x21,0x9C,0x95,0x8D,0x89,0x87,0x03,0x03,0x0C,0x01,0x91,0x01,0x06,0x03,0x05,0xFF,0xFC,0xAA,0x04,
+    0x04,0xF5,0x03,0x00,0xD8,0xFF,0x11,0xE8,0x7F,0x00,0x06,0x00,0xD5,0xFF,0x0A,0x08,0x04,0x00,0xC1,0x03,0x04,0x00,0x9E,0xCF,
+    0x02,0x05,0x02,0x06,0x0D,0x01,0x02,0x03,0x86,0x8A,0x8C,0x93,0xA0,0xA4,0xA7,0x8E,0x01,0x02,0x9E,0x04,0x00,0x04,0x00,0x8E,
+    0x04,0x02,0x81,0x88,0x8B,0x92,0x88,0x02,0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0x00,0x93,0x04,0x04,0x00,0x9F,0x01,0x00,0xC4,
+    0xFF,0x3B,0x0C,0xFF,0x12,0x49,0xC9,0x7F,0x00,0x07,0x00,0xBD,0xFF,0x3A,0xEB,0xFF,0x02,0x8A,0x01,0x00,0x00,0x94,0xC1,0x03,
+    0x04,0xFF,0xFB,0xE7,0x03,0x05,0x01,0x06,0x91,0x0C,0x01,0x02,0x03,0x81,0x90,0x93,0x89,0x87,0x04,0x02,0x87,0x05,0x00,0x04,
+    0x00,0xA0,0x01,0x02,0x8C,0x95,0x97,0xA3,0xA6,0xAE,0xA3,0x89,0x01,0x02,0x83,0x0D,0x01,0x02,0x06,0x02,0x05,0xF1,0x04,0x04,
+    0xFF,0xF0,0x20,0x7F,0x00,0x12,0x00,0xF6,0x04,0x04,0x00,0xBA,0x03,0x05,0x01,0x06,0x0D,0x01,0x01,0x03,0x82,0x81,0x9C,0xA6,
+    0xBB,0xAD,0xA4,0x94,0x90,0x83,0x82,0x8A,0x05,0x00,0x04,0x00,0x94,0x01,0x02,0x98,0xA1,0x9C,0x96,0x8B,0x8A,0x87,0x83,0x8A,
+    0x90,0x94,0xA0,0x8A,0x0B,0x01,0x91,0x01,0x06,0x02,0x05,0x82,0x00,0xB4,0x03,0x04,0xE0,0x00,0x95,0x7F,0x00,0x11,0x00,0x00,
+    0xD0,0x04,0x04,0x00,0xDC,0x02,0x05,0x02,0x06,0x0B,0x01,0x87,0x92,0x9C,0x92,0x8C,0x01,0x01,0x88,0x89,0x8F,0x94,0x01,0x24,
+    0x8A,0x82,0x8A,0x05,0x00,0x04,0x00,0x92,0x03,0x02,0x83,0x8C,0x8F,0x94,0xAD,0xAE,0xB1,0xA6,0x9E,0x99,0x88,0x0C,0x01,0x01,
+    0x06,0x03,0x05,0xFF,0xFD,0x10,0x04,0x04,0xFE,0x02,0x00,0xD5,0xED,0x00,0xD7,0x10,0x00,0x00,0x8F,0x72,0x00,0xFF,0x01,0xA6,
+    0xFF,0x32,0xAA,0xC4,0x02,0x00,0x00,0xB3,0x04,0x04,0x00,0xD8,0xF1,0x02,0x05,0x02,0x06,0x0C,0x01,0x96,0xA3,0xA6,0x02,0x31,
+    0xA1,0x92,0x8D,0x87,0x03,0x02,0x88,0x05,0x00,0x05,0x00,0x8B,0x82,0x8A,0xA5,0xAD,0xFC,0x00,0x8F,0xBB,0xA4,0x98,0x8C,0x02,
+    0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0xFD,0x04,0x04,0x00,0xDE,0x01,0x00,0xBC,0xFF,0x02,0x6A,0xF8,0x7F,0x00,0x07,0x00,0xC7,
+    0xFF,0x01,0xC8,0x01,0x00,0xEA,0xE1,0x03,0x04,0xFF,0xFC,0x4A,0x03,0x05,0x01,0x06,0x91,0x0C,0x01,0x83,0x01,0x02,0x88,0x96,
+    0x97,0x9A,0xD3,0x00,0x9B,0xBB,0xA7,0x96,0x01,0x02,0x00,0x86,0x05,0x00,0x05,0x00,0x8F,0x82,0x8A,0x9C,0xA0,0x8F,0x88,0x81,
+    0x82,0x87,0x81,0x02,0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0xD1,0x00,0xD8,0x03,0x04,0xE2,0x00,0x95,0x7F,0x00,0x0F,0x00,0xFF,
+    0xD0,0xA0,0x04,0x04,0x00,0xDD,0x03,0x05,0x01,0x06,0x0D,0x01,0x03,0x03,0x87,0x01,0x03,0x87,0x89,0x8E,0x97,0x92,0x01,0x02,
+    0x06,0x00,0x05,0x00,0x8B,0x03,0x02,0x87,0x8D,0xA0,0xAD,0xBA,0x92,0x82,0x01,0x03,0x0D,0x01,0x91,0x01,0x06,0x03,0x05,0x00,
+    0xE4,0x04,0x04,0xEA,0x04,0x00,0xBE,0x7F,0x00,0x02,0x00,0x00,0x87,0xE5,0x03,0x00,0xFF,0x38,0x00,0xD7,0x04,0x04,0x00,0x92,
+    0x02,0x05,0x02,0x06,0x0D,0x01,0x02,0x03,0x89,0x9E,0xAE,0xA8,0x92,0x8A,0x04,0x02,0x06,0x00,0x05,0x00,0x8D,0x83,0x82,0x8D,
+    0xA8,0xA6,0xAE,0x9A,0x99,0x8F,0x81,0x82,0x01,0x03,0x0E,0x01,0x01,0x06,0x03,0x05,0x00,0x93,0x04,0x04,0xFF,0xD8,0x80,0x02,
+    0x00,0xBD,0xFF,0x32,0xCB,0x00,0x8C,0x7F,0x00,0x02,0x00,0xD8,0xFF,0x3A,0xCB,0xFF,0x12,0x8A,0xBC,0x01,0x00,0xDA,0x04,0x04,
+    0x00,0x9E,0xB6,0x02,0x05,0x01,0x06,0x91,0x0D,0x01,0x03,0x03,0x89,0x8E,0xA1,0xAC,0xAE,0xAB,0x8E,0x01,0x02,0x88,0x06,0x00,
+    0x06,0x00,0x87,0x82,0x8D,0x8E,0x8D,0x87,0x01,0x02,0x89,0x93,0x87,0x02,0x03,0x0D,0x01,0x02,0x06,0x02,0x05,0xFF,0xFF,0x7B,
+    0x00,0xBF,0x03,0x04,0xDB,0x00,0xA0,0x01,0x00,0x00,0xA1,0x7F,0x00,0x06,0x00,0xBC,0x02,0x00,0xFF,0xF0,0xC0,0x04,0x04,0x00,
+    0xE6,0x03,0x05,0x01,0x06,0x91,0x0D,0x01,0x02,0x03,0x01,0x0D,0x83,0x82,0x83,0x8A,0x01,0x12,0x01,0x02,0x9E,0x06,0x00,0x06,
+    0x00,0x88,0x02,0x02,0x83,0x8B,0xA0,0x9E,0xBA,0x9D,0x89,0x02,0x03,0x0D,0x01,0x02,0x06,0x03,0x05,0xFF,0xFC,0x28,0x04,0x04,
+    0xFF,0xC0,0x80,0x7F,0x00,0x0C,0x00,0xEF,0xD7,0x04,0x04,0x00,0x96,0x03,0x05,0x01,0x06,0x0D,0x01,0x02,0x03,0x81,0x9C,0xD0,
+    0xA6,0xA8,0x96,0x88,0x03,0x02,0x9E,0x06,0x00,0x06,0x00,0x8A,0x01,0x02,0x8E,0x9D,0xAE,0x9A,0x94,0x8C,0x04,0x03,0x0D,0x01,
+    0x91,0x01,0x06,0x03,0x05,0x00,0x93,0x04,0x04,0xEB,0x03,0x00,0xC9,0xFF,0x42,0xCB,0xE3,0x7F,0x00,0xFF,0x3A,0xAB,0xC7,0x03,
+    0x00,0xFF,0xC8,0x60,0x04,0x04,0x00,0xD5,0x00,0xD2,0x02,0x05,0x02,0x06,0x0D,0x01,0x04,0x03,0x88,0x92,0xA1,0xAC,0xAE,0xA4,
+    0x87,0x82,0x83,0xAD,0x06,0x00,0x06,0x00,0xA6,0x01,0x02,0x8F,0x90,0x88,0x01,0x02,0x89,0x92,0x95,0x87,0x03,0x03,0x0C,0x01,
+    0x01,0x06,0x03,0x05,0xD1,0xFF,0xF9,0x80,0x03,0x04,0xE1,0x00,0x8A,0x01,0x00,0xF8,0xFF,0x02,0x69,0xD5,0x7F,0x00,0x01,0x00,
+    0xC7,0xFF,0x02,0x28,0x01,0x00,0x00,0xAE,0xEC,0x04,0x04,0xFF,0xFD,0xB2,0x03,0x05,0x02,0x06,0x0B,0x01,0x04,0x03,0x8D,0x8E,
+    0x8D,0x81,0x82,0x83,0x8C,0x96,0x81,0x82,0x98,0x07,0x00,0x06,0x00,0xAC,0x83,0x02,0x02,0x89,0x98,0x9A,0xB2,0xB1,0x98,0x81,
+    0x01,0x02,0x89,0x8B,0x0C,0x01,0x02,0x06,0x03,0x05,0x00,0xE4,0x04,0x04,0x00,0xF7,0x7F,0x00,0x0A,0x00,0xFE,0xE2,0x03,0x04,
+    0x00,0xD1,0xE6,0x03,0x05,0x02,0x06,0x0B,0x01,0x88,0x8B,0x81,0x01,0x02,0x8D,0xA9,0xBA,0x9D,0x9B,0x90,0x81,0x02,0x02,0x98,
+    0x07,0x00,0x06,0x00,0xAC,0x89,0x82,0x83,0xA4,0x9E,0xA5,0x90,0x88,0x83,0x8A,0x8D,0xA5,0xB1,0x00,0xC3,0xA5,0x87,0x0B,0x01,
+    0x02,0x06,0x03,0x05,0xDF,0xEB,0x03,0x04,0xE1,0x00,0x8A,0x03,0x00,0x00,0xE7,0xFF,0x2A,0x6A,0xBE,0x7B,0x00,0xFF,0x1A,0x08,
+    0xBD,0x03,0x00,0xFF,0x10,0x00,0x00,0xAC,0x04,0x04,0xFF,0xFC,0xEE,0x82,0x03,0x05,0x02,0x06,0x0A,0x01,0x83,0x8B,0xB1,0xBA,
+    0xA7,0x92,0x89,0x01,0x01,0x8B,0x98,0xA7,0x9A,0x8D,0x82,0x81,0xA8,0x07,0x00,0x07,0x00,0x9B,0x01,0x02,0x88,0x83,0x82,0x87,
+    0x96,0xA5,0xD3,0x00,0x88,0xA9,0x99,0x8B,0x87,0x0C,0x01,0x02,0x06,0x03,0x05,0xB6,0xFF,0xFB,0xE8,0x04,0x04,0xFF,0xE0,0x40,
+    0x02,0x00,0xC4,0xFF,0x32,0xAB,0xD5,0x7D,0x00,0xFF,0x0A,0x29,0xED,0x02,0x00,0xF5,0xE1,0x04,0x04,0x00,0x9C,0x04,0x05,0x02,
+    0x06,0x0C,0x01,0x8A,0x95,0xA8,0xCB,0x80,0xA9,0x98,0x89,0x83,0x82,0x87,0x83,0x82,0x8B,0x08,0x00,0x07,0x00,0x94,0x83,0x01,
+    0x02,0x8F,0xBF,0xB2,0xD0,0xAD,0x94,0x8C,0x81,0x02,0x03,0x0B,0x01,0x91,0x02,0x06,0x04,0x05,0x00,0xB2,0x04,0x04,0xE1,0xF5,
+    0x06,0x00,0x00,0xB9,0x8E,0xFF,0x29,0xC7,0x73,0x00,0x00,0xEB,0x92,0xFF,0x32,0x49,0x06,0x00,0xFF,0xD8,0xA0,0x04,0x04,0xFF,
+    0xFC,0x28,0x82,0x04,0x05,0x02,0x06,0x0B,0x01,0x03,0x03,0xAF,0x96,0x9F,0xF4,0xD0,0xAB,0x98,0x8A,0x01,0x02,0x89,0x08,0x00,
+    0x08,0x00,0x93,0x82,0x89,0xAC,0x9E,0x8E,0x89,0x82,0x81,0x8F,0x8B,0x02,0x03,0x86,0x0A,0x01,0x03,0x06,0x04,0x05,0xCE,0x00,
+    0xC1,0x04,0x04,0x00,0xDE,0x04,0x00,0xFF,0x53,0x4D,0xF3,0x81,0xA1,0x00,0x87,0x73,0x00,0xFF,0x42,0x8A,0xFF,0xD6,0xFB,0x88,
+    0xFF,0x84,0x92,0xE3,0x03,0x00,0x00,0x94,0xDB,0x04,0x04,0x00,0xBC,0x05,0x05,0x03,0x06,0x0A,0x01,0x02,0x03,0x8A,0x93,0x88,
+    0x83,0x87,0x93,0x9B,0xB2,0x97,0x82,0x83,0x00,0x86,0x08,0x00,0x08,0x00,0x90,0x01,0x02,0x87,0x83,0x82,0x8C,0x98,0x9E,0xBA,
+    0x94,0x03,0x03,0x09,0x01,0x91,0x03,0x06,0x05,0x05,0x00,0xE2,0x04,0x04,0xDB,0xF7,0x01,0x00,0xBE,0xFF,0xA5,0x76,0xAA,0x00,
+    0xA6,0xFF,0x32,0x69,0x76,0x00,0xBE,0xFF,0x95,0x14,0xF0,0xFF,0xC6,0x9A,0xFF,0x33,0x0C,0x02,0x00,0x00,0xDE,0x04,0x04,0xFF,
+    0xFC,0x28,0x01,0x02,0x04,0x05,0x03,0x06,0x09,0x01,0x86,0x01,0x03,0x82,0x8D,0x9D,0xAE,0xA5,0x8F,0x81,0x82,0x81,0x83,0x82,
+    0x81,0x09,0x00,0x08,0x00,0xA8,0x88,0x01,0x02,0x93,0xA7,0x9D,0xA7,0xC0,0x8C,0x83,0x82,0x02,0x03,0x86,0x07,0x01,0x91,0x03,
+    0x06,0x06,0x05,0xCE,0x00,0xBB,0x04,0x04,0x00,0xFD,0x01,0x00,0xED,0xFF,0xA5,0xB6,0xFF,0x6B,0xF0,0x7A,0x00,0xFF,0x12,0x69,
+    0xFF,0x9D,0x76,0xFF,0x6C,0x30,0x01,0x00,0xDA,0x05,0x04,0x00,0xBC,0x07,0x02,0x01,0x03,0x01,0x06,0x08,0x01,0x04,0x03,0x88,
+    0x93,0x9B,0x9D,0xAB,0x99,0x89,0x01,0x02,0x98,0x09,0x00,0x09,0x00,0x8C,0x82,0x87,0xA4,0x8E,0x89,0x82,0x83,0x8B,0x9B,0x98,
+    0x81,0x02,0x03,0x06,0x01,0x01,0x06,0x03,0x03,0x07,0x02,0x00,0xB2,0x04,0x04,0xE2,0xDA,0x7F,0x00,0x03,0x00,0xFF,0xE8,0xA0,
+    0x04,0x04,0xFF,0xFC,0x2A,0x08,0x02,0x03,0x03,0x86,0x06,0x01,0x03,0x03,0x8D,0xA4,0x96,0x81,0x82,0x87,0x93,0x9B,0x8E,0x01,
+    0x02,0xBB,0x09,0x00,0x09,0x00,0x8B,0x03,0x02,0x87,0x96,0xA3,0xB2,0x9A,0x93,0x04,0x03,0x04,0x01,0x01,0x06,0x01,0x03,0x82,
+    0x01,0x03,0x86,0x81,0xAA,0x86,0x03,0x02,0xCE,0xFF,0xFB,0xC6,0x04,0x04,0x00,0xDE,0x03,0x00,0xBC,0xFF,0x12,0x49,0x00,0xC0,
+    0x74,0x00,0xD5,0x00,0xD7,0xCA,0x03,0x00,0xEA,0xE1,0x03,0x04,0xEB,0xFD,0x04,0x02,0x00,0x98,0x8B,0xB8,0x88,0x05,0x03,0x86,
+    0x03,0x01,0x86,0x03,0x03,0x89,0x9B,0xB1,0xAC,0x94,0x89,0x03,0x02,0x87,0xCB,0x09,0x00,0x09,0x00,0xD3,0x81,0x01,0x02,0x99,
+    0x9E,0xAB,0xA0,0x8B,0x83,0x88,0x8A,0x04,0x03,0x03,0x06,0x02,0x03,0x00,0xCA,0x92,0xA0,0xBF,0x00,0xDB,0x00,0xF2,0xFF,0x3A,
+    0x8A,0xFF,0x9D,0x34,0x85,0x03,0x02,0x00,0xA7,0x05,0x04,0xEA,0x02,0x00,0xB9,0xD9,0x76,0x00,0x00,0xA1,0xED,0x02,0x00,0x00,
+    0xB3,0xC1,0x04,0x04,0x00,0xE4,0x04,0x02,0x00,0xC4,0xFF,0x4B,0x0C,0x02,0x00,0xA4,0x8B,0x01,0x02,0x02,0x03,0x02,0x06,0x04,
+    0x03,0x87,0x89,0x83,0x8A,0x92,0x9F,0x9D,0xA1,0x8D,0x01,0x02,0x97,0x0A,0x00,0x09,0x00,0xA6,0x87,0x82,0x81,0x94,0x8F,0x86,
+    0x82,0x8A,0xA0,0x9D,0xCD,0x81,0x82,0x81,0x8C,0x89,0x81,0x03,0x03,0x82,0x90,0x07,0x00,0xFF,0xD6,0xFB,0x04,0x02,0xFF,0xFC,
+    0x29,0x04,0x04,0xD7,0x00,0xB3,0x7F,0x00,0x00,0xD0,0x04,0x04,0x00,0xE0,0x00,0xA9,0x03,0x02,0x85,0x00,0xEC,0x05,0x00,0x8E,
+    0x82,0x05,0x03,0x88,0x8B,0x87,0x01,0x02,0x8B,0x9D,0xA1,0x8D,0x83,0x82,0x89,0x8E,0x90,0x01,0x02,0x97,0x0A,0x00,0x0A,0x00,
+    0xA8,0x83,0x01,0x02,0x83,0x96,0x9A,0xB2,0xB7,0xB8,0x83,0x86,0x93,0xCC,0xFC,0x94,0x81,0x03,0x03,0x82,0x94,0x02,0x00,0x00,
+    0xEA,0xDE,0xBF,0x92,0x8B,0x85,0x04,0x02,0xDC,0x00,0xD8,0x04,0x04,0xEE,0x04,0x00,0xFF,0x32,0xAA,0x00,0xC0,0x70,0x00,0xBE,
+    0xFF,0x4B,0x2C,0xD8,0x03,0x00,0xF6,0x05,0x04,0x00,0x93,0x04,0x02,0xB3,0x01,0x00,0xB3,0xD5,0x03,0x00,0x95,0x82,0x04,0x03,
+    0x8B,0x00,0xF5,0x00,0x90,0x9C,0x8A,0x83,0x8A,0x99,0xA6,0xB1,0x99,0x8A,0x02,0x02,0x8D,0x0B,0x00,0x0A,0x00,0xAD,0x8B,0x82,
+    0x87,0xC6,0x9A,0x94,0x8A,0x82,0x88,0x98,0xAE,0xCB,0x97,0x8B,0x86,0x04,0x03,0x82,0x81,0xBB,0x80,0x00,0x9B,0x8E,0xA1,0x8F,
+    0x08,0x02,0x00,0xAA,0x05,0x04,0xFF,0xC0,0xA0,0x02,0x00,0xBD,0xC7,0x72,0x00,0xBC,0xED,0x02,0x00,0xEF,0xC1,0x04,0x04,0xFF,
+    0xFB,0xE8,0x00,0xD2,0x04,0x02,0xB3,0x01,0x00,0x8F,0x9A,0x80,0x97,0x01,0x00,0xA6,0x81,0x82,0x04,0x03,0x8A,0x8E,0x9E,0x00,
+    0x81,0x9F,0x8B,0x82,0x81,0x93,0xA8,0xAD,0x96,0x01,0x02,0x99,0x0B,0x00,0x0B,0x00,0x8E,0x01,0x02,0x89,0x83,0x82,0x89,0xA4,
+    0x00,0x90,0x00,0x8F,0x9C,0x89,0x83,0x82,0x06,0x03,0x82,0x90,0x03,0x00,0x00,0xF8,0x81,0x07,0x02,0x00,0xD2,0xFF,0xFC,0x29,
+    0x04,0x04,0xE0,0xF5,0x05,0x00,0xC9,0x6C,0x00,0xCA,0x06,0x00,0x00,0xF7,0x04,0x04,0xEE,0x00,0x96,0x05,0x02,0xAA,0x00,0x8B,
+    0x80,0xFF,0x4A,0xAA,0xA6,0x80,0x93,0xA0,0x01,0x00,0x88,0x82,0x04,0x03,0x01,0x02,0x81,0x8F,0xAB,0x80,0x9A,0x93,0x01,0x02,
+    0x8A,0x87,0x82,0x81,0x0C,0x00,0x0B,0x00,0x8F,0x8A,0x01,0x02,0x8C,0xA1,0x00,0x8F,0xD4,0xA0,0x87,0x82,0x81,0x82,0x06,0x03,
+    0x82,0x83,0x99,0x03,0x00,0x94,0x81,0x88,0x00,0x80,0xB0,0x86,0x04,0x02,0x00,0x92,0xFF,0xF9,0xA0,0x04,0x04,0xEE,0xFF,0x08,
+    0x00,0x03,0x00,0xFF,0x12,0x69,0xFF,0x42,0xEB,0x6C,0x00,0xFF,0x1A,0x29,0xFF,0x53,0x4D,0x04,0x00,0xFF,0xC0,0xE0,0x05,0x04,
+    0x00,0xE3,0x05,0x02,0x01,0x06,0x99,0x03,0x00,0xB2,0xFF,0x42,0x29,0x80,0xDE,0x86,0x82,0x06,0x03,0x81,0x86,0x83,0x90,0x9A,
+    0xFF,0x10,0xA3,0xAC,0x92,0x02,0x02,0x8D,0x0C,0x00,0x0C,0x00,0x8B,0x82,0x81,0xB5,0x9A,0x96,0x86,0x82,0x8B,0x00,0xB6,0xB7,
+    0xAA,0x82,0x05,0x03,0x01,0x02,0x9A,0x02,0x00,0x9C,0x8B,0xA3,0x02,0x00,0x00,0xDB,0xF0,0x04,0x02,0xFF,0xFD,0x70,0x05,0x04,
+    0xFF,0xD9,0x00,0x02,0x00,0xBE,0x00,0xB1,0x6E,0x00,0xF9,0xB9,0x02,0x00,0xDA,0xE0,0x04,0x04,0x00,0xAB,0x00,0xA9,0x85,0x03,
+    0x02,0xB3,0x00,0x9A,0x80,0xC8,0x00,0xD9,0x05,0x00,0x92,0x01,0x02,0x05,0x03,0x82,0xC5,0xB1,0x8E,0x81,0x82,0x8B,0x9B,0xA6,
+    0x96,0x01,0x02,0xD0,0x0C,0x00,0x0C,0x00,0xA4,0x01,0x02,0x88,0x01,0x02,0x8F,0x9F,0xB2,0xA5,0x8C,0x02,0x02,0x03,0x03,0x02,
+    0x02,0x8D,0x9F,0xA8,0x9A,0xA3,0x05,0x00,0xFF,0x7C,0x51,0x85,0x03,0x02,0xB6,0x00,0xBB,0x05,0x04,0xFF,0xC0,0xA0,0x05,0x00,
+    0xD8,0xC9,0x66,0x00,0x00,0x87,0xFF,0x1A,0x28,0x05,0x00,0x00,0x95,0xC1,0x05,0x04,0x00,0xE9,0x04,0x02,0xFF,0xC6,0x9A,0x03,
+    0x00,0x00,0xDA,0x8C,0xA0,0xD4,0x00,0xE5,0xAE,0x00,0xA4,0x03,0x02,0x02,0x03,0x02,0x02,0x81,0x93,0xAB,0x9D,0x98,0x81,0x82,
+    0x81,0x83,0x82,0x96,0x0D,0x00,0x0C,0x00,0x00,0x81,0x81,0x01,0x02,0xB0,0xA9,0xBB,0x97,0x8A,0x82,0xAF,0x95,0x88,0x01,0x02,
+    0x01,0x03,0x04,0x02,0x83,0x82,0x94,0x02,0x00,0x9D,0xB0,0x92,0x01,0x00,0xB8,0x04,0x02,0x00,0x92,0x05,0x04,0xD7,0xFB,0x03,
+    0x00,0xD5,0x00,0xA3,0x00,0xE7,0x67,0x00,0x00,0xBD,0xB9,0x04,0x00,0xFF,0xE9,0x40,0x05,0x04,0xFF,0xFC,0xAC,0x04,0x02,0x00,
+    0x98,0xFF,0x4A,0xEB,0x80,0xFF,0x01,0x65,0x00,0xC9,0x01,0x00,0xAA,0x82,0x8F,0x8B,0x83,0x08,0x02,0x83,0x01,0x13,0x82,0x86,
+    0x92,0xAD,0x00,0xF5,0x8E,0x02,0x02,0xA4,0x0D,0x00,0x0D,0x00,0xA5,0x01,0x02,0x95,0xA0,0x88,0x82,0x87,0x8E,0xD4,0xB7,0x88,
+    0x05,0x02,0x83,0x02,0x02,0x83,0xFF,0x5A,0xAB,0x03,0x00,0xB7,0x9B,0x01,0x00,0xB8,0x02,0x02,0x01,0x05,0x82,0x00,0xCD,0x05,
+    0x04,0xD7,0x00,0x95,0x02,0x00,0xC7,0xBC,0x69,0x00,0xBD,0x00,0xAF,0x02,0x00,0xF6,0x05,0x04,0x00,0xB4,0xDC,0x02,0x05,0x01,
+    0x02,0x89,0x01,0x00,0x00,0xB5,0x87,0x01,0x00,0x93,0x8C,0x80,0x00,0x9B,0x8A,0x01,0x02,0x01,0x03,0x05,0x02,0x8E,0xFF,0x42,
+    0x6A,0x00,0x82,0x8B,0x82,0x83,0x96,0xC3,0x87,0x82,0x8D,0x0E,0x00,0x0D,0x00,0xCB,0x88,0x02,0x02,0x81,0x8E,0xE8,0xB5,0x93,
+    0x86,0x87,0x81,0x83,0x01,0x02,0xCF,0xFF,0xF5,0xB4,0xFF,0xF4,0xF0,0x00,0xC6,0x01,0x02,0x88,0x01,0x00,0x00,0x8E,0x90,0xA3,
+    0x02,0x00,0xC4,0xAA,0x01,0x02,0x03,0x05,0xC2,0xFF,0xFB,0xE7,0x05,0x04,0x00,0xAC,0x06,0x00,0xD9,0x62,0x00,0xD8,0xF9,0x05,
+    0x00,0xEA,0xE2,0x04,0x04,0xD7,0x00,0xBC,0x04,0x05,0x82,0xF0,0x01,0x00,0xB7,0x82,0x9F,0x80,0x9A,0xAD,0x80,0xF4,0x81,0x82,
+    0x83,0xFF,0xF6,0x36,0xFF,0xEC,0xCF,0xFF,0xF6,0xF9,0x02,0x02,0x86,0xAA,0x82,0xAF,0x99,0x00,0xC8,0x9B,0x89,0x03,0x02,0x9F,
+    0x0E,0x00,0x0E,0x00,0x92,0x01,0x02,0x8C,0xD6,0xA7,0x8F,0x86,0xAA,0x94,0xB5,0x93,0x82,0xCF,0xFF,0xF5,0xD4,0xFF,0xE2,0x60,
+    0xA2,0xFF,0xEA,0xC0,0xD1,0x01,0x02,0x81,0xD0,0x80,0xCB,0x97,0xE4,0x02,0x00,0xC0,0x01,0x02,0x05,0x05,0xE6,0x00,0xB8,0x05,
+    0x04,0xFF,0xD8,0xA0,0x04,0x00,0xC7,0xC9,0x62,0x00,0x00,0xBE,0xB9,0x00,0xBE,0x03,0x00,0xDA,0xDB,0x05,0x04,0x00,0xE2,0x05,
+    0x05,0x82,0x86,0xC8,0x80,0x8E,0x82,0x8E,0x03,0x00,0xB3,0x01,0x02,0x83,0xFF,0xF5,0xD3,0x01,0x22,0xFF,0xEC,0xCE,0xFF,0xF7,
+    0x1B,0x82,0x88,0x00,0xB6,0xB7,0x8B,0x83,0x8A,0x97,0x00,0x85,0x8E,0x01,0x02,0x8A,0x0F,0x00,0x0F,0x00,0x89,0x82,0x81,0xAF,
+    0x82,0x86,0x93,0xCC,0xD6,0xB3,0xFF,0xF7,0x9D,0xFF,0xF6,0x57,0xFF,0xEA,0xA0,0xA2,0x00,0xFD,0x00,0xC7,0x00,0xC6,0x03,0x02,
+    0x95,0x04,0x00,0xFF,0x29,0xA6,0xB3,0x86,0x01,0x02,0x06,0x05,0xFF,0xFF,0x19,0x00,0x9E,0x05,0x04,0xFF,0xD8,0xC0,0x02,0x00,
+    0xBE,0x00,0xAF,0x02,0x00,0xBE,0x5C,0x00,0x00,0x8B,0xD5,0x02,0x00,0xC4,0x02,0x00,0xDA,0xD7,0x05,0x04,0x00,0xCB,0x82,0x06,
+    0x05,0x82,0x86,0x89,0x83,0x82,0x00,0x80,0x02,0x00,0xA3,0x03,0x02,0x83,0xFF,0xF6,0xB9,0xFF,0xEB,0x40,0x01,0x22,0x00,0xC7,
+    0xFF,0xF7,0x5C,0x89,0xBF,0xD4,0x00,0xB9,0x89,0x82,0x87,0x8A,0x01,0x02,0xAE,0x0F,0x00,0x0F,0x00,0x99,0x02,0x02,0x00,0xA8,
+    0xC6,0xCC,0x00,0xB5,0xFF,0xF7,0x9D,0x00,0x96,0xFF,0xEC,0x2A,0x01,0x22,0xFF,0xEC,0xCE,0xFF,0xF7,0x1A,0x83,0x04,0x02,0x81,
+    0x95,0xFF,0x6B,0x2C,0x00,0xED,0x00,0xF5,0x99,0xAF,0x82,0x01,0x03,0x01,0x06,0x06,0x05,0xFD,0xD7,0x04,0x04,0xE1,0xFF,0xD1,
+    0x00,0x05,0x00,0x01,0x3D,0x5C,0x00,0xE3,0x00,0x8C,0x00,0xBE,0x04,0x00,0x00,0x8A,0xFA,0x05,0x04,0xFF,0xFC,0xCD,0x00,0xF1,
+    0x05,0x05,0x02,0x06,0x83,0x82,0x83,0x82,0x81,0xFC,0x01,0x00,0x8A,0x05,0x02,0xCF,0xFF,0xF5,0xD4,0xFF,0xE2,0x20,0xA2,0xFF,
+    0xEA,0x40,0xFF,0xF6,0x15,0xCF,0xB0,0x9B,0x00,0xD4,0x98,0x83,0x01,0x02,0x90,0x10,0x00,0x0F,0x00,0xD5,0xAA,0x01,0x02,0x00,
+    0xF4,0xD2,0xAA,0xD1,0xFF,0xF4,0xEF,0xB4,0xA2,0xFF,0xEB,0xE7,0x00,0x84,0xB6,0x03,0x02,0x01,0x03,0x02,0x02,0x81,0xF2,0x87,
+    0x83,0x82,0x01,0x03,0x04,0x06,0x05,0x05,0x00,0xAA,0x06,0x04,0xFF,0xD0,0xE0,0x03,0x00,0xF9,0xBD,0x5E,0x00,0xD5,0xBD,0x03,
+    0x00,0xDA,0xEC,0x05,0x04,0xFF,0xFC,0x06,0xCF,0x04,0x05,0x05,0x06,0x01,0x03,0x82,0x83,0xA0,0x80,0xA0,0x82,0x02,0x03,0x04,
+    0x02,0xD1,0x00,0xC7,0x01,0x22,0xFF,0xEB,0x86,0xDF,0x83,0x8B,0xC8,0x8C,0x01,0x02,0xA7,0x10,0x00,0x10,0x00,0xA8,0x03,0x02,
+    0xDF,0xFF,0xEA,0x80,0xA2,0xFF,0xEA,0x80,0xFF,0xF6,0x35,0xFF,0xF7,0x7D,0x00,0x80,0xAA,0x02,0x02,0x0B,0x03,0x06,0x06,0x05,
+    0x05,0xFF,0xFD,0x4F,0x06,0x04,0xFF,0xD1,0x00,0x06,0x00,0xFF,0x0A,0x28,0x00,0xC0,0x56,0x00,0xE3,0x00,0x8C,0x06,0x00,0xDA,
+    0xFA,0x05,0x04,0xFF,0xFB,0x80,0xDC,0x04,0x05,0x07,0x06,0x02,0x03,0x81,0x8A,0x81,0x82,0x03,0x03,0x02,0x02,0x86,0xB0,0x88,
+    0xE7,0xFF,0xEC,0x2B,0xA2,0xB4,0xFF,0xF4,0xCE,0xD1,0x02,0x02,0x93,0x11,0x00,0x10,0x00,0xBA,0xB0,0x01,0x02,0xFF,0xED,0xD4,
+    0xA2,0xFF,0xE9,0xA0,0xFF,0xF5,0x93,0x00,0xC6,0x89,0x00,0xB9,0x00,0x99,0xB0,0x02,0x02,0x0A,0x03,0x09,0x06,0x03,0x05,0x82,
+    0xFF,0xFD,0x0E,0x05,0x04,0xE1,0xFF,0xD8,0xE0,0x04,0x00,0xE3,0xFF,0x32,0xCB,0x00,0x8B,0x57,0x00,0xFF,0x0A,0x49,0xB9,0x04,
+    0x00,0xEA,0xFA,0x05,0x04,0x00,0xC1,0xE7,0x04,0x05,0x04,0x06,0x02,0x11,0x02,0x06,0x09,0x03,0x01,0x02,0x81,0x00,0xDA,0x00,
+    0xD4,0xB3,0xC2,0x00,0xF9,0xFF,0xEB,0xC8,0xB4,0xFF,0xEB,0x20,0xB6,0x82,0x91,0x9F,0x11,0x00,0x11,0x00,0xC0,0x01,0x02,0xFF,
+    0xF6,0x77,0x00,0xB7,0x00,0xEE,0x81,0xD2,0x00,0x9A,0xB7,0x8B,0x83,0x86,0x01,0x02,0x08,0x03,0x01,0x06,0x05,0x01,0x91,0x03,
+    0x06,0x03,0x05,0xB6,0xFF,0xFC,0xCD,0x06,0x04,0x00,0xF7,0x00,0xAE,0x02,0x00,0xF9,0x02,0x00,0xCA,0xE5,0x51,0x00,0xC9,0x02,
+    0x00,0xCA,0x03,0x00,0xFF,0xB8,0x40,0xDB,0x05,0x04,0x00,0xAB,0x00,0x9C,0x04,0x05,0x03,0x06,0x06,0x01,0x91,0x86,0x08,0x03,
+    0x82,0x83,0x86,0xAA,0xCD,0xFF,0x52,0xEC,0xC8,0xAF,0xB6,0xFF,0xFE,0x36,0xFF,0xF5,0x72,0xB6,0x82,0x8A,0x12,0x00,0x12,0x00,
+    0x8B,0x02,0x02,0x8C,0xA3,0x00,0xD4,0x00,0xAD,0x86,0x87,0x01,0x17,0x87,0x82,0x06,0x03,0x01,0x06,0x09,0x01,0x03,0x06,0x03,
+    0x05,0xC2,0xFF,0xFC,0x8B,0x06,0x04,0xFF,0xF0,0xE0,0x00,0xA0,0x05,0x00,0xFF,0x42,0xEC,0xD5,0x51,0x00,0x00,0xD7,0xC4,0x05,
+    0x00,0xFF,0xB8,0x20,0xDB,0x05,0x04,0xFA,0x00,0xFE,0x04,0x05,0x02,0x06,0x91,0x09,0x01,0x86,0x07,0x03,0x82,0x93,0xC6,0xB0,
+    0x82,0x89,0x9F,0xFF,0x5B,0x2D,0xC0,0x02,0x02,0x86,0xFF,0x08,0xE4,0x12,0x00,0x12,0x00,0x92,0x87,0x01,0x02,0xA1,0x9C,0xF2,
+    0x82,0x8F,0xB5,0x9E,0x90,0x83,0x82,0x02,0x03,0x01,0x01,0x83,0x86,0x0C,0x01,0x03,0x06,0x03,0x05,0xB6,0xFF,0xFC,0x08,0x06,
+    0x04,0xFF,0xF0,0xC0,0xF5,0x03,0x00,0xD9,0xC4,0x01,0x00,0xBC,0xBE,0x01,0x00,0xFF,0x3A,0x69,0x9B,0xFF,0x21,0xC7,0x41,0x00,
+    0xD6,0x00,0x91,0x02,0x00,0xC9,0x01,0x00,0x00,0xA1,0xFF,0x02,0x28,0x04,0x00,0xFF,0xC0,0x40,0x06,0x04,0x00,0xE0,0x00,0xA7,
+    0x04,0x05,0x02,0x06,0x91,0x0B,0x01,0x86,0x83,0x01,0x01,0x83,0x82,0x83,0x01,0x02,0x88,0xC8,0xD4,0xD2,0x81,0x82,0xC5,0xD6,
+    0x93,0x01,0x02,0xB8,0x13,0x00,0x13,0x00,0xCD,0x01,0x02,0x81,0x82,0x87,0x97,0x00,0xC9,0xCD,0x88,0x87,0xC0,0xB0,0x83,0x82,
+    0x8C,0x9B,0x8F,0x83,0x86,0x0D,0x01,0x03,0x06,0x03,0x05,0xD1,0xFF,0xFC,0x28,0x06,0x04,0xC1,0xDA,0x06,0x00,0xFF,0x0A,0x49,
+    0xCA,0x01,0x00,0xD2,0x8F,0xC4,0x41,0x00,0x00,0xB9,0x00,0xC4,0x00,0xD7,0x01,0x00,0x00,0xBD,0xBE,0x05,0x00,0x00,0xB0,0xFF,
+    0xE0,0xC0,0x06,0x04,0x00,0xD1,0xFD,0x04,0x05,0x02,0x06,0x91,0x0D,0x01,0x83,0x88,0x99,0x92,0x83,0x82,0x81,0x96,0x8B,0x82,
+    0x93,0x9E,0xD6,0x8B,0x82,0x81,0x83,0x82,0xB8,0x14,0x00,0x13,0x00,0xCC,0x88,0x01,0x02,0x8F,0x9A,0xC8,0x8C,0x82,0xB8,0x01,
+    0x35,0x8C,0x83,0x98,0xF4,0x9F,0x8A,0x83,0x86,0x0E,0x01,0x03,0x06,0x03,0x05,0xCF,0x00,0xE6,0x07,0x04,0xFF,0xC8,0x40,0x04,
+    0x00,0xD8,0xB9,0x01,0x00,0x00,0xDF,0xF0,0x00,0xEC,0x42,0x00,0xC4,0xB8,0x00,0xFB,0x01,0x00,0xBC,0xB9,0x04,0x00,0xFB,0xE0,
+    0x06,0x04,0x00,0xC1,0x00,0x9C,0x04,0x05,0x02,0x06,0x91,0x0E,0x01,0x83,0x81,0x98,0xCB,0xB7,0x8A,0x82,0x98,0xDE,0x00,0xFA,
+    0x83,0x81,0xD2,0x9E,0x99,0x02,0x02,0xA0,0x14,0x00,0x14,0x00,0xA5,0x81,0x82,0xB0,0x8D,0x82,0x81,0x99,0xB2,0xCD,0x81,0x88,
+    0xA7,0xBA,0x95,0x02,0x03,0x86,0x0F,0x01,0x03,0x06,0x04,0x05,0x00,0xE2,0xD7,0x06,0x04,0xEE,0xF5,0x05,0x00,0xC7,0xB0,0xC3,
+    0x44,0x00,0xFF,0x53,0x4D,0x86,0xFF,0x74,0x30,0x05,0x00,0x00,0xB0,0xFF,0xD1,0x00,0xDB,0x06,0x04,0x00,0xE4,0x00,0x97,0x04,
+    0x05,0x02,0x06,0x91,0x0F,0x01,0x02,0x03,0x8B,0x9A,0xCB,0x96,0x83,0x8F,0x9D,0x9A,0x89,0x82,0x88,0x93,0x01,0x02,0x00,0xD6,
+    0x15,0x00,0x14,0x00,0xB2,0x8F,0x02,0x02,0x8B,0x9A,0xA3,0x8D,0x82,0x90,0x00,0xF8,0x9D,0x8C,0x82,0x03,0x03,0x10,0x01,0x03,
+    0x06,0x04,0x05,0xFD,0x00,0xD8,0x06,0x04,0xE0,0xFF,0xC8,0xE0,0x04,0x00,0xFF,0x8C,0xF3,0xF3,0xC7,0x01,0x00,0xFF,0x2A,0x49,
+    0x3E,0x00,0x00,0xC0,0xBE,0x01,0x00,0x00,0xE8,0xFF,0xCE,0xFB,0x00,0xAF,0x03,0x00,0xDA,0xEC,0x07,0x04,0x00,0xD3,0xB6,0x04,
+    0x05,0x02,0x06,0x91,0x0F,0x01,0x91,0x02,0x03,0x82,0x87,0x97,0x80,0xA4,0x01,0x01,0x9C,0xAE,0x8E,0x03,0x02,0xF4,0x15,0x00,
+    0x15,0x00,0x00,0xEA,0x89,0x01,0x02,0x9B,0x94,0x83,0x82,0xA0,0x80,0xA3,0xAA,0x87,0x88,0x03,0x03,0x11,0x01,0x03,0x06,0x04,
+    0x05,0xE7,0x00,0xBB,0x07,0x04,0xFA,0xF7,0x02,0x00,0x00,0x7F,0xFF,0x02,0x6A,0x01,0x00,0x01,0x47,0x3B,0x00,0xBC,0x01,0x00,
+    0xBE,0x00,0xA3,0x01,0x00,0xF8,0xFF,0x43,0x6D,0x02,0x00,0xFF,0x20,0x00,0xFF,0xD9,0x00,0xE2,0x06,0x04,0xD7,0x00,0x93,0x05,
+    0x05,0x02,0x06,0x91,0x10,0x01,0x03,0x03,0x81,0x88,0x83,0x93,0xD3,0xAB,0x8A,0x82,0x8F,0xA7,0x89,0x01,0x02,0xA7,0x16,0x00,
+    0x16,0x00,0x8B,0x03,0x02,0x87,0xA3,0xFF,0x29,0x66,0x94,0x83,0x8C,0xCC,0x98,0x82,0x03,0x03,0x11,0x01,0x03,0x06,0x04,0x05,
+    0x00,0x97,0x00,0xE3,0x07,0x04,0xC1,0xFF,0xC8,0xA0,0x00,0xAE,0x04,0x00,0xC7,0x02,0x00,0x00,0x8C,0xCA,0x37,0x00,0x00,0x8C,
+    0xE3,0x01,0x00,0xC7,0xBE,0x04,0x00,0xF5,0xFA,0x07,0x04,0x00,0xB4,0xDF,0x05,0x05,0x02,0x06,0x91,0x10,0x01,0x86,0x02,0x03,
+    0x82,0x8B,0xAD,0x94,0x82,0x89,0x9D,0xD0,0x8F,0x03,0x02,0x89,0x00,0xC3,0x16,0x00,0x17,0x00,0x90,0x01,0x02,0x87,0xAC,0xAD,
+    0x8B,0x82,0x90,0xB2,0x97,0x87,0x01,0x01,0x02,0x03,0x86,0x11,0x01,0x03,0x06,0x04,0x05,0x82,0x00,0xE2,0x00,0xE0,0x07,0x04,
+    0xEC,0xEA,0x06,0x00,0xF8,0xFF,0x0A,0x49,0x01,0x00,0xCA,0xBD,0x30,0x00,0xE3,0xD9,0x01,0x00,0xC9,0xB9,0x06,0x00,0x00,0x89,
+    0xFF,0xD0,0x80,0xEB,0x07,0x04,0xFF,0xFB,0xE7,0xDC,0x05,0x05,0x02,0x06,0x91,0x11,0x01,0x03,0x03,0x81,0x83,0x96,0xB1,0xA4,
+    0x87,0x81,0xA5,0xFC,0x92,0x01,0x02,0x81,0xA6,0x17,0x00,0x17,0x00,0xB2,0x89,0x82,0x81,0x90,0x81,0x82,0x94,0xB2,0x00,0xAD,
+    0x82,0x89,0xA9,0x90,0x03,0x03,0x81,0x83,0x10,0x01,0x03,0x06,0x05,0x05,0xE7,0xFF,0xFA,0xC0,0x07,0x04,0xE2,0x00,0xD0,0x00,
+    0x89,0x04,0x00,0x01,0xA2,0x01,0x00,0xB9,0xD9,0x01,0x00,0xFF,0x0A,0x08,0xCA,0x29,0x00,0x00,0xB1,0x01,0x00,0xE5,0x00,0xBD,
+    0x02,0x00,0xFF,0x00,0xA4,0x05,0x00,0xFF,0xC0,0xA0,0xE0,0x08,0x04,0x00,0xD3,0xCE,0x05,0x05,0x02,0x06,0x91,0x0F,0x01,0x05,
+    0x03,0x88,0xA4,0x98,0x82,0x89,0xA9,0x9E,0x8A,0x82,0x01,0x0B,0x01,0x02,0x9E,0x18,0x00,0x18,0x00,0x96,0x83,0x01,0x02,0x83,
+    0xA4,0xAC,0x90,0x82,0x90,0xBA,0xA1,0x88,0x03,0x03,0x88,0x90,0x88,0x10,0x01,0x02,0x06,0x06,0x05,0xD1,0xFF,0xFC,0x8C,0x08,
+    0x04,0xEB,0xFF,0xD0,0x80,0x00,0xA0,0x06,0x00,0x00,0x7F,0x02,0x00,0x00,0xA3,0xF9,0x01,0x00,0xFF,0x01,0x65,0x22,0x00,0xBE,
+    0xE3,0x01,0x00,0x00,0xBD,0xD5,0x01,0x00,0xB9,0xF9,0x06,0x00,0xEA,0xEC,0x08,0x04,0x00,0xB4,0x00,0xFE,0x82,0x05,0x05,0x02,
+    0x06,0x91,0x10,0x01,0x01,0x0D,0x04,0x03,0x95,0xE4,0x97,0x83,0x86,0x97,0x9D,0x8B,0x02,0x02,0x89,0x19,0x00,0x19,0x00,0x98,
+    0x01,0x02,0x8C,0xC3,0x8A,0x82,0x8E,0xB2,0x94,0x82,0x8C,0x99,0x8A,0x82,0x87,0x9F,0xAB,0x8A,0x83,0x0F,0x01,0x91,0x02,0x06,
+    0x05,0x05,0x01,0x02,0xFF,0xFE,0x55,0x00,0xB4,0x08,0x04,0xE1,0x00,0xCE,0xF7,0x07,0x00,0xCA,0x00,0x7F,0x01,0x00,0x00,0x87,
+    0xB9,0x01,0x00,0xE3,0xCA,0x0B,0x00,0xD5,0x02,0x30,0x0B,0x00,0xBD,0x01,0x00,0xD8,0xB9,0x01,0x00,0xC4,0xC7,0x07,0x00,0x00,
+    0xB3,0xFE,0xFF,0xF0,0xA0,0x08,0x04,0xEC,0x00,0xCD,0x00,0x97,0x01,0x02,0x04,0x05,0x03,0x06,0x10,0x01,0x83,0x94,0xD3,0x96,
+    0x82,0x81,0xC0,0x92,0x82,0x8D,0xAD,0x9F,0x88,0x82,0x01,0x0E,0x01,0x02,0x8B,0x1A,0x00,0x19,0x00,0xDD,0x87,0x03,0x02,0x94,
+    0xAC,0x90,0x82,0x8B,0xBB,0xA1,0x81,0x87,0x9A,0xAC,0x8C,0x83,0x11,0x01,0x03,0x06,0x03,0x05,0x03,0x02,0xCF,0x00,0xCD,0x09,
+    0x04,0xE2,0xFF,0xE8,0xA0,0xFB,0x06,0x00,0xFF,0x00,0xA4,0x01,0x00,0xC4,0xBE,0x01,0x00,0xD9,0xC4,0x01,0x00,0xC7,0x00,0x8B,
+    0x80,0x00,0x87,0xE3,0x04,0x00,0x00,0xA5,0x02,0x30,0x04,0x00,0xE3,0x01,0x00,0xB9,0xCA,0x01,0x00,0x00,0xBD,0x02,0x00,0x00,
+    0x7F,0x02,0x00,0xF8,0x05,0x00,0xFF,0x38,0x00,0xFF,0xC8,0xA0,0xEB,0x09,0x04,0xFF,0xFB,0xA3,0x00,0x92,0x03,0x02,0x04,0x05,
+    0x02,0x06,0x12,0x01,0x87,0x99,0xFC,0x92,0x82,0x95,0xD0,0xA0,0x82,0x88,0xA1,0x9E,0x8C,0x02,0x02,0x83,0xA7,0x1A,0x00,0x1A,
+    0x00,0xA4,0x89,0x01,0x02,0x96,0xA8,0x88,0x82,0x94,0xB2,0x8E,0x83,0x90,0xFC,0xA8,0x88,0x02,0x03,0x10,0x01,0x91,0x02,0x06,
+    0x02,0x05,0x06,0x02,0xDC,0x00,0xE6,0xEE,0x09,0x04,0xEB,0xFF,0xC8,0x80,0x00,0xA0,0x06,0x00,0xE5,0x02,0x00,0xED,0x02,0x00,
+    0xB9,0xBC,0x80,0xC4,0xB9,0x01,0x00,0x00,0xB1,0xD5,0x80,0xBC,0x02,0x30,0x80,0xB9,0x01,0x00,0x00,0x87,0xFF,0x0A,0x28,0x01,
+    0x00,0xB9,0xC9,0x01,0x00,0xD9,0xF9,0x01,0x00,0xFF,0x01,0x46,0x06,0x00,0xFF,0x08,0x00,0x00,0x8A,0xFF,0xE8,0x80,0x0A,0x04,
+    0xFF,0xFB,0xA5,0xFD,0x07,0x02,0x01,0x05,0x03,0x06,0x11,0x01,0x02,0x03,0x93,0xD0,0x9B,0x81,0x8C,0x9A,0xA3,0x88,0x82,0x95,
+    0xA1,0x83,0x82,0x83,0x92,0x1B,0x00,0x1B,0x00,0xA8,0x8A,0x02,0x02,0x83,0x97,0xAC,0x90,0x82,0x92,0x80,0x9F,0x88,0x04,0x03,
+    0x10,0x01,0x02,0x06,0x85,0x0A,0x02,0x00,0x92,0xFF,0xFC,0x8C,0x0A,0x04,0xE1,0xFF,0xE0,0xA0,0xEA,0x00,0x95,0x07,0x00,0x00,
+    0xA1,0x02,0x00,0xD8,0x01,0x00,0xD8,0xC7,0x01,0x00,0xC7,0x00,0x8B,0x01,0x00,0x02,0x30,0x80,0xB9,0x02,0x00,0xB9,0x01,0x00,
+    0xF8,0xF9,0x0A,0x00,0xFF,0x28,0x00,0xFB,0xFF,0xC8,0x20,0xC1,0x0A,0x04,0x00,0x9D,0x00,0xAA,0xB6,0x06,0x02,0x01,0x05,0x82,
+    0x85,0x02,0x06,0x91,0x10,0x01,0x04,0x03,0x95,0x00,0x8F,0xA8,0x87,0x88,0xA8,0x9E,0x8C,0x03,0x02,0x98,0x1C,0x00,0x1C,0x00,
+    0xA8,0x81,0x01,0x02,0x99,0xA3,0x89,0x82,0x98,0xFF,0x08,0x41,0xA5,0x81,0x90,0x94,0x81,0x03,0x03,0x0F,0x01,0x02,0x06,0x82,
+    0xAA,0xF3,0x00,0xA4,0x00,0xA6,0x86,0x07,0x02,0x00,0xDC,0xFF,0xFB,0xA2,0x0B,0x04,0xE2,0xFF,0xE8,0x20,0xFE,0xEF,0x0C,0x00,
+    0xBC,0x01,0x00,0xD9,0x02,0x00,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0xFF,0xD7,0x1C,0x80,0xBD,0x02,0x00,0x00,0xBE,0x0B,0x00,0x00,
+    0xB3,0xDA,0xFF,0xD8,0x60,0xFF,0xF0,0x20,0xE2,0x0A,0x04,0x00,0xFC,0x00,0xD3,0xDC,0x07,0x02,0xAF,0x00,0xE8,0x00,0xD6,0x01,
+    0x02,0x02,0x06,0x91,0x0F,0x01,0x02,0x03,0x82,0x8F,0x99,0x87,0x93,0xD0,0xA9,0x88,0x83,0x9C,0xA3,0x87,0x01,0x02,0x8E,0x1D,
+    0x00,0x1C,0x00,0x00,0x88,0x8A,0x01,0x02,0x8A,0x81,0x82,0x9C,0xFF,0x21,0x04,0x94,0x82,0x8D,0xCB,0x9C,0x83,0x82,0x03,0x03,
+    0x0E,0x01,0x01,0x06,0x01,0x02,0xC3,0x02,0x00,0x00,0x91,0xAA,0x07,0x02,0xC2,0x00,0x93,0x00,0xC1,0x0C,0x04,0xE1,0xFF,0xF0,
+    0xA0,0x00,0xCE,0xFB,0xFF,0x18,0x00,0x21,0x00,0x00,0x89,0xF6,0xA2,0xE0,0x0C,0x04,0x00,0xD1,0xFF,0xFD,0x2E,0xDC,0x07,0x02,
+    0x85,0x00,0xB5,0xBE,0x80,0x00,0x9A,0x86,0x82,0x83,0x02,0x06,0x0E,0x01,0x03,0x03,0x82,0x8B,0xA6,0xA5,0x82,0x8D,0xAE,0xAD,
+    0x8A,0x82,0x8A,0x01,0x02,0x81,0xA8,0x1D,0x00,0x1D,0x00,0xAC,0x8D,0x02,0x02,0x9C,0xD3,0x92,0x82,0x8D,0xAE,0x97,0x81,0x93,
+    0x96,0x04,0x03,0x87,0x88,0x0A,0x01,0x91,0x86,0x83,0x01,0x02,0xBF,0x03,0x00,0x00,0x91,0x86,0x08,0x02,0xCE,0x00,0xB2,0xFF,
+    0xFC,0x09,0xDB,0x0E,0x04,0xFF,0xF0,0xC0,0xFF,0xC8,0xC0,0x00,0x8A,0xF7,0x00,0xA0,0x16,0x00,0x00,0xB0,0x00,0x94,0xFB,0xF6,
+    0xFF,0xE1,0x00,0xEB,0x0E,0x04,0x00,0xB4,0x00,0xBA,0xE6,0x08,0x02,0xB8,0xFF,0x63,0xAE,0x02,0x00,0x8E,0x01,0x02,0x01,0x03,
+    0x01,0x06,0x0A,0x01,0x87,0x88,0x86,0x02,0x03,0x82,0x8C,0x94,0x81,0x8C,0xAC,0x9C,0x83,0x89,0x9E,0xFF,0x73,0x6E,0x87,0x01,
+    0x02,0x81,0x97,0x1E,0x00,0x1E,0x00,0xB1,0x8B,0x01,0x02,0x98,0x8F,0x82,0x90,0xB1,0xA0,0x82,0x8F,0xBB,0x98,0x03,0x03,0x81,
+    0x01,0x1C,0x87,0x83,0x08,0x01,0x01,0x06,0x01,0x03,0x82,0x81,0x93,0x8C,0x90,0x01,0x00,0xB3,0x82,0xAF,0x85,0x05,0x02,0x01,
+    0x05,0xB6,0xDF,0xFF,0xFC,0xEF,0x00,0x9E,0x0F,0x04,0xE2,0xE0,0xE9,0xA2,0xFF,0xD8,0x00,0x00,0x9F,0xFE,0x00,0x8A,0xF5,0x00,
+    0x94,0xEF,0x00,0x89,0x01,0x95,0x00,0x9F,0xDA,0x00,0x95,0xEF,0xF7,0xFB,0xEA,0xF6,0x00,0xCE,0xA2,0xB4,0x01,0x5B,0x10,0x04,
+    0xFF,0xFC,0x08,0x00,0xB2,0xD1,0x02,0x05,0x06,0x02,0x00,0x98,0xFF,0x4B,0x0C,0x01,0x00,0xC8,0x8E,0x01,0x1C,0x8B,0x01,0x02,
+    0x83,0x86,0x09,0x01,0x83,0x8D,0xA4,0x8C,0x82,0x01,0x03,0x82,0x89,0xA6,0x9B,0x83,0x8B,0x9D,0x97,0x82,0x88,0x94,0x8A,0x01,
+    0x02,0xA4,0x1F,0x00,0x1F,0x00,0xDD,0x87,0x02,0x02,0x90,0xAE,0x8E,0x82,0x8C,0xAC,0x94,0x83,0x93,0x98,0x81,0x82,0x94,0xDD,
+    0x96,0x01,0x03,0x08,0x01,0x86,0x01,0x03,0x81,0x82,0x88,0xD6,0x9E,0xD6,0x01,0x00,0x8F,0xB0,0xC9,0xFF,0x6B,0xAF,0xFF,0xD6,
+    0xFB,0x04,0x02,0x03,0x05,0x82,0xD1,0x00,0x93,0xFF,0xFB,0x80,0x1A,0x04,0xE9,0x84,0xE9,0x18,0x04,0x00,0xD1,0xFF,0xFC,0xCC,
+    0x00,0x92,0xB6,0x04,0x05,0x03,0x02,0xAA,0xFF,0xD6,0xFB,0x00,0xC4,0x81,0xC6,0x01,0x00,0x9B,0x03,0x00,0x8F,0x82,0x01,0x03,
+    0x86,0x08,0x01,0x83,0xAA,0xA3,0x9E,0x87,0x82,0x8F,0xA0,0x83,0x8B,0xA6,0x9B,0x82,0x8C,0x9E,0xA5,0x03,0x02,0xA1,0x20,0x00,
+    0x20,0x00,0x9D,0x81,0x01,0x02,0x95,0x96,0x82,0x89,0xAC,0x97,0x83,0x8F,0xCB,0xA0,0x83,0x92,0xDD,0x98,0x81,0x01,0x03,0x07,
+    0x01,0x86,0x83,0x82,0x89,0xA4,0x96,0x89,0x00,0xEA,0x02,0x00,0x9A,0xAA,0xF4,0x02,0x00,0x00,0xB9,0xAF,0x02,0x02,0x06,0x05,
+    0xB6,0x00,0xBC,0xFF,0xFD,0x0F,0x00,0xB4,0x17,0x04,0xE9,0x84,0xE9,0x15,0x04,0x00,0x9E,0xFF,0xFC,0x4B,0x00,0x93,0xD1,0x07,
+    0x05,0x02,0x02,0xC0,0x02,0x00,0xC8,0x92,0x06,0x00,0xBA,0x81,0x82,0x83,0x86,0x08,0x01,0x01,0x03,0x8C,0xA6,0xA8,0x81,0x8C,
+    0xAE,0x97,0x82,0x8B,0x9D,0xA0,0x82,0x8C,0x99,0x87,0x01,0x02,0x99,0x21,0x00,0x21,0x00,0xA9,0x81,0x02,0x02,0x8A,0x9E,0x97,
+    0x83,0x8B,0xB1,0x9C,0x81,0x95,0x00,0x88,0x99,0x04,0x03,0x06,0x01,0x86,0x83,0x82,0x92,0x01,0x00,0x8C,0x8D,0x01,0x00,0xA8,
+    0x82,0x97,0x01,0x00,0xFF,0x42,0x8A,0x02,0x00,0xFF,0xC6,0x7A,0x82,0x0A,0x05,0x00,0x97,0xDF,0x00,0xDD,0xFF,0xFC,0x0A,0x00,
+    0xE0,0x13,0x04,0x02,0x69,0x12,0x04,0xFF,0xFB,0x42,0xFF,0xFC,0xEF,0x00,0xA7,0xDC,0x0A,0x05,0x01,0x02,0x00,0xA6,0x04,0x00,
+    0x94,0xA3,0x01,0x00,0xA7,0xF2,0xA7,0x01,0x00,0x8C,0x82,0x01,0x03,0x86,0x05,0x01,0x86,0x02,0x03,0x82,0x8D,0xE4,0x9F,0x81,
+    0x8F,0xBB,0x99,0x82,0x8B,0xAD,0x8E,0x03,0x02,0x99,0x22,0x00,0x22,0x00,0x94,0x83,0x01,0x02,0x95,0xA0,0x82,0x8A,0x9D,0x99,
+    0x83,0x90,0x00,0xEA,0xA4,0x01,0x01,0x05,0x03,0x02,0x01,0x91,0x86,0x01,0x03,0x82,0xFF,0xE6,0xFC,0x01,0x00,0xA7,0x8F,0x01,
+    0x00,0x97,0xFF,0xD6,0xDA,0x01,0x00,0x00,0xF0,0x00,0xD6,0x8E,0xD5,0x80,0x99,0x01,0x02,0x0C,0x05,0x86,0xDC,0xDF,0xFF,0xFD,
+    0x30,0x00,0xC1,0xDB,0x0F,0x04,0x02,0x69,0x0E,0x04,0x00,0x9D,0xFF,0xFC,0x49,0x00,0xE9,0xE7,0xCF,0x0D,0x05,0x82,0x85,0x00,
+    0x9A,0x80,0x00,0x85,0xC5,0x01,0x00,0xA4,0x8D,0x80,0x9A,0x89,0x82,0xFF,0x94,0x71,0x01,0x00,0x8C,0x82,0x02,0x03,0x86,0x02,
+    0x01,0x86,0x04,0x03,0x81,0x83,0x93,0x80,0x9B,0x82,0x8F,0xAE,0x98,0x82,0x8F,0x97,0x83,0x01,0x02,0x92,0x23,0x00,0x23,0x00,
+    0x8C,0x81,0x02,0x02,0x87,0x9E,0x98,0x82,0x90,0x00,0x9B,0x9C,0x82,0x92,0xA7,0x8A,0x82,0x0C,0x03,0xA5,0x04,0x00,0x8E,0x92,
+    0x03,0x00,0x00,0x85,0x01,0x30,0x81,0x82,0x02,0x05,0x86,0x0F,0x05,0xDC,0xFD,0x00,0xFF,0x00,0xE3,0xFF,0xFB,0xA5,0xFF,0xFA,
+    0xC0,0xFF,0xF9,0x80,0x08,0x04,0x01,0x69,0xB4,0x07,0x04,0x00,0xAB,0x00,0xC1,0xFF,0xFC,0x4B,0xFF,0xFD,0x51,0xFF,0xFE,0x55,
+    0x00,0x9C,0xCE,0x0D,0x05,0x03,0x06,0x85,0x82,0x91,0xFF,0x32,0x08,0x80,0xD2,0x83,0xFF,0x29,0xC7,0x80,0x94,0x82,0x81,0xA5,
+    0x03,0x00,0xA4,0x01,0x02,0x0B,0x03,0x82,0x98,0xA8,0x83,0x8D,0x00,0x86,0x9B,0x82,0x89,0x9D,0x99,0x03,0x02,0x89,0xB2,0x23,
+    0x00,0x23,0x00,0x00,0x88,0x8B,0x81,0x01,0x02,0x90,0x98,0x82,0x8B,0xD3,0xA4,0x83,0x8D,0xCB,0x98,0x81,0x8C,0x81,0x03,0x03,
+    0x81,0x8D,0x87,0x03,0x03,0x82,0x83,0x95,0xFF,0x6B,0x2D,0x01,0x00,0x9F,0x99,0x9B,0x95,0x93,0xC3,0x01,0x00,0xCD,0x02,0x02,
+    0x08,0x06,0x0E,0x05,0x00,0xD2,0xCE,0xD1,0x00,0xC5,0x00,0xDC,0x00,0xCC,0x00,0xAA,0xFF,0xFD,0x93,0xFF,0xFD,0x52,0xFF,0xFD,
+    0x32,0xFF,0xFD,0x12,0xFF,0xFC,0xF2,0xFF,0xE3,0x6C,0xE9,0xA2,0xFF,0xEC,0x70,0xFF,0xFD,0x11,0xFF,0xFD,0x52,0x00,0xFF,0x00,
+    0xE9,0x00,0xA7,0xDF,0xE6,0xCF,0xB6,0x82,0x0D,0x05,0x08,0x06,0x01,0x02,0x92,0x94,0x82,0x8B,0x01,0x00,0x90,0x82,0x89,0xB2,
+    0x02,0x00,0x9C,0x83,0x82,0x03,0x03,0x81,0x8C,0x8A,0x04,0x03,0x89,0x88,0x8C,0xB1,0x9C,0x82,0x93,0x00,0x88,0x99,0x82,0x8C,
+    0x9C,0x83,0x01,0x02,0x8A,0xAB,0x24,0x00,0x24,0x00,0x00,0x88,0x8C,0x88,0x02,0x02,0x89,0xBB,0x9F,0x83,0x89,0xB1,0x9C,0x82,
+    0x92,0xA9,0x8A,0x01,0x02,0x83,0x82,0x94,0x9D,0x89,0x04,0x03,0x01,0x02,0x81,0xAF,0x8A,0x82,0xAB,0x80,0x9E,0x82,0x87,0x01,
+    0x00,0xE8,0x86,0x82,0x83,0x0C,0x06,0x0F,0x05,0x0F,0x02,0x0E,0x05,0x0D,0x06,0x01,0x03,0x01,0x02,0x8E,0x01,0x00,0x93,0xA1,
+    0xB2,0x95,0x8F,0x96,0x8A,0x83,0x82,0x04,0x03,0x86,0x97,0xA9,0x87,0x82,0x83,0x82,0x83,0x99,0xAB,0x81,0x8B,0xB2,0x98,0x82,
+    0x92,0xFF,0x21,0x04,0x98,0x03,0x02,0x8A,0xA6,0x25,0x00,0x26,0x00,0x8E,0x88,0x01,0x02,0x8E,0xA1,0x01,0x01,0x9A,0xA1,0x83,
+    0x8C,0xB2,0x98,0x81,0x93,0x89,0x82,0x8B,0x00,0x86,0x94,0x05,0x03,0x05,0x02,0x00,0x8E,0x01,0x00,0xA5,0xA8,0x01,0x00,0xC6,
+    0x82,0x01,0x03,0x03,0x06,0x02,0x11,0x09,0x06,0x0B,0x05,0x0F,0x02,0x0A,0x05,0x09,0x06,0x03,0x11,0x03,0x06,0x01,0x03,0x82,
+    0x83,0xA3,0x04,0x00,0x95,0x04,0x02,0x04,0x03,0x82,0x8B,0xB2,0x97,0x82,0x81,0x93,0x89,0x88,0xAD,0xA5,0x82,0x96,0xCB,0x90,
+    0x82,0x98,0x9F,0x02,0x02,0x92,0x00,0x9B,0x26,0x00,0x27,0x00,0x9E,0x8A,0x03,0x02,0xA4,0x9F,0x81,0x87,0x9A,0xA4,0x83,0x8E,
+    0xAE,0x8C,0x81,0x9D,0x9F,0x81,0x82,0x04,0x03,0x05,0x02,0x87,0xA3,0x04,0x00,0x8F,0x82,0x83,0x02,0x06,0x07,0x01,0x91,0x09,
+    0x06,0x07,0x05,0x0F,0x02,0x06,0x05,0x09,0x06,0x91,0x08,0x01,0x01,0x06,0x01,0x03,0x82,0x8A,0x03,0x00,0xD3,0x95,0x81,0x04,
+    0x02,0x05,0x03,0x82,0x95,0x00,0x90,0x93,0x83,0xA8,0xA9,0x81,0x8B,0x9D,0x93,0x82,0x8E,0xA6,0x89,0x82,0x83,0x01,0x02,0x97,
+    0x28,0x00,0x28,0x00,0xAE,0x88,0x01,0x02,0x87,0x9C,0x8A,0x82,0xA4,0xA3,0x81,0x89,0xB2,0x92,0x82,0xA1,0xDE,0x8A,0x82,0x05,
+    0x03,0x01,0x02,0xB6,0xCF,0x02,0x02,0x87,0x92,0xA6,0x80,0x9E,0x90,0x02,0x03,0x86,0x91,0x0C,0x01,0x91,0x08,0x06,0x04,0x05,
+    0x0F,0x02,0x04,0x05,0x07,0x06,0x91,0x0D,0x01,0x01,0x06,0x83,0x82,0x89,0x02,0x00,0xA0,0x87,0x02,0x02,0xB6,0xC2,0x01,0x02,
+    0x05,0x03,0x82,0x83,0x9B,0xBA,0x01,0x09,0xAC,0x9C,0x82,0x95,0xAE,0x8A,0x82,0x8E,0x93,0x02,0x02,0xA4,0x29,0x00,0x29,0x00,
+    0xD0,0x88,0x03,0x02,0xA0,0xAD,0x89,0x82,0xA9,0xC3,0x82,0x95,0x80,0x93,0x82,0xAA,0x83,0x82,0x02,0x03,0x02,0x02,0xFF,0xF5,
+    0x72,0xFF,0xEB,0xA4,0xFF,0xFF,0x3C,0x03,0x02,0x83,0x81,0x83,0x82,0x01,0x03,0x86,0x91,0x11,0x01,0x91,0x06,0x06,0x02,0x05,
+    0x01,0x02,0x85,0x0D,0x02,0x01,0x05,0x06,0x06,0x91,0x11,0x01,0x86,0x83,0x82,0x87,0x9B,0xA9,0x8A,0x04,0x02,0xFF,0xF5,0x30,
+    0xFF,0xEB,0xC5,0xCF,0x02,0x02,0x01,0x03,0x01,0x02,0x01,0x01,0x8A,0xDE,0x9A,0x82,0x8F,0xAE,0x93,0x82,0x97,0xAB,0x04,0x02,
+    0xA4,0x2A,0x00,0x2A,0x00,0xAC,0x8A,0x02,0x02,0xA0,0x8D,0x82,0xA0,0xA9,0x81,0x89,0xFF,0x08,0xA2,0xA5,0x82,0x99,0xA7,0x81,
+    0x05,0x02,0x00,0x83,0xA2,0xFF,0xEA,0x00,0xF1,0x03,0x02,0x05,0x03,0x86,0x15,0x01,0x91,0x04,0x06,0x85,0x82,0x86,0xD2,0x02,
+    0x00,0xB7,0xAF,0x90,0x82,0xB3,0x01,0x00,0xC4,0x00,0xA6,0x02,0x02,0x85,0x04,0x06,0x91,0x15,0x01,0x86,0x01,0x03,0x02,0x02,
+    0x83,0x03,0x02,0x00,0x8D,0xA2,0xFF,0xF5,0x52,0x06,0x02,0xC0,0xD6,0x81,0x8F,0xFF,0x21,0x25,0x99,0x82,0x8E,0xA6,0x8A,0x83,
+    0xA0,0x89,0x01,0x02,0x83,0x97,0x2B,0x00,0x2B,0x00,0x9D,0x87,0x03,0x02,0x8F,0xB1,0x8D,0x83,0xAD,0x9E,0x83,0x8D,0xD0,0x96,
+    0x81,0x8E,0x8A,0x02,0x02,0x83,0xFF,0xEB,0xE8,0xA2,0xFF,0xF5,0xB3,0x02,0x02,0x06,0x03,0x86,0x18,0x01,0x04,0x06,0x82,0xC3,
+    0x04,0x00,0xFF,0x53,0x6D,0xFF,0xD6,0x59,0xB8,0x04,0x00,0x8F,0x01,0x02,0x83,0x03,0x06,0x17,0x01,0x91,0x06,0x03,0x02,0x02,
+    0xFF,0xF7,0x3B,0xFF,0xE1,0x60,0xA2,0xFF,0xF7,0x1B,0x02,0x02,0x83,0x96,0x8F,0x88,0xCC,0xA5,0x82,0x94,0x00,0x88,0x8F,0x82,
+    0x9B,0xA1,0x03,0x02,0x81,0xA4,0x2C,0x00,0x2C,0x00,0x00,0x9B,0xA8,0x8A,0x01,0x02,0x8A,0x89,0x82,0xA1,0xB1,0x01,0x08,0x9D,
+    0x94,0x82,0x99,0xCC,0x02,0x08,0x82,0xFF,0xF5,0xF5,0xA2,0xFF,0xEB,0xC6,0xCF,0x01,0x02,0x07,0x03,0x86,0x19,0x01,0x02,0x06,
+    0x01,0x02,0xC8,0x80,0xBF,0x81,0xA3,0x01,0x00,0xFF,0xAD,0x35,0x00,0x99,0x80,0xFF,0x95,0x34,0x8B,0x01,0x00,0x00,0xC8,0x01,
+    0x02,0x83,0x02,0x06,0x19,0x01,0x86,0x06,0x03,0x02,0x02,0xFF,0xF5,0xF5,0xA2,0xFF,0xEB,0xA7,0xB6,0x86,0x89,0x83,0xC0,0xCC,
+    0xAA,0x8B,0xA6,0x00,0xA4,0x82,0x9B,0xB2,0x8C,0x83,0x8C,0x02,0x02,0x8E,0x00,0x88,0x2D,0x00,0x2E,0x00,0xA8,0x89,0x02,0x02,
+    0x89,0xAE,0x8F,0x82,0x9B,0xA7,0x83,0x8C,0xD4,0x93,0xAA,0xB5,0x00,0xAD,0x00,0xC6,0xFF,0xE2,0x00,0xA2,0xFF,0xF6,0xB9,0x02,
+    0x02,0x07,0x03,0x1B,0x01,0x01,0x06,0x01,0x03,0x01,0x01,0x8F,0xC8,0x01,0x00,0x00,0x91,0x9C,0x01,0x00,0x00,0xCF,0x9E,0x02,
+    0x00,0x8A,0x82,0x83,0x01,0x06,0x1A,0x01,0x86,0x06,0x03,0x02,0x02,0xC2,0xFF,0xEB,0xA5,0xA2,0xFF,0xF6,0x57,0xFF,0xE7,0x7E,
+    0xCC,0xC5,0x83,0xB7,0x97,0x82,0x8E,0x9D,0x8A,0x81,0xA3,0x97,0x02,0x02,0x83,0x8E,0x2F,0x00,0x2F,0x00,0xA1,0x8D,0x83,0x82,
+    0x83,0x8A,0x82,0x96,0x9D,0x89,0x82,0x00,0x82,0xBF,0x82,0x00,0x8E,0x00,0xDF,0xF2,0xFF,0xF5,0x30,0xA2,0xFF,0xF5,0x30,0x04,
+    0x02,0x06,0x03,0x91,0x1A,0x01,0x01,0x06,0x01,0x03,0x01,0x02,0x9B,0x02,0x00,0x94,0x97,0x06,0x00,0x8C,0x82,0x83,0x01,0x06,
+    0x1A,0x01,0x86,0x06,0x03,0x03,0x02,0x00,0x84,0xA2,0xFF,0xEA,0x80,0xCF,0xFF,0xAD,0xB7,0x00,0xD4,0x81,0xB8,0xDE,0x8B,0x82,
+    0x9B,0xA1,0x82,0x81,0x8A,0x01,0x02,0x8A,0x99,0x30,0x00,0x30,0x00,0xFF,0x08,0x61,0x99,0x8A,0x02,0x02,0x97,0x96,0x82,0x98,
+    0xCC,0x88,0x81,0x00,0x99,0xF3,0xE7,0xA2,0xFF,0xEA,0x80,0xFF,0xF7,0x3B,0xB8,0x89,0x02,0x02,0x02,0x03,0x82,0x96,0x93,0x81,
+    0x86,0x1B,0x01,0x86,0x01,0x03,0x86,0x82,0xB0,0x8E,0xE4,0x01,0x00,0xA9,0x02,0x00,0x99,0xC6,0x01,0x00,0x8A,0x82,0x83,0x86,
+    0x91,0x19,0x01,0x86,0x83,0x8C,0x8E,0x87,0x82,0x01,0x03,0x02,0x02,0x81,0xF3,0x81,0x00,0x8D,0xA2,0xFF,0xF5,0x92,0x86,0xFF,
+    0x73,0xF0,0x99,0x82,0xC3,0xA3,0x82,0x88,0x9B,0x88,0x02,0x02,0x8B,0x32,0x00,0x32,0x00,0x92,0x8F,0x03,0x02,0x8A,0xE8,0xC5,
+    0x82,0x01,0x3F,0x81,0xFF,0xEC,0x2A,0xA2,0x00,0xCC,0x89,0xE8,0x93,0x86,0x88,0x83,0x82,0x83,0x82,0x87,0xAE,0x9C,0x01,0x03,
+    0x86,0x1A,0x01,0x86,0x82,0x81,0xA1,0x00,0xC3,0x95,0x82,0x8E,0x01,0x00,0xAB,0xAE,0x80,0x00,0xF2,0xAA,0xBA,0x80,0xBA,0x83,
+    0x82,0x83,0x86,0x19,0x01,0x91,0x01,0x03,0xB8,0xD4,0x92,0x82,0x83,0x01,0x02,0x87,0x01,0x2A,0xB5,0x00,0xFB,0xCF,0xFF,0xEA,
+    0x20,0xA2,0xDC,0xFF,0xCE,0xDB,0xFF,0x52,0xEC,0x89,0x87,0xFF,0x7B,0xF0,0x98,0x03,0x02,0x81,0x8B,0x33,0x00,0x33,0x00,0x00,
+    0x8F,0x90,0x02,0x02,0x89,0x92,0x82,0x8D,0xDE,0xB0,0x00,0xF9,0xB4,0xFF,0xEB,0xA7,0xCF,0xFF,0x94,0xF4,0x00,0x91,0x81,0x95,
+    0xA1,0x81,0x86,0x83,0x82,0x95,0xF4,0x8B,0x82,0x02,0x03,0x19,0x01,0x86,0x01,0x03,0xAD,0x01,0x00,0xAC,0x02,0x00,0xA0,0xC0,
+    0x01,0x00,0xFF,0x19,0x04,0x01,0x00,0x98,0x82,0x01,0x03,0x86,0x18,0x01,0x86,0x02,0x03,0x87,0xA7,0xA9,0x83,0x82,0x81,0x82,
+    0xB3,0xB7,0x87,0x00,0xA4,0xDE,0xF2,0x00,0xCC,0xA2,0xFF,0xF4,0x8C,0x82,0xBF,0x00,0xB6,0x82,0x8B,0x93,0x02,0x02,0x87,0xAC,
+    0x34,0x00,0x35,0x00,0x97,0x88,0x03,0x02,0xA5,0x99,0x00,0xF6,0xFF,0xF3,0xA7,0xB4,0xDF,0x00,0x80,0x00,0xC9,0xB3,0x81,0x9E,
+    0x99,0xAA,0x97,0x8B,0x82,0xA9,0xC8,0x06,0x03,0x17,0x01,0x86,0x83,0x82,0x8C,0xDD,0x03,0x00,0x00,0xFB,0xB8,0x82,0xA5,0x02,
+    0x00,0x9B,0x83,0x82,0x01,0x03,0x86,0x14,0x01,0x83,0x81,0x86,0x04,0x03,0x82,0x00,0xAD,0xB2,0x8D,0x81,0x9C,0x8F,0xAF,0xB5,
+    0x93,0x86,0xB5,0xC3,0xC2,0xFF,0xEB,0x84,0xB4,0x00,0x96,0xAF,0xB7,0xAF,0x03,0x02,0xA0,0xBA,0x35,0x00,0x36,0x00,0x00,0xC3,
+    0xB0,0x02,0x02,0x87,0x82,0xFF,0xFE,0x57,0xB4,0xFF,0xF4,0xEE,0x82,0x00,0xB9,0xC8,0x82,0x92,0x9D,0x8A,0x00,0xD6,0xAE,0x88,
+    0x8D,0x00,0xED,0x8F,0x82,0x07,0x03,0x01,0x12,0x13,0x01,0x86,0x02,0x03,0x87,0x8B,0x95,0x93,0x88,0x83,0xB8,0x01,0x02,0xA5,
+    0x94,0xB8,0x81,0x03,0x03,0x86,0x11,0x01,0x83,0x8B,0x94,0x87,0x06,0x03,0x82,0x87,0xAD,0xA1,0x86,0xC8,0x9F,0x83,0x94,0x9F,
+    0x82,0x96,0x00,0xC9,0xAF,0xDF,0xB4,0xFF,0xF4,0x2B,0x82,0x81,0x02,0x02,0x89,0x00,0xB6,0x37,0x00,0x38,0x00,0xB7,0x81,0x02,
+    0x02,0xFF,0xF6,0x77,0xFF,0xEC,0x2B,0xD1,0x8B,0xCC,0xB0,0x82,0x9A,0x00,0xFA,0x82,0x9A,0x9C,0x82,0x9A,0x9E,0x83,0x90,0x8D,
+    0x01,0x02,0x02,0x03,0x82,0x87,0xAC,0xA4,0x01,0x03,0x11,0x01,0x86,0x02,0x03,0x0B,0x02,0x83,0x86,0x02,0x03,0x86,0x11,0x01,
+    0x82,0x8F,0xD3,0x8F,0x82,0x03,0x03,0x82,0x88,0x96,0x81,0x98,0xFC,0x89,0x8B,0xB1,0x8B,0x88,0x9D,0x8F,0x82,0xB7,0xC3,0x82,
+    0xFF,0xF5,0x52,0xFF,0xEC,0xCF,0x03,0x02,0x98,0x39,0x00,0x39,0x00,0x9E,0x99,0x86,0x03,0x02,0xC3,0xCD,0x82,0x92,0xB5,0x87,
+    0xAF,0xE8,0x88,0x8C,0xFF,0x10,0xC3,0xC5,0x81,0xA6,0x92,0x81,0x96,0x87,0x02,0x02,0x8F,0xBA,0x96,0x82,0x03,0x03,0x03,0x01,
+    0x87,0x09,0x01,0x06,0x03,0x07,0x02,0x05,0x03,0x86,0x08,0x01,0x87,0x03,0x01,0x86,0x03,0x03,0x88,0xAD,0x9B,0x03,0x02,0x01,
+    0x0F,0x8A,0x9E,0x93,0xAA,0xBB,0x97,0x82,0xA4,0xC8,0x82,0x9C,0xC6,0x82,0x8B,0xA3,0x81,0x03,0x02,0x8F,0x9A,0x3A,0x00,0x3B,
+    0x00,0xBF,0x93,0x83,0x03,0x02,0x81,0x9A,0x00,0xAD,0x82,0xA1,0x8E,0x82,0xA3,0x9D,0x83,0xA0,0x9D,0x87,0x8E,0xAB,0x88,0x96,
+    0x92,0x82,0x9C,0xAD,0x88,0x82,0x05,0x03,0x82,0x8D,0xA9,0x89,0x83,0x05,0x01,0x91,0x86,0x07,0x03,0x05,0x02,0x07,0x03,0x86,
+    0x91,0x05,0x01,0x83,0x9C,0x99,0x07,0x03,0x82,0x9C,0xB1,0x81,0x8C,0xA0,0x81,0x8E,0xAC,0x81,0xA0,0x9A,0x82,0x94,0xE4,0x8A,
+    0x89,0x9D,0xB8,0x81,0xB5,0xB3,0x04,0x02,0x8A,0x99,0x3C,0x00,0x3D,0x00,0x92,0xB0,0x03,0x02,0xB8,0x82,0x8C,0x9D,0x8A,0x89,
+    0x00,0xEA,0x95,0x83,0x9D,0x94,0x82,0xD6,0xA5,0x87,0x9E,0x99,0x87,0xB1,0x97,0x82,0x87,0x83,0x82,0x03,0x03,0x82,0x99,0xAE,
+    0x88,0x07,0x03,0x01,0x09,0x07,0x03,0x04,0x02,0x05,0x03,0x87,0x8C,0x81,0x06,0x03,0x82,0xA5,0x9D,0x81,0x82,0x03,0x03,0x82,
+    0x81,0x82,0x8D,0x00,0x9B,0x96,0x8C,0xCB,0x90,0x8A,0xAE,0x96,0x89,0xA6,0x90,0x87,0xBB,0x97,0x82,0x97,0xA1,0x82,0x8C,0x8A,
+    0x02,0x02,0x83,0x92,0xBA,0x3D,0x00,0x3E,0x00,0xB2,0xA3,0x87,0x03,0x02,0x8B,0x95,0x82,0xA5,0xA6,0x83,0x90,0xAC,0x8A,0x89,
+    0xAE,0x8F,0x8B,0xB1,0x8B,0x8D,0x00,0x88,0x96,0x89,0xA5,0x88,0x87,0x88,0x83,0x02,0x02,0xA7,0xA3,0x81,0x07,0x03,0x9B,0xA4,
+    0x07,0x03,0x01,0x02,0xAF,0x82,0x02,0x03,0x81,0x01,0x03,0x82,0x8B,0xD6,0x8C,0x82,0x05,0x03,0x82,0x95,0xBB,0x8A,0x02,0x02,
+    0x87,0x8A,0x82,0x01,0x15,0x88,0xCB,0xA4,0x83,0xA9,0xA5,0x82,0xA1,0x9B,0x82,0xA4,0xA1,0x82,0x99,0xD4,0xAA,0x8A,0x8E,0x04,
+    0x02,0x9C,0x9A,0x3F,0x00,0x41,0x00,0x9C,0x89,0x04,0x02,0xA7,0x98,0x82,0x01,0x1B,0x82,0x98,0x9A,0x83,0x99,0xA7,0x82,0xA5,
+    0xAE,0x83,0x98,0x9E,0x82,0x01,0x19,0x82,0x93,0x89,0x81,0xB1,0xA0,0x82,0x07,0x03,0xA3,0x9B,0x82,0x05,0x03,0x01,0x02,0x00,
+    0x8D,0xA2,0x00,0x8D,0x82,0x01,0x03,0x81,0x01,0x03,0x82,0x89,0xA6,0x8B,0x82,0x05,0x03,0x82,0x8B,0xAE,0x90,0x83,0x93,0x87,
+    0x8D,0xAB,0x87,0x92,0xAB,0x83,0x97,0xE4,0x87,0x8E,0xAC,0x87,0x93,0xA9,0x91,0x93,0xAD,0x8A,0x89,0xAB,0x8F,0x03,0x02,0x81,
+    0x90,0xFF,0x08,0xC3,0x41,0x00,0x43,0x00,0xC0,0x8C,0x02,0x02,0x81,0x82,0x81,0xA7,0x8B,0x82,0x9A,0x8E,0x82,0x9A,0x95,0x83,
+    0x9D,0x9B,0x82,0xA7,0x9C,0x82,0xA9,0x96,0x87,0xBB,0x8F,0x8C,0x80,0x96,0x81,0x89,0x03,0x03,0x01,0x02,0x83,0xB5,0x9C,0x01,
+    0x02,0x02,0x03,0x03,0x02,0x00,0x8D,0xA2,0x00,0x8D,0x02,0x02,0x91,0x01,0x03,0x82,0x88,0xB1,0x8F,0x02,0x02,0x83,0x81,0x82,
+    0x88,0x89,0x88,0xB1,0x97,0x81,0x9E,0x92,0x87,0x9D,0x90,0x89,0xB1,0x8A,0x8F,0x00,0x86,0x8D,0x88,0xAC,0x8F,0x83,0x9F,0x90,
+    0x83,0xA4,0x96,0x82,0x81,0x02,0x02,0x83,0x93,0x00,0x86,0x43,0x00,0x44,0x00,0xDD,0x9F,0x87,0x03,0x02,0x88,0x82,0x8A,0xAB,
+    0x87,0x8A,0x9E,0x87,0x8C,0x00,0xEF,0x8D,0x88,0xA6,0xB8,0x88,0x9E,0x8A,0x8F,0xB2,0x89,0x96,0xFF,0x08,0x01,0x8B,0x92,0xA3,
+    0x88,0x95,0x96,0x82,0x8D,0x8A,0x87,0x9D,0x8E,0x82,0x83,0x06,0x02,0x00,0x8D,0xA2,0x00,0x8D,0x02,0x02,0x86,0x83,0x86,0x83,
+    0x86,0xAC,0x96,0x83,0x90,0x87,0x8C,0x9C,0x87,0x92,0x9A,0x8A,0xAB,0xA3,0x83,0xA8,0x9B,0x82,0xA8,0xA5,0x82,0xAB,0x95,0x82,
+    0xA6,0xA5,0x82,0xA4,0xA5,0x82,0x01,0x20,0x82,0x87,0x81,0x03,0x02,0x99,0xAB,0x45,0x00,0x46,0x00,0x00,0xC3,0xA5,0x87,0x04,
+    0x02,0x8A,0x82,0x8E,0x97,0x82,0x9C,0xAC,0x81,0x96,0x9E,0x87,0x93,0xA7,0x83,0xA0,0x9A,0x81,0xA4,0xA6,0x81,0x97,0xA7,0x81,
+    0xA9,0xCD,0x83,0x9A,0x96,0x8C,0xD0,0x90,0x8B,0xCD,0x83,0x90,0xC5,0x82,0xB3,0x00,0x80,0x82,0x00,0x8D,0xA2,0x00,0x8D,0x82,
+    0xAF,0xB8,0x8E,0x82,0x93,0x98,0x83,0x9D,0x99,0x88,0xAC,0x8F,0x8C,0xCB,0x01,0x0D,0xA6,0x8C,0xA0,0xB2,0x8A,0x8E,0x9A,0x83,
+    0x8E,0x9A,0x83,0x99,0x9F,0x82,0x9C,0xA6,0x82,0x8D,0xAB,0x01,0x03,0x88,0x03,0x02,0x87,0x90,0xD3,0x47,0x00,0x49,0x00,0xAC,
+    0x8F,0x81,0x03,0x02,0x88,0x81,0x82,0x9E,0x9C,0x82,0xA4,0x9B,0x82,0xA5,0x97,0x82,0x9F,0x97,0x82,0xAD,0x9F,0x82,0xA8,0xA5,
+    0x81,0xAD,0x92,0x88,0xAC,0x8D,0x90,0x00,0x86,0x8A,0x92,0x9A,0x83,0xA4,0x9F,0x91,0xD6,0xC3,0x82,0x00,0xB7,0xA2,0x00,0xB7,
+    0x82,0x8F,0x95,0xE8,0x81,0xD2,0xB5,0x82,0x9A,0x00,0xB6,0x83,0xAD,0x95,0x87,0xB1,0x96,0x8A,0x9E,0x8B,0x90,0x00,0x86,0x01,
+    0x0B,0xA6,0x89,0x8C,0x9D,0x8C,0x8B,0xA6,0x83,0x8A,0xE4,0x89,0x82,0x89,0x04,0x02,0x8C,0xA9,0x4A,0x00,0x4B,0x00,0x9E,0x97,
+    0x90,0x04,0x02,0x8D,0x88,0x82,0xA8,0x96,0x82,0xA9,0x8E,0x81,0x9E,0x92,0x83,0xB1,0x9C,0x83,0x9A,0x95,0x8A,0x9D,0x8C,0x8B,
+    0xAC,0x87,0x96,0x00,0x86,0x81,0x8E,0x9F,0x82,0xA1,0xA4,0x86,0xB5,0x00,0xE8,0x82,0x00,0xB7,0xA2,0x00,0xB7,0x82,0xB3,0x93,
+    0xE8,0x88,0x92,0x9E,0x82,0x00,0x82,0x9A,0x82,0xA7,0x9C,0x82,0xA3,0x94,0x83,0x9F,0x93,0x8B,0xE4,0x96,0x88,0x9E,0x96,0x81,
+    0x9A,0x95,0x81,0xA7,0x8B,0x82,0x8F,0x86,0x03,0x02,0x89,0x99,0x9B,0x4C,0x00,0x4E,0x00,0xCB,0x01,0x0A,0x87,0x03,0x02,0x87,
+    0x82,0x81,0x97,0x89,0x8C,0x9E,0x8A,0x8B,0xD0,0x8B,0x88,0x9D,0x8C,0x8F,0x9E,0x81,0x90,0xAD,0x82,0x92,0x00,0x90,0x81,0xA0,
+    0x9B,0x82,0xA7,0xC3,0x83,0xB5,0x00,0xCF,0x82,0x00,0xB7,0xB4,0x00,0xB7,0x82,0xB3,0x8F,0xE8,0xAF,0x90,0xCC,0x82,0xA1,0xB5,
+    0x82,0xA5,0xA8,0x82,0xA5,0xC8,0x82,0x9C,0x94,0x83,0xAB,0xA4,0x83,0x9B,0x9C,0x82,0x01,0x15,0x82,0x87,0x03,0x02,0x83,0x88,
+    0x82,0xA6,0xFF,0x10,0x82,0x4E,0x00,0x51,0x00,0xA1,0x8F,0x96,0x81,0x05,0x02,0x8A,0x93,0x82,0x93,0xA6,0x83,0x8B,0xAD,0x83,
+    0x95,0xA3,0x82,0x95,0xA3,0x82,0x94,0xA6,0x83,0x97,0xCD,0x82,0xD6,0x94,0x82,0xB5,0xD2,0x82,0x00,0xC7,0xB4,0x00,0xC7,0x82,
+    0xB3,0xB0,0x00,0x99,0x01,0x0C,0xCC,0x87,0x9C,0x9D,0x82,0x8E,0xA9,0x82,0x98,0xA9,0x82,0x95,0xA5,0x82,0xA5,0xA7,0x82,0x8C,
+    0x90,0x06,0x02,0x8B,0x90,0x96,0x52,0x00,0x54,0x00,0x8E,0xA4,0x98,0x01,0x03,0x04,0x02,0x87,0x8B,0x82,0x8C,0x94,0x82,0x94,
+    0x9C,0x82,0x9C,0x9B,0x82,0xA1,0xA3,0x82,0x9B,0x8E,0x82,0xB5,0x00,0xA4,0x82,0xB5,0xFF,0xB5,0xF8,0x82,0xFF,0xF5,0x52,0xB4,
+    0xFF,0xF5,0x52,0x82,0xB3,0x8A,0x9D,0x8D,0x88,0x9E,0x89,0x92,0xCB,0x81,0x00,0xA8,0x9E,0x82,0x8D,0xA3,0x83,0x8C,0x95,0x82,
+    0x88,0x8C,0x06,0x02,0x90,0xA5,0x94,0xB1,0x54,0x00,0x57,0x00,0xAC,0xCB,0x8A,0x01,0x08,0x83,0x06,0x02,0x8A,0x88,0x82,0x93,
+    0x8F,0x82,0xA8,0x99,0x82,0x9B,0x90,0x82,0xAB,0xC5,0x82,0x9A,0xC0,0x82,0xFF,0xFD,0x72,0xB4,0xFF,0xFD,0x72,0x82,0xB3,0xAA,
+    0xB5,0x00,0xA8,0x83,0xA9,0x8B,0x89,0x9D,0x88,0x81,0x98,0x01,0x02,0x8C,0x07,0x02,0x87,0x88,0x87,0xAD,0xA6,0x58,0x00,0x5C,
+    0x00,0x9B,0x8B,0x90,0x8F,0x81,0x08,0x02,0x81,0x83,0x82,0x89,0x81,0x82,0xC5,0xAF,0x82,0x8E,0xB0,0x82,0x00,0xDD,0xB4,0x00,
+    0xDD,0x82,0x89,0x83,0xC5,0xF2,0x82,0x8C,0x83,0x82,0x87,0x09,0x02,0x8C,0x8F,0x8B,0x98,0x5D,0x00,0x60,0x00,0x96,0x94,0x97,
+    0xA0,0x8B,0x22,0x02,0x87,0x95,0x99,0xA0,0x93,0x61,0x00,0x64,0x00,0xFF,0x18,0xC3,0xA3,0x01,0x1E,0x9A,0xA8,0x8D,0x83,0x81,
+    0x01,0x07,0x03,0x01,0x86,0x07,0x01,0x86,0x03,0x01,0x83,0x8A,0xA5,0xA9,0xAB,0x9E,0xA9,0xA6,0x65,0x00,0x7F,0x00,0x6F,0x00,
+    0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,0x7F,0x00,0x6F,0x00,
+};
+
+const CompressedFace clockFace = {
+    240, 240, 256, clockFacePalette, clockFaceRowOffsets, clockFaceData
+};
+
+#endif // CLOCK_FACE_RLE_H
@@ -0,0 +1,162 @@
+#include "complications.h"
+#include <WiFi.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ---- TextComplication ----
+
+TextComplication::TextComplication(const ClockRect& area, const lgfx::IFont* font, uint16_t color)
+    : area(area), font(font), color(color) {
+    text[0] = '\0';
+}
+
+ClockRect TextComplication::setText(const char* next) {
+    if (strncmp(text, next, sizeof(text) - 1) == 0) {
+        return ClockRect{ 0, 0, 0, 0 };
+    }
+    strncpy(text, next, sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+    tile.render(font, text);
+    return area;
+}
+
+void TextComplication::draw(lgfx::LovyanGFX* dst, int originX, int originY) {
+    int x = area.x + (area.w - tile.getWidth()) / 2;
+    int y = area.y + (area.h - tile.getHeight()) / 2;
+    tile.draw(dst, x - originX, y - originY, color);
+}
+
+// ---- DigitalTimeComplication ----
+
+ClockRect DigitalTimeComplication::refresh(const ClockTime& time) {
+    char buf[8];
+    sprintf(buf, "%02d:%02d", time.hour, time.minute);
+    return setText(buf);
+}
+
+// ---- StepCounterComplication ----
+
+// 5秒ごとに0〜11歩増える。日付が変わる0時台の最初に0に戻す
+ClockRect StepCounterComplication::refresh(const ClockTime& time) {
+    if (time.hour == 0 && time.minute == 0 && steps > 100) {
+        steps = 0;
+    }
+    seed = seed * 1103515245 + 12345;
+    steps += (seed >> 16) % 12;
+    char buf[16];
+    sprintf(buf, "%lu steps", (unsigned long)steps);
+    return setText(buf);
+}
+
+// ---- TemperatureComplication ----
+
+// 24度を中心に10分周期で±1.5度ゆっくり変わる
+float TemperatureSensorStub::read() {
+    float phase = (millis() % 600000) / 600000.0f * 2.0f * (float)M_PI;
+    return 24.0f + 1.5f * sinf(phase);
+}
+
+ClockRect TemperatureComplication::refresh(const ClockTime& time) {
+    int tenths = (int)lroundf(sensor->read() * 10.0f);
+    if (tenths == lastTenths) {
+        return ClockRect{ 0, 0, 0, 0 };
+    }
+    lastTenths = tenths;
+    char buf[12];
+    sprintf(buf, "%d.%dC", tenths / 10, abs(tenths % 10));
+    return setText(buf);
+}
+
+// ---- NextAlarmComplication ----
+
+ClockRect NextAlarmComplication::refresh(const ClockTime& time) {
+    char buf[12];
+    if (alarmHour < 0) {
+        strcpy(buf, "ALM --:--");
+    } else {
+        sprintf(buf, "ALM %02d:%02d", alarmHour, alarmMinute);
+    }
+    return setText(buf);
+}
+
+// ---- WiFiRssiComplication ----
+
+// RSSIを0〜4本に変換（未接続なら-1）
+ClockRect WiFiRssiComplication::refresh(const ClockTime& time) {
+    int next = -1;
+    if (WiFi.status() == WL_CONNECTED) {
+        int rssi = WiFi.RSSI();
+        next = rssi >= -55 ? 4 : rssi >= -65 ? 3 : rssi >= -75 ? 2 : rssi >= -85 ? 1 : 0;
+    }
+    if (next == bars) {
+        return ClockRect{ 0, 0, 0, 0 };
+    }
+    bars = next;
+    return area;
+}
+
+// 左から高くなる4本のバー。届いていない分は dimColor、未接続なら何も描かない
+void WiFiRssiComplication::draw(lgfx::LovyanGFX* dst, int originX, int originY) {
+    if (bars < 0) {
+        return;
+    }
+    int barWidth = (area.w - 3) / 4;
+    for (int i = 0; i < 4; i++) {
+        int h = area.h * (i + 1) / 4;
+        int x = area.x + i * (barWidth + 1) - originX;
+        int y = area.y + area.h - h - originY;
+        dst->fillRect(x, y, barWidth, h, i < bars ? color : dimColor);
+    }
+}
+
+// ---- SecondsRingComplication ----
+
+ClockRect SecondsRingComplication::dotRect(int index) const {
+    int step = clock_trig::secondStep(index);
+    int x = centerX + clock_trig::offsetX(step, radius);
+    int y = centerY + clock_trig::offsetY(step, radius);
+    ClockRect r = { x - dotRadius, y - dotRadius, dotRadius * 2 + 1, dotRadius * 2 + 1 };
+    return r;
+}
+
+ClockRect SecondsRingComplication::region() const {
+    int extent = radius + dotRadius;
+    ClockRect r = { centerX - extent, centerY - extent, extent * 2 + 1, extent * 2 + 1 };
+    return r;
+}
+
+// 秒が1つ進んだら増えた点だけ、0秒に戻ったら消える点を含めて全体を返す
+ClockRect SecondsRingComplication::refresh(const ClockTime& time) {
+    int next = time.second;
+    if (next == second) {
+        return ClockRect{ 0, 0, 0, 0 };
+    }
+    ClockRect changed = { 0, 0, 0, 0 };
+    if (next == second + 1) {
+        changed = dotRect(next);
+    } else if (next > second) {
+        for (int i = second + 1; i <= next; i++) {
+            changed = changed.unite(dotRect(i));
+        }
+    } else {
+        for (int i = next + 1; i <= second; i++) {
+            changed = changed.unite(dotRect(i));
+        }
+    }
+    second = next;
+    return changed;
+}
+
+void SecondsRingComplication::draw(lgfx::LovyanGFX* dst, int originX, int originY) {
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+    ClockRect clip = { clipX + originX, clipY + originY, clipW, clipH };
+    for (int i = 0; i <= second; i++) {
+        ClockRect r = dotRect(i);
+        if (!r.intersects(clip)) {
+            continue;
+        }
+        dst->fillCircle(r.x + dotRadius - originX, r.y + dotRadius - originY, dotRadius, color);
+    }
+}
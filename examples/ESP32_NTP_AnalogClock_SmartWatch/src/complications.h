@@ -0,0 +1,137 @@
+#ifndef COMPLICATIONS_H
+#define COMPLICATIONS_H
+
+#include <Arduino.h>
+#include <limits.h>
+#include <LovyanGFX.hpp>
+#include <ClockEngine.h>
+
+// 文字で表示するコンプリケーションの共通部分
+// 文字が変わった時だけ TextTile を作り直し、範囲の中央に描く。
+class TextComplication : public Complication {
+protected:
+    ClockRect area;
+    const lgfx::IFont* font;
+    uint16_t color;
+    TextTile tile;
+    char text[16];
+
+    // 表示する文字を設定（変わったら area を、変わらなければ空の矩形を返す）
+    ClockRect setText(const char* next);
+
+public:
+    TextComplication(const ClockRect& area, const lgfx::IFont* font, uint16_t color);
+
+    ClockRect region() const override { return area; }
+    void draw(lgfx::LovyanGFX* dst, int originX, int originY) override;
+};
+
+// デジタル時刻（HH:MM）
+class DigitalTimeComplication : public TextComplication {
+public:
+    DigitalTimeComplication(const ClockRect& area, uint16_t color)
+        : TextComplication(area, &fonts::Font2, color) {}
+
+    const char* name() const override { return "time"; }
+    uint32_t period() const override { return 1000; }
+    ClockRect refresh(const ClockTime& time) override;
+};
+
+// 歩数計（センサーがないので歩いているような値を作るスタブ）
+class StepCounterComplication : public TextComplication {
+private:
+    uint32_t steps;
+    uint32_t seed;
+
+public:
+    StepCounterComplication(const ClockRect& area, uint16_t color)
+        : TextComplication(area, &fonts::Font0, color), steps(0), seed(12345) {}
+
+    const char* name() const override { return "steps"; }
+    uint32_t period() const override { return 5000; }
+    ClockRect refresh(const ClockTime& time) override;
+};
+
+// 温度（センサーのスタブ。read() を差し替えれば実際のセンサーになる）
+class TemperatureSensorStub {
+public:
+    virtual ~TemperatureSensorStub() {}
+    // 摂氏。ゆっくり上下する値を返す
+    virtual float read();
+};
+
+class TemperatureComplication : public TextComplication {
+private:
+    TemperatureSensorStub* sensor;
+    int lastTenths;                 // 0.1度単位（表示が変わらなければ描き直さない）
+
+public:
+    TemperatureComplication(const ClockRect& area, uint16_t color, TemperatureSensorStub* sensor)
+        : TextComplication(area, &fonts::Font0, color), sensor(sensor), lastTenths(INT_MIN) {}
+
+    const char* name() const override { return "temperature"; }
+    uint32_t period() const override { return 10000; }
+    ClockRect refresh(const ClockTime& time) override;
+};
+
+// 次のアラーム（負の時刻ならアラームなし）
+class NextAlarmComplication : public TextComplication {
+private:
+    int alarmHour;
+    int alarmMinute;
+
+public:
+    NextAlarmComplication(const ClockRect& area, uint16_t color, int hour = -1, int minute = 0)
+        : TextComplication(area, &fonts::Font0, color), alarmHour(hour), alarmMinute(minute) {}
+
+    void setAlarm(int hour, int minute) { alarmHour = hour; alarmMinute = minute; }
+
+    const char* name() const override { return "alarm"; }
+    uint32_t period() const override { return 1000; }
+    ClockRect refresh(const ClockTime& time) override;
+};
+
+// WiFiの電波強度（4本のバー）
+class WiFiRssiComplication : public Complication {
+private:
+    ClockRect area;
+    uint16_t color;
+    uint16_t dimColor;
+    int bars;                       // 負なら未接続
+
+public:
+    WiFiRssiComplication(const ClockRect& area, uint16_t color, uint16_t dimColor)
+        : area(area), color(color), dimColor(dimColor), bars(-2) {}
+
+    const char* name() const override { return "rssi"; }
+    uint32_t period() const override { return 5000; }
+    ClockRect region() const override { return area; }
+    ClockRect refresh(const ClockTime& time) override;
+    void draw(lgfx::LovyanGFX* dst, int originX, int originY) override;
+};
+
+// 文字盤の縁に沿って秒数だけ点を並べるリング
+// 1秒ごとに変わるのは1つの点だけなので、その点の範囲だけを返す。
+class SecondsRingComplication : public Complication {
+private:
+    int centerX;
+    int centerY;
+    int radius;
+    int dotRadius;
+    uint16_t color;
+    int second;                     // 点灯している点の数 - 1（負なら消灯）
+
+    ClockRect dotRect(int index) const;
+
+public:
+    SecondsRingComplication(int centerX, int centerY, int radius, int dotRadius, uint16_t color)
+        : centerX(centerX), centerY(centerY), radius(radius), dotRadius(dotRadius), color(color), second(-1) {}
+
+    const char* name() const override { return "seconds ring"; }
+    uint32_t period() const override { return 100; }
+    ClockRect region() const override;
+    ClockRect refresh(const ClockTime& time) override;
+    void draw(lgfx::LovyanGFX* dst, int originX, int originY) override;
+};
+
+#endif // COMPLICATIONS_H
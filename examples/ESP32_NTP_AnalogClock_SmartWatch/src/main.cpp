@@ -2,10 +2,14 @@
 #include <LovyanGFX.hpp>
 #include <WiFi.h>
 #include <time.h>
-#include "html_content.h"  // HTMLコンテンツを含むヘッダファイル
-#include "wifi_manager.h"  // WiFi設定管理ライブラリ
+#include <driver/ledc.h>
+#include <wifi_manager.h>   // WiFi設定管理ライブラリ（lib/ClockNet）
+#include <settings_store.h> // 設定の保存（lib/ClockSettings）
+#include <settings_api.h>   // 設定のREST API（lib/ClockSettings）
 #include "ntp_clock.h"    // NTP時計ライブラリ
 #include "touch_manager.h" // タッチセンサー管理ライブラリ
+#include <power_manager.h>  // 電源の管理（省電力モード、lib/ClockNet）
+#include "complications.h" // 文字盤のコンプリケーション
 
 // バックライト設定
 #define BACKLIGHT_CHANNEL 0
@@ -14,6 +18,33 @@
 #define BACKLIGHT_MAX 255
 #define TFT_BACKLIGHT_ON LOW  // 元の設定に戻す
 
+// LCDのSPIクロック（スイープ秒針のバス使用率の計算にも使う）
+#define LCD_SPI_FREQ 27000000
+
+// 秒針のスイープ表示の目標フレームレート（0でティック動作）
+#define SWEEP_FPS 30
+
+// 文字盤を背景スプライト（RAM 115KB）に展開しておくか（0なら圧縮データから都度展開）
+#define USE_BACKGROUND_SPRITE 1
+
+// 全画面スプライト（RAM 230KB）を使わず16行の帯ごとに合成して転送するか（RAM 7.5KB）
+// 0でもスプライトを確保できなければ自動的に帯ごとの合成になる
+#define USE_BAND_COMPOSITOR 0
+
+// 文字盤にコンプリケーション（デジタル時刻・歩数・温度・アラーム・電波強度・秒のリング）を表示するか
+#define SHOW_COMPLICATIONS 1
+
+// 省電力モード（無線は時刻の同期の時だけ入れ、Web・OTAは短いタッチで5分間だけ開く。針を描き直す間はライトスリープ）
+// 1にするとスイープ秒針は使わず（1秒ごとに起きて描く）、CPUは80MHzで動く
+#define LOW_POWER_MODE 0
+
+// 最初のタイムゾーン（time_zone.cpp の表にある名前かPOSIXの規則。Web設定で変えるとそちらを保存して使う）
+#define DEFAULT_TIME_ZONE "Asia/Tokyo"
+
+// 起動時の診断表示（テストパターン・スプラッシュ画面・接続後のネットワーク情報・NTP同期の案内）を出すか
+// 0なら待ち時間を入れずに起動し、WiFiの接続とNTPの同期を待たずにすぐ時計を描く（各段階の時刻は [Boot] としてシリアルに表示）
+#define SHOW_BOOT_DIAGNOSTICS 0
+
 class LGFX : public lgfx::LGFX_Device {
 private:
   lgfx::Panel_ST7789 _panel_instance;
@@ -25,7 +56,7 @@ public:
       auto cfg = _bus_instance.config();
       cfg.spi_host = VSPI_HOST;
       cfg.spi_mode = 3;
-      cfg.freq_write = 27000000;
+      cfg.freq_write = LCD_SPI_FREQ;
       cfg.pin_sclk = 18;
       cfg.pin_mosi = 23;
       cfg.pin_miso = -1;
@@ -71,9 +102,23 @@ LGFX lcd;
 
 // ライブラリのインスタンス
 WiFiManager wifiManager("ESP32-Clock-Setup", "12345678", IPAddress(192, 168, 4, 1));
-NTPClock ntpClock(&lcd, "ntp.nict.jp", 9 * 3600, 0);
+NTPClock ntpClock(&lcd, "ntp.nict.jp", DEFAULT_TIME_ZONE);
 TouchManager touchManager(&lcd, 32, 83, 3000); // IO32をタッチセンサーとして使用
 
+// 電源の管理（省電力モードでは無線を同期の時だけ入れる。状態ごとの時間はシリアルのデバッグ出力に表示）
+PowerManager powerManager(&wifiManager, &ntpClock.getTimeSync(), &touchManager);
+
+#if SHOW_COMPLICATIONS
+// コンプリケーション（位置は240x240の画面座標、更新間隔はそれぞれのクラスで決まる）
+DigitalTimeComplication timeComplication({ 90, 140, 60, 16 }, TFT_WHITE);
+NextAlarmComplication alarmComplication({ 80, 158, 80, 10 }, TFT_ORANGE, 7, 0);
+StepCounterComplication stepComplication({ 40, 114, 64, 10 }, TFT_GREEN);
+TemperatureSensorStub temperatureSensor;
+TemperatureComplication temperatureComplication({ 150, 114, 50, 10 }, TFT_CYAN, &temperatureSensor);
+WiFiRssiComplication rssiComplication({ 112, 60, 17, 12 }, TFT_WHITE, TFT_DARKGREY);
+SecondsRingComplication secondsRing(120, 120, 116, 1, TFT_RED);
+#endif
+
 // バックライト設定
 #define LCD_BACKLIGHT_PIN 25
 #define LCD_BACKLIGHT_CHANNEL 0
@@ -85,12 +130,31 @@ uint8_t backlightBrightness = 128; // 初期値は50%（128/255）
 
 // バックライトをPWM制御する関数
 void setBacklightBrightness(uint8_t brightness) {
+#if LOW_POWER_MODE
+  // ライトスリープ中もPWMを止めないように、LEDCのクロックにRTC8Mを使う（ledcSetup() のAPBクロックはスリープ中に止まる）
+  ledc_timer_config_t timer = {};
+  timer.speed_mode = LEDC_LOW_SPEED_MODE;
+  timer.duty_resolution = LEDC_TIMER_8_BIT;
+  timer.timer_num = LEDC_TIMER_0;
+  timer.freq_hz = LCD_BACKLIGHT_FREQ;
+  timer.clk_cfg = LEDC_USE_RTC8M_CLK;
+  ledc_timer_config(&timer);
+  
+  ledc_channel_config_t channel = {};
+  channel.gpio_num = LCD_BACKLIGHT_PIN;
+  channel.speed_mode = LEDC_LOW_SPEED_MODE;
+  channel.channel = LEDC_CHANNEL_0;
+  channel.timer_sel = LEDC_TIMER_0;
+  channel.duty = 255 - brightness; // 明るさの反転（LOWで点灯のため）
+  ledc_channel_config(&channel);
+#else
   // PWM設定
   ledcSetup(LCD_BACKLIGHT_CHANNEL, LCD_BACKLIGHT_FREQ, LCD_BACKLIGHT_RESOLUTION);
   ledcAttachPin(LCD_BACKLIGHT_PIN, LCD_BACKLIGHT_CHANNEL);
   
   // 明るさの反転（LOWで点灯のため）
   ledcWrite(LCD_BACKLIGHT_CHANNEL, 255 - brightness);
+#endif
   
   // 現在の明るさを更新
   backlightBrightness = brightness;
@@ -98,16 +162,27 @@ void setBacklightBrightness(uint8_t brightness) {
   Serial.printf("[DEBUG] バックライトの明るさを%d%%に設定\n", (brightness * 100) / 255);
 }
 
+// 設定（RAMに持ち、変更はまとめてNVSに保存する）
+SettingsStore settingsStore;
+
+// 設定のREST API（/api/settings で明るさも変更できる）
+SettingsApi settingsApi(&settingsStore, &ntpClock, setBacklightBrightness);
+
 // バックライトを点灯する関数
 void turnOnBacklight() {
   // 現在の明るさでバックライトを点灯
   setBacklightBrightness(backlightBrightness);
 }
 
-// ネットワーク情報を表示する関数
+// ネットワーク情報を表示している時間（その間も loop() は止めず、時計は描かない）
+#define NETWORK_INFO_MS 3000
+unsigned long networkInfoShownAt = 0;
+
+// ネットワーク情報を表示する関数（NETWORK_INFO_MS 後に loop() の handleNetworkInfo() で時計に戻す）
 void displayNetworkInfo() {
   // IPアドレス表示中フラグを設定
   TouchManager::isShowingIPAddress = true;
+  networkInfoShownAt = millis();
 
   lcd.fillScreen(TFT_BLACK);
   lcd.setTextColor(TFT_WHITE);
@@ -118,7 +193,20 @@ void displayNetworkInfo() {
   lcd.println("Network Information");
 
   lcd.setCursor(10, 40);
-  if (wifiManager.isConnected()) {
+  if (wifiManager.getCurrentMode() == WiFiManager::MODE_AP_SETUP) {
+    lcd.println("WiFi: AP Mode");
+    lcd.setCursor(10, 60);
+    lcd.println("AP Mode: ESP32-Clock-Setup");
+    lcd.setCursor(10, 80);
+    lcd.print("AP IP: ");
+    lcd.println("192.168.4.1");
+    // 設定モードでもWiFiの接続は続けている
+    if (wifiManager.isConnected()) {
+      lcd.setCursor(10, 100);
+      lcd.print("STA IP: ");
+      lcd.println(WiFi.localIP().toString());
+    }
+  } else if (wifiManager.isConnected()) {
     lcd.println("WiFi: Connected");
     lcd.setCursor(10, 60);
     lcd.print("SSID: ");
@@ -130,32 +218,107 @@ void displayNetworkInfo() {
     lcd.print("Signal: ");
     lcd.print(WiFi.RSSI());
     lcd.println(" dBm");
-  } else if (wifiManager.getCurrentMode() == WiFiManager::MODE_AP_SETUP) {
-    lcd.println("WiFi: AP Mode");
-    lcd.setCursor(10, 60);
-    lcd.println("AP Mode: ESP32-Clock-Setup");
-    lcd.setCursor(10, 80);
-    lcd.print("AP IP: ");
-    lcd.println("192.168.4.1");
   } else {
     lcd.println("WiFi: Disconnected");
   }
+}
 
-  delay(3000);
+// ネットワーク情報の表示時間が過ぎたら時計に戻す（loop() から毎回呼ぶ。表示中なら true）
+bool handleNetworkInfo() {
+  if (!TouchManager::isShowingIPAddress) {
+    return false;
+  }
+  if (millis() - networkInfoShownAt < NETWORK_INFO_MS) {
+    return true;
+  }
   TouchManager::isShowingIPAddress = false;
+  ntpClock.redrawFullScreen();
+  return false;
+}
+
+// 設定モードに切り替える（APを開き、WiFiの接続と時計の表示はそのまま続ける）
+// 長押しを検出してから、APの情報を表示するまでの時間をシリアルに出力する（時計には loop() で戻る）
+void enterSetupMode() {
+  unsigned long start = millis();
+  wifiManager.startAPMode();
+  unsigned long switched = millis() - start;
+  displayNetworkInfo();
+  Serial.printf("[DEBUG] 設定モードに切り替え: AP開始 %lu ms, 情報の表示まで %lu ms\n",
+                switched, millis() - start);
+}
+
+// 通常モードに戻る（APを閉じる。設定モードで変えたWiFiの設定にはすでに接続し直している）
+void leaveSetupMode() {
+  unsigned long start = millis();
+  wifiManager.stopAPMode();
+  powerManager.resumeAfterSetup();
+  TouchManager::isShowingIPAddress = false; // APの情報を表示中ならすぐ時計に戻す
+  unsigned long switched = millis() - start;
+  ntpClock.redrawFullScreen();
+  Serial.printf("[DEBUG] 通常モードに切り替え: AP終了 %lu ms, 時計の表示まで %lu ms\n", switched, millis() - start);
+}
+
+// 起動の各段階の時刻（起動してからのms）と前の段階からの時間をシリアルに出力する
+void bootMark(const char* phase) {
+  static unsigned long last = 0;
+  unsigned long now = millis();
+  Serial.printf("[Boot] %s: %lu ms (+%lu ms)\n", phase, now, now - last);
+  last = now;
+}
+
+// 起動の進み具合（setup() では時計を描くところまで進め、WiFiの接続とNTPの同期は loop() の中で待つ）
+enum BootPhase { BOOT_WAIT_WIFI, BOOT_WAIT_NTP, BOOT_DONE };
+BootPhase bootPhase = BOOT_WAIT_WIFI;
+
+// 起動の続きを進める（loop() から毎回呼ぶ。待たずにすぐ戻る）
+void handleBoot() {
+  switch (bootPhase) {
+  case BOOT_WAIT_WIFI:
+    if (wifiManager.getCurrentMode() == WiFiManager::MODE_AP_SETUP) {
+      // 設定モード（APの情報は表示済み。WiFiの設定があれば接続はAPと並行して続ける）
+      bootPhase = BOOT_WAIT_NTP;
+    } else if (wifiManager.getLinkState() == WiFiManager::LINK_CONNECTED) {
+      bootMark("WiFi接続");
+#if !LOW_POWER_MODE
+      // OTAサーバーを設定（省電力モードでは短いタッチで開く）
+      wifiManager.setupOTA();
+      bootMark("Webサーバー");
+#endif
+#if SHOW_BOOT_DIAGNOSTICS
+      displayNetworkInfo();
+#endif
+      bootPhase = BOOT_WAIT_NTP;
+    } else if (wifiManager.getLinkState() == WiFiManager::LINK_BACKOFF) {
+      // 最初の接続に失敗したら設定モードにする（再接続は間隔を空けて続ける）
+      bootMark("WiFi接続失敗");
+      enterSetupMode();
+      bootPhase = BOOT_WAIT_NTP;
+    }
+    break;
+    
+  case BOOT_WAIT_NTP:
+    if (ntpClock.getTimeSync().isSynchronized()) {
+      bootMark("NTP同期");
+      bootPhase = BOOT_DONE;
+    }
+    break;
+    
+  case BOOT_DONE:
+    break;
+  }
 }
 
 // メインプログラムの初期化関数
 void setup() {
-  // シリアル通信の初期化
+  // シリアル通信の初期化（ポートが開くのは待たない）
   Serial.begin(115200);
-  delay(1000); // シリアルポートが安定するまで待機
   Serial.println("\nESP32 NTPアナログ時計起動");
-  Serial.println("[DEBUG] シリアル初期化完了");
+  bootMark("シリアル初期化");
   
-  // バックライトを最初に設定 - 50%の明るさで点灯
-  setBacklightBrightness(backlightBrightness);
-  Serial.printf("[DEBUG] バックライトの初期明るさ: %d%%\n", (backlightBrightness * 100) / 255);
+  // 保存してある設定を読み込む（NVSから1回で読む。保存されていなければ時計の初期値と明るさ50%）
+  settingsStore.begin(ntpClock.getNtpServer(), DEFAULT_TIME_ZONE, backlightBrightness);
+  backlightBrightness = settingsStore.get().brightness;
+  bootMark("設定の読み込み");
   
   // ヒープメモリの確認
   Serial.printf("[DEBUG] 空きメモリ: %d bytes\n", ESP.getFreeHeap());
@@ -169,9 +332,6 @@ void setup() {
   pinMode(2, OUTPUT);  // DC
   pinMode(4, OUTPUT);  // RST
   
-  // バックライトを確実に点灯
-  turnOnBacklight();
-  
   // LCD初期化
   lcd.init();
   lcd.setRotation(0);
@@ -179,12 +339,11 @@ void setup() {
   // lcd.setBrightness(BACKLIGHT_MAX);
   lcd.fillScreen(TFT_BLACK);
   
-  // バックライトを再度確認
+  // 画面を消してからバックライトを点灯（保存してある明るさ）
   turnOnBacklight();
+  bootMark("LCD初期化");
   
-  Serial.println("[DEBUG] LCD初期化完了");
-  delay(500);
-  
+#if SHOW_BOOT_DIAGNOSTICS
   // テストパターンを表示
   Serial.println("[DEBUG] テストパターン表示");
   lcd.drawRect(10, 10, 220, 220, TFT_RED);
@@ -204,24 +363,18 @@ void setup() {
   lcd.setCursor(60, 120);
   lcd.println("Version 1.0");
   delay(1000); // スプラッシュ画面を確認する時間
-
-  // ---（ネットワーク情報表示ブロックを削除）---
+#endif
   
   // WiFi管理ライブラリの初期化
-  Serial.println("[DEBUG] WiFiManager初期化開始");
-  wifiManager.begin();
-  Serial.println("[DEBUG] WiFiManager初期化完了");
-  delay(500);
+  wifiManager.begin(&settingsStore);
+  wifiManager.setSettingsApi(&settingsApi);
+  settingsApi.begin(); // 保存してあるNTPサーバー・タイムゾーン・文字盤を時計に反映
   
   // タッチセンサーの初期化
-  Serial.println("[DEBUG] タッチセンサー初期化");
   touchManager.begin();
   touchManager.setNTPClock(&ntpClock); // NTPClockの参照を設定
-  Serial.println("[DEBUG] タッチセンサー初期化完了");
-  delay(500);
   
   // 起動時にタッチされているか確認
-  Serial.println("[DEBUG] タッチ状態確認");
   uint16_t touchValue = touchManager.getTouchValue();
   uint16_t threshold = touchManager.getTouchThreshold();
   Serial.printf("[DEBUG] タッチ値: %d, 閾値: %d\n", touchValue, threshold);
@@ -230,40 +383,41 @@ void setup() {
     Serial.println("[DEBUG] 起動時にタッチ検出。設定モードで起動します");
     wifiManager.startAPMode();
   } else {
-    // WiFi接続を試みる
-    Serial.println("[DEBUG] WiFi接続開始");
-    if (wifiManager.connectToWiFi()) {
-      Serial.println("[DEBUG] WiFi接続成功");
-      
-      // ネットワーク情報を表示
-      Serial.println("[DEBUG] ネットワーク情報表示");
-      displayNetworkInfo();
-      // displayNetworkInfo後にクロックフェイスを再描画
-      // ntpClock.drawClockFace(); // 不要なためコメントアウト
-      
-      // NTP時計の初期化
-      Serial.println("[DEBUG] NTPClock初期化開始");
-      ntpClock.begin();
-      Serial.println("[DEBUG] NTPClock初期化完了");
-      delay(500);
-      
-      // NTPから時刻を取得
-      Serial.println("[DEBUG] NTP同期開始");
-      bool syncResult = ntpClock.syncTimeWithNTP();
-      Serial.printf("[DEBUG] NTP同期%s\n", syncResult ? "成功" : "失敗");
-      delay(500);
-      
-
-      // OTAサーバーを設定
-      Serial.println("[DEBUG] OTAサーバー設定開始");
-      wifiManager.setupOTA();
-      Serial.println("[DEBUG] OTAサーバー設定完了");
-    } else {
-      Serial.println("[DEBUG] WiFi接続失敗");
-    }
+    // WiFiへの接続を始める（待たずに戻り、loop() の handleConnection() で進める。設定がなければ設定モード）
+    wifiManager.startConnection();
+  }
+  bootMark("WiFi接続開始");
+  
+  // NTP時計の初期化（すぐに文字盤を描き、RTCに時刻が残っていれば針も描く）
+  ntpClock.setUseBackgroundSprite(USE_BACKGROUND_SPRITE);
+  ntpClock.setUseBandCompositor(USE_BAND_COMPOSITOR);
+#if SHOW_COMPLICATIONS
+  ntpClock.addComplication(&secondsRing);
+  ntpClock.addComplication(&timeComplication);
+  ntpClock.addComplication(&alarmComplication);
+  ntpClock.addComplication(&stepComplication);
+  ntpClock.addComplication(&temperatureComplication);
+  ntpClock.addComplication(&rssiComplication);
+#endif
+  ntpClock.setShowSyncStatus(SHOW_BOOT_DIAGNOSTICS);
+  ntpClock.begin();
+  ntpClock.setBusBandwidth(LCD_SPI_FREQ / 8);
+  ntpClock.setSweepMode(SWEEP_FPS > 0 && !LOW_POWER_MODE, SWEEP_FPS);
+  unsigned long clockShownAt = millis();
+  bootMark(ntpClock.isTimeInitialized() ? "時計の表示（RTCの時刻）" : "文字盤の表示（NTPの同期待ち）");
+  
+  // NTPとの時刻同期を始める（待たずに戻り、WiFiにつながったら loop() の handleTimeSync() で問い合わせる）
+  ntpClock.beginTimeSync();
+  
+  // 設定モードならAPの情報を表示する（時計には loop() で戻る）
+  if (wifiManager.getCurrentMode() == WiFiManager::MODE_AP_SETUP) {
+    displayNetworkInfo();
   }
   
-  Serial.println("[DEBUG] setup()完了");
+  // 電源の管理を始める（省電力モードなら最初の同期が済むと無線を止める）
+  powerManager.begin(LOW_POWER_MODE);
+  
+  Serial.printf("[Boot] setup()完了: %lu ms（時計の表示まで %lu ms、目標 500 ms）\n", millis(), clockShownAt);
   Serial.printf("[DEBUG] 空きメモリ: %d bytes\n", ESP.getFreeHeap());
 }
 
@@ -276,8 +430,24 @@ void loop() {
   
   // 10秒ごとにデバッグ情報を出力
   if (currentTime - lastDebugTime > 10000) {
-    Serial.printf("[DEBUG] loop実行回数: %lu, 空きメモリ: %d bytes\n", 
-                  loopCount, ESP.getFreeHeap());
+    unsigned long elapsed = currentTime - lastDebugTime;
+    unsigned long bytesPerSec = (unsigned long)((uint64_t)ntpClock.takePushedBytes() * 1000ULL / elapsed);
+    unsigned long fps10 = (unsigned long)ntpClock.takeSweepFrames() * 10000UL / elapsed; // 0.1fps単位
+    Serial.printf("[DEBUG] loop実行回数: %lu, 空きメモリ: %d bytes, WiFi: %s (最長 %lu us), LCD転送: %lu bytes/s (バス使用率 %lu%%), 針描画: %lu px, スイープ: %lu.%lu fps, 合成: %lu us/frame (%s)\n", 
+                  loopCount, ESP.getFreeHeap(), wifiManager.getLinkStateName(),
+                  (unsigned long)wifiManager.takeHandleMaxMicros(), bytesPerSec,
+                  bytesPerSec * 100UL / (LCD_SPI_FREQ / 8),
+                  (unsigned long)ntpClock.takeHandPixels(),
+                  fps10 / 10, fps10 % 10,
+                  (unsigned long)ntpClock.getLastComposeMicros(),
+                  ntpClock.getStrategyName());
+    ntpClock.logComplicationStats();
+    SntpClient& sntp = ntpClock.getTimeSync();
+    Serial.printf("[DEBUG] NTP: ずれ %ld us, 周波数 %.2f ppm, 間隔 %lu 秒 (次回 %lu 秒後), 同期 %lu 回, 問い合わせ %lu/%lu, 通信 %lu ms\n",
+                  (long)sntp.getLastOffsetMicros(), sntp.getFrequencyPpm(), (unsigned long)sntp.getPollSeconds(),
+                  (unsigned long)(sntp.getMillisUntilNextSync() / 1000), (unsigned long)sntp.getRoundCount(),
+                  (unsigned long)sntp.getReplyCount(), (unsigned long)sntp.getQueryCount(), (unsigned long)sntp.getRadioMillis());
+    powerManager.logStats();
     lastDebugTime = currentTime;
     loopCount = 0;
   }
@@ -287,6 +457,12 @@ void loop() {
   yield();
   
   try {
+    // Webから変更された設定を時計とバックライトに反映し、変更が落ち着いたらNVSに保存
+    settingsStore.handle();
+    
+    // 起動の続き（WiFiにつながったらWebサーバーを開き、NTPの同期までの時刻を記録する）
+    handleBoot();
+    
     // 現在の動作モードに応じた処理
     WiFiManager::OperationMode currentMode = wifiManager.getCurrentMode();
     
@@ -295,9 +471,9 @@ void loop() {
       
       // タッチセンサーをチェック
       if (touchManager.checkLongTouch()) {
-        // 長押し検出、設定モードに切り替え
+        // 長押し検出、設定モードに切り替え（再起動しない）
         Serial.println("[DEBUG] 長押し検出。設定モードに切り替えます");
-        wifiManager.startAPMode();
+        enterSetupMode();
         return;
       }
       
@@ -310,90 +486,68 @@ void loop() {
         Serial.println("[DEBUG] 短いタッチ検出。IPアドレスを表示します");
         lastIPDisplayTime = currentIPTime;
         
-        // IPアドレス表示処理を実行
-        displayNetworkInfo();
-        // IPアドレス表示後に画面全体を再描画
-        ntpClock.redrawFullScreen();
-      }
-
-      
-      // 初期化済みフラグの設定
-      static bool clockInitialized = true; // setup内で初期化済みにする
-      
-      // 5秒ごとにバックライトを確認
-      static unsigned long lastBacklightCheckTime = 0;
-      if (currentTime - lastBacklightCheckTime > 5000) { // 5秒ごと
-        // バックライトの明るさを再設定
-        setBacklightBrightness(backlightBrightness);
-        lastBacklightCheckTime = currentTime;
-      }
-      
-      // 時計を更新
-      try {
-        // WiFi接続状態を確認
-        if (wifiManager.isConnected()) {
-          // NTP同期済みの時計を更新
-          ntpClock.updateClock();
-        } else {
-          // WiFi未接続時も内部時計で更新
-          struct tm timeinfo;
-          if (getLocalTime(&timeinfo)) {
-            ntpClock.drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-          }
-        }
-      } catch (const std::exception& e) {
-        Serial.printf("[ERROR] 時計更新エラー: %s\n", e.what());
-      }
-        
-      // 1時間ごとにNTP同期
-      static unsigned long lastSyncTime = 0;
-      unsigned long currentSyncTime = millis();
-      if (wifiManager.isConnected() && (currentSyncTime - lastSyncTime > 3600000)) { // 1時間 = 3600000ms
-        Serial.println("[DEBUG] NTP再同期開始");
-        bool syncResult = ntpClock.syncTimeWithNTP();
-        lastSyncTime = currentSyncTime;
-        if (syncResult) {
-          Serial.println("[DEBUG] NTP同期成功");
-        } else {
-          Serial.println("[DEBUG] NTP同期失敗");
-        }
+        // Webサーバーを開く（省電力モードでは無線を入れて、つながってから開く）
+        powerManager.requestWeb();
       }
       
-      // WiFi接続が切れた場合は再接続を試みる
-      if (!wifiManager.isConnected()) {
-        static unsigned long lastReconnectTime = 0;
-        
-        if (currentTime < lastReconnectTime) {
-          lastReconnectTime = 0;
-        }
-        
-        // 30秒ごとに再接続を試みる
-        if (currentTime - lastReconnectTime > 30000) { // 30秒 = 30000ms
-          Serial.println("[DEBUG] WiFi再接続を試みます");
-          bool connectResult = false;
-          try {
-            connectResult = wifiManager.connectToWiFi();
-          } catch (const std::exception& e) {
-            Serial.printf("[ERROR] WiFi接続エラー: %s\n", e.what());
-          }
-          
-          if (connectResult) {
-            lastReconnectTime = currentTime;
-            Serial.println("[DEBUG] WiFi再接続成功");
-          } else {
-            Serial.println("[DEBUG] WiFi再接続失敗");
-          }
-        }
+      // Webサーバーを開いたらIPアドレスを表示
+      if (powerManager.takeWebReady()) {
+        displayNetworkInfo();
       }
     } else if (currentMode == WiFiManager::MODE_AP_SETUP) {
       // APモード（設定モード）
-      // タッチセンサーをチェックして長押しで通常モードに戻る
+      // タッチセンサーをチェックして長押しで通常モードに戻る（再起動しない）
       if (touchManager.checkLongTouch()) {
         Serial.println("[DEBUG] 長押し検出。通常モードに切り替えます");
-        Serial.println("[DEBUG] ESP32を再起動します");
-        delay(1000); // シリアル出力が完了するまで待機
-        ESP.restart(); // ESP32を再起動して通常モードで起動
+        leaveSetupMode();
+        return;
+      }
+    }
+    
+    // 5秒ごとにバックライトを確認
+    static unsigned long lastBacklightCheckTime = 0;
+    if (currentTime - lastBacklightCheckTime > 5000) { // 5秒ごと
+      // バックライトの明るさを再設定
+      setBacklightBrightness(backlightBrightness);
+      lastBacklightCheckTime = currentTime;
+    }
+    
+    // 時計を更新（設定モードでも止めない。ネットワーク情報の表示中は描かず、表示が終わったら描き直す）
+    try {
+      if (handleNetworkInfo()) {
+        // ネットワーク情報を表示中
+      } else if (wifiManager.isConnected()) {
+        // NTP同期済みの時計を更新
+        ntpClock.updateClock();
+      } else {
+        // WiFi未接続時も内部時計で更新
+        struct tm timeinfo;
+        if (ntpClock.isTimeInitialized() && ntpClock.getLocalTime(&timeinfo)) {
+          ntpClock.drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+        }
       }
+    } catch (const std::exception& e) {
+      Serial.printf("[ERROR] 時計更新エラー: %s\n", e.what());
+    }
+      
+    // NTPとの時刻同期を進める（間隔は時計のずれに合わせて伸び縮みする。待たずにすぐ戻る）
+    ntpClock.handleTimeSync();
+    
+    // WiFiの接続状態を進める（切断されたら間隔を空けて再接続する。設定モードでもAPと並行して接続を保つ）
+    wifiManager.handleConnection();
+    if (wifiManager.takeReconnected()) {
+      Serial.println("[DEBUG] WiFi再接続成功");
+    }
+    
+    // Webから頼まれた再起動（応答を送り終えてから、書いていない設定を保存して再起動する）
+    wifiManager.handleRestart();
+    
+    if (currentMode == WiFiManager::MODE_NORMAL) {
+      // 無線を入れる・止める（省電力モードでは同期とWebの時だけ入れる。設定モードの間はAPを開いたままにする）
+      powerManager.handle();
+      
+      // 次に描き直すまでライトスリープ（省電力モードで無線を止めている時だけ。タッチでも起きる）
+      powerManager.idle();
     }
   } catch (const std::exception& e) {
     Serial.printf("[ERROR] loop内で例外が発生しました: %s\n", e.what());
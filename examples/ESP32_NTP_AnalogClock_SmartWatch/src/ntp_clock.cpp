@@ -1,21 +1,35 @@
 #include "ntp_clock.h"
 #include <WiFi.h>
-#include "clock_face.h" // 時計文字盤ビットマップデータ
+#include <sys/time.h>
+#include "clock_face_rle.h" // 時計文字盤（パレット+RLEで圧縮、tools/convert_face.py で生成）
 
-// 文字盤が描画済みかチェックするフラグ
-static bool clockFaceDrawn = false;
+// 選べる文字盤（文字盤の画像は共通で、針の色が違う）
+struct FaceTheme {
+    const char* name;
+    uint16_t hourHand;
+    uint16_t minHand;
+    uint16_t secHand;
+};
+static const FaceTheme faceThemes[] = {
+    { "orange", 0xFB00, 0xFB00, 0xF800 },   // 赤みのオレンジの時針・分針（最初の設定）
+    { "white", 0xFFFF, 0xFFFF, 0xF800 },    // 白の時針・分針
+};
 
-// ビットマップを使用して時計文字盤をLCDに描画する関数のプロトタイプ
-void drawClockFaceBitmapToLCD(lgfx::LGFX_Device* lcd, int centerX, int centerY, int radius);
+// これより前の時刻は設定されていないものとする（ESP32の getLocalTime() と同じく2016年）
+static const time_t MIN_VALID_TIME = 1451606400;
 
 // Constructor
-NTPClock::NTPClock(lgfx::LGFX_Device* display, const char* ntpServer, long gmtOffset_sec, int daylightOffset_sec)
-    : lcd(display), ntpServer(ntpServer), gmtOffset_sec(gmtOffset_sec), daylightOffset_sec(daylightOffset_sec),
-      last_hour(-1), last_minute(-1), last_second(-1), last_day(-1), last_wday(-1), timeInitialized(false),
-      last_sec_x1(0), last_sec_y1(0), last_sec_startX(0), last_sec_startY(0),
-      last_min_x1(0), last_min_y1(0), last_min_startX(0), last_min_startY(0),
-      last_hour_x1(0), last_hour_y1(0), last_hour_startX(0), last_hour_startY(0),
-      backgroundSprite(nullptr), clockSprite(nullptr), backgroundInitialized(false), clockSpriteInitialized(false) {
+NTPClock::NTPClock(lgfx::LGFX_Device* display, const char* ntpServer, const char* timeZone)
+    : lcd(display), timeInitialized(false), statusShown(false), showSyncStatus(false), faceIndex(0), engine(display), face(clockFace, 120, 120), strategy(&directStrategy), dateLabel(-1), labelDay(0),
+      useBackgroundSprite(true), useBandCompositor(false), pushedBytes(0),
+      sweepMode(false), sweepTargetFps(30), busBytesPerSecond(27000000 / 8),
+      lastFrameMillis(0), frameCostAvgUs(0), frameBytesAvg(0), overBudgetFrames(0), sweepThrottleUntil(0),
+      sweepFrames(0) {
+    strncpy(this->ntpServer, ntpServer, sizeof(this->ntpServer) - 1);
+    this->ntpServer[sizeof(this->ntpServer) - 1] = '\0';
+    sntp.setServers(this->ntpServer);
+    this->timeZone.setZone(timeZone);
+    applyTimeZone();
     
     // Default settings - スマートウォッチ風のサイズに調整
     clockCenterX = 120; // 240x240の中心
@@ -35,667 +49,165 @@ NTPClock::NTPClock(lgfx::LGFX_Device* display, const char* ntpServer, long gmtOf
     hourMarksColor = TFT_WHITE;     // 時間マーカー：白
     textColor = 0xFD00;             // テキスト：赤みのオレンジ（RGB565形式）
     
-    // スプライトの初期化はコンストラクタでは行わない
-    // begin関数で行う
+    // 日付と曜日（文字盤の中心の上、白）
+    LabelStyle date = { clockCenterX, clockCenterY - 40, true, &fonts::Font2, 0xFFFF, false, 0, { 0, 0, 0, 0 } };
+    dateLabel = engine.addLabel(date);
+    
+    engine.setFace(&face);
+    applyStyle();
+}
+
+// 設定をエンジンに反映
+void NTPClock::applyStyle() {
+    face.setCenter(clockCenterX, clockCenterY);
+    engine.setCenter(clockCenterX, clockCenterY);
+    engine.setCenterAvoidRadius(centerAvoidRadius);
+    HandStyle hour = { hourHandLength, 0, HOUR_HAND_WIDTH, hourHandColor };
+    HandStyle minute = { minHandLength, 0, MIN_HAND_WIDTH, minHandColor };
+    HandStyle second = { secHandLength, 0, SEC_HAND_WIDTH, secHandColor };
+    engine.setHand(ClockEngine::HOUR, hour);
+    engine.setHand(ClockEngine::MINUTE, minute);
+    engine.setHand(ClockEngine::SECOND, second);
+    CenterCap cap = { 4, 0xFFFF, false, 0, 0, 0 }; // 中心点：白
+    engine.setCenterCap(cap);
 }
 
 // Initialize
+// 更新方式を選んでバッファを確保する。確保できなければ順にメモリの少ない方式に切り替える
 void NTPClock::begin() {
-    // 既存のスプライトをクリーンアップ
-    if (backgroundSprite != nullptr) {
-        backgroundSprite->deleteSprite();
-        delete backgroundSprite;
-        backgroundSprite = nullptr;
-    }
-    
-    if (clockSprite != nullptr) {
-        clockSprite->deleteSprite();
-        delete clockSprite;
-        clockSprite = nullptr;
-    }
-    
-    backgroundInitialized = false;
-    clockSpriteInitialized = false;
-    
     // 画面をクリア
     lcd->fillScreen(TFT_BLACK);
     
-    // 背景用スプライトを初期化
-    backgroundSprite = new LGFX_Sprite(lcd);
-    if (backgroundSprite) {
-        backgroundSprite->setColorDepth(16); // 16ビットカラーモード（RGB565）
-        backgroundSprite->setPsram(false);   // PSRAM不使用で高速化
-        
-        // 背景スプライトのサイズを設定
-        if (!backgroundSprite->createSprite(240, 240)) {
-            delete backgroundSprite;
-            backgroundSprite = nullptr;
-            Serial.println("Failed to allocate memory for background sprite");
-            return;
-        }
-        
-        // 背景スプライトに文字盤を描画
-        backgroundSprite->fillScreen(TFT_BLACK);
-        drawClockFaceBitmapToSprite(backgroundSprite, clockCenterX, clockCenterY, clockRadius);
-        
-        backgroundInitialized = true;
-        Serial.println("Background sprite initialized successfully");
-    } else {
-        Serial.println("Failed to create background sprite");
-        return;
+    UpdateStrategy* candidates[3];
+    int count = 0;
+    if (!useBandCompositor) {
+        doubleBuffer.setCacheBackground(useBackgroundSprite);
+        candidates[count++] = &doubleBuffer;
     }
+    candidates[count++] = &bandStrategy;
+    candidates[count++] = &directStrategy;
     
-    // ダブルバッファリング用のスプライトを初期化
-    clockSprite = new LGFX_Sprite(lcd);
-    if (clockSprite) {
-        clockSprite->setColorDepth(16); // 16ビットカラーモード（RGB565）
-        clockSprite->setPsram(false);   // PSRAM不使用で高速化
-        
-        // 時計スプライトのサイズを設定
-        if (!clockSprite->createSprite(240, 240)) {
-            delete clockSprite;
-            clockSprite = nullptr;
-            Serial.println("Failed to allocate memory for clock sprite");
-            return;
+    for (int i = 0; i < count; i++) {
+        if (strategy != nullptr) {
+            strategy->end();
         }
-        
-        clockSpriteInitialized = true;
-        Serial.println("Clock sprite initialized successfully");
-    } else {
-        Serial.println("Failed to create clock sprite");
-        return;
-    }
-    
-    // 文字盤の初期化
-    clockFaceDrawn = false;
-    
-    // 文字盤描画フラグをリセット
-    clockFaceDrawn = false;
-}
-
-// 背景スプライトに文字盤を描画する関数
-void NTPClock::drawClockFaceBitmapToSprite(LGFX_Sprite* sprite, int centerX, int centerY, int radius) {
-    // ビットマップデータのサイズを取得
-    int imgWidth = ::imgWidth;
-    int imgHeight = ::imgHeight;
-    
-    // ビットマップの左上の座標を計算
-    int startX = centerX - imgWidth / 2;
-    int startY = centerY - imgHeight / 2;
-    
-    // ビットマップデータをピクセル単位で描画
-    int index = 0;
-    for (int y = 0; y < imgHeight; y++) {
-        for (int x = 0; x < imgWidth; x++) {
-            // PROGMEMから色データを読み出し
-            uint16_t color = pgm_read_word(&img[index++]);
-            
-            // バイトオーダーを調整（必要に応じて）
-            color = ((color & 0x00FF) << 8) | ((color & 0xFF00) >> 8);
-            
-            // ピクセルを描画
-            sprite->drawPixel(startX + x, startY + y, color);
+        strategy = candidates[i];
+        engine.setStrategy(strategy);
+        uint32_t start = micros();
+        if (engine.begin()) {
+            Serial.printf("Update strategy: %s, %u bytes of DRAM (%lu us)\n", strategy->name(),
+                          (unsigned)strategy->bufferBytes(), (unsigned long)(micros() - start));
+            break;
         }
+        Serial.printf("Failed to allocate memory for %s strategy\n", strategy->name());
     }
+    
+    // 同期を待たずにすぐ文字盤を描く。電源を入れたままの再起動やディープスリープからの復帰ではRTCに時刻が
+    // 残っているので針も描く（NTPで同期したら次の更新で合わせ直す）
+    timeInitialized = time(nullptr) >= MIN_VALID_TIME;
+    redrawFullScreen();
 }
 
-// Get time from NTP server
-bool NTPClock::syncTimeWithNTP() {
-    if (WiFi.status() == WL_CONNECTED) {
-        // シリアルにのみ同期開始メッセージを表示
-        Serial.println("Synchronizing with NTP server...");
-        
-        // 初回のみLCDに同期メッセージを表示
-        if (!timeInitialized) {
-            lcd->fillScreen(TFT_BLACK);
-            lcd->setTextColor(TFT_WHITE);
-            lcd->setTextSize(1);
-            lcd->setFont(&fonts::Font2);
-            lcd->setCursor(10, 10);
-            lcd->println("Synchronizing with NTP server...");
-        }
-        
-        // NTPサーバーと時刻同期
-        configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
-        
-        // 時刻取得を試みる
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-            Serial.println("Time synchronization successful!");
-            
-            // 初回のみLCDに成功メッセージを表示
-            if (!timeInitialized) {
-                lcd->setCursor(10, 30);
-                lcd->println("Time sync OK");
-                
-                char timeStr[50];
-                strftime(timeStr, sizeof(timeStr), "%Y/%m/%d %H:%M:%S", &timeinfo);
-                lcd->setCursor(10, 50);
-                lcd->println(timeStr);
-                
-                delay(2000);
-            }
-            
-            // 初回のみ文字盤を再描画、それ以外は現在の表示を維持
-            bool firstSync = !timeInitialized;
-            timeInitialized = true;
-            
-            if (firstSync) {
-                drawClockFace();
-            }
-            
-            return true;
-        } else {
-            Serial.println("Time synchronization failed");
-            
-            // 初回のみLCDに失敗メッセージを表示
-            if (!timeInitialized) {
-                lcd->setCursor(10, 30);
-                lcd->println("Time sync failed");
-                lcd->setCursor(10, 50);
-                lcd->println("Using internal clock");
-                delay(2000);
-                drawClockFace();
-            }
-            
-            return false;
-        }
+// 時刻の同期を始める
+void NTPClock::beginTimeSync() {
+    if (!timeInitialized && showSyncStatus) {
+        lcd->fillScreen(TFT_BLACK);
+        lcd->setTextColor(TFT_WHITE);
+        lcd->setTextSize(1);
+        lcd->setFont(&fonts::Font2);
+        lcd->setCursor(10, 10);
+        lcd->println("Synchronizing with NTP server...");
+        statusShown = true;
     }
-    return false;
+    sntp.begin();
 }
 
-// ビットマップを使用して時計文字盤をLCDに描画する関数
-// 画像データの変換元ツール: https://lang-ship.com/tools/image2data/
-void drawClockFaceBitmapToLCD(lgfx::LGFX_Device* lcd, int centerX, int centerY, int radius) {
-    // ビットマップの寸法（240x240ピクセル）
-    // clock_face.hから直接値を使用
-    
-    // ビットマップを中央に配置するための開始位置を計算
-    int startX = centerX - imgWidth / 2;
-    int startY = centerY - imgHeight / 2;
-    
-    // 画面外にはみ出さないように調整
-    if (startX < 0) startX = 0;
-    if (startY < 0) startY = 0;
-    
-    Serial.println("Drawing 240x240 bitmap image to display");
-    
-    // ビットマップデータを直接LCDに描画
-    // img配列から240x240のRGB565ビットマップデータを読み込んで描画
-    int index = 0;
-    for (int y = 0; y < imgHeight; y++) {
-        for (int x = 0; x < imgWidth; x++) {
-            // PROGMEMからデータを読み込む
-            uint16_t color = pgm_read_word(&img[index++]);
-            
-            // RGB565のバイトオーダーを調整（必要に応じて）
-            // オレンジ色が青色になっている場合、赤と青のチャンネルが入れ替わっている可能性がある
-            // バイトオーダーを入れ替える
-            color = ((color & 0x00FF) << 8) | ((color & 0xFF00) >> 8);
-            
-            // 画面内の場合のみ描画
-            if ((startX + x) < lcd->width() && (startY + y) < lcd->height()) {
-                lcd->drawPixel(startX + x, startY + y, color);
-            }
+// 時刻の同期を進める
+void NTPClock::handleTimeSync() {
+    if (sntp.handle() && !timeInitialized) {
+        timeInitialized = true;
+        // 文字盤はもう描いてあるので、案内を表示していた時だけ描き直す（針は次の更新で描く）
+        if (statusShown) {
+            drawClockFace();
         }
     }
-    
-    Serial.println("Bitmap drawing complete");
 }
 
 // Draw the clock face - SmartWatch style
 void NTPClock::drawClockFace() {
-    if (clockFaceDrawn) {
-        return; // 既に描画済みなら何もしない
-    }
-    
-    // 背景スプライトが利用可能な場合は、スプライトを表示
-    if (backgroundInitialized && backgroundSprite != nullptr) {
-        lcd->startWrite();
-        backgroundSprite->pushSprite(0, 0);
-        lcd->endWrite();
-    } else {
-        // スプライトが使えない場合は直接描画
-        drawClockFaceBitmapToLCD(lcd, clockCenterX, clockCenterY, clockRadius);
-    }
-    
-    clockFaceDrawn = true;
+    engine.redraw();
 }
 
 // 画面全体を再描画する
 void NTPClock::redrawFullScreen() {
-    // ダブルバッファリング用のスプライトが初期化されていない場合は従来の方法で再描画
-    if (!clockSpriteInitialized || !backgroundInitialized || clockSprite == nullptr || backgroundSprite == nullptr) {
-        // 文字盤描画フラグをリセットして強制再描画
-        clockFaceDrawn = false;
-        
-        // 画面をクリア
-        lcd->fillScreen(TFT_BLACK);
-        
-        // 文字盤を再描画
-        if (backgroundInitialized && backgroundSprite != nullptr) {
-            lcd->startWrite();
-            backgroundSprite->pushSprite(0, 0);
-            lcd->endWrite();
-            clockFaceDrawn = true;
-        } else {
-            drawClockFace();
-        }
-        
-        // 現在時刻を取得して針を再描画
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-            // 針の前回位置をリセットして強制再描画
-            last_hour = -1;
-            last_minute = -1;
-            last_second = -1;
-            
-            // 針を強制描画
-            drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-        }
-        return;
-    }
+    engine.invalidate();
     
-    // ダブルバッファリングを使用した再描画
-    // 現在時刻を取得
+    // 現在時刻を取得して針を再描画
     struct tm timeinfo;
     if (getLocalTime(&timeinfo)) {
-        // 針の前回位置をリセットして強制再描画
-        last_hour = -1;
-        last_minute = -1;
-        last_second = -1;
-        
-        // ステップ1: 背景スプライトを時計スプライトにコピー
-        backgroundSprite->pushSprite(clockSprite, 0, 0);
-        
-        // ステップ2: 時計スプライトに針と日付を描画
-        
-        // 時針を描画
-        float hour_angle = ((timeinfo.tm_hour % 12) * 30 + timeinfo.tm_min * 0.5) * DEG_TO_RAD;
-        int hour_x1 = clockCenterX + hourHandLength * sin(hour_angle);
-        int hour_y1 = clockCenterY - hourHandLength * cos(hour_angle);
-        int hour_startX = clockCenterX + centerAvoidRadius * sin(hour_angle);
-        int hour_startY = clockCenterY - centerAvoidRadius * cos(hour_angle);
-        
-        for (int dx = -3; dx <= 3; ++dx) {
-            clockSprite->drawLine(hour_startX+dx, hour_startY, hour_x1+dx, hour_y1, hourHandColor);
-        }
-        
-        // 分針を描画
-        float min_angle = timeinfo.tm_min * 6 * DEG_TO_RAD;
-        int min_x1 = clockCenterX + minHandLength * sin(min_angle);
-        int min_y1 = clockCenterY - minHandLength * cos(min_angle);
-        int min_startX = clockCenterX + centerAvoidRadius * sin(min_angle);
-        int min_startY = clockCenterY - centerAvoidRadius * cos(min_angle);
-        
-        for (int dx = -2; dx <= 2; ++dx) {
-            clockSprite->drawLine(min_startX+dx, min_startY, min_x1+dx, min_y1, minHandColor);
-        }
-        
-        // 秒針を描画
-        float sec_angle = timeinfo.tm_sec * 6 * DEG_TO_RAD;
-        int sec_x1 = clockCenterX + secHandLength * sin(sec_angle);
-        int sec_y1 = clockCenterY - secHandLength * cos(sec_angle);
-        int sec_startX = clockCenterX + centerAvoidRadius * sin(sec_angle);
-        int sec_startY = clockCenterY - centerAvoidRadius * cos(sec_angle);
-        
-        clockSprite->drawLine(sec_startX, sec_startY, sec_x1, sec_y1, secHandColor);
-        
-        // 日付と曜日を描画
-        char dayBuf[8];
-        static const char* const dayNames[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
-        sprintf(dayBuf, "%s %d", dayNames[timeinfo.tm_wday], timeinfo.tm_mday);
-        
-        clockSprite->setTextColor(0xFFFF); // RGB565形式で白色を指定
-        clockSprite->setFont(&fonts::Font2);
-        int dayWidth = clockSprite->textWidth(dayBuf);
-        clockSprite->setCursor(clockCenterX - dayWidth/2, clockCenterY - 40);
-        clockSprite->print(dayBuf);
-        
-        // 中心点を描画
-        clockSprite->fillCircle(clockCenterX, clockCenterY, 4, 0xFFFF); // RGB565形式で白色を指定
-        
-        // ステップ3: 時計スプライトをLCDに描画
-        lcd->startWrite();
-        clockSprite->pushSprite(lcd, 0, 0);
-        lcd->endWrite();
-        
-        // 現在の針の位置を記憶
-        last_hour = timeinfo.tm_hour;
-        last_minute = timeinfo.tm_min;
-        last_second = timeinfo.tm_sec;
-        
-        // 秒針の位置を記憶
-        last_sec_x1 = sec_x1;
-        last_sec_y1 = sec_y1;
-        last_sec_startX = sec_startX;
-        last_sec_startY = sec_startY;
-        
-        // 分針の位置を記憶
-        last_min_x1 = min_x1;
-        last_min_y1 = min_y1;
-        last_min_startX = min_startX;
-        last_min_startY = min_startY;
-        
-        // 時針の位置を記憶
-        last_hour_x1 = hour_x1;
-        last_hour_y1 = hour_y1;
-        last_hour_startX = hour_startX;
-        last_hour_startY = hour_startY;
+        drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+    } else {
+        engine.redraw();
     }
 }
 
 // 文字盤描画フラグをリセット
 void NTPClock::resetClockFaceDrawnFlag() {
-    clockFaceDrawn = false;
-}
-
-// 背景スプライトの一部を再表示
-void NTPClock::restoreBackgroundArea(int x, int y, int width, int height) {
-    // ダブルバッファリング方式では、部分再描画は不要
-    // 互換性のために関数は残しておく
-    
-    // ダブルバッファリングが有効な場合は、全体再描画を行う
-    if (clockSpriteInitialized && clockSprite != nullptr) {
-        // 現在時刻を取得
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-            // 時計の針を再描画
-            drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-        }
-        return;
-    }
-    
-    // 旧式の方法（ダブルバッファリングが無効な場合のフォールバック）
-    if (backgroundInitialized && backgroundSprite != nullptr) {
-        // 座標が画面内に収まるように調整
-        if (x < 0) {
-            width += x;
-            x = 0;
-        }
-        if (y < 0) {
-            height += y;
-            y = 0;
-        }
-        if (x + width > 240) width = 240 - x;
-        if (y + height > 240) height = 240 - y;
-        
-        // 有効な領域がある場合のみ描画
-        if (width > 0 && height > 0) {
-            lcd->startWrite();
-            lcd->setClipRect(x, y, width, height);
-            backgroundSprite->pushSprite(0, 0);
-            lcd->clearClipRect();
-            lcd->endWrite();
-        }
-    } else {
-        // 背景スプライトがない場合は単に背景色で塗りつぶす
-        lcd->startWrite();
-        lcd->fillRect(x, y, width, height, clockFaceColor);
-        lcd->endWrite();
-    }
+    engine.invalidate();
 }
 
 // Draw the clock hands
-void NTPClock::drawClockHands(int hour, int minute, int second) {
-    // ダブルバッファリング用のスプライトが初期化されていない場合は従来の方法で描画
-    if (!clockSpriteInitialized || !backgroundInitialized || clockSprite == nullptr || backgroundSprite == nullptr) {
-        // 従来の方法で描画
-        if (!clockFaceDrawn) {
-            drawClockFace();
-        }
-        
-        // 更新項目を判定
-        bool hourChanged = (last_hour != hour);
-        bool minuteChanged = (last_minute != minute);
-        bool secondChanged = (last_second != second);
-        
-        // 日付の変更を確認
-        struct tm timeinfo;
-        getLocalTime(&timeinfo);
-        bool dateChanged = (last_day != timeinfo.tm_mday || last_wday != timeinfo.tm_wday);
-        if (dateChanged) {
-            last_day = timeinfo.tm_mday;
-            last_wday = timeinfo.tm_wday;
-        }
-        
-        // 何か変化があれば再描画
-        if (hourChanged || minuteChanged || secondChanged || dateChanged) {
-            // 前回の針を消去
-            if (secondChanged && last_second >= 0) {
-                // 秒針の前回位置を消去
-                restoreBackgroundArea(last_sec_startX - 1, last_sec_startY - 1, 
-                                    abs(last_sec_x1 - last_sec_startX) + 3, 
-                                    abs(last_sec_y1 - last_sec_startY) + 3);
-            }
-            
-            if (minuteChanged && last_minute >= 0) {
-                // 分針の前回位置を消去
-                restoreBackgroundArea(last_min_startX - 3, last_min_startY - 3, 
-                                    abs(last_min_x1 - last_min_startX) + 7, 
-                                    abs(last_min_y1 - last_min_startY) + 7);
-            }
-            
-            if (hourChanged && last_hour >= 0) {
-                // 時針の前回位置を消去
-                restoreBackgroundArea(last_hour_startX - 4, last_hour_startY - 4, 
-                                    abs(last_hour_x1 - last_hour_startX) + 9, 
-                                    abs(last_hour_y1 - last_hour_startY) + 9);
-            }
-            
-            // 日付と曜日を描画
-            if (dateChanged) {
-                char dayBuf[8];
-                static const char* const dayNames[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
-                sprintf(dayBuf, "%s %d", dayNames[timeinfo.tm_wday], timeinfo.tm_mday);
-                
-                lcd->setTextColor(0xFFFF); // RGB565形式で白色を指定
-                lcd->setFont(&fonts::Font2);
-                int dayWidth = lcd->textWidth(dayBuf);
-                lcd->setCursor(clockCenterX - dayWidth/2, clockCenterY - 40);
-                lcd->print(dayBuf);
-            }
-            
-            // 時針を描画
-            float hour_angle = ((hour % 12) * 30 + minute * 0.5) * DEG_TO_RAD;
-            int hour_x1 = clockCenterX + hourHandLength * sin(hour_angle);
-            int hour_y1 = clockCenterY - hourHandLength * cos(hour_angle);
-            int hour_startX = clockCenterX + centerAvoidRadius * sin(hour_angle);
-            int hour_startY = clockCenterY - centerAvoidRadius * cos(hour_angle);
-            
-            for (int dx = -3; dx <= 3; ++dx) {
-                lcd->drawLine(hour_startX+dx, hour_startY, hour_x1+dx, hour_y1, hourHandColor);
-            }
-            
-            // 分針を描画
-            float min_angle = minute * 6 * DEG_TO_RAD;
-            int min_x1 = clockCenterX + minHandLength * sin(min_angle);
-            int min_y1 = clockCenterY - minHandLength * cos(min_angle);
-            int min_startX = clockCenterX + centerAvoidRadius * sin(min_angle);
-            int min_startY = clockCenterY - centerAvoidRadius * cos(min_angle);
-            
-            for (int dx = -2; dx <= 2; ++dx) {
-                lcd->drawLine(min_startX+dx, min_startY, min_x1+dx, min_y1, minHandColor);
-            }
-            
-            // 秒針を描画
-            float sec_angle = second * 6 * DEG_TO_RAD;
-            int sec_x1 = clockCenterX + secHandLength * sin(sec_angle);
-            int sec_y1 = clockCenterY - secHandLength * cos(sec_angle);
-            int sec_startX = clockCenterX + centerAvoidRadius * sin(sec_angle);
-            int sec_startY = clockCenterY - centerAvoidRadius * cos(sec_angle);
-            
-            lcd->drawLine(sec_startX, sec_startY, sec_x1, sec_y1, secHandColor);
-            
-            // 中心点を描画
-            lcd->fillCircle(clockCenterX, clockCenterY, 4, 0xFFFF); // RGB565形式で白色を指定
-            
-            // 現在の針の位置を記憶
-            last_hour = hour;
-            last_minute = minute;
-            last_second = second;
-            
-            // 秒針の位置を記憶
-            last_sec_x1 = sec_x1;
-            last_sec_y1 = sec_y1;
-            last_sec_startX = sec_startX;
-            last_sec_startY = sec_startY;
-            
-            // 分針の位置を記憶
-            last_min_x1 = min_x1;
-            last_min_y1 = min_y1;
-            last_min_startX = min_startX;
-            last_min_startY = min_startY;
-            
-            // 時針の位置を記憶
-            last_hour_x1 = hour_x1;
-            last_hour_y1 = hour_y1;
-            last_hour_startX = hour_startX;
-            last_hour_startY = hour_startY;
-        }
-        return;
-    }
-    
-    // 更新項目を判定
-    bool hourChanged = (last_hour != hour);
-    bool minuteChanged = (last_minute != minute);
-    bool secondChanged = (last_second != second);
-    bool dateChanged = false;
-    
-    // 日付の変更を確認
+void NTPClock::drawClockHands(int hour, int minute, int second, int millisecond) {
+    // 日付と曜日（日付が変わった時だけ文字を作り直す）
     struct tm timeinfo;
-    getLocalTime(&timeinfo);
-    if (last_day != timeinfo.tm_mday || last_wday != timeinfo.tm_wday) {
-        dateChanged = true;
-        last_day = timeinfo.tm_mday;
-        last_wday = timeinfo.tm_wday;
-    }
-    
-    // 何か変化があれば再描画
-    if (hourChanged || minuteChanged || secondChanged || dateChanged || !clockFaceDrawn) {
-        // ステップ1: 背景スプライトを時計スプライトにコピー
-        backgroundSprite->pushSprite(clockSprite, 0, 0);
-        
-        // ステップ2: 時計スプライトに針を描画
-        
-        // 日付と曜日を描画
+    if (getLocalTime(&timeinfo) && timeinfo.tm_mday != labelDay) {
+        labelDay = timeinfo.tm_mday;
         char dayBuf[8];
         static const char* const dayNames[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
         sprintf(dayBuf, "%s %d", dayNames[timeinfo.tm_wday], timeinfo.tm_mday);
-        
-        clockSprite->setTextColor(0xFFFF); // RGB565形式で白色を指定
-        clockSprite->setFont(&fonts::Font2);
-        int dayWidth = clockSprite->textWidth(dayBuf);
-        clockSprite->setCursor(clockCenterX - dayWidth/2, clockCenterY - 40);
-        clockSprite->print(dayBuf);
-        
-        // 時針を描画
-        float hour_angle = ((hour % 12) * 30 + minute * 0.5) * DEG_TO_RAD;
-        int hour_x1 = clockCenterX + hourHandLength * sin(hour_angle);
-        int hour_y1 = clockCenterY - hourHandLength * cos(hour_angle);
-        int hour_startX = clockCenterX + centerAvoidRadius * sin(hour_angle);
-        int hour_startY = clockCenterY - centerAvoidRadius * cos(hour_angle);
-        
-        for (int dx = -3; dx <= 3; ++dx) {
-            clockSprite->drawLine(hour_startX+dx, hour_startY, hour_x1+dx, hour_y1, hourHandColor);
-        }
-        
-        // 分針を描画
-        float min_angle = minute * 6 * DEG_TO_RAD;
-        int min_x1 = clockCenterX + minHandLength * sin(min_angle);
-        int min_y1 = clockCenterY - minHandLength * cos(min_angle);
-        int min_startX = clockCenterX + centerAvoidRadius * sin(min_angle);
-        int min_startY = clockCenterY - centerAvoidRadius * cos(min_angle);
-        
-        for (int dx = -2; dx <= 2; ++dx) {
-            clockSprite->drawLine(min_startX+dx, min_startY, min_x1+dx, min_y1, minHandColor);
-        }
-        
-        // 秒針を描画
-        float sec_angle = second * 6 * DEG_TO_RAD;
-        int sec_x1 = clockCenterX + secHandLength * sin(sec_angle);
-        int sec_y1 = clockCenterY - secHandLength * cos(sec_angle);
-        int sec_startX = clockCenterX + centerAvoidRadius * sin(sec_angle);
-        int sec_startY = clockCenterY - centerAvoidRadius * cos(sec_angle);
-        
-        clockSprite->drawLine(sec_startX, sec_startY, sec_x1, sec_y1, secHandColor);
-        
-        // 中心点を描画
-        clockSprite->fillCircle(clockCenterX, clockCenterY, 4, 0xFFFF); // RGB565形式で白色を指定
-        
-        // ステップ3: 時計スプライトをLCDに描画
-        lcd->startWrite();
-        clockSprite->pushSprite(lcd, 0, 0);
-        lcd->endWrite();
-        
-        // 前回の針の位置を記憶
-        last_sec_x1 = sec_x1;
-        last_sec_y1 = sec_y1;
-        last_sec_startX = sec_startX;
-        last_sec_startY = sec_startY;
-        
-        last_min_x1 = min_x1;
-        last_min_y1 = min_y1;
-        last_min_startX = min_startX;
-        last_min_startY = min_startY;
-        
-        last_hour_x1 = hour_x1;
-        last_hour_y1 = hour_y1;
-        last_hour_startX = hour_startX;
-        last_hour_startY = hour_startY;
-        
-        // 時間を更新
-        last_hour = hour;
-        last_minute = minute;
-        last_second = second;
-        
-        // 文字盤描画フラグをセット
-        clockFaceDrawn = true;
+        engine.setLabelText(dateLabel, dayBuf);
     }
+    
+    // 変化した針と日付の範囲だけが更新方式に渡される
+    ClockTime time = { hour, minute, second, millisecond };
+    engine.update(time);
+    pushedBytes += engine.takePushedBytes();
+}
+
+// 前回呼び出し以降にLCDへ転送したバイト数を取得してリセット
+uint32_t NTPClock::takePushedBytes() {
+    uint32_t bytes = pushedBytes;
+    pushedBytes = 0;
+    return bytes;
 }
 
 // Get current time and update the clock
 void NTPClock::updateClock() {
+    // スイープ表示はちらつかない方式（スプライトか帯で合成）の時だけ
+    if (sweepMode && timeInitialized && strategy != &directStrategy) {
+        updateSweep();
+        return;
+    }
+    
     struct tm timeinfo;
     
-    if (getLocalTime(&timeinfo)) {
+    if (timeInitialized && getLocalTime(&timeinfo)) {
         // Successfully retrieved time from NTP
         drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
     } else if (timeInitialized) {
         // Failed to get time from NTP, but previously synchronized
         // Use internal clock
         time_t now = time(nullptr);
-        localtime_r(&now, &timeinfo);
+        timeZone.toLocal(now, &timeinfo);
         drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
     } else {
         // Time not initialized, display error message
-        // ダブルバッファリングが有効な場合
-        if (clockSpriteInitialized && clockSprite != nullptr) {
-            // エラー表示用にスプライトをクリア
-            clockSprite->fillScreen(TFT_BLACK);
-            
-            // エラーメッセージをスプライトに描画
-            clockSprite->setTextColor(TFT_RED);
-            clockSprite->setTextSize(1);
-            clockSprite->setFont(&fonts::Font2);
-            clockSprite->setCursor(10, 10);
-            clockSprite->println("Time not set");
-            clockSprite->setCursor(10, 30);
-            clockSprite->println("Please check WiFi connection");
-            
-            // スプライトをLCDに転送
-            lcd->startWrite();
-            clockSprite->pushSprite(lcd, 0, 0);
-            lcd->endWrite();
-        } else {
-            // 従来の方法（ダブルバッファリングが無効な場合）
-            // 文字盤を再描画する必要がある
-            clockFaceDrawn = false;
-            
-            // エラー表示用に画面をクリア
+        // 同期を待っている間は案内を表示したままにする
+        if (showSyncStatus && !statusShown) {
+            // 時刻が設定されたら画面全体を描き直す
+            engine.invalidate();
+        
             lcd->fillScreen(TFT_BLACK);
-            
-            // エラーメッセージを直接LCDに描画
             lcd->setTextColor(TFT_RED);
             lcd->setTextSize(1);
             lcd->setFont(&fonts::Font2);
@@ -703,15 +215,160 @@ void NTPClock::updateClock() {
             lcd->println("Time not set");
             lcd->setCursor(10, 30);
             lcd->println("Please check WiFi connection");
+            statusShown = true;
         }
     }
 }
 
+// 秒針をスイープ表示で更新
+// 目標フレームレートの間隔で秒針を現在のミリ秒位置まで進め、変化した矩形だけを転送する。
+// 描画時間またはLCDバスの転送量が予算を超え続けたら、しばらくティック動作に戻す。
+void NTPClock::updateSweep() {
+    uint32_t now = millis();
+    bool throttled = sweepThrottleUntil != 0 && (int32_t)(now - sweepThrottleUntil) < 0;
+    if (!throttled && sweepThrottleUntil != 0) {
+        Serial.println("[Sweep] スイープ表示を再開");
+        sweepThrottleUntil = 0;
+        overBudgetFrames = 0;
+    }
+    
+    uint32_t frameInterval = 1000 / sweepTargetFps;
+    if (!throttled && now - lastFrameMillis < frameInterval) {
+        return;
+    }
+    
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    struct tm timeinfo;
+    timeZone.toLocal(tv.tv_sec, &timeinfo);
+    
+    if (throttled) {
+        // ティック動作（秒が変わった時だけ描画される）
+        drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+        return;
+    }
+    
+    lastFrameMillis = now;
+    uint32_t bytesBefore = pushedBytes;
+    uint32_t start = micros();
+    drawClockHands(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec, tv.tv_usec / 1000);
+    uint32_t cost = micros() - start;
+    uint32_t bytes = pushedBytes - bytesBefore;
+    if (bytes == 0) {
+        return; // 針が動かなかった
+    }
+    sweepFrames++;
+    
+    // 移動平均（1/8）で予算と比べる。CPUは1フレーム間隔の3/4、バスは転送能力の半分まで
+    frameCostAvgUs = (frameCostAvgUs * 7 + cost) / 8;
+    frameBytesAvg = (frameBytesAvg * 7 + bytes) / 8;
+    bool overCpu = frameCostAvgUs > frameInterval * 1000 * 3 / 4;
+    bool overBus = frameBytesAvg * sweepTargetFps > busBytesPerSecond / 2;
+    if (!overCpu && !overBus) {
+        overBudgetFrames = 0;
+        return;
+    }
+    if (++overBudgetFrames >= SWEEP_OVER_BUDGET_FRAMES) {
+        Serial.printf("[Sweep] 予算超過（描画 %lu us/frame, 転送 %lu bytes/frame）。%lu 秒間ティック動作に戻します\n",
+                      (unsigned long)frameCostAvgUs, (unsigned long)frameBytesAvg,
+                      (unsigned long)(SWEEP_BACKOFF_MS / 1000));
+        sweepThrottleUntil = now + SWEEP_BACKOFF_MS;
+        if (sweepThrottleUntil == 0) sweepThrottleUntil = 1;
+        frameCostAvgUs = 0;
+        frameBytesAvg = 0;
+    }
+}
+
+// 秒針のスイープ表示を設定
+void NTPClock::setSweepMode(bool enable, uint16_t fps) {
+    sweepMode = enable;
+    sweepTargetFps = fps > 0 ? fps : 1;
+    sweepThrottleUntil = 0;
+    overBudgetFrames = 0;
+}
+
+// 前回呼び出し以降にスイープで描画したフレーム数を取得してリセット
+uint32_t NTPClock::takeSweepFrames() {
+    uint32_t frames = sweepFrames;
+    sweepFrames = 0;
+    return frames;
+}
+
+// 前回呼び出し以降のコンプリケーションごとの統計をシリアルに出力
+void NTPClock::logComplicationStats() {
+    for (int i = 0; i < engine.getComplicationCount(); i++) {
+        ComplicationStats stats;
+        if (engine.takeComplicationStats(i, stats)) {
+            Serial.printf("[Complication] %-12s 更新 %lu 回 (変化 %lu 回), CPU %lu us, 転送 %lu px\n", stats.name,
+                          (unsigned long)stats.refreshes, (unsigned long)stats.changes, (unsigned long)stats.cpuUs,
+                          (unsigned long)stats.pushedPixels);
+        }
+    }
+}
+
+// NTPサーバーを変更
+void NTPClock::setNtpServer(const char* server) {
+    strncpy(ntpServer, server, sizeof(ntpServer) - 1);
+    ntpServer[sizeof(ntpServer) - 1] = '\0';
+    sntp.setServers(ntpServer);
+}
+
+// タイムゾーンを変更（次の表示からその時刻になる）
+bool NTPClock::setTimeZone(const char* nameOrRule) {
+    if (!timeZone.setZone(nameOrRule)) {
+        Serial.printf("[DEBUG] タイムゾーンを解析できません: %s\n", nameOrRule);
+        return false;
+    }
+    applyTimeZone();
+    Serial.printf("[DEBUG] タイムゾーン: %s (%s)\n", nameOrRule, timeZone.getRule());
+    return true;
+}
+
+// TZ環境変数を設定
+void NTPClock::applyTimeZone() {
+    setenv("TZ", timeZone.getRule(), 1);
+    tzset();
+}
+
+// 現在の地方時（同じ秒の間は TimeZone が前回の結果を返す）
+bool NTPClock::getLocalTime(struct tm* info) {
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_TIME) {
+        return false;
+    }
+    timeZone.toLocal(now, info);
+    return true;
+}
+
+// 選べる文字盤の数と名前
+int NTPClock::getFaceCount() {
+    return sizeof(faceThemes) / sizeof(faceThemes[0]);
+}
+
+const char* NTPClock::getFaceName(int index) {
+    return index >= 0 && index < getFaceCount() ? faceThemes[index].name : nullptr;
+}
+
+// 文字盤を切り替える（次の更新で画面全体を描き直す）
+bool NTPClock::setFace(int index) {
+    if (index < 0 || index >= getFaceCount()) {
+        return false;
+    }
+    faceIndex = index;
+    hourHandColor = faceThemes[index].hourHand;
+    minHandColor = faceThemes[index].minHand;
+    secHandColor = faceThemes[index].secHand;
+    applyStyle();
+    engine.invalidate();
+    return true;
+}
+
 // Set clock size
 void NTPClock::setClockSize(int centerX, int centerY, int radius) {
     clockCenterX = centerX;
     clockCenterY = centerY;
     clockRadius = radius;
+    applyStyle();
 }
 
 // Set hand lengths
@@ -719,6 +376,7 @@ void NTPClock::setHandLengths(int hour, int min, int sec) {
     hourHandLength = hour;
     minHandLength = min;
     secHandLength = sec;
+    applyStyle();
 }
 
 // Set colors (RGB565形式の16ビットカラー)
@@ -731,4 +389,5 @@ void NTPClock::setColors(uint16_t face, uint16_t border, uint16_t hourHand,
     secHandColor = secHand;
     hourMarksColor = marks;
     textColor = text;
+    applyStyle();
 }
@@ -4,14 +4,20 @@
 #include <Arduino.h>
 #include <time.h>
 #include <LovyanGFX.hpp>
+#include <ClockEngine.h>
+#include <sntp_client.h>
+#include <time_zone.h>
+#include <settings_target.h>
 
-class NTPClock {
+// 設定（NTPサーバー・タイムゾーン・文字盤）は SettingsApi から SettingsTarget として反映する
+class NTPClock : public SettingsTarget {
 private:
     // NTP設定
-    const char* ntpServer;
-    long gmtOffset_sec;
-    int daylightOffset_sec;
-    
+    char ntpServer[64];         // configTime() はこの文字列を参照し続けるので保持しておく
+
+    // タイムゾーン（地方時への変換は1秒に1回だけ）
+    TimeZone timeZone;
+
     // 時計の設定
     int clockCenterX;
     int clockCenterY;
@@ -20,7 +26,7 @@ private:
     int minHandLength;
     int secHandLength;
     int centerAvoidRadius;  // 針の中心部分の半径
-    
+
     // 色の定義（RGB565形式の16ビットカラー）
     uint16_t clockFaceColor;
     uint16_t clockBorderColor;
@@ -29,89 +35,168 @@ private:
     uint16_t secHandColor;
     uint16_t hourMarksColor;
     uint16_t textColor;
-    
-    // 時計の針と日付の前回位置を保存する変数
-    int last_hour;
-    int last_minute;
-    int last_second;
-    int last_day;    // 日付
-    int last_wday;   // 曜日
-    
-    // 秒針の前回の位置を記憶するための変数
-    int last_sec_x1;
-    int last_sec_y1;
-    int last_sec_startX;
-    int last_sec_startY;
-    
-    // 分針の前回の位置を記憶するための変数
-    int last_min_x1;
-    int last_min_y1;
-    int last_min_startX;
-    int last_min_startY;
-    
-    // 時針の前回の位置を記憶するための変数
-    int last_hour_x1;
-    int last_hour_y1;
-    int last_hour_startX;
-    int last_hour_startY;
-    
+
     // 時刻同期フラグ
     bool timeInitialized;
-    
+    bool statusShown;           // 同期する前の案内を表示した
+    bool showSyncStatus;        // 同期する前の案内を表示するか
+
+    // 時刻の同期（待たずに動く）
+    SntpClient sntp;
+
+    // 選んでいる文字盤（faceThemes の番号）
+    int faceIndex;
+
     // LCDディスプレイ参照
     lgfx::LGFX_Device* lcd;
-    
-    // 背景用のスプライト
-    LGFX_Sprite* backgroundSprite;
-    
-    // ダブルバッファリング用のスプライト
-    LGFX_Sprite* clockSprite;       // 時計全体用スプライト
-    
-    // スプライト初期化フラグ
-    bool backgroundInitialized;
-    bool clockSpriteInitialized;
-    
+
+    // 描画エンジン（圧縮ビットマップの文字盤 + 更新方式）
+    ClockEngine engine;
+    BitmapFace face;
+    DirectStrategy directStrategy;          // メモリ不足時の最後の手段
+    BandStrategy bandStrategy;              // 16行の帯で合成（RAM 7.5KB）
+    DoubleBufferStrategy doubleBuffer;      // 全画面スプライト（RAM 115KB、背景も持つと230KB）
+    UpdateStrategy* strategy;
+    int dateLabel;
+    int labelDay;                           // 日付の文字を作った日（tm_mday、0なら未作成）
+
+    // 背景スプライト（115KB）を使うか。使わない場合は圧縮された文字盤から都度展開する
+    bool useBackgroundSprite;
+
+    // 全画面スプライトを使わず帯ごとに合成するか
+    bool useBandCompositor;
+
+    // LCDへ転送したバイト数（統計用）
+    uint32_t pushedBytes;
+
+    // 針の太さ
+    static constexpr float HOUR_HAND_WIDTH = 7.0f;
+    static constexpr float MIN_HAND_WIDTH = 5.0f;
+    static constexpr float SEC_HAND_WIDTH = 1.5f;
+
+    // 設定をエンジンに反映
+    void applyStyle();
+
+    // TZ環境変数を同じ規則にする（Cライブラリの localtime() なども同じ時刻になる）
+    void applyTimeZone();
+
+    // スイープ秒針
+    bool sweepMode;
+    uint16_t sweepTargetFps;
+    uint32_t busBytesPerSecond;    // LCDバスの転送能力
+    uint32_t lastFrameMillis;
+    uint32_t frameCostAvgUs;       // 1フレームの描画・転送時間（移動平均）
+    uint32_t frameBytesAvg;        // 1フレームの転送量（移動平均）
+    uint16_t overBudgetFrames;     // 予算超過が続いたフレーム数
+    uint32_t sweepThrottleUntil;   // この時刻まではティック動作に戻す（0なら制限なし）
+    uint32_t sweepFrames;          // 統計用
+
+    // 予算超過がこのフレーム数続いたら、一定時間ティック動作に戻す
+    static const int SWEEP_OVER_BUDGET_FRAMES = 15;
+    static const uint32_t SWEEP_BACKOFF_MS = 10000;
+
+    // スイープ表示で時計を更新
+    void updateSweep();
+
 public:
     // コンストラクタ
-    NTPClock(lgfx::LGFX_Device* display, 
+    NTPClock(lgfx::LGFX_Device* display,
              const char* ntpServer = "ntp.nict.jp",
-             long gmtOffset_sec = 9 * 3600,
-             int daylightOffset_sec = 0);
-    
-    // 初期化
+             const char* timeZone = "Asia/Tokyo");
+
+    // 背景スプライトを使うか（begin()より前に設定）
+    void setUseBackgroundSprite(bool enable) { useBackgroundSprite = enable; }
+
+    // 全画面スプライトを使わず帯ごとに合成するか（begin()より前に設定）
+    // 無効でもスプライトを確保できなければ自動的にバンド合成になる
+    void setUseBandCompositor(bool enable) { useBandCompositor = enable; }
+
+    // 使用中の更新方式の名前と作業用メモリ（bytes）
+    const char* getStrategyName() { return strategy->name(); }
+    size_t getStrategyBytes() { return strategy->bufferBytes(); }
+
+    // 同期する前に案内（"Synchronizing..."・"Time not set"）を表示するか（既定は表示せず、文字盤を描いて同期を待つ）
+    void setShowSyncStatus(bool show) { showSyncStatus = show; }
+
+    // 初期化（文字盤を描き、RTCに時刻が残っていれば針も描く）
     void begin();
-    
-    // NTPサーバーから時刻を取得
-    bool syncTimeWithNTP();
-    
-    // 時計の文字盤を描画
+
+    // 時刻の同期を始める（待たずに戻り、handleTimeSync() で進める。WiFiに接続するより前に呼んでもよく、接続したら問い合わせる）
+    void beginTimeSync();
+
+    // 時刻の同期を進める（loop() から毎回呼ぶ。最初に同期した時、案内を表示していれば文字盤を描き直す）
+    void handleTimeSync();
+
+    // 時刻の同期の状態と統計
+    SntpClient& getTimeSync() { return sntp; }
+
+    // 時計の文字盤を描画（時刻が設定済みなら針も）
     void drawClockFace();
-    
-    // 背景スプライトに文字盤を描画
-    void drawClockFaceBitmapToSprite(LGFX_Sprite* sprite, int centerX, int centerY, int radius);
-    
-    // 背景スプライトの一部を再表示
-    void restoreBackgroundArea(int x, int y, int width, int height);
-    
+
     // 画面全体を再描画する
     void redrawFullScreen();
-    
-    // 文字盤描画フラグをリセット
+
+    // 文字盤描画フラグをリセット（次の更新で画面全体を描き直す）
     void resetClockFaceDrawnFlag();
-    
-    // 時計の針を描画
-    void drawClockHands(int hour, int minute, int second);
-    
+
+    // 時計の針を描画（millisecondを指定すると秒針をその位置まで進める）
+    void drawClockHands(int hour, int minute, int second, int millisecond = -1);
+
     // 現在時刻を取得して時計を更新
     void updateClock();
-    
+
     // 時刻が初期化されているかを取得
     bool isTimeInitialized() { return timeInitialized; }
-    
+
+    // 前回呼び出し以降にLCDへ転送したバイト数を取得してリセット
+    uint32_t takePushedBytes();
+
+    // 前回呼び出し以降に針の描画で書き込んだ画素数を取得してリセット
+    uint32_t takeHandPixels() { return engine.takeHandPixels(); }
+
+    // 直近のフレームの合成・転送にかかった時間（us）
+    uint32_t getLastComposeMicros() { return engine.getLastFrameMicros(); }
+
+    // 針のアンチエイリアスの有効・無効
+    void setAntiAlias(bool enable) { engine.setAntiAlias(enable); }
+
+    // 秒針のスイープ表示（fpsは目標フレームレート）
+    // 描画時間かLCDバスの予算を超えると一時的に1秒ごとのティック動作に戻る
+    void setSweepMode(bool enable, uint16_t fps = 30);
+    bool isSweepMode() { return sweepMode; }
+
+    // LCDバスの転送能力（bytes/s）。スイープの予算判定に使う
+    void setBusBandwidth(uint32_t bytesPerSecond) { busBytesPerSecond = bytesPerSecond; }
+
+    // 前回呼び出し以降にスイープで描画したフレーム数を取得してリセット
+    uint32_t takeSweepFrames();
+
+    // 文字盤にコンプリケーションを追加（次の更新で画面全体を描き直す）
+    int addComplication(Complication* complication) { return engine.addComplication(complication); }
+
+    // 前回呼び出し以降のコンプリケーションごとの更新回数・CPU時間・転送画素数をシリアルに出力
+    void logComplicationStats();
+
+    // NTPサーバー（カンマ区切りで3つまで。変えるとすぐに同期し直す）とタイムゾーン
+    void setNtpServer(const char* server);
+    const char* getNtpServer() { return ntpServer; }
+    // タイムゾーンは TimeZone の表にある名前かPOSIXの規則（解析できなければ false で、今のまま）
+    bool setTimeZone(const char* nameOrRule);
+    const char* getTimeZoneRule() { return timeZone.getRule(); }
+
+    // 現在の地方時（時刻が設定されていなければ false）
+    bool getLocalTime(struct tm* info);
+
+    // 文字盤の種類（0が最初の文字盤。名前はWeb設定のAPIで使う）
+    int getFaceCount();
+    const char* getFaceName(int index);
+    int getFace() { return faceIndex; }
+    bool setFace(int index);
+
     // 設定を変更
     void setClockSize(int centerX, int centerY, int radius);
     void setHandLengths(int hour, int min, int sec);
-    void setColors(uint16_t face, uint16_t border, uint16_t hourHand, 
+    void setColors(uint16_t face, uint16_t border, uint16_t hourHand,
                    uint16_t minHand, uint16_t secHand, uint16_t marks, uint16_t text);
 };
 
@@ -1,5 +1,6 @@
 #include "touch_manager.h"
 #include "ntp_clock.h"
+#include <esp_sleep.h>
 
 // 静的変数の定義
 bool TouchManager::isShowingIPAddress = false;
@@ -175,6 +176,16 @@ void TouchManager::resetTouch() {
     }
 }
 
+// タッチの割り込み（ライトスリープから起こすだけなので何もしない）
+static void onTouchWakeup() {
+}
+
+// タッチでライトスリープから起きるようにする
+void TouchManager::enableWakeup() {
+    touchAttachInterrupt(touchPin, onTouchWakeup, touchThreshold);
+    esp_sleep_enable_touchpad_wakeup();
+}
+
 // 現在のタッチ値を取得
 uint16_t TouchManager::getTouchValue() {
     // 複数回読み取って平均値を返すことでノイズを軽減
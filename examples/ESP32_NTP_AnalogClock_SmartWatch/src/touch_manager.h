@@ -3,11 +3,12 @@
 
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
+#include <wake_source.h>
 
 // 前方宣言
 class NTPClock;
 
-class TouchManager {
+class TouchManager : public WakeSource {
 private:
     // タッチセンサー設定
     uint8_t touchPin;
@@ -65,6 +66,15 @@ public:
     // 現在のタッチ値を取得
     uint16_t getTouchValue();
     
+    // タッチしているか（checkLongTouch() / checkShortTouch() で読んだ状態）
+    bool isTouched() const { return isTouching; }
+    
+    // タッチでライトスリープから起きるようにする（省電力モード）
+    void enableWakeup();
+    
+    // タッチ中かIPアドレスの表示中（省電力モードでライトスリープしない）
+    bool isBusy() { return isTouching || isShowingIPAddress; }
+    
     // 設定を変更
     void setTouchThreshold(uint16_t threshold) { touchThreshold = threshold; }
     uint16_t getTouchThreshold() const { return touchThreshold; }
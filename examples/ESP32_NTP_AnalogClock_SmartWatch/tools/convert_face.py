@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# 文字盤画像を「パレット + 行単位RLE」形式のヘッダに変換する
+#
+# 使い方:
+#   python tools/convert_face.py assets/clock_face.h src/clock_face_rle.h
+#   python tools/convert_face.py face.png src/clock_face_rle.h   (Pillowが必要)
+#
+# platformio.ini の extra_scripts に pre スクリプトとして登録してあり、
+# ビルド時に assets/clock_face.h が新しければ src/clock_face_rle.h を再生成する。
+#
+# 圧縮形式（1行ずつ独立して展開できる。詳細は src/face_decoder.h）
+#   0x00-0x7F : 次の1バイトのパレット番号を (値+1) 画素繰り返す
+#   0x80-0xFE : パレット番号 (値-0x80) の1画素（よく使う127色）
+#   0xFF      : 続く2バイトがパレット外の1画素（リトルエンディアン）
+
+import os
+import re
+import sys
+from collections import Counter
+
+MAX_RUN = 128
+MAX_PALETTE = 256
+SHORT_INDEX_COUNT = 127
+
+
+def load_image2data_header(path):
+    """image2data で出力した RGB565 ダンプ（img[] 配列）を読み込む"""
+    text = open(path, encoding="utf-8").read()
+    width = int(re.search(r"imgWidth\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"imgHeight\s*=\s*(\d+)", text).group(1))
+    body = text[text.index("PROGMEM"):]
+    pixels = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{4})", body)]
+    if len(pixels) != width * height:
+        raise ValueError("%s: %d pixels, expected %d" % (path, len(pixels), width * height))
+    return width, height, pixels
+
+
+def load_png(path):
+    """PNGを読み込み、img[] と同じバイト順（上位下位を入れ替えたRGB565）に変換する"""
+    from PIL import Image
+    image = Image.open(path).convert("RGB")
+    width, height = image.size
+    pixels = []
+    for r, g, b in image.getdata():
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        pixels.append(((c & 0xFF) << 8) | (c >> 8))
+    return width, height, pixels
+
+
+def encode(width, height, pixels):
+    counts = Counter(pixels)
+    palette = [c for c, _ in counts.most_common(MAX_PALETTE)]
+    index = {c: i for i, c in enumerate(palette)}
+
+    data = bytearray()
+    row_offsets = []
+    for y in range(height):
+        row_offsets.append(len(data))
+        row = pixels[y * width:(y + 1) * width]
+        x = 0
+        while x < width:
+            color = row[x]
+            n = 1
+            while x + n < width and row[x + n] == color and n < MAX_RUN:
+                n += 1
+            i = index.get(color)
+            if i is None:
+                # パレット外の色は1画素ずつ直接書く
+                for _ in range(n):
+                    data += bytes((0xFF, color & 0xFF, color >> 8))
+            elif n == 1 and i < SHORT_INDEX_COUNT:
+                data.append(0x80 + i)
+            else:
+                data += bytes((n - 1, i))
+            x += n
+
+    if len(data) > 0xFFFF:
+        raise ValueError("compressed data is %d bytes; row offsets are 16 bit" % len(data))
+    return palette, row_offsets, bytes(data)
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ",".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(path, source, width, height, palette, row_offsets, data):
+    raw_size = width * height * 2
+    total = len(palette) * 2 + len(row_offsets) * 2 + len(data)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// このファイルは tools/convert_face.py で生成（直接編集しない）\n")
+        f.write("// 元画像: %s (%dx%d)\n" % (os.path.basename(source), width, height))
+        f.write("// %d bytes（非圧縮 %d bytes）\n" % (total, raw_size))
+        f.write("#ifndef CLOCK_FACE_RLE_H\n#define CLOCK_FACE_RLE_H\n\n")
+        f.write("#include \"face_decoder.h\" // PROGMEM の定義を含む\n\n")
+        f.write("const uint16_t clockFacePalette[%d] PROGMEM = {\n" % len(palette))
+        f.write(format_array(palette, "0x%04X", 12) + "\n};\n\n")
+        f.write("const uint16_t clockFaceRowOffsets[%d] PROGMEM = {\n" % len(row_offsets))
+        f.write(format_array(row_offsets, "%d", 16) + "\n};\n\n")
+        f.write("const uint8_t clockFaceData[%d] PROGMEM = {\n" % len(data))
+        f.write(format_array(list(data), "0x%02X", 24) + "\n};\n\n")
+        f.write("const CompressedFace clockFace = {\n")
+        f.write("    %d, %d, %d, clockFacePalette, clockFaceRowOffsets, clockFaceData\n};\n\n" %
+                (width, height, len(palette)))
+        f.write("#endif // CLOCK_FACE_RLE_H\n")
+    return raw_size, total
+
+
+def convert(source, output):
+    if source.lower().endswith(".png"):
+        width, height, pixels = load_png(source)
+    else:
+        width, height, pixels = load_image2data_header(source)
+    palette, row_offsets, data = encode(width, height, pixels)
+    raw_size, total = write_header(output, source, width, height, palette, row_offsets, data)
+    print("convert_face: %s -> %s: %d -> %d bytes (palette %d colors)" %
+          (source, output, raw_size, total, len(palette)))
+
+
+try:
+    Import("env")  # noqa: F821  PlatformIO の extra_scripts から実行された場合
+    project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+    source = os.path.join(project_dir, "assets", "clock_face.h")
+    output = os.path.join(project_dir, "src", "clock_face_rle.h")
+    if not os.path.exists(output) or os.path.getmtime(source) > os.path.getmtime(output):
+        convert(source, output)
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) != 3:
+            print("usage: convert_face.py <face.png | clock_face.h> <output.h>")
+            sys.exit(1)
+        convert(sys.argv[1], sys.argv[2])
@@ -4,13 +4,19 @@
 #include <Arduino.h>
 #include <time.h>
 #include <LovyanGFX.hpp>
+#include <ClockEngine.h>
+#include <sntp_client.h>
+#include <time_zone.h>
+#include <settings_target.h>
 
-class NTPClock {
+// 設定（NTPサーバー・タイムゾーン・文字盤）は SettingsApi から SettingsTarget として反映する
+class NTPClock : public SettingsTarget {
 private:
     // NTP設定
-    const char* ntpServer;
-    long gmtOffset_sec;
-    int daylightOffset_sec;
+    char ntpServer[64];         // configTime() はこの文字列を参照し続けるので保持しておく
+
+    // タイムゾーン（地方時への変換は1秒に1回だけ）
+    TimeZone timeZone;
     
     // 時計の設定
     int clockCenterX;
@@ -29,29 +35,57 @@ private:
     uint32_t hourMarksColor;
     uint32_t textColor;
     
-    // 時計の針の前回位置を保存する変数
-    int last_hour;
-    int last_minute;
-    int last_second;
-    
     // 時刻同期フラグ
     bool timeInitialized;
+    bool statusShown;           // 同期する前の案内を表示した
+    bool showSyncStatus;        // 同期する前の案内を表示するか
+    
+    // 時刻の同期（待たずに動く）
+    SntpClient sntp;
+    
+    // 選んでいる文字盤（faceThemes の番号）
+    int faceIndex;
     
     // LCDディスプレイ参照
     lgfx::LGFX_Device* lcd;
     
+    // 針の太さ
+    static constexpr float HOUR_HAND_WIDTH = 5.0f;
+    static constexpr float MIN_HAND_WIDTH = 3.0f;
+    static constexpr float SEC_HAND_WIDTH = 1.5f;
+    
+    // 描画エンジン（図形の文字盤をLCDに直接描く）
+    ClockEngine engine;
+    VectorFace face;
+    SaveRestoreStrategy saveRestore;        // 針の下の文字盤を退避して書き戻す（RAM 約11KB）
+    DirectStrategy directStrategy;          // メモリ不足時
+    
+    // 設定をエンジンに反映
+    void applyStyle();
+    
+    // TZ環境変数を同じ規則にする（Cライブラリの localtime() なども同じ時刻になる）
+    void applyTimeZone();
+    
 public:
     // コンストラクタ
     NTPClock(lgfx::LGFX_Device* display, 
              const char* ntpServer = "ntp.nict.jp",
-             long gmtOffset_sec = 9 * 3600,
-             int daylightOffset_sec = 0);
+             const char* timeZone = "Asia/Tokyo");
     
-    // 初期化
+    // 同期する前に案内（"Synchronizing..."・"Time not set"）を表示するか（既定は表示せず、文字盤を描いて同期を待つ）
+    void setShowSyncStatus(bool show) { showSyncStatus = show; }
+    
+    // 初期化（文字盤を描き、RTCに時刻が残っていれば針も描く）
     void begin();
     
-    // NTPサーバーから時刻を取得
-    bool syncTimeWithNTP();
+    // 時刻の同期を始める（待たずに戻り、handleTimeSync() で進める。WiFiに接続するより前に呼んでもよく、接続したら問い合わせる）
+    void beginTimeSync();
+    
+    // 時刻の同期を進める（loop() から毎回呼ぶ。最初に同期した時、案内を表示していれば文字盤を描き直す）
+    void handleTimeSync();
+    
+    // 時刻の同期の状態と統計
+    SntpClient& getTimeSync() { return sntp; }
     
     // 時計の文字盤を描画
     void drawClockFace();
@@ -65,6 +99,28 @@ public:
     // 時刻が初期化されているかを取得
     bool isTimeInitialized() { return timeInitialized; }
     
+    // 前回呼び出し以降に針の描画で書き込んだ画素数を取得してリセット
+    uint32_t takeHandPixels() { return engine.takeHandPixels(); }
+    
+    // 針のアンチエイリアスの有効・無効
+    void setAntiAlias(bool enable) { engine.setAntiAlias(enable); }
+    
+    // NTPサーバー（カンマ区切りで3つまで。変えるとすぐに同期し直す）とタイムゾーン
+    void setNtpServer(const char* server);
+    const char* getNtpServer() { return ntpServer; }
+    // タイムゾーンは TimeZone の表にある名前かPOSIXの規則（解析できなければ false で、今のまま）
+    bool setTimeZone(const char* nameOrRule);
+    const char* getTimeZoneRule() { return timeZone.getRule(); }
+
+    // 現在の地方時（時刻が設定されていなければ false）
+    bool getLocalTime(struct tm* info);
+    
+    // 文字盤の種類（0が最初の文字盤。名前はWeb設定のAPIで使う）
+    int getFaceCount();
+    const char* getFaceName(int index);
+    int getFace() { return faceIndex; }
+    bool setFace(int index);
+    
     // 設定を変更
     void setClockSize(int centerX, int centerY, int radius);
     void setHandLengths(int hour, int min, int sec);
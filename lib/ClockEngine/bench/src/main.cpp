@@ -0,0 +1,179 @@
+// ClockEngine のホスト用ベンチマーク
+// 文字盤（図形・圧縮ビットマップ）と更新方式の組み合わせごとに、同じ時刻の列を描画して
+// 1フレームの描画時間・LCDへの転送量・作業用メモリを表示する。製品ごとの方式選びに使う。
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <LovyanGFX.hpp>
+#include <ClockEngine.h>
+#include "clock_face_rle.h" // SmartWatch の文字盤
+
+// LCDのSPIクロック 27MHz での転送能力
+static const double SPI_BYTES_PER_SECOND = 27000000.0 / 8;
+
+// 計測するフレーム数
+static const int TICK_FRAMES = 600;     // 1秒ごと（10分間、分針・時針の移動を含む）
+static const int SWEEP_FRAMES = 600;    // 30fpsのスイープ（20秒間）
+
+struct Result {
+    double fullUs;          // 最初の全画面描画
+    double avgUs;           // 2フレーム目以降の平均
+    double maxUs;
+    double avgBytes;
+    size_t ramBytes;
+    long stalePixels;       // 全画面描き直しと違った画素の合計（0なら描き残しなし）
+    int staleFrames;        // 全画面描き直しと違ったフレーム数
+};
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static VectorFaceStyle classicFace() {
+    VectorFaceStyle style;
+    style.centerX = 120;
+    style.centerY = 120;
+    style.radius = 112;
+    style.screenColor = TFT_WHITE;
+    style.faceColor = TFT_WHITE;
+    style.borderColor = TFT_BLACK;
+    style.borderWidth = 4;
+    style.markColor = TFT_BLACK;
+    style.markInset = 2;
+    style.hourMarkLength = 12;
+    style.hourMarkThickness = 2;
+    style.quarterMarkThickness = 2;
+    style.minuteMarkLength = 5;
+    style.numeralFont = &fonts::Font4;
+    style.numeralInset = 30;
+    style.numeralColor = TFT_BLACK;
+    return style;
+}
+
+static void configure(ClockEngine& engine, FaceRenderer* face, UpdateStrategy* strategy) {
+    engine.setFace(face);
+    engine.setStrategy(strategy);
+    engine.setCenter(120, 120);
+    engine.setCenterAvoidRadius(6);
+    HandStyle hour = { 60, 0, 7.0f, 0xFB00 };
+    HandStyle minute = { 80, 0, 5.0f, 0xFB00 };
+    HandStyle second = { 95, 0, 1.5f, 0xF800 };
+    engine.setHand(ClockEngine::HOUR, hour);
+    engine.setHand(ClockEngine::MINUTE, minute);
+    engine.setHand(ClockEngine::SECOND, second);
+    CenterCap cap = { 4, 0xFFFF, false, 0, 0, 0 };
+    engine.setCenterCap(cap);
+}
+
+static void addDate(ClockEngine& engine) {
+    LabelStyle dateStyle = { 120, 80, true, &fonts::Font2, 0xFFFF, false, 0, { 0, 0, 0, 0 } };
+    int date = engine.addLabel(dateStyle);
+    engine.setLabelText(date, "MON 5");
+}
+
+// reference は strategy と同じ種類の更新方式で、毎フレーム全画面を描き直す
+static Result run(LGFX_Sprite& panel, LGFX_Sprite& referencePanel, FaceRenderer* face,
+                  UpdateStrategy* strategy, UpdateStrategy* referenceStrategy, bool sweep) {
+    ClockEngine engine(&panel);
+    configure(engine, face, strategy);
+    addDate(engine);
+    panel.fillScreen(TFT_BLACK);
+    ClockEngine reference(&referencePanel);
+    configure(reference, face, referenceStrategy);
+    addDate(reference);
+
+    Result result = {};
+    if (!engine.begin() || !reference.begin()) {
+        printf("  %s: failed to allocate buffers\n", strategy->name());
+        return result;
+    }
+    result.ramBytes = strategy->bufferBytes();
+    size_t pixels = (size_t)panel.width() * panel.height();
+
+    int frames = sweep ? SWEEP_FRAMES : TICK_FRAMES;
+    double total = 0;
+    uint32_t bytes = 0;
+    ClockTime time = { 10, 8, 0, sweep ? 0 : -1 };
+    for (int i = 0; i < frames; i++) {
+        int ms = sweep ? i * 1000 / 30 : i * 1000;
+        time.second = ms / 1000 % 60;
+        time.minute = 8 + ms / 60000;
+        if (sweep) {
+            time.millisecond = ms % 1000;
+        }
+        engine.takePushedBytes();
+        double start = nowUs();
+        engine.update(time);
+        double cost = nowUs() - start;
+        if (i == 0) {
+            result.fullUs = cost;
+            continue;
+        }
+        total += cost;
+        bytes += engine.takePushedBytes();
+        if (cost > result.maxUs) result.maxUs = cost;
+
+        // 毎フレーム、同じ時刻の全画面描き直しと比べて描き残しを数える
+        reference.invalidate();
+        reference.update(time);
+        const uint16_t* drawn = (const uint16_t*)panel.getBuffer();
+        const uint16_t* fresh = (const uint16_t*)referencePanel.getBuffer();
+        long stale = 0;
+        for (size_t p = 0; p < pixels; p++) {
+            if (drawn[p] != fresh[p]) stale++;
+        }
+        if (stale > 0) {
+            result.stalePixels += stale;
+            result.staleFrames++;
+        }
+    }
+    result.avgUs = total / (frames - 1);
+    result.avgBytes = (double)bytes / (frames - 1);
+    strategy->end();
+    referenceStrategy->end();
+    return result;
+}
+
+int main() {
+    LGFX_Sprite panel;
+    panel.setColorDepth(16);
+    panel.createSprite(240, 240);
+    LGFX_Sprite referencePanel;
+    referencePanel.setColorDepth(16);
+    referencePanel.createSprite(240, 240);
+
+    VectorFace vector(classicFace());
+    BitmapFace bitmap(clockFace, 120, 120);
+    DirectStrategy direct;
+    BandStrategy band(16);
+    DoubleBufferStrategy doubleBuffer(false);
+    DoubleBufferStrategy doubleCached(true);
+    SaveRestoreStrategy saveRestore;
+    // 全画面描き直しの比較用（同じ種類の更新方式をもう1つ）
+    DirectStrategy directReference;
+    BandStrategy bandReference(16);
+    DoubleBufferStrategy doubleBufferReference(false);
+    DoubleBufferStrategy doubleCachedReference(true);
+    SaveRestoreStrategy saveRestoreReference;
+
+    struct { const char* name; FaceRenderer* face; } faces[] = { { "vector", &vector }, { "bitmap", &bitmap } };
+    struct { UpdateStrategy* strategy; UpdateStrategy* reference; } strategies[] = {
+        { &direct, &directReference }, { &saveRestore, &saveRestoreReference }, { &band, &bandReference },
+        { &doubleBuffer, &doubleBufferReference }, { &doubleCached, &doubleCachedReference } };
+
+    printf("%-7s %-6s %-18s %9s %9s %9s %9s %9s %9s %6s %7s\n", "face", "mode", "strategy",
+           "RAM[B]", "full[us]", "avg[us]", "max[us]", "avg[B]", "bus[us]", "stale", "staleF");
+    for (auto& f : faces) {
+        for (int sweep = 0; sweep < 2; sweep++) {
+            for (auto& s : strategies) {
+                Result r = run(panel, referencePanel, f.face, s.strategy, s.reference, sweep != 0);
+                printf("%-7s %-6s %-18s %9u %9.0f %9.1f %9.1f %9.0f %9.0f %6ld %7d\n", f.name,
+                       sweep ? "sweep" : "tick", s.strategy->name(), (unsigned)r.ramBytes, r.fullUs,
+                       r.avgUs, r.maxUs, r.avgBytes, r.avgBytes / SPI_BYTES_PER_SECOND * 1e6,
+                       r.stalePixels, r.staleFrames);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef CLOCKENGINE_H
+#define CLOCKENGINE_H
+
+// アナログ時計の共通描画ライブラリ
+//   clock_trig.h       : 針・目盛り用の固定小数点三角関数テーブル
+//   hand_renderer.h    : 太さのある針のラスタライザ
+//   text_tile.h        : 文字を1bitのマスクにしておいて重ねる
+//   face_renderer.h    : 文字盤（VectorFace / BitmapFace）
+//   complication.h     : 文字盤に重ねる小さな表示（更新周期と範囲を持つ）
+//   update_strategy.h  : 更新方式（DirectStrategy / SaveRestoreStrategy / BandStrategy / DoubleBufferStrategy）
+//   clock_engine.h     : 文字盤・針・文字を組み合わせて変化した部分を更新する
+#include "clock_trig.h"
+#include "clock_types.h"
+#include "hand_renderer.h"
+#include "text_tile.h"
+#include "face_decoder.h"
+#include "face_renderer.h"
+#include "complication.h"
+#include "update_strategy.h"
+#include "clock_engine.h"
+
+#endif // CLOCKENGINE_H
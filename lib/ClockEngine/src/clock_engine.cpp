@@ -0,0 +1,398 @@
+#include "clock_engine.h"
+#include <math.h>
+#include <string.h>
+#include "clock_trig.h"
+#include "update_strategy.h"
+
+ClockEngine::ClockEngine(lgfx::LovyanGFX* display)
+    : display(display), face(nullptr), strategy(nullptr), centerX(120), centerY(120), centerAvoidRadius(0),
+      slotCount(0), needsFullRedraw(true), hasTime(false), pushedBytes(0), lastFrameUs(0), frames(0) {
+    HandStyle hour = { 50, 0, 5.0f, 0xFFFF };
+    HandStyle minute = { 70, 0, 3.0f, 0xFFFF };
+    HandStyle second = { 80, 0, 1.5f, 0xF800 };
+    hands[HOUR] = hour;
+    hands[MINUTE] = minute;
+    hands[SECOND] = second;
+    CenterCap defaultCap = { 3, 0xFFFF, false, 0, 0, 0 };
+    cap = defaultCap;
+    for (int i = 0; i < HAND_COUNT; i++) {
+        handState[i].fine = -1;
+        handState[i].segments = 0;
+        handState[i].bounds = ClockRect{ 0, 0, 0, 0 };
+    }
+    for (int i = 0; i < MAX_LABELS; i++) {
+        labels[i].used = false;
+        labels[i].tiled = false;
+        labels[i].changed = false;
+        labels[i].text[0] = '\0';
+        labels[i].drawn = ClockRect{ 0, 0, 0, 0 };
+    }
+}
+
+bool ClockEngine::begin() {
+    needsFullRedraw = true;
+    return face != nullptr && strategy != nullptr && strategy->begin(*this);
+}
+
+ClockRect ClockEngine::screenRect() const {
+    ClockRect r = { 0, 0, (int)display->width(), (int)display->height() };
+    return r;
+}
+
+// 針の線分と、縁の混色まで含めた外接矩形を計算
+void ClockEngine::layoutHand(int hand, int fine, HandState& state) {
+    const HandStyle& style = hands[hand];
+    const float scale = 1.0f / (1 << clock_trig::FRAC_BITS);
+    float s = clock_trig::sinQFine(fine) * scale;
+    float c = clock_trig::cosQFine(fine) * scale;
+    float avoidX = centerAvoidRadius * s;
+    float avoidY = -centerAvoidRadius * c;
+
+    state.fine = fine;
+    state.segments = 0;
+    // 先端側
+    state.x0[0] = centerX + avoidX;
+    state.y0[0] = centerY + avoidY;
+    state.x1[0] = centerX + style.length * s;
+    state.y1[0] = centerY - style.length * c;
+    state.segments++;
+    // 反対側
+    if (style.back > 0) {
+        state.x0[1] = centerX - avoidX;
+        state.y0[1] = centerY - avoidY;
+        state.x1[1] = centerX - style.back * s;
+        state.y1[1] = centerY + style.back * c;
+        state.segments++;
+    }
+
+    int pad = (int)ceilf(style.width * 0.5f + 0.5f);
+    state.bounds = ClockRect{ 0, 0, 0, 0 };
+    for (int i = 0; i < state.segments; i++) {
+        int left = (int)floorf(fminf(state.x0[i], state.x1[i])) - pad;
+        int top = (int)floorf(fminf(state.y0[i], state.y1[i])) - pad;
+        int right = (int)ceilf(fmaxf(state.x0[i], state.x1[i])) + pad;
+        int bottom = (int)ceilf(fmaxf(state.y0[i], state.y1[i])) + pad;
+        ClockRect r = { left, top, right - left + 1, bottom - top + 1 };
+        state.bounds = state.bounds.unite(r);
+    }
+}
+
+int ClockEngine::handFootprint(int hand, HandSpan* spans, int maxSpans) {
+    const HandState& state = handState[hand];
+    if (state.fine < 0) {
+        return 0;
+    }
+    int count = 0;
+    for (int s = 0; s < state.segments; s++) {
+        int n = handRenderer.footprint(state.x0[s], state.y0[s], state.x1[s], state.y1[s], hands[hand].width,
+                                       0, 0, display->width(), display->height(), spans + count, maxSpans - count);
+        if (n < 0) {
+            return -1;
+        }
+        count += n;
+    }
+    return count;
+}
+
+// 線分1本あたり、行数は長さ+太さ+縁、1行の画素数は太さ+縁を斜めに切った長さで抑えられる
+void ClockEngine::handFootprintLimits(int hand, int& maxSpans, int& maxPixels) const {
+    const HandStyle& style = hands[hand];
+    int across = (int)ceilf(style.width) + 3;
+    maxSpans = 0;
+    maxPixels = 0;
+    int lengths[2] = { style.length, style.back };
+    for (int s = 0; s < 2; s++) {
+        if (lengths[s] <= 0) {
+            continue;
+        }
+        int rows = lengths[s] + across;
+        maxSpans += rows;
+        maxPixels += rows * across;
+    }
+}
+
+ClockRect ClockEngine::handBounds(int hand) const {
+    if (handState[hand].fine < 0) {
+        return ClockRect{ 0, 0, 0, 0 };
+    }
+    return handState[hand].bounds;
+}
+
+int ClockEngine::addComplication(Complication* complication) {
+    if (slotCount >= MAX_COMPLICATIONS || complication == nullptr) {
+        return -1;
+    }
+    Slot& slot = slots[slotCount];
+    slot.complication = complication;
+    slot.lastRefreshMs = 0;
+    slot.refreshed = false;
+    slot.stats = ComplicationStats{ complication->name(), 0, 0, 0, 0 };
+    needsFullRedraw = true;
+    return slotCount++;
+}
+
+bool ClockEngine::takeComplicationStats(int id, ComplicationStats& stats, bool reset) {
+    if (id < 0 || id >= slotCount) {
+        return false;
+    }
+    stats = slots[id].stats;
+    if (reset) {
+        slots[id].stats.refreshes = 0;
+        slots[id].stats.changes = 0;
+        slots[id].stats.cpuUs = 0;
+        slots[id].stats.pushedPixels = 0;
+    }
+    return true;
+}
+
+int ClockEngine::addLabel(const LabelStyle& style) {
+    for (int i = 0; i < MAX_LABELS; i++) {
+        if (!labels[i].used) {
+            labels[i].used = true;
+            labels[i].style = style;
+            labels[i].text[0] = '\0';
+            labels[i].tile.clear();
+            labels[i].tiled = true;
+            labels[i].drawn = ClockRect{ 0, 0, 0, 0 };
+            labels[i].changed = true;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void ClockEngine::setLabelText(int id, const char* text) {
+    if (id < 0 || id >= MAX_LABELS || !labels[id].used) {
+        return;
+    }
+    Label& label = labels[id];
+    if (strncmp(label.text, text, MAX_LABEL_LENGTH - 1) == 0) {
+        return;
+    }
+    strncpy(label.text, text, MAX_LABEL_LENGTH - 1);
+    label.text[MAX_LABEL_LENGTH - 1] = '\0';
+    label.tiled = label.tile.render(label.style.font, label.text);
+    label.changed = true;
+}
+
+// 文字の描き換え範囲（box と文字の外接矩形を合わせた範囲）
+ClockRect ClockEngine::labelRect(const Label& label) {
+    ClockRect box = label.style.box;
+    if (label.text[0] == '\0') {
+        return box;
+    }
+    int w, h;
+    if (label.tiled) {
+        w = label.tile.getWidth();
+        h = label.tile.getHeight();
+    } else {
+        display->setFont(label.style.font);
+        w = display->textWidth(label.text);
+        h = display->fontHeight();
+    }
+    ClockRect r = { label.style.centered ? label.style.x - w / 2 : label.style.x, label.style.y, w, h };
+    return box.unite(r);
+}
+
+void ClockEngine::update(const ClockTime& time) {
+    uint32_t start = lgfx::micros();
+    int fines[HAND_COUNT];
+    fines[HOUR] = clock_trig::hourStep(time.hour, time.minute) << clock_trig::FINE_BITS;
+    fines[MINUTE] = clock_trig::minuteStep(time.minute) << clock_trig::FINE_BITS;
+    fines[SECOND] = time.millisecond < 0 ? clock_trig::secondStep(time.second) << clock_trig::FINE_BITS
+                                         : clock_trig::sweepSecondFine(time.second, time.millisecond);
+
+    bool full = needsFullRedraw || !hasTime;
+    ClockRect damage[MAX_DAMAGE];
+    int count = 0;
+
+    // 針ごとに前回と今回の位置を囲む矩形
+    // 針の移動を自前で反映する更新方式には渡さない
+    bool tracksHands = strategy != nullptr && strategy->tracksHands();
+    bool handMoved = false;
+    for (int i = 0; i < HAND_COUNT; i++) {
+        if (!full && handState[i].fine == fines[i]) {
+            continue;
+        }
+        HandState next;
+        layoutHand(i, fines[i], next);
+        if (!full && !tracksHands) {
+            damage[count++] = handState[i].bounds.unite(next.bounds);
+        }
+        handState[i] = next;
+        handMoved = true;
+    }
+
+    // 文字が変わったら前回と今回の範囲
+    for (int i = 0; i < MAX_LABELS; i++) {
+        Label& label = labels[i];
+        if (!label.used || (!full && !label.changed)) {
+            continue;
+        }
+        ClockRect next = labelRect(label);
+        if (!full) {
+            damage[count++] = label.drawn.unite(next);
+        }
+        label.drawn = next;
+        label.changed = false;
+    }
+
+    // 周期が来たコンプリケーションだけデータを更新し、表示が変わった範囲を加える
+    uint32_t nowMs = lgfx::millis();
+    ClockRect screen = screenRect();
+    for (int i = 0; i < slotCount; i++) {
+        Slot& slot = slots[i];
+        if (slot.refreshed && nowMs - slot.lastRefreshMs < slot.complication->period()) {
+            continue;
+        }
+        slot.lastRefreshMs = nowMs;
+        slot.refreshed = true;
+        uint32_t refreshStart = lgfx::micros();
+        ClockRect changed = slot.complication->refresh(time).intersect(screen);
+        slot.stats.cpuUs += lgfx::micros() - refreshStart;
+        slot.stats.refreshes++;
+        if (changed.isEmpty()) {
+            continue;
+        }
+        slot.stats.changes++;
+        if (!full) {
+            damage[count++] = changed;
+            slot.stats.pushedPixels += changed.w * changed.h;
+        }
+    }
+    hasTime = true;
+
+    if (full) {
+        needsFullRedraw = false;
+        damage[0] = screenRect();
+        count = 1;
+    }
+
+    // 画面内に切り詰めて、空になった矩形を除く
+    int valid = 0;
+    for (int i = 0; i < count; i++) {
+        ClockRect r = damage[i].intersect(screen);
+        if (!r.isEmpty()) {
+            damage[valid++] = r;
+        }
+    }
+    if ((valid == 0 && !(tracksHands && handMoved)) || strategy == nullptr || face == nullptr) {
+        return;
+    }
+    strategy->render(*this, damage, valid);
+    lastFrameUs = lgfx::micros() - start;
+    frames++;
+}
+
+void ClockEngine::redraw() {
+    if (strategy == nullptr || face == nullptr) {
+        return;
+    }
+    uint32_t start = lgfx::micros();
+    for (int i = 0; i < MAX_LABELS; i++) {
+        if (labels[i].used) {
+            labels[i].drawn = labelRect(labels[i]);
+            labels[i].changed = false;
+        }
+    }
+    needsFullRedraw = false;
+    ClockRect screen = screenRect();
+    strategy->render(*this, &screen, 1);
+    lastFrameUs = lgfx::micros() - start;
+    frames++;
+}
+
+void ClockEngine::drawOverlaysImpl(lgfx::LovyanGFX* dst, LGFX_Sprite* blendDst, int originX, int originY) {
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+    ClockRect clip = { clipX + originX, clipY + originY, clipW, clipH };
+
+    // 日付などの文字（範囲がクリップ領域に掛かるものだけ）
+    for (int i = 0; i < MAX_LABELS; i++) {
+        const Label& label = labels[i];
+        if (!label.used || !label.drawn.intersects(clip)) {
+            continue;
+        }
+        if (label.style.fillBox) {
+            dst->fillRect(label.style.box.x - originX, label.style.box.y - originY,
+                          label.style.box.w, label.style.box.h, label.style.boxColor);
+        }
+        if (label.text[0] == '\0') {
+            continue;
+        }
+        if (label.tiled) {
+            int x = label.style.x;
+            if (label.style.centered) {
+                x -= label.tile.getWidth() / 2;
+            }
+            label.tile.draw(dst, x - originX, label.style.y - originY, label.style.color);
+            continue;
+        }
+        dst->setFont(label.style.font);
+        dst->setTextColor(label.style.color);
+        int x = label.style.x;
+        if (label.style.centered) {
+            x -= dst->textWidth(label.text) / 2;
+        }
+        dst->setCursor(x - originX, label.style.y - originY);
+        dst->print(label.text);
+    }
+
+    // コンプリケーション（範囲がクリップ領域に掛かるものだけ）
+    for (int i = 0; i < slotCount; i++) {
+        Slot& slot = slots[i];
+        if (!slot.complication->region().intersects(clip)) {
+            continue;
+        }
+        uint32_t drawStart = lgfx::micros();
+        slot.complication->draw(dst, originX, originY);
+        slot.stats.cpuUs += lgfx::micros() - drawStart;
+    }
+
+    // 針（時・分・秒の順に重ねる。縁は描画済みの文字盤・文字・他の針と混色）
+    uint16_t bgColor = face != nullptr ? face->backgroundColor() : 0;
+    for (int i = 0; i < HAND_COUNT; i++) {
+        const HandState& state = handState[i];
+        if (state.fine < 0 || !state.bounds.intersects(clip)) {
+            continue;
+        }
+        // 座標は画面座標のまま渡す（原点をずらすのは書き込む位置だけ）
+        for (int s = 0; s < state.segments; s++) {
+            if (blendDst != nullptr) {
+                handRenderer.drawHand(blendDst, state.x0[s], state.y0[s], state.x1[s], state.y1[s],
+                                      hands[i].width, hands[i].color, originX, originY);
+            } else {
+                handRenderer.drawHand(dst, state.x0[s], state.y0[s], state.x1[s], state.y1[s],
+                                      hands[i].width, hands[i].color, bgColor, originX, originY);
+            }
+        }
+    }
+
+    // 中心のキャップ
+    if (cap.radius > 0) {
+        ClockRect capRect = { centerX - cap.radius, centerY - cap.radius, cap.radius * 2 + 1, cap.radius * 2 + 1 };
+        if (capRect.intersects(clip)) {
+            int cx = centerX - originX;
+            int cy = centerY - originY;
+            dst->fillCircle(cx, cy, cap.radius, cap.color);
+            if (cap.border) {
+                dst->drawCircle(cx, cy, cap.radius, cap.borderColor);
+            }
+            if (cap.dotRadius > 0) {
+                dst->fillCircle(cx, cy, cap.dotRadius, cap.dotColor);
+            }
+        }
+    }
+}
+
+uint32_t ClockEngine::takePushedBytes() {
+    uint32_t bytes = pushedBytes;
+    pushedBytes = 0;
+    return bytes;
+}
+
+uint32_t ClockEngine::takeFrames() {
+    uint32_t count = frames;
+    frames = 0;
+    return count;
+}
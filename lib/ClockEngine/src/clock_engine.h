@@ -0,0 +1,147 @@
+#ifndef CLOCK_ENGINE_H
+#define CLOCK_ENGINE_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+#include "clock_types.h"
+#include "face_renderer.h"
+#include "hand_renderer.h"
+#include "text_tile.h"
+#include "complication.h"
+
+class UpdateStrategy;
+
+// アナログ時計の描画エンジン
+// 文字盤（FaceRenderer）の上に日付などの文字・針・中心キャップを重ね、
+// 前回から変化した部分（針の移動範囲、文字の書き換え範囲）を更新方式（UpdateStrategy）に渡す。
+// 文字盤と更新方式は製品ごとに組み合わせを選ぶ。
+class ClockEngine {
+public:
+    enum Hand { HOUR = 0, MINUTE, SECOND, HAND_COUNT };
+    static const int MAX_LABELS = 4;
+    static const int MAX_LABEL_LENGTH = 24;
+    static const int MAX_COMPLICATIONS = 8;
+    static const int MAX_DAMAGE = HAND_COUNT + MAX_LABELS + MAX_COMPLICATIONS;
+
+private:
+    lgfx::LovyanGFX* display;
+    FaceRenderer* face;
+    UpdateStrategy* strategy;
+
+    int centerX;
+    int centerY;
+    int centerAvoidRadius;          // 針を描き始める中心からの距離
+    HandStyle hands[HAND_COUNT];
+    CenterCap cap;
+    HandRenderer handRenderer;
+
+    // 針の位置（clock_trig の細分化位置）と描画した線分
+    struct HandState {
+        int fine;                   // 負なら未描画
+        float x0[2], y0[2], x1[2], y1[2];
+        int segments;
+        ClockRect bounds;
+    };
+    HandState handState[HAND_COUNT];
+
+    struct Label {
+        LabelStyle style;
+        char text[MAX_LABEL_LENGTH];
+        TextTile tile;              // 文字を描いたマスク（文字が変わった時だけ作り直す）
+        bool tiled;                 // falseならフォントから直接描く
+        ClockRect drawn;            // 前回描画した範囲
+        bool used;
+        bool changed;
+    };
+    Label labels[MAX_LABELS];
+
+    struct Slot {
+        Complication* complication;
+        uint32_t lastRefreshMs;
+        bool refreshed;             // 一度でも refresh() したか
+        ComplicationStats stats;
+    };
+    Slot slots[MAX_COMPLICATIONS];
+    int slotCount;
+
+    bool needsFullRedraw;
+    bool hasTime;
+
+    // 統計用
+    uint32_t pushedBytes;
+    uint32_t lastFrameUs;
+    uint32_t frames;
+
+    void layoutHand(int hand, int fine, HandState& state);
+    ClockRect labelRect(const Label& label);
+    void drawOverlaysImpl(lgfx::LovyanGFX* dst, LGFX_Sprite* blendDst, int originX, int originY);
+
+public:
+    explicit ClockEngine(lgfx::LovyanGFX* display);
+
+    // 構成（begin() より前に設定）
+    void setFace(FaceRenderer* newFace) { face = newFace; }
+    void setStrategy(UpdateStrategy* newStrategy) { strategy = newStrategy; }
+    void setCenter(int x, int y) { centerX = x; centerY = y; }
+    void setCenterAvoidRadius(int radius) { centerAvoidRadius = radius; }
+    void setHand(Hand hand, const HandStyle& style) { hands[hand] = style; needsFullRedraw = true; }
+    void setCenterCap(const CenterCap& newCap) { cap = newCap; needsFullRedraw = true; }
+    void setAntiAlias(bool enable) { handRenderer.setAntiAlias(enable); needsFullRedraw = true; }
+
+    // 更新方式のバッファを確保（失敗したらfalse）
+    bool begin();
+
+    // 文字の表示を追加（戻り値は setLabelText() に渡す番号、空きがなければ-1）
+    int addLabel(const LabelStyle& style);
+    // 文字を設定（前回と同じなら何もしない）
+    void setLabelText(int id, const char* text);
+
+    // コンプリケーションを追加（戻り値は統計の取得に使う番号、空きがなければ-1）
+    int addComplication(Complication* complication);
+    int getComplicationCount() const { return slotCount; }
+
+    // 時刻を描画（変化した部分だけを更新方式に渡す）
+    void update(const ClockTime& time);
+
+    // 次の update() で画面全体を描き直す
+    void invalidate() { needsFullRedraw = true; }
+
+    // 直前の時刻で画面全体を描き直す（時刻が未設定なら文字盤だけ）
+    void redraw();
+
+    // ---- 更新方式から使う ----
+    lgfx::LovyanGFX* getDisplay() { return display; }
+    FaceRenderer* getFace() { return face; }
+    ClockRect screenRect() const;
+
+    // 日付などの文字・針・中心キャップを描画（描画先の左上が画面座標の originX, originY）
+    // スプライトなら針の縁を既存の画素と、LCDなら文字盤の背景色と混色する
+    void drawOverlays(LGFX_Sprite* dst, int originX, int originY) { drawOverlaysImpl(dst, dst, originX, originY); }
+    void drawOverlays(lgfx::LovyanGFX* dst, int originX, int originY) { drawOverlaysImpl(dst, nullptr, originX, originY); }
+
+    // 針が書き込む画素を行ごとの区間で取得（画面内に切り詰め、未描画なら0、maxSpans を超えたら-1）
+    int handFootprint(int hand, HandSpan* spans, int maxSpans);
+    // 針がどの角度にあっても handFootprint() が収まる区間数と画素数
+    void handFootprintLimits(int hand, int& maxSpans, int& maxPixels) const;
+    // 針の位置（clock_trig の細分化位置、未描画なら負）
+    int handPosition(int hand) const { return handState[hand].fine; }
+    // 針の縁の混色まで含めた外接矩形（未描画なら空）
+    ClockRect handBounds(int hand) const;
+
+    void addPushedBytes(uint32_t bytes) { pushedBytes += bytes; }
+
+    // ---- 統計 ----
+    // 前回呼び出し以降にLCDへ転送したバイト数を取得してリセット
+    uint32_t takePushedBytes();
+    // 前回呼び出し以降に針の描画で書き込んだ画素数を取得してリセット
+    uint32_t takeHandPixels() { return handRenderer.takePixelCount(); }
+    // 前回呼び出し以降に描画したフレーム数を取得してリセット
+    uint32_t takeFrames();
+    // コンプリケーションの統計を取得（reset ならその後0に戻す）
+    bool takeComplicationStats(int id, ComplicationStats& stats, bool reset = true);
+    // 直近のフレームの合成・転送時間（us）
+    uint32_t getLastFrameMicros() const { return lastFrameUs; }
+    UpdateStrategy* getStrategy() { return strategy; }
+};
+
+#endif // CLOCK_ENGINE_H
@@ -0,0 +1,109 @@
+#ifndef CLOCK_TRIG_H
+#define CLOCK_TRIG_H
+
+#include <stdint.h>
+
+// 時計の針・目盛り用の三角関数テーブル
+// 1周を720ステップ（0.5度刻み）に分け、sinをQ14固定小数点でコンパイル時に生成する。
+// 秒・分は12ステップ、時針は分を含めて1ステップ刻みで720位置すべてを表せる。
+namespace clock_trig {
+
+const int STEPS = 720;      // 1周のステップ数
+const int FRAC_BITS = 14;   // 固定小数点の小数部ビット数
+
+// ---- コンパイル時のsin計算（C++11のconstexprで書ける範囲に収める） ----
+
+constexpr double PI_PER_STEP = 3.14159265358979323846 / 360.0;
+
+// |x| <= π/2 のテイラー展開（13次の項まで、誤差は1e-6未満）
+constexpr double sinPoly(double x, double x2) {
+    return x * (1 - x2 / 6 * (1 - x2 / 20 * (1 - x2 / 42 * (1 - x2 / 72 * (1 - x2 / 110 * (1 - x2 / 156))))));
+}
+
+constexpr double sinRadian(double x) {
+    return sinPoly(x, x * x);
+}
+
+// 0〜719ステップの sin（対称性で 0〜π/2 に折り返す）
+constexpr double sinStep(int step) {
+    return step < 180 ? sinRadian(step * PI_PER_STEP)
+         : step < 360 ? sinRadian((360 - step) * PI_PER_STEP)
+         : -sinStep(step - 360);
+}
+
+constexpr int16_t toFixed(double v) {
+    return (int16_t)(v >= 0 ? v * (1 << FRAC_BITS) + 0.5 : v * (1 << FRAC_BITS) - 0.5);
+}
+
+// テーブル生成用の整数列（再帰の深さを log(N) に抑える）
+template<int... I> struct Seq {};
+
+template<class A, class B> struct Concat;
+template<int... A, int... B> struct Concat<Seq<A...>, Seq<B...> > {
+    typedef Seq<A..., (int)(sizeof...(A) + B)...> type;
+};
+
+template<int N> struct MakeSeq {
+    typedef typename Concat<typename MakeSeq<N / 2>::type, typename MakeSeq<N - N / 2>::type>::type type;
+};
+template<> struct MakeSeq<0> { typedef Seq<> type; };
+template<> struct MakeSeq<1> { typedef Seq<0> type; };
+
+template<class S> struct SinTable;
+template<int... I> struct SinTable<Seq<I...> > {
+    static constexpr int16_t values[sizeof...(I)] = { toFixed(sinStep(I))... };
+};
+template<int... I> constexpr int16_t SinTable<Seq<I...> >::values[sizeof...(I)];
+
+typedef SinTable<MakeSeq<STEPS>::type> Table;
+
+static_assert(sizeof(Table::values) / sizeof(Table::values[0]) == STEPS, "sin table size");
+static_assert(Table::values[180] == (1 << FRAC_BITS), "sin(90deg) must be 1.0");
+
+// ---- 実行時に使う関数 ----
+
+// ステップ位置（0〜719）の sin / cos（Q14）
+inline int sinQ(int step) { return Table::values[step]; }
+inline int cosQ(int step) { return Table::values[step < 540 ? step + 180 : step - 540]; }
+
+// 12時方向を0とした時計回りの角度で、中心から長さlengthの点までのオフセット
+inline int offsetX(int step, int length) {
+    return (length * sinQ(step) + (1 << (FRAC_BITS - 1))) >> FRAC_BITS;
+}
+inline int offsetY(int step, int length) {
+    return -((length * cosQ(step) + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+}
+
+// 時刻からステップ位置への変換
+inline int secondStep(int second) { return (second % 60) * 12; }
+inline int minuteStep(int minute) { return (minute % 60) * 12; }
+inline int hourStep(int hour, int minute) { return (hour % 12) * 60 + (minute % 60); }
+
+// ---- 1ステップ未満の位置（秒針のスイープ用） ----
+
+const int FINE_BITS = 8;    // 1ステップを256分割
+
+// 細分化した位置（step << FINE_BITS 単位）の sin / cos を隣のステップと線形補間（Q14）
+inline int sinQFine(int fine) {
+    int i = fine >> FINE_BITS;
+    int f = fine & ((1 << FINE_BITS) - 1);
+    int a = sinQ(i);
+    int b = sinQ(i + 1 < STEPS ? i + 1 : 0);
+    return a + (((b - a) * f) >> FINE_BITS);
+}
+inline int cosQFine(int fine) {
+    int i = fine >> FINE_BITS;
+    int f = fine & ((1 << FINE_BITS) - 1);
+    int a = cosQ(i);
+    int b = cosQ(i + 1 < STEPS ? i + 1 : 0);
+    return a + (((b - a) * f) >> FINE_BITS);
+}
+
+// 秒とミリ秒から秒針の細分化位置へ（60000ms で 720 << 8、つまり 1ms あたり 384/125）
+inline int sweepSecondFine(int second, int millisecond) {
+    return ((second % 60) * 1000 + millisecond) * 384 / 125;
+}
+
+} // namespace clock_trig
+
+#endif // CLOCK_TRIG_H
@@ -0,0 +1,81 @@
+#ifndef CLOCK_TYPES_H
+#define CLOCK_TYPES_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+
+// 画面座標の矩形
+struct ClockRect {
+    int x;
+    int y;
+    int w;
+    int h;
+
+    bool isEmpty() const { return w <= 0 || h <= 0; }
+
+    // 2つの矩形を囲む矩形（空の矩形は無視）
+    ClockRect unite(const ClockRect& o) const {
+        if (isEmpty()) return o;
+        if (o.isEmpty()) return *this;
+        int left = x < o.x ? x : o.x;
+        int top = y < o.y ? y : o.y;
+        int right = x + w > o.x + o.w ? x + w : o.x + o.w;
+        int bottom = y + h > o.y + o.h ? y + h : o.y + o.h;
+        ClockRect r = { left, top, right - left, bottom - top };
+        return r;
+    }
+
+    // 2つの矩形の共通部分
+    ClockRect intersect(const ClockRect& o) const {
+        int left = x > o.x ? x : o.x;
+        int top = y > o.y ? y : o.y;
+        int right = x + w < o.x + o.w ? x + w : o.x + o.w;
+        int bottom = y + h < o.y + o.h ? y + h : o.y + o.h;
+        ClockRect r = { left, top, right - left, bottom - top };
+        return r;
+    }
+
+    bool intersects(const ClockRect& o) const { return !intersect(o).isEmpty(); }
+};
+
+// 針の形と色
+// 中心から length の先端側と、back > 0 なら反対側にも伸ばす（どちらも中心の避け半径から描く）
+struct HandStyle {
+    int length;
+    int back;
+    float width;
+    uint16_t color;     // RGB565
+};
+
+// 中心のキャップ（radius の円、borderColor の縁、dotRadius の中心点。0なら描かない）
+struct CenterCap {
+    int radius;
+    uint16_t color;
+    bool border;
+    uint16_t borderColor;
+    int dotRadius;
+    uint16_t dotColor;
+};
+
+// 文字の表示（日付やデジタル時刻）
+// 文字の外接矩形と box を合わせた範囲を描き換える（box の幅が0なら文字だけ）。fillBox なら box を boxColor で塗ってから描く
+struct LabelStyle {
+    int x;              // centered なら中心のx座標
+    int y;              // 上端
+    bool centered;
+    const lgfx::IFont* font;
+    uint16_t color;
+    bool fillBox;
+    uint16_t boxColor;
+    ClockRect box;
+};
+
+// 描画する時刻（millisecond が負なら秒針は1秒刻み）
+struct ClockTime {
+    int hour;
+    int minute;
+    int second;
+    int millisecond;
+};
+
+#endif // CLOCK_TYPES_H
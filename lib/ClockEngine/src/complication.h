@@ -0,0 +1,40 @@
+#ifndef COMPLICATION_H
+#define COMPLICATION_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+#include "clock_types.h"
+
+// 文字盤に重ねる小さな表示（デジタル時刻・歩数・電波強度など）
+// それぞれが更新周期と画面上の範囲を持ち、ClockEngine は周期が来た時だけ refresh() を呼んで
+// 表示が変わった範囲を針と同じように部分更新する。文字盤の上、針の下に描かれる。
+class Complication {
+public:
+    virtual ~Complication() {}
+
+    virtual const char* name() const = 0;
+
+    // refresh() を呼ぶ間隔（ms）
+    virtual uint32_t period() const = 0;
+
+    // 描画する範囲（画面座標）
+    virtual ClockRect region() const = 0;
+
+    // データを更新して、表示が変わった範囲を返す（前回の表示の範囲も含める。変わらなければ空の矩形）
+    virtual ClockRect refresh(const ClockTime& time) = 0;
+
+    // 描画先の左上が画面座標の (originX, originY) にあたるとして描画
+    // 描画先のクリップ領域の外は描かれなくてよい。背景（文字盤）は描かずに重ねる
+    virtual void draw(lgfx::LovyanGFX* dst, int originX, int originY) = 0;
+};
+
+// コンプリケーションごとの統計
+struct ComplicationStats {
+    const char* name;
+    uint32_t refreshes;         // refresh() を呼んだ回数
+    uint32_t changes;           // 表示が変わった回数
+    uint32_t cpuUs;             // refresh() と draw() にかかった時間の合計
+    uint32_t pushedPixels;      // 表示の変化でLCDへ転送した画素数
+};
+
+#endif // COMPLICATION_H
@@ -0,0 +1,91 @@
+#include "face_decoder.h"
+#include <stdlib.h>
+
+namespace FaceDecoder {
+
+void decodeSpan(const CompressedFace& face, int row, int x, int width, uint16_t* dst) {
+    const uint8_t* p = face.data + pgm_read_word(&face.rowOffsets[row]);
+    int end = x + width;
+    int pos = 0;
+    while (pos < end) {
+        uint8_t token = pgm_read_byte(p++);
+        int count;
+        uint16_t color;
+        if (token < 0x80) {
+            count = token + 1;
+            color = pgm_read_word(&face.palette[pgm_read_byte(p++)]);
+        } else if (token < 0xFF) {
+            count = 1;
+            color = pgm_read_word(&face.palette[token - 0x80]);
+        } else {
+            count = 1;
+            color = pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+            p += 2;
+        }
+        // 要求された範囲と重なる部分だけ書き込む
+        int from = pos > x ? pos : x;
+        int to = pos + count < end ? pos + count : end;
+        for (int i = from; i < to; i++) {
+            dst[i - x] = color;
+        }
+        pos += count;
+    }
+}
+
+void decodeToSprite(const CompressedFace& face, LGFX_Sprite* sprite, int x, int y) {
+    uint16_t* buffer = (uint16_t*)sprite->getBuffer();
+    int spriteWidth = sprite->width();
+    int spriteHeight = sprite->height();
+    if (buffer == nullptr) {
+        return;
+    }
+    // スプライトからはみ出す部分を除く
+    int left = x < 0 ? -x : 0;
+    int right = x + face.width > spriteWidth ? spriteWidth - x : face.width;
+    if (left >= right) {
+        return;
+    }
+    for (int row = 0; row < face.height; row++) {
+        int sy = y + row;
+        if (sy < 0 || sy >= spriteHeight) {
+            continue;
+        }
+        decodeSpan(face, row, left, right - left, buffer + sy * spriteWidth + x + left);
+    }
+}
+
+bool decodeToLCD(const CompressedFace& face, lgfx::LovyanGFX* lcd, int x, int y, int bandRows) {
+    int left = x < 0 ? -x : 0;
+    int right = x + face.width > lcd->width() ? lcd->width() - x : face.width;
+    int top = y < 0 ? -y : 0;
+    int bottom = y + face.height > lcd->height() ? lcd->height() - y : face.height;
+    int width = right - left;
+    if (width <= 0 || top >= bottom) {
+        return true;
+    }
+
+    // バンド用のバッファ（確保できなければ1行ずつ）
+    uint16_t* band = (uint16_t*)malloc(width * bandRows * sizeof(uint16_t));
+    if (band == nullptr) {
+        bandRows = 1;
+        band = (uint16_t*)malloc(width * sizeof(uint16_t));
+        if (band == nullptr) {
+            return false;
+        }
+    }
+
+    lcd->startWrite();
+    for (int row = top; row < bottom; row += bandRows) {
+        int rows = bottom - row < bandRows ? bottom - row : bandRows;
+        for (int i = 0; i < rows; i++) {
+            decodeSpan(face, row + i, left, width, band + i * width);
+        }
+        // 16bit配列はバイト順を入れ替えたRGB565として転送される
+        lcd->pushImage(x + left, y + row, width, rows, band);
+    }
+    lcd->endWrite();
+    free(band);
+    return true;
+}
+
+} // namespace FaceDecoder
@@ -0,0 +1,44 @@
+#ifndef FACE_DECODER_H
+#define FACE_DECODER_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+
+#if defined(ARDUINO)
+#include <pgmspace.h>
+#else
+// ホスト（ベンチマーク）ではフラッシュとRAMの区別がない
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#endif
+
+// 圧縮された文字盤画像（tools/convert_face.py で生成）
+// パレットと行ごとのRLEで、各行は先頭から独立して展開できる。
+//   0x00-0x7F : 次の1バイトのパレット番号を (値+1) 画素繰り返す
+//   0x80-0xFE : パレット番号 (値-0x80) の1画素
+//   0xFF      : 続く2バイトがパレット外の1画素（リトルエンディアン）
+// 色はLovyanGFXの16bitスプライトのバッファと同じバイト順（上位下位を入れ替えたRGB565）。
+struct CompressedFace {
+    uint16_t width;
+    uint16_t height;
+    uint16_t paletteSize;
+    const uint16_t* palette;     // PROGMEM
+    const uint16_t* rowOffsets;  // PROGMEM、各行の data 内の開始位置
+    const uint8_t* data;         // PROGMEM
+};
+
+namespace FaceDecoder {
+
+// 行rowの画素 [x, x + width) を dst に展開（範囲は画像内であること）
+void decodeSpan(const CompressedFace& face, int row, int x, int width, uint16_t* dst);
+
+// 画像全体を16bitスプライトのバッファへ展開（(x, y) は画像の左上、画像外は背景のまま）
+void decodeToSprite(const CompressedFace& face, LGFX_Sprite* sprite, int x, int y);
+
+// 画像全体をbandRows行ずつ展開してLCDへ転送（バッファを確保できなければfalse）
+bool decodeToLCD(const CompressedFace& face, lgfx::LovyanGFX* lcd, int x, int y, int bandRows = 16);
+
+} // namespace FaceDecoder
+
+#endif // FACE_DECODER_H
@@ -0,0 +1,156 @@
+#include "face_renderer.h"
+#include <stdlib.h>
+#include <string.h>
+#include "clock_trig.h"
+
+// ---- VectorFace ----
+
+// 目盛りを1本描画（thickness が2以上なら右、3なら下にずらした線を重ねる）
+void VectorFace::drawMark(lgfx::LovyanGFX* dst, int cx, int cy, int step, int inner, int outer, int thickness) {
+    int x1 = cx + clock_trig::offsetX(step, inner);
+    int y1 = cy + clock_trig::offsetY(step, inner);
+    int x2 = cx + clock_trig::offsetX(step, outer);
+    int y2 = cy + clock_trig::offsetY(step, outer);
+    dst->drawLine(x1, y1, x2, y2, style.markColor);
+    if (thickness >= 2) {
+        dst->drawLine(x1 + 1, y1, x2 + 1, y2, style.markColor);
+    }
+    if (thickness >= 3) {
+        dst->drawLine(x1, y1 + 1, x2, y2 + 1, style.markColor);
+    }
+}
+
+void VectorFace::draw(lgfx::LovyanGFX* dst, int originX, int originY) {
+    int cx = style.centerX - originX;
+    int cy = style.centerY - originY;
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+
+    // 1. 背景と枠
+    dst->fillScreen(style.screenColor);
+    if (style.borderWidth > 0) {
+        dst->fillCircle(cx, cy, style.radius, style.borderColor);
+    }
+    dst->fillCircle(cx, cy, style.radius - style.borderWidth, style.faceColor);
+
+    // 2. 目盛り（分目盛りがあれば60本、なければ時目盛りの12本）
+    int outer = style.radius - style.markInset;
+    int count = style.minuteMarkLength > 0 ? 60 : 12;
+    for (int i = 0; i < count; i++) {
+        int hour = style.minuteMarkLength > 0 ? i / 5 : i;
+        if (style.minuteMarkLength > 0 && i % 5 != 0) {
+            drawMark(dst, cx, cy, clock_trig::minuteStep(i), outer - style.minuteMarkLength, outer, 1);
+            continue;
+        }
+        int thickness = hour % 3 == 0 ? style.quarterMarkThickness : style.hourMarkThickness;
+        drawMark(dst, cx, cy, clock_trig::hourStep(hour, 0), outer - style.hourMarkLength, outer, thickness);
+    }
+
+    // 3. 数字（クリップ領域に掛からない数字は描かない）
+    if (style.numeralFont == nullptr) {
+        return;
+    }
+    if (prepareNumerals()) {
+        for (int i = 0; i < 12; i++) {
+            numerals[i].draw(dst, cx + numeralX[i], cy + numeralY[i], style.numeralColor);
+        }
+        return;
+    }
+    // マスクを確保できなければフォントから直接描く
+    dst->setFont(style.numeralFont);
+    dst->setTextColor(style.numeralColor);
+    int h = dst->fontHeight();
+    for (int i = 1; i <= 12; i++) {
+        int step = clock_trig::hourStep(i, 0);
+        int tx = cx + clock_trig::offsetX(step, style.radius - style.numeralInset);
+        int ty = cy + clock_trig::offsetY(step, style.radius - style.numeralInset);
+        char buf[3];
+        sprintf(buf, "%d", i);
+        int w = dst->textWidth(buf);
+        if (tx - w / 2 >= clipX + clipW || tx - w / 2 + w <= clipX ||
+            ty - h / 2 >= clipY + clipH || ty - h / 2 + h <= clipY) {
+            continue;
+        }
+        dst->setCursor(tx - w / 2, ty - h / 2);
+        dst->print(buf);
+    }
+}
+
+// 12個の数字をマスクにして、左上の位置を求める（失敗したらfalse）
+bool VectorFace::prepareNumerals() {
+    if (numeralsReady) {
+        return true;
+    }
+    for (int i = 0; i < 12; i++) {
+        char buf[3];
+        sprintf(buf, "%d", i + 1);
+        if (!numerals[i].render(style.numeralFont, buf)) {
+            return false;
+        }
+        int step = clock_trig::hourStep(i + 1, 0);
+        numeralX[i] = clock_trig::offsetX(step, style.radius - style.numeralInset) - numerals[i].getWidth() / 2;
+        numeralY[i] = clock_trig::offsetY(step, style.radius - style.numeralInset) - numerals[i].getHeight() / 2;
+    }
+    numeralsReady = true;
+    return true;
+}
+
+// ---- BitmapFace ----
+
+BitmapFace::BitmapFace(const CompressedFace& face, int centerX, int centerY, uint16_t outsideColor)
+    : face(face), left(centerX - face.width / 2), top(centerY - face.height / 2),
+      outsideRaw((uint16_t)((outsideColor >> 8) | (outsideColor << 8))) {
+}
+
+// 画面座標の1行分 [x, x + width) を展開（画像の外は outsideColor）
+bool BitmapFace::decodeRow(int y, int x, int width, uint16_t* dst) {
+    int row = y - top;
+    int from = x > left ? x : left;
+    int to = x + width < left + (int)face.width ? x + width : left + (int)face.width;
+    if (row < 0 || row >= face.height || from >= to) {
+        for (int i = 0; i < width; i++) dst[i] = outsideRaw;
+        return true;
+    }
+    for (int i = 0; i < from - x; i++) dst[i] = outsideRaw;
+    for (int i = to - x; i < width; i++) dst[i] = outsideRaw;
+    FaceDecoder::decodeSpan(face, row, from - left, to - from, dst + (from - x));
+    return true;
+}
+
+// 描画先のクリップ領域だけをバンド単位で展開して転送
+void BitmapFace::draw(lgfx::LovyanGFX* dst, int originX, int originY) {
+    const int bandRows = 16;
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+    if (clipW <= 0 || clipH <= 0) {
+        return;
+    }
+    int rowsPerBand = bandRows;
+    uint16_t* band = (uint16_t*)malloc(clipW * rowsPerBand * sizeof(uint16_t));
+    if (band == nullptr) {
+        rowsPerBand = 1;
+        band = (uint16_t*)malloc(clipW * sizeof(uint16_t));
+        if (band == nullptr) {
+            // メモリ不足時は背景色で塗りつぶす
+            dst->fillRect(clipX, clipY, clipW, clipH, backgroundColor());
+            return;
+        }
+    }
+    dst->startWrite();
+    for (int y = clipY; y < clipY + clipH; y += rowsPerBand) {
+        int rows = clipY + clipH - y < rowsPerBand ? clipY + clipH - y : rowsPerBand;
+        for (int i = 0; i < rows; i++) {
+            decodeRow(y + i + originY, clipX + originX, clipW, band + i * clipW);
+        }
+        // 16bit配列はバイト順を入れ替えたRGB565として転送される
+        dst->pushImage(clipX, y, clipW, rows, band);
+    }
+    dst->endWrite();
+    free(band);
+}
+
+// 最も多く使われている色（パレットの先頭）をRGB565で返す
+uint16_t BitmapFace::backgroundColor() const {
+    uint16_t raw = pgm_read_word(&face.palette[0]);
+    return (uint16_t)((raw >> 8) | (raw << 8));
+}
@@ -0,0 +1,89 @@
+#ifndef FACE_RENDERER_H
+#define FACE_RENDERER_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+#include "face_decoder.h"
+#include "text_tile.h"
+
+// 文字盤（針や文字の下になる背景）の描き方
+// 更新方式（UpdateStrategy）はこのインターフェースだけを使って背景を復元する。
+class FaceRenderer {
+public:
+    virtual ~FaceRenderer() {}
+
+    // 描画先の左上が画面座標の (originX, originY) にあたるとして文字盤を描画
+    // 描画先のクリップ領域の外は描かれなくてよい
+    virtual void draw(lgfx::LovyanGFX* dst, int originX, int originY) = 0;
+
+    // 画面座標の1行分 [x, x + width) をスプライトと同じバイト順の16bitで dst に展開
+    // 行単位で展開できない文字盤はfalseを返す（その場合は draw() が使われる）
+    virtual bool decodeRow(int y, int x, int width, uint16_t* dst) { return false; }
+
+    // 読み出しできない描画先（LCD）で針の縁を混色する背景色（RGB565）
+    virtual uint16_t backgroundColor() const = 0;
+};
+
+// 図形で描く文字盤
+struct VectorFaceStyle {
+    int centerX;
+    int centerY;
+    int radius;
+    uint16_t screenColor;           // 文字盤の外
+    uint16_t faceColor;
+    uint16_t borderColor;
+    int borderWidth;                // 0なら枠なし
+    uint16_t markColor;             // 目盛りの色
+    int markInset;                  // 目盛りの外端と文字盤の縁の間隔
+    int hourMarkLength;
+    int hourMarkThickness;          // 1〜3
+    int quarterMarkThickness;       // 3・6・9・12時（1〜3）
+    int minuteMarkLength;           // 0なら分目盛りなし
+    const lgfx::IFont* numeralFont; // nullptrなら数字なし
+    int numeralInset;               // 数字の中心と文字盤の縁の間隔
+    uint16_t numeralColor;
+};
+
+class VectorFace : public FaceRenderer {
+private:
+    VectorFaceStyle style;
+
+    // 数字は最初に描く時に1回だけマスクにしておく（位置は文字盤の中心からの相対）
+    TextTile numerals[12];
+    int numeralX[12];
+    int numeralY[12];
+    bool numeralsReady;
+
+    void drawMark(lgfx::LovyanGFX* dst, int cx, int cy, int step, int inner, int outer, int thickness);
+    bool prepareNumerals();
+
+public:
+    explicit VectorFace(const VectorFaceStyle& style) : style(style), numeralsReady(false) {}
+
+    void setStyle(const VectorFaceStyle& newStyle) { style = newStyle; numeralsReady = false; }
+    const VectorFaceStyle& getStyle() const { return style; }
+
+    void draw(lgfx::LovyanGFX* dst, int originX, int originY) override;
+    uint16_t backgroundColor() const override { return style.faceColor; }
+};
+
+// 圧縮ビットマップの文字盤（画像の外は outsideColor、RGB565）
+class BitmapFace : public FaceRenderer {
+private:
+    const CompressedFace& face;
+    int left;                       // 画像の左上の画面座標
+    int top;
+    uint16_t outsideRaw;            // outsideColor をスプライトと同じバイト順にしたもの
+
+public:
+    BitmapFace(const CompressedFace& face, int centerX, int centerY, uint16_t outsideColor = 0);
+
+    // 画像の中心を画面座標で指定
+    void setCenter(int centerX, int centerY) { left = centerX - face.width / 2; top = centerY - face.height / 2; }
+
+    void draw(lgfx::LovyanGFX* dst, int originX, int originY) override;
+    bool decodeRow(int y, int x, int width, uint16_t* dst) override;
+    uint16_t backgroundColor() const override;
+};
+
+#endif // FACE_RENDERER_H
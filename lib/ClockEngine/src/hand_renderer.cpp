@@ -0,0 +1,192 @@
+#include "hand_renderer.h"
+#include <math.h>
+#include <algorithm>
+
+// RGB565の2色をalpha（0〜32）で混色
+static uint16_t blend565(uint16_t fg, uint16_t bg, uint32_t alpha) {
+    // G を上位16bit、R と B を下位16bitに分けて3成分を一度に計算する
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = ((((f - b) * alpha) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)((r >> 16) | r);
+}
+
+// a*x + c が [lo, hi] に入る x の範囲を [xmin, xmax] に絞り込む
+static bool clipSpan(float a, float c, float lo, float hi, float& xmin, float& xmax) {
+    if (fabsf(a) < 1e-6f) {
+        return c >= lo && c <= hi;
+    }
+    float xa = (lo - c) / a;
+    float xb = (hi - c) / a;
+    if (xa > xb) {
+        float tmp = xa;
+        xa = xb;
+        xb = tmp;
+    }
+    if (xa > xmin) xmin = xa;
+    if (xb < xmax) xmax = xb;
+    return xmin <= xmax;
+}
+
+static float clamp01(float v) {
+    return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+HandRenderer::HandRenderer() : antiAlias(true), pixelCount(0) {
+}
+
+void HandRenderer::drawHand(lgfx::LovyanGFX* dst, float x0, float y0, float x1, float y1,
+                            float width, uint16_t color, uint16_t bgColor, int originX, int originY) {
+    rasterize(dst, false, x0, y0, x1, y1, width, color, bgColor, originX, originY);
+}
+
+void HandRenderer::drawHand(LGFX_Sprite* dst, float x0, float y0, float x1, float y1,
+                            float width, uint16_t color, int originX, int originY) {
+    rasterize(dst, true, x0, y0, x1, y1, width, color, 0, originX, originY);
+}
+
+bool HandRenderer::setup(float x0, float y0, float x1, float y1, float width, Geometry& g) const {
+    float vx = x1 - x0;
+    float vy = y1 - y0;
+    g.len = sqrtf(vx * vx + vy * vy);
+    if (g.len < 0.5f) {
+        return false;
+    }
+    // 針方向の単位ベクトル(ux,uy)と法線(nx,ny)
+    g.x0 = x0;
+    g.y0 = y0;
+    g.y1 = y1;
+    g.ux = vx / g.len;
+    g.uy = vy / g.len;
+    g.nx = -g.uy;
+    g.ny = g.ux;
+    g.halfWidth = width * 0.5f;
+
+    // 画素中心からの距離がこの範囲なら1画素でも掛かる
+    float edge = antiAlias ? 0.5f : 0.0f;
+    g.reachW = g.halfWidth + edge;
+    g.reachT = edge;
+    return true;
+}
+
+// 長方形の外接矩形の行をクリップ領域で切り詰める
+void HandRenderer::rowRange(const Geometry& g, int clipY, int clipH, int& yStart, int& yEnd) const {
+    float ey = fabsf(g.ny) * g.reachW + fabsf(g.uy) * g.reachT;
+    yStart = (int)ceilf(std::min(g.y0, g.y1) - ey);
+    yEnd = (int)floorf(std::max(g.y0, g.y1) + ey);
+    if (yStart < clipY) yStart = clipY;
+    if (yEnd > clipY + clipH - 1) yEnd = clipY + clipH - 1;
+}
+
+bool HandRenderer::rowSpan(const Geometry& g, int y, int clipX, int clipW, int& xs, int& xe) const {
+    // この行での法線方向の距離 d(x) = nx*x + dc、針方向の位置 t(x) = ux*x + tc
+    float dy = y - g.y0;
+    float dc = -g.nx * g.x0 + g.ny * dy;
+    float tc = -g.ux * g.x0 + g.uy * dy;
+    float xmin = clipX;
+    float xmax = clipX + clipW - 1;
+    if (!clipSpan(g.nx, dc, -g.reachW, g.reachW, xmin, xmax) ||
+        !clipSpan(g.ux, tc, -g.reachT, g.len + g.reachT, xmin, xmax)) {
+        return false;
+    }
+    xs = (int)ceilf(xmin);
+    xe = (int)floorf(xmax);
+    return xs <= xe;
+}
+
+void HandRenderer::rasterize(lgfx::LovyanGFX* dst, bool blendWithDst,
+                             float x0, float y0, float x1, float y1, float width,
+                             uint16_t color, uint16_t bgColor, int originX, int originY) {
+    Geometry g;
+    if (!setup(x0, y0, x1, y1, width, g)) {
+        return;
+    }
+    // クリップ領域を画面座標にして、画面座標のまま区間と被覆率を求める
+    // （浮動小数点の座標を原点でずらすと縁の混色が1段階ずれることがある）
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+    clipX += originX;
+    clipY += originY;
+    int yStart, yEnd;
+    rowRange(g, clipY, clipH, yStart, yEnd);
+
+    dst->startWrite();
+    for (int y = yStart; y <= yEnd; y++) {
+        int xs, xe;
+        if (!rowSpan(g, y, clipX, clipW, xs, xe)) {
+            continue;
+        }
+
+        int py = y - originY;
+        if (!antiAlias) {
+            dst->drawFastHLine(xs - originX, py, xe - xs + 1, color);
+            pixelCount += xe - xs + 1;
+            continue;
+        }
+
+        // 完全に覆われる画素は連続区間ごとにまとめて塗り、縁だけ混色する
+        float dy = y - g.y0;
+        float dc = -g.nx * g.x0 + g.ny * dy;
+        float tc = -g.ux * g.x0 + g.uy * dy;
+        int runStart = -1;
+        for (int x = xs; x <= xe; x++) {
+            float d = fabsf(g.nx * x + dc);
+            float t = g.ux * x + tc;
+            float coverW = clamp01(g.halfWidth + 0.5f - d);
+            float coverT = clamp01(std::min(t, g.len - t) + 0.5f);
+            uint32_t alpha = (uint32_t)(coverW * coverT * 32.0f + 0.5f);
+            if (alpha >= 32) {
+                if (runStart < 0) runStart = x;
+                continue;
+            }
+            if (runStart >= 0) {
+                dst->drawFastHLine(runStart - originX, py, x - runStart, color);
+                pixelCount += x - runStart;
+                runStart = -1;
+            }
+            if (alpha == 0) {
+                continue;
+            }
+            uint16_t bg = blendWithDst ? dst->readPixel(x - originX, py) : bgColor;
+            dst->drawPixel(x - originX, py, blend565(color, bg, alpha));
+            pixelCount++;
+        }
+        if (runStart >= 0) {
+            dst->drawFastHLine(runStart - originX, py, xe - runStart + 1, color);
+            pixelCount += xe - runStart + 1;
+        }
+    }
+    dst->endWrite();
+}
+
+int HandRenderer::footprint(float x0, float y0, float x1, float y1, float width,
+                            int clipX, int clipY, int clipW, int clipH, HandSpan* spans, int maxSpans) const {
+    Geometry g;
+    if (!setup(x0, y0, x1, y1, width, g)) {
+        return 0;
+    }
+    int yStart, yEnd;
+    rowRange(g, clipY, clipH, yStart, yEnd);
+    int count = 0;
+    for (int y = yStart; y <= yEnd; y++) {
+        int xs, xe;
+        if (!rowSpan(g, y, clipX, clipW, xs, xe)) {
+            continue;
+        }
+        if (count >= maxSpans) {
+            return -1;
+        }
+        spans[count].y = (int16_t)y;
+        spans[count].x0 = (int16_t)xs;
+        spans[count].x1 = (int16_t)xe;
+        count++;
+    }
+    return count;
+}
+
+// 前回呼び出し以降に書き込んだ画素数を取得してリセット
+uint32_t HandRenderer::takePixelCount() {
+    uint32_t count = pixelCount;
+    pixelCount = 0;
+    return count;
+}
@@ -0,0 +1,72 @@
+#ifndef HAND_RENDERER_H
+#define HAND_RENDERER_H
+
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+
+// 針が書き込む画素の1行分の区間 [x0, x1]
+struct HandSpan {
+    int16_t y;
+    int16_t x0;
+    int16_t x1;
+};
+
+// 太さのある針を1パスで描画するラスタライザ
+// 針を線分を中心とした長方形として扱い、各行で内側になる区間を求めて1回だけ書き込む。
+// 角度によらず太さが一定で、アンチエイリアス有効時は縁の画素を背景と混色する。
+// 座標は常に画面座標で計算し、描画先の原点は整数のまま書き込む位置だけをずらすので、
+// 帯や矩形ごとに描いても全画面に描いた時と同じ画素になる。
+class HandRenderer {
+private:
+    bool antiAlias;
+
+    // 書き込んだ画素数（統計用）
+    uint32_t pixelCount;
+
+    // 針の長方形（線分からの距離で表す）
+    struct Geometry {
+        float x0, y0;
+        float y1;
+        float len;
+        float ux, uy;       // 針方向の単位ベクトル
+        float nx, ny;       // 法線
+        float halfWidth;
+        float reachW;       // 画素中心がこの範囲なら1画素でも掛かる
+        float reachT;
+    };
+
+    bool setup(float x0, float y0, float x1, float y1, float width, Geometry& g) const;
+    // 行yで針に掛かる画素の区間を [clipX, clipX + clipW) の範囲で求める
+    bool rowSpan(const Geometry& g, int y, int clipX, int clipW, int& xs, int& xe) const;
+    void rowRange(const Geometry& g, int clipY, int clipH, int& yStart, int& yEnd) const;
+
+    void rasterize(lgfx::LovyanGFX* dst, bool blendWithDst,
+                   float x0, float y0, float x1, float y1, float width,
+                   uint16_t color, uint16_t bgColor, int originX, int originY);
+
+public:
+    HandRenderer();
+
+    // アンチエイリアスの有効・無効
+    void setAntiAlias(bool enable) { antiAlias = enable; }
+    bool isAntiAlias() const { return antiAlias; }
+
+    // (x0,y0)から(x1,y1)へ太さwidthの針を描画（縁は背景色bgColorと混色）
+    // LCDのように読み出しできない描画先に使う。座標は画面座標で、描画先の左上が画面の (originX, originY)
+    void drawHand(lgfx::LovyanGFX* dst, float x0, float y0, float x1, float y1,
+                  float width, uint16_t color, uint16_t bgColor, int originX = 0, int originY = 0);
+
+    // 描画先スプライトの既存の画素と混色して針を描画
+    void drawHand(LGFX_Sprite* dst, float x0, float y0, float x1, float y1,
+                  float width, uint16_t color, int originX = 0, int originY = 0);
+
+    // drawHand() が書き込む画素（縁の混色を含む）を行ごとの区間として spans に格納
+    // 戻り値は格納した区間の数。maxSpans に収まらなければ-1
+    int footprint(float x0, float y0, float x1, float y1, float width,
+                  int clipX, int clipY, int clipW, int clipH, HandSpan* spans, int maxSpans) const;
+
+    // 前回呼び出し以降に書き込んだ画素数を取得してリセット
+    uint32_t takePixelCount();
+};
+
+#endif // HAND_RENDERER_H
@@ -0,0 +1,83 @@
+#include "text_tile.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool TextTile::render(const lgfx::IFont* font, const char* text) {
+    clear();
+    if (text == nullptr || text[0] == '\0') {
+        return true;
+    }
+    LGFX_Sprite canvas;
+    canvas.setColorDepth(16);
+    canvas.setPsram(false);
+    canvas.setFont(font);
+    int w = canvas.textWidth(text);
+    int h = canvas.fontHeight();
+    if (w <= 0 || h <= 0 || canvas.createSprite(w, h) == nullptr) {
+        return false;
+    }
+    canvas.fillScreen(TFT_BLACK);
+    canvas.setTextColor(TFT_WHITE);
+    canvas.setCursor(0, 0);
+    canvas.print(text);
+
+    stride = (w + 7) / 8;
+    mask = (uint8_t*)calloc(stride * h, 1);
+    if (mask == nullptr) {
+        canvas.deleteSprite();
+        return false;
+    }
+    width = w;
+    height = h;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (canvas.readPixel(x, y) != 0) {
+                mask[y * stride + x / 8] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+    canvas.deleteSprite();
+    return true;
+}
+
+void TextTile::clear() {
+    free(mask);
+    mask = nullptr;
+    width = 0;
+    height = 0;
+    stride = 0;
+}
+
+// クリップ領域に掛かる行だけ、連続するビットをまとめて水平線で描く
+void TextTile::draw(lgfx::LovyanGFX* dst, int x, int y, uint16_t color) const {
+    if (mask == nullptr) {
+        return;
+    }
+    int32_t clipX, clipY, clipW, clipH;
+    dst->getClipRect(&clipX, &clipY, &clipW, &clipH);
+    int rowStart = clipY > y ? clipY - y : 0;
+    int rowEnd = clipY + clipH - y < height ? clipY + clipH - y : height;
+    int colStart = clipX > x ? clipX - x : 0;
+    int colEnd = clipX + clipW - x < width ? clipX + clipW - x : width;
+    if (rowStart >= rowEnd || colStart >= colEnd) {
+        return;
+    }
+    dst->startWrite();
+    for (int row = rowStart; row < rowEnd; row++) {
+        const uint8_t* bits = mask + row * stride;
+        int run = -1;
+        for (int col = colStart; col < colEnd; col++) {
+            bool on = bits[col >> 3] & (0x80 >> (col & 7));
+            if (on && run < 0) {
+                run = col;
+            } else if (!on && run >= 0) {
+                dst->drawFastHLine(x + run, y + row, col - run, color);
+                run = -1;
+            }
+        }
+        if (run >= 0) {
+            dst->drawFastHLine(x + run, y + row, colEnd - run, color);
+        }
+    }
+    dst->endWrite();
+}
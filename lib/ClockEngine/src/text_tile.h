@@ -0,0 +1,39 @@
+#ifndef TEXT_TILE_H
+#define TEXT_TILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+
+// 文字列を一度だけ1bitのマスクに描いておき、以降は色を付けて重ねるだけにする
+// 日付や文字盤の数字のように滅多に変わらない文字を、針を描き直すたびに
+// フォントから組み立て直さないために使う。
+class TextTile {
+private:
+    uint8_t* mask;                  // 1行 stride バイト、上位ビットが左
+    int width;
+    int height;
+    int stride;
+
+    TextTile(const TextTile&);
+    TextTile& operator=(const TextTile&);
+
+public:
+    TextTile() : mask(nullptr), width(0), height(0), stride(0) {}
+    ~TextTile() { clear(); }
+
+    // font で text を描いてマスクを作る（作業用に文字の大きさの16bitスプライトを一時的に確保）
+    // 確保できなければfalse（空の文字列は空のタイルとしてtrue）
+    bool render(const lgfx::IFont* font, const char* text);
+    void clear();
+
+    // 左上を (x, y) として color で描画（描画先のクリップ領域の外は描かない）
+    void draw(lgfx::LovyanGFX* dst, int x, int y, uint16_t color) const;
+
+    bool isEmpty() const { return mask == nullptr; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    size_t bytes() const { return (size_t)stride * height; }
+};
+
+#endif // TEXT_TILE_H
@@ -0,0 +1,362 @@
+#include "update_strategy.h"
+#include <stdlib.h>
+#include <string.h>
+#include "clock_engine.h"
+#include "face_renderer.h"
+
+// 16bit・内蔵RAMのスプライトを確保（失敗したらnullptr）
+static LGFX_Sprite* createSprite(lgfx::LovyanGFX* parent, int width, int height) {
+    LGFX_Sprite* sprite = new LGFX_Sprite(parent);
+    if (sprite == nullptr) {
+        return nullptr;
+    }
+    sprite->setColorDepth(16);  // 16ビットカラーモード（RGB565）
+    sprite->setPsram(false);    // PSRAM不使用で高速化
+    if (!sprite->createSprite(width, height)) {
+        delete sprite;
+        return nullptr;
+    }
+    return sprite;
+}
+
+static void deleteSprite(LGFX_Sprite*& sprite) {
+    if (sprite != nullptr) {
+        sprite->deleteSprite();
+        delete sprite;
+        sprite = nullptr;
+    }
+}
+
+// ---- UpdateStrategy ----
+
+void UpdateStrategy::restoreFace(FaceRenderer* face, LGFX_Sprite* dst, const ClockRect& area, int originX, int originY) {
+    uint16_t* buffer = (uint16_t*)dst->getBuffer();
+    int stride = dst->width();
+    if (face->decodeRow(originY + area.y, originX + area.x, area.w, buffer + area.y * stride + area.x)) {
+        for (int row = 1; row < area.h; row++) {
+            face->decodeRow(originY + area.y + row, originX + area.x, area.w,
+                            buffer + (area.y + row) * stride + area.x);
+        }
+        return;
+    }
+    dst->setClipRect(area.x, area.y, area.w, area.h);
+    face->draw(dst, originX, originY);
+    dst->clearClipRect();
+}
+
+void UpdateStrategy::pushArea(lgfx::LovyanGFX* lcd, LGFX_Sprite* src, const ClockRect& area, int x, int y) {
+    // クリップ領域の外は転送されない
+    lcd->setClipRect(x + area.x, y + area.y, area.w, area.h);
+    src->pushSprite(lcd, x, y);
+    lcd->clearClipRect();
+}
+
+// ---- DirectStrategy ----
+
+void DirectStrategy::render(ClockEngine& engine, const ClockRect* rects, int count) {
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    lcd->startWrite();
+    for (int i = 0; i < count; i++) {
+        const ClockRect& r = rects[i];
+        lcd->setClipRect(r.x, r.y, r.w, r.h);
+        engine.getFace()->draw(lcd, 0, 0);
+        engine.drawOverlays(lcd, 0, 0);
+        lcd->clearClipRect();
+        engine.addPushedBytes(r.w * r.h * 2);
+    }
+    lcd->endWrite();
+}
+
+// ---- BandStrategy ----
+
+bool BandStrategy::begin(ClockEngine& engine) {
+    end();
+    band = createSprite(engine.getDisplay(), engine.getDisplay()->width(), bandRows);
+    return band != nullptr;
+}
+
+void BandStrategy::end() {
+    deleteSprite(band);
+}
+
+size_t BandStrategy::bufferBytes() const {
+    return band != nullptr ? (size_t)band->width() * band->height() * 2 : 0;
+}
+
+void BandStrategy::render(ClockEngine& engine, const ClockRect* rects, int count) {
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    lcd->startWrite();
+    for (int i = 0; i < count; i++) {
+        const ClockRect& r = rects[i];
+        for (int y = r.y; y < r.y + r.h; y += bandRows) {
+            // 帯の左上を画面の (r.x, y) として、文字盤・日付・針を重ねてから転送
+            ClockRect area = { 0, 0, r.w, r.y + r.h - y < bandRows ? r.y + r.h - y : bandRows };
+            restoreFace(engine.getFace(), band, area, r.x, y);
+            band->setClipRect(area.x, area.y, area.w, area.h);
+            engine.drawOverlays(band, r.x, y);
+            band->clearClipRect();
+            pushArea(lcd, band, area, r.x, y);
+            engine.addPushedBytes(area.w * area.h * 2);
+        }
+    }
+    lcd->endWrite();
+}
+
+// ---- DoubleBufferStrategy ----
+
+bool DoubleBufferStrategy::begin(ClockEngine& engine) {
+    end();
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    canvas = createSprite(lcd, lcd->width(), lcd->height());
+    if (canvas == nullptr) {
+        return false;
+    }
+    if (cacheBackground) {
+        background = createSprite(lcd, lcd->width(), lcd->height());
+        if (background == nullptr) {
+            end();
+            return false;
+        }
+        ClockRect all = engine.screenRect();
+        restoreFace(engine.getFace(), background, all, 0, 0);
+    }
+    return true;
+}
+
+void DoubleBufferStrategy::end() {
+    deleteSprite(canvas);
+    deleteSprite(background);
+}
+
+size_t DoubleBufferStrategy::bufferBytes() const {
+    size_t bytes = 0;
+    if (canvas != nullptr) bytes += (size_t)canvas->width() * canvas->height() * 2;
+    if (background != nullptr) bytes += (size_t)background->width() * background->height() * 2;
+    return bytes;
+}
+
+void DoubleBufferStrategy::render(ClockEngine& engine, const ClockRect* rects, int count) {
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    int stride = canvas->width();
+    uint16_t* dst = (uint16_t*)canvas->getBuffer();
+    lcd->startWrite();
+    for (int i = 0; i < count; i++) {
+        const ClockRect& r = rects[i];
+        // 該当する行だけ文字盤を復元（背景スプライトがあればコピー）
+        if (background != nullptr) {
+            const uint16_t* src = (const uint16_t*)background->getBuffer();
+            for (int row = r.y; row < r.y + r.h; row++) {
+                memcpy(dst + row * stride + r.x, src + row * stride + r.x, r.w * sizeof(uint16_t));
+            }
+        } else {
+            restoreFace(engine.getFace(), canvas, r, 0, 0);
+        }
+        // 領域内に掛かる他の針や日付も含めて描き直す
+        canvas->setClipRect(r.x, r.y, r.w, r.h);
+        engine.drawOverlays(canvas, 0, 0);
+        canvas->clearClipRect();
+        pushArea(lcd, canvas, r, 0, 0);
+        engine.addPushedBytes(r.w * r.h * 2);
+    }
+    lcd->endWrite();
+}
+
+// ---- SaveRestoreStrategy ----
+
+SaveRestoreStrategy::SaveRestoreStrategy(int scratchRows)
+    : work(nullptr), maxWork(0), scratch(nullptr), scratchRows(scratchRows) {
+    memset(saved, 0, sizeof(saved));
+}
+
+bool SaveRestoreStrategy::begin(ClockEngine& engine) {
+    static_assert(HANDS == ClockEngine::HAND_COUNT, "SaveRestoreStrategy::HANDS");
+    end();
+    for (int i = 0; i < HANDS; i++) {
+        SavedHand& hand = saved[i];
+        engine.handFootprintLimits(i, hand.maxSpans, hand.maxPixels);
+        hand.spans = (HandSpan*)malloc(hand.maxSpans * sizeof(HandSpan));
+        hand.pixels = (uint16_t*)malloc(hand.maxPixels * sizeof(uint16_t));
+        hand.position = -1;
+        hand.spanCount = -1;
+        hand.bounds = ClockRect{ 0, 0, 0, 0 };
+        if (hand.spans == nullptr || hand.pixels == nullptr) {
+            end();
+            return false;
+        }
+        if (hand.maxSpans > maxWork) {
+            maxWork = hand.maxSpans;
+        }
+    }
+    work = (HandSpan*)malloc(maxWork * sizeof(HandSpan));
+    if (work == nullptr) {
+        end();
+        return false;
+    }
+    // 行単位で展開できない文字盤だけ作業用スプライトを使う
+    uint16_t probe;
+    if (!engine.getFace()->decodeRow(0, 0, 1, &probe)) {
+        scratch = createSprite(engine.getDisplay(), engine.getDisplay()->width(), scratchRows);
+        if (scratch == nullptr) {
+            end();
+            return false;
+        }
+    }
+    return true;
+}
+
+void SaveRestoreStrategy::end() {
+    for (int i = 0; i < HANDS; i++) {
+        free(saved[i].spans);
+        free(saved[i].pixels);
+        saved[i].spans = nullptr;
+        saved[i].pixels = nullptr;
+        saved[i].maxSpans = 0;
+        saved[i].maxPixels = 0;
+        saved[i].spanCount = -1;
+    }
+    free(work);
+    work = nullptr;
+    maxWork = 0;
+    deleteSprite(scratch);
+}
+
+size_t SaveRestoreStrategy::bufferBytes() const {
+    size_t bytes = maxWork * sizeof(HandSpan);
+    for (int i = 0; i < HANDS; i++) {
+        bytes += saved[i].maxSpans * sizeof(HandSpan) + saved[i].maxPixels * sizeof(uint16_t);
+    }
+    if (scratch != nullptr) bytes += (size_t)scratch->width() * scratch->height() * 2;
+    return bytes;
+}
+
+// work の区間を針の新しい位置として、その下の文字盤の画素を退避
+void SaveRestoreStrategy::capture(ClockEngine& engine, int handIndex, int spanCount) {
+    SavedHand& hand = saved[handIndex];
+    hand.position = engine.handPosition(handIndex);
+    hand.bounds = engine.handBounds(handIndex);
+    hand.spanCount = -1;
+    if (spanCount < 0 || spanCount > hand.maxSpans) {
+        return;
+    }
+    int pixels = 0;
+    for (int i = 0; i < spanCount; i++) {
+        pixels += work[i].x1 - work[i].x0 + 1;
+    }
+    if (pixels > hand.maxPixels) {
+        return;
+    }
+    memcpy(hand.spans, work, spanCount * sizeof(HandSpan));
+    hand.spanCount = spanCount;
+    hand.pixelCount = pixels;
+
+    FaceRenderer* face = engine.getFace();
+    if (scratch == nullptr) {
+        uint16_t* dst = hand.pixels;
+        for (int i = 0; i < spanCount; i++) {
+            int w = work[i].x1 - work[i].x0 + 1;
+            face->decodeRow(work[i].y, work[i].x0, w, dst);
+            dst += w;
+        }
+        return;
+    }
+
+    // 外接矩形を scratchRows 行ずつ作業用スプライトに描いて、その行に掛かる区間を取り出す
+    const uint16_t* src = (const uint16_t*)scratch->getBuffer();
+    int stride = scratch->width();
+    for (int top = hand.bounds.y; top < hand.bounds.y + hand.bounds.h; top += scratchRows) {
+        scratch->setClipRect(hand.bounds.x, 0, hand.bounds.w, scratchRows);
+        face->draw(scratch, 0, top);
+        scratch->clearClipRect();
+        uint16_t* dst = hand.pixels;
+        for (int i = 0; i < spanCount; i++) {
+            int w = work[i].x1 - work[i].x0 + 1;
+            int row = work[i].y - top;
+            if (row >= 0 && row < scratchRows) {
+                memcpy(dst, src + row * stride + work[i].x0, w * sizeof(uint16_t));
+            }
+            dst += w;
+        }
+    }
+}
+
+// 退避した文字盤の画素を書き戻す
+void SaveRestoreStrategy::restore(ClockEngine& engine, const SavedHand& hand) {
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    if (hand.spanCount < 0) {
+        // 退避できなかった針は外接矩形を文字盤から描き直す
+        if (!hand.bounds.isEmpty()) {
+            lcd->setClipRect(hand.bounds.x, hand.bounds.y, hand.bounds.w, hand.bounds.h);
+            engine.getFace()->draw(lcd, 0, 0);
+            lcd->clearClipRect();
+            engine.addPushedBytes(hand.bounds.w * hand.bounds.h * 2);
+        }
+        return;
+    }
+    const uint16_t* src = hand.pixels;
+    for (int i = 0; i < hand.spanCount; i++) {
+        int w = hand.spans[i].x1 - hand.spans[i].x0 + 1;
+        lcd->pushImage(hand.spans[i].x0, hand.spans[i].y, w, 1, src);
+        src += w;
+    }
+    engine.addPushedBytes(hand.pixelCount * 2);
+}
+
+void SaveRestoreStrategy::render(ClockEngine& engine, const ClockRect* rects, int count) {
+    lgfx::LovyanGFX* lcd = engine.getDisplay();
+    ClockRect screen = engine.screenRect();
+    bool full = count == 1 && rects[0].x == screen.x && rects[0].y == screen.y &&
+                rects[0].w == screen.w && rects[0].h == screen.h;
+    lcd->startWrite();
+
+    if (full) {
+        engine.getFace()->draw(lcd, 0, 0);
+        engine.drawOverlays(lcd, 0, 0);
+        engine.addPushedBytes(screen.w * screen.h * 2);
+        for (int i = 0; i < HANDS; i++) {
+            capture(engine, i, engine.handFootprint(i, work, maxWork));
+        }
+        lcd->endWrite();
+        return;
+    }
+
+    // 日付などの文字は矩形ごとに文字盤から描き直す
+    for (int i = 0; i < count; i++) {
+        const ClockRect& r = rects[i];
+        lcd->setClipRect(r.x, r.y, r.w, r.h);
+        engine.getFace()->draw(lcd, 0, 0);
+        engine.drawOverlays(lcd, 0, 0);
+        lcd->clearClipRect();
+        engine.addPushedBytes(r.w * r.h * 2);
+    }
+
+    // 動いた針は前の位置を書き戻して新しい位置の下を退避
+    ClockRect dirty[HANDS];
+    int dirtyCount = 0;
+    for (int i = 0; i < HANDS; i++) {
+        SavedHand& hand = saved[i];
+        if (hand.position == engine.handPosition(i)) {
+            continue;
+        }
+        ClockRect previous = hand.bounds;
+        restore(engine, hand);
+        capture(engine, i, engine.handFootprint(i, work, maxWork));
+        dirty[dirtyCount++] = previous.unite(hand.bounds);
+    }
+
+    // 書き戻した範囲に掛かる文字・針・キャップを重ね直す（重なっていない画素は同じ値の上書き）
+    for (int i = 0; i < dirtyCount; i++) {
+        const ClockRect& r = dirty[i];
+        lcd->setClipRect(r.x, r.y, r.w, r.h);
+        engine.drawOverlays(lcd, 0, 0);
+        lcd->clearClipRect();
+        // 転送量は重ね直した針の画素数で数える
+        for (int h = 0; h < HANDS; h++) {
+            const SavedHand& other = saved[h];
+            if (other.bounds.intersects(r)) {
+                int pixels = other.spanCount >= 0 ? other.pixelCount : other.bounds.w * other.bounds.h;
+                engine.addPushedBytes(pixels * 2);
+            }
+        }
+    }
+    lcd->endWrite();
+}
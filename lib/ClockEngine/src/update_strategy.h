@@ -0,0 +1,133 @@
+#ifndef UPDATE_STRATEGY_H
+#define UPDATE_STRATEGY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <LovyanGFX.hpp>
+#include "clock_types.h"
+#include "hand_renderer.h"
+
+class ClockEngine;
+class FaceRenderer;
+
+// 変化した矩形をLCDに反映する方法
+// 必要なメモリと1フレームの描画時間・ちらつきの有無がそれぞれ異なるので、製品ごとに選ぶ。
+class UpdateStrategy {
+public:
+    virtual ~UpdateStrategy() {}
+
+    virtual const char* name() const = 0;
+
+    // 作業用のバッファを確保（失敗したらfalse）
+    virtual bool begin(ClockEngine& engine) = 0;
+    virtual void end() {}
+
+    // 確保しているRAM（bytes）
+    virtual size_t bufferBytes() const = 0;
+
+    // 矩形（画面座標、画面内に切り詰め済み）を文字盤から描き直して日付・針を重ねる
+    virtual void render(ClockEngine& engine, const ClockRect* rects, int count) = 0;
+
+    // 針の移動を自前で反映するか（trueなら針の範囲は rects に含まれず、針が動くと count が0でも呼ばれる）
+    virtual bool tracksHands() const { return false; }
+
+protected:
+    // 16bitスプライトの area（スプライト座標）に文字盤を復元
+    // スプライトの左上は画面座標の (originX, originY)。行単位で展開できない文字盤は図形で描く
+    static void restoreFace(FaceRenderer* face, LGFX_Sprite* dst, const ClockRect& area, int originX, int originY);
+
+    // スプライトの area を LCD の (x, y) に転送
+    static void pushArea(lgfx::LovyanGFX* lcd, LGFX_Sprite* src, const ClockRect& area, int x, int y);
+};
+
+// LCDに直接描く（作業用メモリなし）
+// 矩形ごとに文字盤を描き直してから針を描くので、描き換えの途中が一瞬見えることがある。
+class DirectStrategy : public UpdateStrategy {
+public:
+    const char* name() const override { return "direct"; }
+    bool begin(ClockEngine& engine) override { return true; }
+    size_t bufferBytes() const override { return 0; }
+    void render(ClockEngine& engine, const ClockRect* rects, int count) override;
+};
+
+// 画面幅 x bandRows 行の帯で合成して転送する（変化した矩形だけを帯ごとに処理）
+// 帯ごとに合成が終わってから転送するのでちらつかない。
+class BandStrategy : public UpdateStrategy {
+private:
+    LGFX_Sprite* band;
+    int bandRows;
+
+public:
+    explicit BandStrategy(int bandRows = 16) : band(nullptr), bandRows(bandRows) {}
+    ~BandStrategy() { end(); }
+
+    const char* name() const override { return "band"; }
+    bool begin(ClockEngine& engine) override;
+    void end() override;
+    size_t bufferBytes() const override;
+    void render(ClockEngine& engine, const ClockRect* rects, int count) override;
+};
+
+// 全画面のスプライトで合成して、変化した矩形だけを転送する
+// cacheBackground なら文字盤を描いた全画面スプライトをもう1枚持ち、復元をコピーで済ませる。
+class DoubleBufferStrategy : public UpdateStrategy {
+private:
+    LGFX_Sprite* canvas;
+    LGFX_Sprite* background;
+    bool cacheBackground;
+
+public:
+    explicit DoubleBufferStrategy(bool cacheBackground = true)
+        : canvas(nullptr), background(nullptr), cacheBackground(cacheBackground) {}
+    ~DoubleBufferStrategy() { end(); }
+
+    // 文字盤の全画面スプライトを持つか（begin() より前に設定）
+    void setCacheBackground(bool enable) { cacheBackground = enable; }
+
+    const char* name() const override { return cacheBackground ? "double+background" : "double"; }
+    bool begin(ClockEngine& engine) override;
+    void end() override;
+    size_t bufferBytes() const override;
+    void render(ClockEngine& engine, const ClockRect* rects, int count) override;
+};
+
+// 針ごとに下の文字盤の画素を退避しておき、針が動いたら退避した画素を書き戻してから新しい位置に描く
+// 針の形の画素だけを書き換えるので、全画面のスプライトなしでちらつかずに針を動かせる。
+// LCDは読み出せないので、退避する画素は文字盤から展開する（行単位で展開できない文字盤は
+// 画面幅 x scratchRows 行の作業用スプライトに描いて取り出す）。日付などの文字は DirectStrategy と同じ。
+class SaveRestoreStrategy : public UpdateStrategy {
+private:
+    static const int HANDS = 3;     // ClockEngine::HAND_COUNT
+
+    struct SavedHand {
+        int position;               // 退避した時の針の位置
+        HandSpan* spans;
+        int spanCount;              // 負なら退避できていない（外接矩形を文字盤から描き直す）
+        int maxSpans;
+        uint16_t* pixels;           // スプライトと同じバイト順
+        int pixelCount;
+        int maxPixels;
+        ClockRect bounds;
+    };
+    SavedHand saved[HANDS];
+    HandSpan* work;                 // 新しい位置の区間
+    int maxWork;
+    LGFX_Sprite* scratch;
+    int scratchRows;
+
+    void capture(ClockEngine& engine, int hand, int spanCount);
+    void restore(ClockEngine& engine, const SavedHand& hand);
+
+public:
+    explicit SaveRestoreStrategy(int scratchRows = 8);
+    ~SaveRestoreStrategy() { end(); }
+
+    const char* name() const override { return "save/restore"; }
+    bool begin(ClockEngine& engine) override;
+    void end() override;
+    size_t bufferBytes() const override;
+    void render(ClockEngine& engine, const ClockRect* rects, int count) override;
+    bool tracksHands() const override { return true; }
+};
+
+#endif // UPDATE_STRATEGY_H
@@ -0,0 +1,269 @@
+#include "power_manager.h"
+#include <sys/time.h>
+#include <esp_sleep.h>
+
+// 状態ごとの電流の目安（mA。ESP32のデータシートから。LCDとバックライトは含まない）
+static const float DEFAULT_MILLIAMPS[PowerManager::POWER_STATE_COUNT] = {
+    30.0f,      // POWER_ACTIVE: 80MHz で動作、無線なし
+    1.0f,       // POWER_SLEEP: ライトスリープ（バックライトのPWM用に RTC8M を動かしたまま）
+    110.0f,     // POWER_RADIO: 接続・受信中
+    70.0f       // POWER_WEB: 接続を保って待ち受け（モデムスリープ）
+};
+
+PowerManager::PowerManager(WiFiManager* wifi, SntpClient* sntp, WakeSource* touch)
+    : wifi(wifi), sntp(sntp), touch(touch), lowPower(false), radioOn(true), radioConnected(false), radioOnAt(0),
+      radioBackoff(false), radioRetryAt(0), radioRetryMs(RADIO_RETRY_MIN_MS), wakeLeadMs(WAKE_LEAD_MAX_MS),
+      webRequested(false), webUntil(0), webStarted(false), webReady(false), state(POWER_RADIO), stateSince(0),
+      timelineNext(0), timelineCount(0), wakeCount(0), failedWakeCount(0), lastConnectMs(0), sleepCount(0) {
+    for (int i = 0; i < POWER_STATE_COUNT; i++) {
+        residencyUs[i] = 0;
+        stateMilliamps[i] = DEFAULT_MILLIAMPS[i];
+    }
+}
+
+void PowerManager::begin(bool lowPower) {
+    this->lowPower = lowPower;
+    stateSince = micros();
+    radioOn = true;
+    radioConnected = wifi->isConnected();
+    webStarted = !lowPower;
+    setState(radioConnected ? (webStarted ? POWER_WEB : POWER_RADIO) : POWER_RADIO);
+    if (!lowPower) {
+        return;
+    }
+
+    setCpuFrequencyMhz(LOW_POWER_CPU_MHZ);
+
+    // ライトスリープ中もバックライトのPWMを止めない（LEDCのクロックに RTC8M を使う）
+    esp_sleep_pd_config(ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_ON);
+
+    // タッチでライトスリープから起きる
+    touch->enableWakeup();
+    Serial.printf("[Power] 省電力モード: CPU %lu MHz、無線は同期の時だけ入れます\n", (unsigned long)LOW_POWER_CPU_MHZ);
+}
+
+// 今の状態の時間を数える（micros() が一周しないように loop() ごとに呼ぶ）
+void PowerManager::account() {
+    uint32_t now = micros();
+    residencyUs[state] += now - stateSince;
+    stateSince = now;
+}
+
+void PowerManager::setState(PowerState next) {
+    if (next == state) {
+        return;
+    }
+    account();
+    state = next;
+    Transition& t = timeline[timelineNext];
+    t.at = millis();
+    t.state = next;
+    timelineNext = (timelineNext + 1) % TIMELINE_SIZE;
+    timelineCount++;
+}
+
+// 無線が要るか（入れている時は、次の同期まで十分に間がある時だけ止める）
+bool PowerManager::radioWanted(uint32_t now) {
+    if (webRequested) {
+        return true;
+    }
+    if (!sntp->isSynchronized() || sntp->getState() == SntpClient::STATE_ROUND) {
+        return true;
+    }
+    uint32_t untilSync = sntp->getMillisUntilNextSync();
+    return untilSync <= wakeLeadMs + (radioOn ? RADIO_OFF_MIN_MS : 0);
+}
+
+void PowerManager::handle() {
+    account();
+    if (!lowPower) {
+        // 無線はずっと入れている（Webサーバーは起動後にWiFiにつながった時に開いている）
+        setState(wifi->isConnected() ? POWER_WEB : POWER_RADIO);
+        return;
+    }
+
+    uint32_t now = millis();
+    if (webRequested && (int32_t)(now - webUntil) >= 0) {
+        webRequested = false;
+        closeWeb();
+    }
+    if (radioBackoff && (int32_t)(now - radioRetryAt) >= 0) {
+        radioBackoff = false;
+    }
+
+    bool wanted = radioWanted(now);
+    if (!radioOn) {
+        if (wanted && (webRequested || !radioBackoff)) {
+            turnRadioOn();
+        }
+    } else if (!radioConnected) {
+        if (wifi->isConnected()) {
+            // 次からは接続にかかった時間の2倍だけ前に無線を入れる
+            radioConnected = true;
+            lastConnectMs = now - radioOnAt;
+            wakeLeadMs = constrain(lastConnectMs * 2, WAKE_LEAD_MIN_MS, WAKE_LEAD_MAX_MS);
+            radioRetryMs = RADIO_RETRY_MIN_MS;
+            Serial.printf("[Power] 無線を入れて %lu ms で接続しました\n", (unsigned long)lastConnectMs);
+        } else if (!webRequested && now - radioOnAt > RADIO_TIMEOUT_MS) {
+            // つながらない。無線を止めて、時間を空けてから入れ直す
+            failedWakeCount++;
+            radioBackoff = true;
+            radioRetryAt = now + radioRetryMs;
+            Serial.printf("[Power] 接続できないので無線を止めます（%lu 秒後に再試行）\n", (unsigned long)(radioRetryMs / 1000));
+            radioRetryMs = radioRetryMs * 2 > RADIO_RETRY_MAX_MS ? RADIO_RETRY_MAX_MS : radioRetryMs * 2;
+            turnRadioOff();
+        }
+    } else if (!wanted) {
+        turnRadioOff();
+    }
+
+    if (radioConnected && webRequested && !webStarted) {
+        openWeb();
+    }
+    setState(!radioOn ? POWER_ACTIVE : (webStarted ? POWER_WEB : POWER_RADIO));
+}
+
+void PowerManager::turnRadioOn() {
+    wifi->radioOn();
+    radioOn = true;
+    radioConnected = false;
+    radioOnAt = millis();
+    wakeCount++;
+}
+
+void PowerManager::turnRadioOff() {
+    closeWeb();
+    wifi->radioOff();
+    radioOn = false;
+    radioConnected = false;
+}
+
+void PowerManager::openWeb() {
+    wifi->setupOTA();
+    webStarted = true;
+    webReady = true;
+}
+
+void PowerManager::closeWeb() {
+    if (webStarted) {
+        wifi->stopWebServer();
+        webStarted = false;
+    }
+}
+
+void PowerManager::requestWeb() {
+    if (!lowPower) {
+        // 無線もWebサーバーもずっと開いている
+        webReady = true;
+        return;
+    }
+    // 開いているなら時間を延ばしてすぐに知らせる。閉じていれば handle() で無線を入れて開く
+    webRequested = true;
+    webUntil = millis() + WEB_WINDOW_MS;
+    if (webStarted) {
+        webReady = true;
+    }
+}
+
+void PowerManager::resumeAfterSetup() {
+    if (!lowPower) {
+        return;
+    }
+    // 無線は入っていて、Webサーバーも開いている（接続は handle() で確かめる）
+    radioOn = true;
+    radioConnected = false;
+    radioOnAt = millis();
+    radioBackoff = false;
+    webStarted = true;
+    webRequested = true;
+    webUntil = millis() + WEB_WINDOW_MS;
+}
+
+bool PowerManager::takeWebReady() {
+    bool result = webReady;
+    webReady = false;
+    return result;
+}
+
+void PowerManager::idle() {
+    if (!lowPower || radioOn || touch->isBusy()) {
+        return;
+    }
+
+    // 次の秒（針を描き直す時刻）まで。無線を入れる時刻は過ぎない
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    uint32_t sleepMs = 1000 - tv.tv_usec / 1000;
+    uint32_t untilSync = sntp->getMillisUntilNextSync();
+    if (untilSync != UINT32_MAX) {
+        uint32_t untilWake = untilSync > wakeLeadMs ? untilSync - wakeLeadMs : 0;
+        if (untilWake < sleepMs) {
+            sleepMs = untilWake;
+        }
+    }
+    if (sleepMs < MIN_SLEEP_MS) {
+        return;
+    }
+
+    setState(POWER_SLEEP);
+    Serial.flush(); // 送りきらないうちに眠るとシリアル出力が途切れる
+    esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000);
+    esp_light_sleep_start();
+    sleepCount++;
+    setState(POWER_ACTIVE);
+}
+
+const char* PowerManager::getStateName(PowerState target) {
+    switch (target) {
+    case POWER_ACTIVE: return "active";
+    case POWER_SLEEP: return "sleep";
+    case POWER_RADIO: return "radio";
+    case POWER_WEB: return "web";
+    default: return "?";
+    }
+}
+
+uint32_t PowerManager::getResidencyMillis(PowerState target) {
+    account();
+    return (uint32_t)(residencyUs[target] / 1000);
+}
+
+float PowerManager::getAverageMilliamps() {
+    account();
+    double charge = 0.0;
+    uint64_t total = 0;
+    for (int i = 0; i < POWER_STATE_COUNT; i++) {
+        charge += (double)residencyUs[i] * stateMilliamps[i];
+        total += residencyUs[i];
+    }
+    return total > 0 ? (float)(charge / total) : 0.0f;
+}
+
+void PowerManager::logStats() {
+    Serial.printf("[Power] 状態: %s, 時間: active %lu ms, sleep %lu ms, radio %lu ms, web %lu ms, 平均 %.1f mA（推定）, "
+                  "無線 %lu 回 (失敗 %lu 回, 接続 %lu ms, %lu ms 前に入れる), スリープ %lu 回\n",
+                  getStateName(state), (unsigned long)getResidencyMillis(POWER_ACTIVE),
+                  (unsigned long)getResidencyMillis(POWER_SLEEP), (unsigned long)getResidencyMillis(POWER_RADIO),
+                  (unsigned long)getResidencyMillis(POWER_WEB), getAverageMilliamps(), (unsigned long)wakeCount,
+                  (unsigned long)failedWakeCount, (unsigned long)lastConnectMs, (unsigned long)wakeLeadMs,
+                  (unsigned long)sleepCount);
+
+    if (timelineCount == 0) {
+        return;
+    }
+    // 前回以降の遷移（時刻 millis と遷移した先の状態）
+    char line[TIMELINE_SIZE * 18 + 48];
+    int length = 0;
+    int count = timelineCount < (uint32_t)TIMELINE_SIZE ? (int)timelineCount : TIMELINE_SIZE;
+    if (timelineCount > (uint32_t)TIMELINE_SIZE) {
+        length += snprintf(line + length, sizeof(line) - length, " (古い %lu 件は省略)",
+                           (unsigned long)(timelineCount - TIMELINE_SIZE));
+    }
+    for (int i = 0; i < count; i++) {
+        const Transition& t = timeline[(timelineNext - count + i + TIMELINE_SIZE) % TIMELINE_SIZE];
+        length += snprintf(line + length, sizeof(line) - length, " %lu:%s", (unsigned long)t.at,
+                           getStateName((PowerState)t.state));
+    }
+    Serial.printf("[Power] 遷移:%s\n", line);
+    timelineCount = 0;
+}
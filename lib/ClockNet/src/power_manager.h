@@ -0,0 +1,135 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "wifi_manager.h"
+#include "sntp_client.h"
+#include "wake_source.h"
+
+// 電源の管理（loop() の通常モードから handle() と idle() を呼ぶ）
+// 省電力モードでは、時刻の同期の時だけ無線を入れ、それ以外は止める。次に無線を入れる時刻は
+// SntpClient の次の同期（周波数のずれが分かるほど間隔が伸びる）から、接続にかかった時間だけ前にする。
+// Web・OTAのサーバーはタッチで requestWeb() された時だけ WEB_WINDOW_MS の間開く。
+// 無線を止めている間は、次の秒（針を描き直す時刻）までライトスリープで待つ（タッチでも起きる）。
+// どちらのモードでも状態ごとの時間と遷移を記録するので、状態ごとの電流から平均の電流を求められる。
+class PowerManager {
+public:
+    // 電源の状態
+    enum PowerState {
+        POWER_ACTIVE,       // CPUが動いている（無線は止めている）
+        POWER_SLEEP,        // ライトスリープ（無線は止めている）
+        POWER_RADIO,        // 無線を入れている（接続中・同期中）
+        POWER_WEB,          // 無線を入れてWebサーバーを開いている
+        POWER_STATE_COUNT
+    };
+
+    // 状態の遷移（時刻は millis）
+    struct Transition {
+        uint32_t at;
+        uint8_t state;
+    };
+
+    // 省電力モードのCPUクロック（MHz。無線を使うので80より下げない）
+    static const uint32_t LOW_POWER_CPU_MHZ = 80;
+
+    // タッチで開いたWebサーバーを閉じるまでの時間
+    static const uint32_t WEB_WINDOW_MS = 300000;
+
+    // 無線を入れてから接続を待つ上限と、接続できなかった時の再試行（失敗するたびに2倍）
+    static const uint32_t RADIO_TIMEOUT_MS = 20000;
+    static const uint32_t RADIO_RETRY_MIN_MS = 60000;
+    static const uint32_t RADIO_RETRY_MAX_MS = 3600000;
+
+    // 次の同期までこれより短ければ無線を止めない
+    static const uint32_t RADIO_OFF_MIN_MS = 30000;
+
+    // 接続にかかる時間の見込み（最初の値と範囲。実際にかかった時間の2倍にする）
+    static const uint32_t WAKE_LEAD_MIN_MS = 2000;
+    static const uint32_t WAKE_LEAD_MAX_MS = 15000;
+
+    // これより短い待ち時間ではライトスリープしない
+    static const uint32_t MIN_SLEEP_MS = 5;
+
+    static const int TIMELINE_SIZE = 32;
+
+private:
+    WiFiManager* wifi;
+    SntpClient* sntp;
+    WakeSource* touch;
+    bool lowPower;
+
+    // 無線
+    bool radioOn;
+    bool radioConnected;
+    uint32_t radioOnAt;            // 無線を入れた時刻（millis）
+    bool radioBackoff;             // 接続できなかったので radioRetryAt まで無線を入れない
+    uint32_t radioRetryAt;
+    uint32_t radioRetryMs;
+    uint32_t wakeLeadMs;           // 次の同期のこれだけ前に無線を入れる
+
+    // Webサーバー
+    bool webRequested;
+    uint32_t webUntil;             // この時刻にWebサーバーを閉じる（millis）
+    bool webStarted;               // Webサーバーを開いている
+    bool webReady;                 // 開いたので知らせる（takeWebReady() で取得してリセット）
+
+    // 状態ごとの時間と遷移
+    PowerState state;
+    uint32_t stateSince;           // 最後に時間を数えた時刻（micros）
+    uint64_t residencyUs[POWER_STATE_COUNT];
+    float stateMilliamps[POWER_STATE_COUNT];
+    Transition timeline[TIMELINE_SIZE];
+    int timelineNext;              // 次に書く位置
+    uint32_t timelineCount;        // 前回の logStats() 以降の遷移の数（TIMELINE_SIZE を超えた分は古い方から消える）
+
+    // 統計
+    uint32_t wakeCount;
+    uint32_t failedWakeCount;
+    uint32_t lastConnectMs;
+    uint32_t sleepCount;
+
+    void setState(PowerState next);
+    void account();
+    void turnRadioOn();
+    void turnRadioOff();
+    void openWeb();
+    void closeWeb();
+    bool radioWanted(uint32_t now);
+
+public:
+    PowerManager(WiFiManager* wifi, SntpClient* sntp, WakeSource* touch);
+
+    // 始める（lowPower が false なら無線は入れたままで、状態の記録だけを行う）
+    void begin(bool lowPower);
+    bool isLowPower() { return lowPower; }
+
+    // 無線を入れる・止める（loop() から毎回呼ぶ。待たずにすぐ戻る）
+    void handle();
+
+    // 次に描き直すまでライトスリープで待つ（loop() の最後に呼ぶ。無線を入れている時やタッチ中はすぐ戻る）
+    void idle();
+
+    // 設定モードから戻った時に呼ぶ（設定モードの間は handle() を呼ばず、無線とWebサーバーは WiFiManager が入れている）
+    // 省電力モードでは、そのまま WEB_WINDOW_MS の間Webサーバーを開いておき、その後は同期の時だけ無線を入れる
+    void resumeAfterSetup();
+
+    // Webサーバーを開く（タッチした時。開いたら takeWebReady() が true を返す）
+    void requestWeb();
+    bool takeWebReady();
+
+    // 状態ごとの電流（mA）を設定する（初期値はデータシートの目安。LCDとバックライトは含まない）
+    void setStateMilliamps(PowerState target, float milliamps) { stateMilliamps[target] = milliamps; }
+
+    // 状態
+    PowerState getState() { return state; }
+    static const char* getStateName(PowerState target);
+
+    // 起動してからの状態ごとの時間（ms）と、それから求めた平均の電流（mA）
+    uint32_t getResidencyMillis(PowerState target);
+    float getAverageMilliamps();
+
+    // 状態ごとの時間・平均の電流と、前回呼び出し以降の遷移をシリアルに出力
+    void logStats();
+};
+
+#endif // POWER_MANAGER_H
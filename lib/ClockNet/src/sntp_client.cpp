@@ -0,0 +1,555 @@
+#include "sntp_client.h"
+#include <sys/time.h>
+#include <math.h>
+#include <string.h>
+#include <lwip/dns.h>
+
+static const uint16_t NTP_PORT = 123;
+static const int NTP_PACKET_SIZE = 48;
+static const uint32_t NTP_UNIX_DELTA = 2208988800UL;    // 1900年から1970年までの秒数
+
+// これより基準時計から遠いサーバーは使わない（us）
+static const int32_t MAX_ROOT_DISTANCE_US = 1500000;
+
+// 重みの下限（往復時間が極端に短いサーバーに偏りすぎないように）
+static const int32_t MIN_DISTANCE_US = 1000;
+
+enum DnsState {
+    DNS_NONE,
+    DNS_PENDING,
+    DNS_DONE,
+    DNS_FAILED
+};
+
+// 今の時刻（us、UNIX時刻）
+static int64_t nowMicros() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// UNIX時刻（us）と NTP の64ビット時刻の変換（2036年以降は最上位ビットが0になる）
+static void toNtpTime(int64_t unixUs, uint32_t& sec, uint32_t& frac) {
+    sec = (uint32_t)(unixUs / 1000000 + NTP_UNIX_DELTA);
+    frac = (uint32_t)(((uint64_t)(unixUs % 1000000) << 32) / 1000000);
+}
+
+static int64_t fromNtpTime(uint32_t sec, uint32_t frac) {
+    int64_t seconds = (sec & 0x80000000UL) ? (int64_t)sec - NTP_UNIX_DELTA
+                                           : (int64_t)sec + 0x100000000LL - NTP_UNIX_DELTA;
+    return seconds * 1000000 + (int64_t)(((uint64_t)frac * 1000000) >> 32);
+}
+
+static uint32_t read32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void write32(uint8_t* p, uint32_t value) {
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+// NTP の32ビット（16.16）の秒を us に
+static int32_t shortToMicros(uint32_t value) {
+    return (int32_t)(((uint64_t)value * 1000000) >> 16);
+}
+
+static int32_t clampMicros(int64_t us) {
+    if (us > INT32_MAX) return INT32_MAX;
+    if (us < -INT32_MAX) return -INT32_MAX;
+    return (int32_t)us;
+}
+
+static int64_t absMicros(int64_t us) {
+    return us < 0 ? -us : us;
+}
+
+// 時計を少しずつ合わせる（まだ合わせていない分に足す）
+static void slewClock(int64_t us) {
+    struct timeval remaining;
+    if (adjtime(nullptr, &remaining) == 0) {
+        us += (int64_t)remaining.tv_sec * 1000000 + remaining.tv_usec;
+    }
+    struct timeval delta;
+    delta.tv_sec = (time_t)(us / 1000000);
+    delta.tv_usec = (suseconds_t)(us % 1000000);
+    adjtime(&delta, nullptr);
+}
+
+// DNSの応答（lwIP のタスクから呼ばれる）
+static void onDnsFound(const char* name, const ip_addr_t* address, void* arg) {
+    SntpClient::Server* server = (SntpClient::Server*)arg;
+    if (address != nullptr && IP_IS_V4(address)) {
+        server->address = IPAddress(ip4_addr_get_u32(ip_2_ip4(address)));
+        server->dnsState = DNS_DONE;
+    } else {
+        server->dnsState = DNS_FAILED;
+    }
+}
+
+SntpClient::SntpClient()
+    : serverCount(0), state(STATE_STOPPED), samplesPerServer(MAX_SAMPLES), roundStartedAt(0), nextRoundAt(0),
+      failedRounds(0), synchronized(false), clockChanged(false), freqKnown(false), freqPpm(0.0f), freqCarryUs(0.0f),
+      lastFreqApplyAt(0), lastUpdateAt(0), pollS(MIN_POLL_S), lastOffsetUs(0), lastDelayUs(0), lastJitterUs(0),
+      lastServerCount(0), rounds(0), steps(0), queries(0), replies(0), radioMs(0), lastRoundMs(0) {
+    for (int i = 0; i < MAX_SERVERS; i++) {
+        servers[i] = Server();
+    }
+}
+
+void SntpClient::setServers(const char* list) {
+    // 問い合わせ中なら打ち切って、新しいサーバーでやり直す
+    if (state == STATE_ROUND) {
+        udp.stop();
+        state = STATE_WAITING;
+    }
+    for (int i = 0; i < MAX_SERVERS; i++) {
+        servers[i] = Server();
+    }
+    serverCount = 0;
+    const char* p = list;
+    while (*p != '\0' && serverCount < MAX_SERVERS) {
+        while (*p == ' ' || *p == ',') p++;
+        const char* end = p;
+        while (*end != '\0' && *end != ',' && *end != ' ') end++;
+        size_t length = end - p;
+        if (length > 0 && length < sizeof(servers[0].name)) {
+            memcpy(servers[serverCount].name, p, length);
+            servers[serverCount].name[length] = '\0';
+            serverCount++;
+        }
+        p = end;
+    }
+    requestSync();
+}
+
+void SntpClient::begin() {
+    state = STATE_WAITING;
+    nextRoundAt = millis();
+    lastFreqApplyAt = millis();
+}
+
+void SntpClient::stop() {
+    if (state == STATE_ROUND) {
+        udp.stop();
+    }
+    state = STATE_STOPPED;
+}
+
+void SntpClient::requestSync() {
+    if (state == STATE_WAITING) {
+        nextRoundAt = millis();
+    }
+}
+
+uint32_t SntpClient::getMillisUntilNextSync() {
+    if (state == STATE_STOPPED) {
+        return UINT32_MAX;
+    }
+    if (state == STATE_ROUND) {
+        return 0;
+    }
+    int32_t remaining = (int32_t)(nextRoundAt - millis());
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+void SntpClient::scheduleNext(uint32_t seconds) {
+    nextRoundAt = millis() + seconds * 1000;
+    state = STATE_WAITING;
+}
+
+bool SntpClient::handle() {
+    if (state == STATE_STOPPED) {
+        return false;
+    }
+    uint32_t now = millis();
+    applyFrequency(now);
+
+    if (state == STATE_WAITING) {
+        if ((int32_t)(now - nextRoundAt) < 0 || serverCount == 0 || WiFi.status() != WL_CONNECTED) {
+            return false;
+        }
+        startRound();
+    }
+
+    receiveReplies();
+
+    // 送る・待つ（まだ問い合わせの残っているサーバーがあればラウンドを続ける）
+    bool active = false;
+    now = millis();
+    for (int i = 0; i < serverCount; i++) {
+        Server& server = servers[i];
+        if (server.disabled || server.dnsState == DNS_FAILED) {
+            continue;
+        }
+        if (server.dnsState != DNS_DONE) {
+            if (now - roundStartedAt > DNS_TIMEOUT_MS) {
+                server.dnsState = DNS_FAILED;
+            } else {
+                active = true;
+            }
+            continue;
+        }
+        if (server.waiting) {
+            if (now - server.sentAt <= REPLY_TIMEOUT_MS) {
+                active = true;
+                continue;
+            }
+            server.waiting = false;         // 応答が来なかった
+        }
+        if (server.sent < samplesPerServer) {
+            if (server.sent == 0 || now - server.sentAt >= QUERY_SPACING_MS) {
+                sendQuery(server);
+            }
+            active = true;
+        }
+    }
+    if (!active) {
+        finishRound();
+    }
+
+    bool changed = clockChanged;
+    clockChanged = false;
+    return changed;
+}
+
+void SntpClient::startRound() {
+    roundStartedAt = millis();
+    state = STATE_ROUND;
+    udp.begin(0);
+
+    // 周波数のずれが分かって間隔が伸びてからは問い合わせを減らす
+    samplesPerServer = (freqKnown && pollS > MIN_POLL_S) ? 2 : MAX_SAMPLES;
+
+    for (int i = 0; i < serverCount; i++) {
+        Server& server = servers[i];
+        server.sent = 0;
+        server.sampleCount = 0;
+        server.waiting = false;
+        if (server.disabled) {
+            continue;
+        }
+        // 名前は毎回引き直す（同じ名前で複数のサーバーを持つプールもある。lwIP がキャッシュしている間は問い合わせない）
+        ip_addr_t address;
+        server.dnsState = DNS_PENDING;
+        err_t err = dns_gethostbyname(server.name, &address, onDnsFound, &server);
+        if (err == ERR_OK) {
+            server.address = IPAddress(ip4_addr_get_u32(ip_2_ip4(&address)));
+            server.dnsState = DNS_DONE;
+        } else if (err != ERR_INPROGRESS) {
+            server.dnsState = DNS_FAILED;
+        }
+    }
+}
+
+void SntpClient::sendQuery(Server& server) {
+    uint8_t packet[NTP_PACKET_SIZE];
+    memset(packet, 0, sizeof(packet));
+    packet[0] = (0 << 6) | (4 << 3) | 3;    // LI=0, バージョン4, クライアント
+
+    server.t1 = nowMicros();
+    toNtpTime(server.t1, server.transmitSec, server.transmitFrac);
+    write32(packet + 40, server.transmitSec);
+    write32(packet + 44, server.transmitFrac);
+
+    udp.beginPacket(server.address, NTP_PORT);
+    udp.write(packet, sizeof(packet));
+    udp.endPacket();
+
+    server.sent++;
+    server.sentAt = millis();
+    server.waiting = true;
+    queries++;
+}
+
+void SntpClient::receiveReplies() {
+    while (udp.parsePacket() > 0) {
+        int64_t t4 = nowMicros();
+        uint8_t packet[NTP_PACKET_SIZE];
+        int length = udp.read(packet, sizeof(packet));
+        processReply(packet, length, t4, udp.remoteIP());
+    }
+}
+
+void SntpClient::processReply(const uint8_t* packet, int length, int64_t t4, const IPAddress& from) {
+    if (length < NTP_PACKET_SIZE) {
+        return;
+    }
+
+    // 待っているサーバーで、送った時刻がそのまま返ってきたものだけを使う
+    Server* server = nullptr;
+    for (int i = 0; i < serverCount; i++) {
+        Server& candidate = servers[i];
+        if (candidate.waiting && candidate.address == from &&
+            read32(packet + 24) == candidate.transmitSec && read32(packet + 28) == candidate.transmitFrac) {
+            server = &candidate;
+            break;
+        }
+    }
+    if (server == nullptr) {
+        return;
+    }
+    server->waiting = false;
+    replies++;
+
+    uint8_t leap = packet[0] >> 6;
+    uint8_t version = (packet[0] >> 3) & 7;
+    uint8_t mode = packet[0] & 7;
+    uint8_t stratum = packet[1];
+    if (mode != 4 || version < 3) {
+        return;
+    }
+    if (stratum == 0) {
+        // Kiss-o'-Death（DENY・RSTR なら以後問い合わせない。RATE ならこのラウンドはやめる）
+        if (memcmp(packet + 12, "DENY", 4) == 0 || memcmp(packet + 12, "RSTR", 4) == 0) {
+            server->disabled = true;
+            Serial.printf("[DEBUG] NTPサーバー %s に問い合わせを断られました\n", server->name);
+        } else {
+            server->sent = samplesPerServer;
+        }
+        return;
+    }
+    if (leap == 3 || stratum > 15) {
+        return;                             // サーバーが同期していない
+    }
+    uint32_t transmitSec = read32(packet + 40);
+    if (transmitSec == 0) {
+        return;
+    }
+    int32_t rootDistance = shortToMicros(read32(packet + 4)) / 2 + shortToMicros(read32(packet + 8));
+    if (rootDistance > MAX_ROOT_DISTANCE_US) {
+        return;
+    }
+
+    int64_t t2 = fromNtpTime(read32(packet + 32), read32(packet + 36));
+    int64_t t3 = fromNtpTime(transmitSec, read32(packet + 44));
+    int64_t offset = ((t2 - server->t1) + (t3 - t4)) / 2;
+    int64_t delay = (t4 - server->t1) - (t3 - t2);
+    if (delay < 0) {
+        delay = 0;
+    }
+
+    if (server->sampleCount < MAX_SAMPLES) {
+        server->offsetUs[server->sampleCount] = offset;
+        server->delayUs[server->sampleCount] = clampMicros(delay);
+        server->sampleCount++;
+    }
+    server->rootDistanceUs = rootDistance;
+
+    // まだ合わせていなければ、一致する応答が2つそろったところですぐに合わせる（時計を早く表示するため）
+    if (!synchronized) {
+        stepOnAgreement();
+    }
+}
+
+// 応答の誤差の範囲（往復時間の半分と、サーバーから基準時計までの距離）
+static int64_t sampleDistance(const SntpClient::Server& server, int index) {
+    int64_t distance = server.delayUs[index] / 2 + server.rootDistanceUs;
+    return distance < MIN_DISTANCE_US ? MIN_DISTANCE_US : distance;
+}
+
+// 最初の同期
+// 1つだけの応答は片道だけが遅れたものや、時刻のおかしなサーバーのものかもしれないので、
+// 誤差の範囲が重なる2つの応答（同じサーバーでもよい）がそろうまで待ち、そのうち往復時間が短い方で合わせる。
+// そろわないままラウンドが終わったら、finishRound() で失敗として再試行する。
+bool SntpClient::stepOnAgreement() {
+    int64_t bestOffset = 0;
+    int32_t bestDelay = INT32_MAX;
+    for (int a = 0; a < serverCount; a++) {
+        const Server& first = servers[a];
+        for (int i = 0; i < first.sampleCount; i++) {
+            for (int b = a; b < serverCount; b++) {
+                const Server& second = servers[b];
+                for (int j = (b == a ? i + 1 : 0); j < second.sampleCount; j++) {
+                    if (absMicros(first.offsetUs[i] - second.offsetUs[j]) > sampleDistance(first, i) + sampleDistance(second, j)) {
+                        continue;
+                    }
+                    bool useFirst = first.delayUs[i] <= second.delayUs[j];
+                    int32_t delay = useFirst ? first.delayUs[i] : second.delayUs[j];
+                    if (delay < bestDelay) {
+                        bestDelay = delay;
+                        bestOffset = useFirst ? first.offsetUs[i] : second.offsetUs[j];
+                    }
+                }
+            }
+        }
+    }
+    if (bestDelay == INT32_MAX) {
+        return false;
+    }
+    lastDelayUs = bestDelay;
+    stepClock(bestOffset);
+    return true;
+}
+
+// 時計を進める・戻す（合わせる前に測ったずれは使えなくなるので捨てる）
+void SntpClient::stepClock(int64_t offsetUs) {
+    int64_t target = nowMicros() + offsetUs;
+    struct timeval tv;
+    tv.tv_sec = (time_t)(target / 1000000);
+    tv.tv_usec = (suseconds_t)(target % 1000000);
+    settimeofday(&tv, nullptr);
+
+    for (int i = 0; i < serverCount; i++) {
+        servers[i].sampleCount = 0;
+        servers[i].waiting = false;
+    }
+    synchronized = true;
+    clockChanged = true;
+    lastUpdateAt = millis();
+    lastOffsetUs = clampMicros(offsetUs);
+    steps++;
+    Serial.printf("[DEBUG] NTP: 時計を %ld ms 合わせました\n", (long)(offsetUs / 1000));
+}
+
+// 求めた周波数のずれを少しずつ補正する
+void SntpClient::applyFrequency(uint32_t now) {
+    uint32_t elapsed = now - lastFreqApplyAt;
+    if (elapsed < FREQ_APPLY_MS) {
+        return;
+    }
+    lastFreqApplyAt = now;
+    if (!freqKnown) {
+        return;
+    }
+    freqCarryUs += freqPpm * elapsed / 1000.0f;     // ppm × 秒 = us
+    int32_t us = (int32_t)freqCarryUs;
+    if (us != 0) {
+        freqCarryUs -= us;
+        slewClock(us);
+    }
+}
+
+void SntpClient::finishRound() {
+    udp.stop();
+    uint32_t now = millis();
+    lastRoundMs = now - roundStartedAt;
+    radioMs += lastRoundMs;
+    rounds++;
+
+    // サーバーごとに往復時間が一番短い応答を選ぶ（クロックフィルタ）
+    struct Candidate {
+        int64_t offset;
+        int32_t delay;
+        int32_t jitter;
+        int32_t distance;
+    };
+    Candidate candidates[MAX_SERVERS];
+    int count = 0;
+    for (int i = 0; i < serverCount; i++) {
+        const Server& server = servers[i];
+        if (server.sampleCount == 0) {
+            continue;
+        }
+        int best = 0;
+        for (int j = 1; j < server.sampleCount; j++) {
+            if (server.delayUs[j] < server.delayUs[best]) {
+                best = j;
+            }
+        }
+        float sum = 0.0f;
+        for (int j = 0; j < server.sampleCount; j++) {
+            float diff = (float)(server.offsetUs[j] - server.offsetUs[best]);
+            sum += diff * diff;
+        }
+        Candidate& c = candidates[count++];
+        c.offset = server.offsetUs[best];
+        c.delay = server.delayUs[best];
+        c.jitter = server.sampleCount > 1 ? (int32_t)sqrtf(sum / (server.sampleCount - 1)) : 0;
+        c.distance = c.delay / 2 + server.rootDistanceUs + c.jitter;
+        if (c.distance < MIN_DISTANCE_US) {
+            c.distance = MIN_DISTANCE_US;
+        }
+    }
+
+    // 応答がなかった、または最初の同期で一致する応答がそろわなかった
+    if (count == 0 || !synchronized) {
+        failedRounds++;
+        uint32_t retry = RETRY_MIN_S << (failedRounds < 5 ? failedRounds - 1 : 4);
+        if (retry > MIN_POLL_S) {
+            retry = MIN_POLL_S;
+        }
+        Serial.printf("[DEBUG] NTP同期失敗（%lu ms）。%lu 秒後に再試行します\n", (unsigned long)lastRoundMs, (unsigned long)retry);
+        scheduleNext(retry);
+        return;
+    }
+
+    // 食い違うサーバーを除く（3つ以上なら中央のサーバーと、2つなら互いに、それぞれの誤差の範囲で重ならないもの）
+    bool keep[MAX_SERVERS];
+    for (int i = 0; i < count; i++) {
+        keep[i] = true;
+    }
+    if (count >= 3) {
+        int order[MAX_SERVERS];
+        for (int i = 0; i < count; i++) order[i] = i;
+        for (int i = 1; i < count; i++) {
+            for (int j = i; j > 0 && candidates[order[j]].offset < candidates[order[j - 1]].offset; j--) {
+                int t = order[j]; order[j] = order[j - 1]; order[j - 1] = t;
+            }
+        }
+        const Candidate& median = candidates[order[count / 2]];
+        for (int i = 0; i < count; i++) {
+            keep[i] = absMicros(candidates[i].offset - median.offset) <= (int64_t)candidates[i].distance + median.distance;
+        }
+    } else if (count == 2) {
+        if (absMicros(candidates[0].offset - candidates[1].offset) > (int64_t)candidates[0].distance + candidates[1].distance) {
+            keep[candidates[0].distance <= candidates[1].distance ? 1 : 0] = false;
+        }
+    }
+
+    // 残ったサーバーを距離の逆数で重み付けして平均する
+    double weightSum = 0.0;
+    double offsetSum = 0.0;
+    int bestIndex = -1;
+    int used = 0;
+    for (int i = 0; i < count; i++) {
+        if (!keep[i]) {
+            continue;
+        }
+        double weight = 1.0 / candidates[i].distance;
+        weightSum += weight;
+        offsetSum += weight * (double)candidates[i].offset;
+        if (bestIndex < 0 || candidates[i].distance < candidates[bestIndex].distance) {
+            bestIndex = i;
+        }
+        used++;
+    }
+    int64_t offset = (int64_t)(offsetSum / weightSum);
+    lastDelayUs = candidates[bestIndex].delay;
+    lastJitterUs = candidates[bestIndex].jitter;
+    lastServerCount = used;
+    failedRounds = 0;
+
+    if (absMicros(offset) > STEP_THRESHOLD_US) {
+        stepClock(offset);
+        pollS = MIN_POLL_S;
+    } else {
+        // 前に合わせてから残ったずれは周波数のずれによるもの（us / 秒 = ppm）
+        float interval = (now - lastUpdateAt) / 1000.0f;
+        if (interval >= MIN_POLL_S / 2) {
+            float measured = (float)offset / interval;
+            freqPpm += freqKnown ? measured * interval / (interval + FLL_TAU_S) : measured;
+            if (freqPpm > MAX_FREQ_PPM) freqPpm = MAX_FREQ_PPM;
+            if (freqPpm < -MAX_FREQ_PPM) freqPpm = -MAX_FREQ_PPM;
+            freqKnown = true;
+        }
+        slewClock(offset);
+        lastOffsetUs = clampMicros(offset);
+        lastUpdateAt = now;
+        clockChanged = true;
+
+        // ずれが小さければ間隔を伸ばし、大きければ縮める
+        if (freqKnown && absMicros(offset) < POLL_INCREASE_US && pollS < MAX_POLL_S) {
+            pollS *= 2;
+        } else if (absMicros(offset) > POLL_DECREASE_US && pollS > MIN_POLL_S) {
+            pollS /= 2;
+        }
+    }
+
+    Serial.printf("[DEBUG] NTP同期: ずれ %ld us, 往復 %ld us, ばらつき %ld us, サーバー %d/%d, 周波数 %.2f ppm, %lu ms, 次回 %lu 秒後\n",
+                  (long)lastOffsetUs, (long)lastDelayUs, (long)lastJitterUs, used, serverCount,
+                  freqPpm, (unsigned long)lastRoundMs, (unsigned long)pollS);
+    scheduleNext(pollS);
+}
@@ -0,0 +1,148 @@
+#ifndef SNTP_CLIENT_H
+#define SNTP_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+// 待たずに動くSNTPクライアント（loop() から handle() を毎回呼ぶ）
+// 1回の同期（ラウンド）で複数のサーバーに数回ずつ問い合わせ、サーバーごとに往復時間が一番短い応答を使う。
+// 他のサーバーと大きく食い違うサーバーは除き、残りを往復時間の短い方を重くして平均したずれで時計を合わせる。
+// 最初の同期とずれが大きい時は時計を進め・戻し（ステップ）、それ以外は adjtime() で少しずつ合わせる（スルー）。
+// 最初の同期は1つの応答では合わせず、誤差の範囲で一致する2つの応答がそろったところで、往復時間が短い方で合わせる。
+// 同期の間隔とずれから水晶の周波数のずれ（ppm）を求め、同期の間も少しずつ補正する。
+// ずれが小さいうちは同期の間隔を倍にしていき（最大 MAX_POLL_S）、大きくなれば半分に戻す。
+class SntpClient {
+public:
+    // 状態
+    enum State {
+        STATE_STOPPED,      // begin() 前、または stop() 後
+        STATE_WAITING,      // 次のラウンドを待っている
+        STATE_ROUND         // 問い合わせ中
+    };
+
+    static const int MAX_SERVERS = 3;
+    static const int MAX_SAMPLES = 4;                // 1ラウンドで1つのサーバーに問い合わせる回数の上限
+
+    // 問い合わせの間隔と待ち時間
+    static const uint32_t QUERY_SPACING_MS = 2000;   // 同じサーバーに続けて問い合わせる間隔
+    static const uint32_t REPLY_TIMEOUT_MS = 1500;
+    static const uint32_t DNS_TIMEOUT_MS = 5000;
+
+    // 同期の間隔（秒）
+    static const uint32_t MIN_POLL_S = 256;
+    static const uint32_t MAX_POLL_S = 65536;
+    static const uint32_t RETRY_MIN_S = 16;          // 失敗した時の最初の再試行（失敗するたびに2倍、最大 MIN_POLL_S）
+
+    // これより大きいずれはステップで合わせる（us）
+    static const int32_t STEP_THRESHOLD_US = 500000;
+
+    // 間隔を倍にする・半分にするずれ（us）
+    static const int32_t POLL_INCREASE_US = 25000;
+    static const int32_t POLL_DECREASE_US = 50000;
+
+    // 周波数の補正の上限（ppm）と、補正を加える間隔
+    static constexpr float MAX_FREQ_PPM = 500.0f;
+    static const uint32_t FREQ_APPLY_MS = 10000;
+
+    // 周波数のずれを求め直す時の重み（間隔 / (間隔 + FLL_TAU_S)。間隔が長いほど測ったずれを信用する）
+    static const uint32_t FLL_TAU_S = 2048;
+
+    // サーバーごとの状態
+    struct Server {
+        char name[64];
+        IPAddress address;
+        volatile uint8_t dnsState;   // 0: 未解決 1: 問い合わせ中 2: 解決済み 3: 失敗
+        bool disabled;               // 問い合わせを断られた（DENY・RSTR）
+        uint8_t sent;                // このラウンドで送った数
+        uint8_t sampleCount;
+        bool waiting;                // 応答を待っている
+        uint32_t sentAt;             // 最後に送った時刻（millis）
+        uint32_t transmitSec;        // 送った時刻（NTP形式。応答の originate と照合する）
+        uint32_t transmitFrac;
+        int64_t t1;                  // 送った時刻（us、UNIX時刻）
+        int64_t offsetUs[MAX_SAMPLES];
+        int32_t delayUs[MAX_SAMPLES];
+        int32_t rootDistanceUs;      // サーバーから基準時計までの距離（root delay / 2 + root dispersion）
+    };
+
+private:
+    Server servers[MAX_SERVERS];
+    int serverCount;
+    WiFiUDP udp;
+    State state;
+
+    uint8_t samplesPerServer;      // このラウンドの問い合わせ回数
+    uint32_t roundStartedAt;
+    uint32_t nextRoundAt;          // millis
+    uint16_t failedRounds;         // 続けて失敗したラウンドの数
+
+    // 時計の調整
+    bool synchronized;             // 一度でも合わせた
+    bool clockChanged;             // handle() で true を返す
+    bool freqKnown;                // 周波数のずれを求めた
+    float freqPpm;                 // 補正している周波数のずれ（正なら時計が遅れるので進める）
+    float freqCarryUs;             // まだ補正していない端数
+    uint32_t lastFreqApplyAt;
+    uint32_t lastUpdateAt;         // 最後に時計を合わせた時刻（millis）
+    uint32_t pollS;                // 今の同期の間隔
+
+    // 統計
+    int32_t lastOffsetUs;
+    int32_t lastDelayUs;
+    int32_t lastJitterUs;
+    int lastServerCount;           // 最後のラウンドで使ったサーバーの数
+    uint32_t rounds;
+    uint32_t steps;
+    uint32_t queries;
+    uint32_t replies;
+    uint32_t radioMs;              // 問い合わせに使った時間の合計
+    uint32_t lastRoundMs;
+
+    void startRound();
+    void finishRound();
+    void sendQuery(Server& server);
+    void receiveReplies();
+    void processReply(const uint8_t* packet, int length, int64_t t4, const IPAddress& from);
+    bool stepOnAgreement();
+    void stepClock(int64_t offsetUs);
+    void scheduleNext(uint32_t seconds);
+    void applyFrequency(uint32_t now);
+
+public:
+    SntpClient();
+
+    // サーバー（カンマ区切りで MAX_SERVERS 個まで。次のラウンドから使う）
+    void setServers(const char* list);
+    int getServerCount() { return serverCount; }
+
+    // 同期を始める（すぐに最初のラウンドを始める）・止める
+    void begin();
+    void stop();
+
+    // 問い合わせを進める（待たずにすぐ戻る）。時計を合わせたら true
+    bool handle();
+
+    // すぐに同期し直す（サーバーを変えた時など）
+    void requestSync();
+
+    // 状態
+    State getState() { return state; }
+    bool isSynchronized() { return synchronized; }
+    uint32_t getMillisUntilNextSync();
+
+    // 統計
+    int32_t getLastOffsetMicros() { return lastOffsetUs; }
+    int32_t getLastDelayMicros() { return lastDelayUs; }
+    int32_t getLastJitterMicros() { return lastJitterUs; }
+    float getFrequencyPpm() { return freqPpm; }
+    uint32_t getPollSeconds() { return pollS; }
+    uint32_t getRoundCount() { return rounds; }
+    uint32_t getStepCount() { return steps; }
+    uint32_t getQueryCount() { return queries; }
+    uint32_t getReplyCount() { return replies; }
+    uint32_t getRadioMillis() { return radioMs; }
+    uint32_t getLastRoundMillis() { return lastRoundMs; }
+};
+
+#endif // SNTP_CLIENT_H
@@ -0,0 +1,17 @@
+#ifndef WAKE_SOURCE_H
+#define WAKE_SOURCE_H
+
+// ライトスリープから起こす入力（各時計の TouchManager が実装する）
+// PowerManager は操作中・表示中でなければ次の秒までライトスリープする。
+class WakeSource {
+public:
+    virtual ~WakeSource() {}
+
+    // この入力でライトスリープから起きるようにする（省電力モード）
+    virtual void enableWakeup() = 0;
+
+    // 操作中・表示中か（その間はライトスリープしない）
+    virtual bool isBusy() = 0;
+};
+
+#endif // WAKE_SOURCE_H
@@ -0,0 +1,16 @@
+#ifndef WEB_ASSET_H
+#define WEB_ASSET_H
+
+#include <Arduino.h>
+
+// gzip圧縮してフラッシュに置いた設定用Webページのファイル（tools/build_web_assets.py で生成）
+struct WebAsset {
+    const char* path;           // URL（.css / .js は内容のハッシュを含む）
+    const char* contentType;
+    const uint8_t* data;        // gzip圧縮済み（PROGMEM）
+    size_t length;
+    const char* etag;           // 内容のハッシュ（引用符付き）
+    bool immutable;             // URLにハッシュを含むので長期間キャッシュさせてよい
+};
+
+#endif // WEB_ASSET_H
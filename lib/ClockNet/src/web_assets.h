@@ -0,0 +1,194 @@
+// このファイルは tools/build_web_assets.py で生成（直接編集しない）
+// 6 ファイル: 9059 bytes -> gzip 3582 bytes
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include "web_asset.h"
+
+// main.html: 913 bytes -> gzip 548 bytes
+const uint8_t webMainHtmlData[548] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x7D,0x53,0x59,0x4F,0xDC,0x30,0x10,0x7E,0xCF,0xAF,0x98,0xE6,0x25,0x8B,
+    0xC4,0x26,0x40,0xA5,0x16,0x41,0x12,0x89,0x2E,0x5B,0x4A,0xC5,0x25,0x36,0x48,0xED,0xA3,0xB1,0x67,0x37,0x16,0x5E,0xDB,0x8D,
+    0x27,0x1C,0xAA,0xF8,0xEF,0x1D,0x27,0xBB,0x12,0x45,0x6A,0x9F,0x92,0xCC,0x77,0xCC,0x99,0xF2,0xC3,0xE9,0xF5,0xAC,0xF9,0x79,
+    0x33,0x87,0x6F,0xCD,0xE5,0x45,0x9D,0x94,0x2D,0xAD,0x4D,0x7C,0xA0,0x50,0xFC,0x58,0x23,0x09,0x90,0xAD,0xE8,0x02,0x52,0x95,
+    0xDE,0x35,0x5F,0xA7,0x87,0x29,0x87,0x49,0x93,0xC1,0x7A,0xBE,0xB8,0xF9,0x78,0x00,0x27,0x56,0x18,0xB7,0x82,0x99,0x71,0xF2,
+    0xA1,0x2C,0x46,0x64,0x23,0xB4,0x62,0x8D,0x55,0xFA,0xA8,0xF1,0xC9,0xBB,0x8E,0x52,0x90,0xCE,0x12,0x5A,0x36,0x7A,0xD2,0x8A,
+    0xDA,0x4A,0xE1,0xA3,0x96,0x38,0x1D,0x3E,0x76,0x41,0x5B,0x4D,0x5A,0x98,0x69,0x90,0xC2,0x60,0xB5,0x1F,0xD3,0x18,0x6D,0x1F,
+    0xA0,0x43,0x53,0xA5,0x81,0x5E,0x0C,0x86,0x16,0x91,0x5D,0xDA,0x0E,0x97,0x55,0x5A,0x0C,0xA1,0x7C,0x79,0x78,0xF0,0x79,0xF9,
+    0x49,0x2D,0x73,0x19,0x42,0x94,0x14,0x9B,0xC2,0xEF,0x9D,0x7A,0x01,0x69,0x44,0x08,0x55,0x2A,0x39,0x27,0x76,0x11,0x6D,0xF7,
+    0x37,0x45,0x5F,0x35,0x37,0xEF,0x0A,0x67,0x28,0x29,0x7D,0x3D,0xEB,0xBB,0x8E,0xE9,0xB0,0x20,0x41,0x7D,0x38,0x82,0xDB,0xDE,
+    0x5A,0x6D,0x57,0x65,0xE1,0x07,0x78,0xB1,0x38,0x3F,0x3D,0x82,0x32,0x78,0x61,0x41,0x2B,0xAE,0x2B,0x68,0x95,0xD6,0x65,0x11,
+    0x03,0xF5,0x96,0x74,0xCE,0xDE,0x4A,0x75,0x18,0xC2,0x5B,0xAA,0xF6,0xEF,0x88,0x62,0xEC,0x24,0x2B,0x7A,0xAF,0x04,0x61,0xB6,
+    0x29,0x37,0xBB,0x27,0x9B,0xD5,0x67,0x0E,0xC8,0xC1,0x75,0x73,0x02,0x77,0x03,0x5A,0x16,0xE2,0xAD,0x84,0xCD,0x49,0x74,0xF4,
+    0xB7,0xE6,0x76,0x0C,0x8E,0x54,0x5F,0x37,0x2E,0x6E,0xCE,0xAE,0x10,0xA8,0x45,0xE0,0x05,0x12,0x37,0x12,0x76,0xC1,0x38,0xBB,
+    0x9A,0xFA,0x58,0xDE,0x00,0x90,0xEB,0x65,0xCB,0xB0,0x0D,0xAE,0x03,0x61,0x15,0x38,0x8F,0x76,0x2B,0xE9,0x3D,0x78,0xC1,0x0E,
+    0x6E,0x8C,0xC8,0x38,0xAB,0x2C,0x80,0x90,0x32,0xCA,0xBD,0xD3,0x96,0xF2,0xB1,0x9B,0x20,0x3B,0xED,0xA9,0x4E,0x78,0xC7,0x81,
+    0xE0,0xB9,0xED,0xA0,0x02,0x8B,0x4F,0xF0,0xE3,0xF2,0xE2,0x1B,0x91,0xBF,0xC5,0x5F,0x3D,0x97,0x37,0xD9,0x39,0x4E,0x18,0xCB,
+    0x63,0x8E,0x49,0x76,0x36,0x6F,0xB2,0x5D,0xC8,0x0A,0xE1,0x35,0xAF,0x33,0x0E,0x3C,0xDB,0xE2,0xD6,0x38,0xA1,0xD8,0x62,0xD9,
+    0x5B,0x49,0xDA,0xD9,0xC9,0x0E,0xFC,0x4E,0xF4,0x12,0x26,0x11,0x1D,0xB9,0x50,0x55,0x15,0x1C,0xEC,0xED,0x45,0x64,0xCC,0xBA,
+    0x8D,0xC3,0xF7,0xC5,0xF5,0x55,0xEE,0xE3,0xD5,0x0E,0x7C,0xEE,0xD5,0x33,0x01,0x1B,0x7C,0x26,0x4E,0xA0,0x9C,0xEC,0xD7,0xBC,
+    0xE4,0x7C,0x85,0x34,0x37,0x18,0x5F,0xBF,0xBC,0x9C,0xAB,0x49,0x16,0xB7,0x99,0xED,0xE4,0xC4,0xB4,0xD9,0x78,0xAA,0xEC,0x35,
+    0x9A,0xE6,0x11,0xFB,0x8F,0x54,0xFB,0x7F,0x09,0xB5,0x3F,0x4E,0x5E,0x93,0xD7,0xB1,0x2F,0x1E,0xB3,0x8A,0x33,0xE0,0x43,0xD8,
+    0xCC,0xAB,0x2C,0xE2,0xA9,0x0E,0x97,0x3B,0xFC,0x79,0x7F,0x00,0xBB,0x2F,0xC4,0x2F,0x91,0x03,0x00,0x00,
+};
+const WebAsset webMainHtml = { "/main.html", "text/html", webMainHtmlData, 548, "\"2f787b06\"", false };
+
+// restart.html: 404 bytes -> gzip 345 bytes
+const uint8_t webRestartHtmlData[345] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x55,0x90,0xCF,0x4A,0xC3,0x40,0x10,0xC6,0xEF,0x79,0x8A,0x98,0x4B,0x5B,
+    0x68,0x93,0x56,0x41,0x0B,0xCD,0xE6,0xE2,0x1F,0x3C,0x28,0x7A,0x88,0x07,0x8F,0xEB,0x66,0x42,0x16,0x37,0x9B,0x90,0xDD,0x36,
+    0x14,0xF1,0x10,0x03,0x22,0xA8,0x17,0x41,0x8A,0xBE,0x40,0x0F,0xE2,0x51,0x2C,0x28,0x7D,0x99,0xB5,0xD4,0xC7,0x70,0x13,0xEB,
+    0xC1,0xD3,0x30,0xDF,0xF0,0x7D,0xF3,0x9B,0x71,0xD7,0x76,0x8E,0xB6,0xFD,0xD3,0xE3,0x5D,0x73,0xDF,0x3F,0x3C,0xF0,0x0C,0x37,
+    0x92,0x31,0xAB,0x0A,0xE0,0x40,0x97,0x18,0x24,0x36,0x49,0x84,0x33,0x01,0x12,0x59,0x27,0xFE,0x5E,0xA7,0x6F,0x69,0x59,0x52,
+    0xC9,0xC0,0x5B,0x5C,0xDF,0x7F,0xBF,0xBD,0x2F,0x6E,0x1F,0xBF,0x66,0xAF,0xAE,0xF3,0xAB,0xAD,0x2C,0x1C,0xC7,0x80,0xAC,0x11,
+    0x85,0x3C,0x4D,0x32,0x69,0x99,0x24,0xE1,0x12,0xB8,0x8E,0xC8,0x69,0x20,0x23,0x14,0xC0,0x88,0x12,0xE8,0xD4,0x4D,0xDB,0xA4,
+    0x9C,0x4A,0x8A,0x59,0x47,0x10,0xCC,0x00,0xF5,0xAA,0x05,0x8C,0xF2,0x73,0x33,0x03,0x86,0x2C,0x21,0xC7,0x0C,0x44,0x04,0xA0,
+    0x53,0xA2,0x0C,0x42,0x64,0x39,0xB5,0x64,0x87,0xFD,0xF5,0xAD,0x70,0x33,0x08,0x6D,0x22,0x44,0x65,0x71,0x56,0xC8,0x67,0x49,
+    0x30,0x36,0x09,0xC3,0x42,0x20,0x8B,0xE8,0x9D,0x90,0x55,0xD3,0xA8,0xF7,0x0F,0xD7,0xB6,0x6D,0x6D,0xE8,0xE9,0x41,0xEA,0x6D,
+    0x2C,0xA7,0x0F,0x8B,0xF9,0x9D,0x2A,0x5E,0x54,0x79,0xA3,0xCA,0x52,0x95,0x13,0x55,0x3E,0xAB,0xF2,0x53,0x5D,0xCD,0xB4,0xB8,
+    0x9C,0x7E,0x68,0x8F,0x2A,0x26,0xAA,0x98,0xAB,0xE2,0xC9,0x75,0x52,0xED,0x12,0x24,0xA3,0xA9,0xF4,0x0C,0xFD,0x16,0x9F,0xC6,
+    0x90,0x0C,0x65,0x33,0x1C,0x72,0x22,0x69,0xC2,0x9B,0xAD,0x0B,0x23,0xA7,0x3C,0x48,0x72,0x9B,0x25,0x04,0x57,0x92,0x5D,0x83,
+    0x37,0x9C,0xC6,0xC0,0xB8,0x6C,0x9B,0x1B,0xDD,0x6E,0xB7,0x35,0xD0,0xC0,0x7F,0x21,0xAE,0x53,0x31,0xD7,0x27,0xD4,0xCF,0xFF,
+    0x01,0x33,0x88,0xBF,0x23,0x94,0x01,0x00,0x00,
+};
+const WebAsset webRestartHtml = { "/restart.html", "text/html", webRestartHtmlData, 345, "\"5520036b\"", false };
+
+// setup.html: 2113 bytes -> gzip 776 bytes
+const uint8_t webSetupHtmlData[776] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9D,0x56,0x5D,0x4F,0xDB,0x30,0x14,0x7D,0xE7,0x57,0x78,0x7E,0x62,0x12,
+    0x4D,0xDB,0x30,0x36,0x98,0x92,0x48,0xD0,0x82,0x36,0x69,0x8C,0x6A,0x6D,0x35,0x6D,0x6F,0x6E,0x72,0x93,0x78,0x38,0x71,0x64,
+    0x3B,0x85,0xFE,0xFB,0x5D,0x27,0x69,0x13,0x42,0x3B,0x60,0x2F,0xC4,0xBE,0x1F,0xE7,0x1E,0x9F,0xEB,0x5B,0xE3,0xBD,0x9B,0xDE,
+    0x4D,0x16,0xBF,0x66,0xD7,0xE4,0xCB,0xE2,0xF6,0x5B,0x70,0xE4,0xA5,0x26,0x13,0xF6,0x03,0x2C,0xC2,0x4F,0x06,0x86,0x91,0x9C,
+    0x65,0xE0,0xD3,0x35,0x87,0x87,0x42,0x2A,0x43,0x49,0x28,0x73,0x03,0xB9,0xF1,0xE9,0x03,0x8F,0x4C,0xEA,0x47,0xB0,0xE6,0x21,
+    0x0C,0xAA,0xCD,0x09,0xE1,0x39,0x37,0x9C,0x89,0x81,0x0E,0x99,0x00,0x7F,0x4C,0xB7,0x20,0x61,0xCA,0x94,0x06,0x4C,0x5A,0x2E,
+    0x6E,0x06,0xE7,0xD6,0x6C,0xB8,0x11,0x10,0x5C,0xCF,0x67,0xA7,0x2E,0xB9,0xCC,0x99,0x90,0x09,0x99,0x08,0x19,0xDE,0x93,0x39,
+    0x98,0xB2,0xF0,0x86,0xB5,0xFF,0xC8,0x13,0x3C,0xBF,0x27,0x0A,0x84,0x4F,0xB5,0xD9,0x08,0xD0,0x29,0x00,0x92,0x48,0x15,0xC4,
+    0x3E,0x1D,0x56,0x26,0x27,0x3E,0x77,0x3F,0xC5,0x1F,0xA3,0xD8,0x09,0xB5,0xB6,0xD0,0xC3,0x86,0xFE,0x4A,0x46,0x1B,0x7B,0x98,
+    0xF1,0x3F,0xCA,0xA0,0xF3,0xC8,0x8B,0xF8,0x9A,0x84,0x82,0x69,0xED,0xD3,0x90,0xA9,0xC8,0x62,0xA4,0x6E,0xF0,0x93,0xDF,0x70,
+    0x1B,0x66,0x78,0x9E,0x68,0x8C,0x74,0xD1,0x1C,0x4B,0x95,0x11,0x1E,0xD9,0xC3,0xC7,0xFC,0x06,0x37,0x36,0x56,0xB0,0x15,0x08,
+    0x82,0x2E,0xE4,0xA8,0x39,0xA6,0xD7,0x99,0xF3,0xAF,0xD3,0xCF,0xDE,0xB0,0x72,0x62,0x10,0xCF,0x8B,0xD2,0x10,0xB3,0x29,0x50,
+    0x4C,0x03,0x8F,0x78,0x06,0x0B,0x53,0xC5,0x37,0x12,0xD7,0xB9,0x4F,0xE0,0x0A,0xE4,0xF4,0x20,0xD5,0x16,0x72,0xD6,0x6C,0x0F,
+    0xC0,0xEE,0xA2,0x2B,0xE8,0x76,0x57,0xC3,0xB7,0x58,0xA8,0x4C,0x69,0x8C,0xCC,0x9B,0x34,0x5D,0xAE,0x32,0x6E,0x1B,0x5B,0x2B,
+    0x50,0xFB,0x68,0x30,0x67,0x6B,0x20,0x3D,0x0D,0x6A,0x9F,0x95,0xD8,0x0A,0x81,0xDF,0x62,0x27,0xC6,0x2D,0x68,0xCD,0x12,0xA0,
+    0x81,0x37,0x2C,0x6C,0x00,0x6A,0x7A,0x50,0xD9,0xBB,0xC5,0x25,0x59,0x16,0x11,0x33,0x70,0x50,0x5F,0x69,0xD8,0x1E,0x79,0xD1,
+    0xBA,0xD4,0xA0,0xEC,0x81,0x68,0xB0,0x5D,0xBD,0x28,0x72,0x37,0xAB,0x11,0xE3,0x09,0x50,0xBF,0xC4,0x6C,0xA7,0xD4,0x9B,0x04,
+    0xEF,0x66,0xB6,0x65,0x66,0xFF,0x23,0xBB,0x15,0xE8,0x45,0xD5,0x11,0xFC,0x2D,0xA2,0xEF,0xAE,0xFD,0x5E,0xBD,0x43,0xEB,0xDD,
+    0xA3,0x78,0x6E,0x8A,0x39,0xA8,0x35,0x28,0x1A,0x7C,0x5F,0xCC,0x48,0xBD,0xD6,0xE4,0x38,0x94,0x59,0xC6,0x88,0x86,0x82,0x29,
+    0x6C,0x63,0x74,0x42,0xCA,0x82,0x18,0x49,0x4E,0xDF,0xBF,0xD8,0x8D,0x16,0xB1,0x11,0xA9,0x63,0x28,0x04,0x0B,0x21,0x95,0x22,
+    0x02,0x7B,0xF9,0xA5,0x14,0x0E,0x3A,0x1D,0xA9,0x92,0x13,0x62,0x78,0x06,0x4E,0x22,0x65,0x82,0x03,0x8F,0xC5,0x7B,0x34,0xAD,
+    0xF7,0xB7,0xCC,0x51,0x89,0x05,0xAE,0x88,0x5D,0x76,0x88,0x68,0x10,0x10,0x9A,0xAA,0xFA,0x2E,0xB0,0x29,0xDE,0x26,0x7A,0xC3,
+    0x3A,0xAC,0x11,0xB0,0x12,0xA5,0xD4,0x46,0x66,0x77,0x71,0x8C,0x3F,0x5D,0xBD,0x82,0x49,0x66,0xB6,0xF6,0xE5,0x62,0x42,0xEA,
+    0x35,0x39,0x4E,0x65,0xA9,0xF4,0x21,0x0D,0xF2,0x32,0x5B,0xD9,0x53,0x5A,0xE8,0x36,0xBF,0x21,0xD2,0x31,0x64,0x3C,0xF7,0xE9,
+    0x60,0xEC,0xE2,0x8A,0x3D,0xFA,0x74,0xFC,0x81,0x12,0x6D,0xA0,0xF0,0xE9,0xC8,0x71,0xCF,0x7A,0x3C,0x22,0xB6,0x11,0x3C,0x49,
+    0x77,0x64,0xA6,0xCD,0x9E,0xE0,0x3D,0xC2,0x3E,0x93,0x63,0x04,0x2B,0x0D,0xBC,0x8A,0x53,0x0F,0xAB,0x21,0xD6,0xB7,0x56,0xEC,
+    0x46,0x5B,0x6E,0xEE,0x68,0x4B,0xEE,0x74,0x44,0xDB,0x2B,0xD8,0x61,0x18,0x63,0x4B,0x69,0x70,0x83,0x7F,0xF7,0x77,0xA4,0xF2,
+    0x37,0xB5,0xEA,0xD8,0x4E,0x27,0x5E,0x3D,0x31,0xFD,0xDB,0xFD,0x6C,0x66,0x3A,0x8C,0x56,0xCA,0x9E,0x27,0x07,0xFB,0x5A,0x5C,
+    0xED,0xD6,0x07,0x04,0x52,0x2C,0xC7,0x01,0xAB,0x98,0x76,0xF2,0x1A,0xBE,0x5D,0xCB,0x13,0x5D,0xDC,0xB3,0xAA,0x51,0x45,0x3B,
+    0x5B,0x6F,0x19,0xD5,0x69,0xF5,0xA6,0x92,0x09,0xBE,0xB4,0x4A,0x8A,0x66,0x54,0x1B,0x29,0x2C,0xA0,0x02,0x6D,0x98,0x32,0x57,
+    0x26,0x7F,0x26,0xC6,0x8F,0xDA,0xD5,0x11,0xA0,0xE8,0xA6,0xEC,0x67,0xA1,0x43,0xC5,0x0B,0x43,0xB4,0x0A,0xED,0x9B,0x6A,0x1F,
+    0x46,0xE7,0xE2,0x22,0x3E,0x5F,0x85,0x63,0x70,0xFE,0xE8,0xAA,0x21,0x55,0x84,0xCD,0x68,0x1E,0xD5,0x61,0xFD,0x9F,0xC2,0x5F,
+    0x7C,0x1B,0x05,0xC6,0x41,0x08,0x00,0x00,
+};
+const WebAsset webSetupHtml = { "/setup.html", "text/html", webSetupHtmlData, 776, "\"8b72e732\"", false };
+
+// setup.js: 4521 bytes -> gzip 1282 bytes
+const uint8_t webSetupJsData[1282] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x57,0x4B,0x53,0xE3,0x46,0x10,0xBE,0xFB,0x57,0x4C,0xB8,0x48,0x4A,
+    0x88,0xF0,0x26,0x29,0x0E,0x36,0x5E,0x6A,0x21,0xB0,0x90,0x82,0x40,0x2D,0xA6,0x92,0x4A,0x2A,0x87,0x41,0x6A,0xD9,0x0A,0xB2,
+    0xA4,0xCC,0x8C,0x30,0x0E,0xCB,0x7F,0x4F,0xF7,0xCC,0xE8,0x85,0x65,0x61,0xB6,0x92,0xCA,0xC9,0xB2,0xFA,0x31,0x3D,0xDF,0xD7,
+    0x2F,0x25,0xA0,0x58,0x92,0xF1,0x10,0xC2,0x1B,0x19,0x87,0x6C,0xC2,0x1C,0x67,0x3C,0x88,0x8A,0x34,0x50,0x71,0x96,0x32,0x39,
+    0xCF,0x96,0x37,0xA0,0x54,0x9C,0xCE,0xA4,0x2B,0xED,0x83,0xC7,0x9E,0x06,0x2D,0x93,0x52,0xE0,0x4B,0xFC,0x3F,0x1E,0x84,0x59,
+    0x50,0x2C,0x20,0x55,0xFE,0x0C,0xD4,0x49,0x02,0xF4,0x78,0xB4,0x3A,0x0F,0x5D,0x87,0xC4,0x8E,0xE7,0x3F,0xF0,0xA4,0x80,0x37,
+    0x98,0xE5,0x5C,0xCA,0x65,0x26,0xC8,0x34,0x4F,0x78,0x00,0xF3,0x2C,0x09,0x41,0x34,0x1D,0x94,0x1A,0x18,0x2A,0x3B,0x64,0x8E,
+    0x8B,0xE1,0xCF,0x79,0x3A,0x83,0xD0,0x73,0xD8,0x48,0xDF,0x68,0xA3,0xF3,0x4C,0xF1,0x5B,0x09,0x22,0xE5,0x0B,0xE8,0x0A,0xAD,
+    0x21,0xEE,0x77,0x72,0xFD,0x6A,0x90,0x0D,0xA5,0x2F,0x88,0x33,0x55,0xF9,0x0D,0x88,0x07,0x10,0x5D,0x51,0x56,0xC2,0x1E,0x07,
+    0xB3,0x85,0xBA,0x8A,0x22,0x34,0xE9,0x72,0x50,0x09,0xD9,0x1E,0xFB,0x7E,0x7F,0x38,0xEC,0xF1,0x13,0xF2,0x55,0x12,0xCF,0xE6,
+    0x3D,0xCE,0xDA,0x1A,0xE8,0x71,0x1F,0xFD,0x05,0x59,0x2A,0x15,0x53,0xF1,0x02,0x7E,0xCB,0x52,0x52,0xDF,0x78,0x40,0xA9,0xE3,
+    0x78,0xE3,0x41,0xF9,0xEC,0xC7,0x69,0x0A,0xE2,0x6C,0x7A,0x79,0x61,0x33,0xD4,0xB8,0xFB,0x1B,0x45,0x12,0xDF,0xFC,0xEE,0x38,
+    0x7F,0xF8,0xF8,0x2A,0xE0,0xAA,0xCA,0x52,0xBF,0xB4,0x95,0xE8,0x27,0x8E,0x98,0xAB,0x95,0xD1,0x51,0x08,0x8F,0x57,0xD1,0xBA,
+    0x9A,0xC7,0x0E,0xD8,0x90,0x52,0xDB,0xE8,0xE5,0x85,0x9C,0x77,0x28,0x8D,0x07,0xCF,0x56,0x21,0xCA,0xC4,0x09,0x0F,0xE6,0x6E,
+    0x59,0x2B,0x2E,0xE5,0x08,0xD9,0x9B,0xD0,0xB2,0x5C,0x17,0x50,0xE3,0x9E,0x81,0x00,0xAE,0xC0,0x5E,0x15,0x73,0x46,0x2B,0xD0,
+    0x25,0xCD,0x53,0x85,0xA3,0xC9,0x35,0xFB,0x52,0xC1,0xA3,0x3A,0xCE,0x52,0x85,0x26,0x56,0xC4,0x26,0x13,0x82,0x80,0xF2,0xE7,
+    0xB8,0x90,0x2A,0x5B,0xB0,0xDB,0xE9,0x31,0xCB,0x0C,0x1B,0x98,0x45,0xC6,0xBC,0x02,0x8E,0xE7,0x39,0xA4,0xE1,0xF1,0x3C,0x4E,
+    0x42,0xD7,0xF8,0xA4,0x3B,0x34,0xA1,0x5D,0xE3,0xAF,0x94,0x8C,0x07,0x54,0xFE,0xE6,0x10,0xC3,0xA5,0xEB,0xF5,0x24,0xC6,0x9D,
+    0x20,0xD2,0x11,0x1A,0xD9,0x95,0x14,0xB5,0xB4,0x24,0x2F,0xC2,0x2A,0xE9,0xCB,0x03,0x92,0x13,0x3C,0xF4,0xBB,0xC6,0x7F,0xE5,
+    0x97,0xA4,0xFF,0x1F,0x19,0x36,0xBA,0x8D,0x20,0x6B,0xE9,0x1A,0x16,0xF4,0x96,0x12,0xA9,0xD5,0x66,0xDB,0x38,0x57,0xA1,0x07,
+    0x86,0xE3,0xAD,0xEA,0xA5,0x3C,0x69,0x32,0xE9,0xEF,0x25,0x41,0xE3,0x28,0xB4,0x92,0x6A,0x95,0x80,0x1F,0xC6,0x12,0x1B,0xD7,
+    0x0A,0x4F,0xB2,0x47,0x1E,0x52,0x96,0x61,0x57,0x4A,0xC9,0x77,0x2B,0x5C,0x6A,0xFE,0xD5,0x54,0xA8,0x43,0x7D,0x9C,0x53,0xBF,
+    0x4B,0x61,0xC9,0x7E,0xBD,0xBC,0x38,0x53,0x2A,0xFF,0x04,0x7F,0x15,0x20,0x75,0xD6,0xA0,0xCC,0xCF,0x10,0x24,0xD7,0xF9,0x78,
+    0x32,0x75,0x76,0x99,0xB3,0xC7,0xF3,0x78,0xAF,0x44,0xC4,0x29,0x35,0x52,0x72,0x8D,0x4E,0x2A,0x1E,0xC9,0x3B,0x15,0x2F,0x49,
+    0xA5,0xE2,0xAA,0x90,0xFA,0x7A,0xDF,0x0D,0x75,0xA9,0xB6,0xC6,0xD3,0x4F,0x37,0x57,0x3F,0xE3,0x24,0x10,0x12,0xB4,0xB6,0x00,
+    0x99,0x63,0x58,0x30,0x45,0xD2,0x3C,0x5D,0xB7,0xCF,0xE6,0x10,0x89,0x54,0xB9,0x5E,0xEB,0x42,0x79,0xA1,0x2A,0x37,0x77,0x59,
+    0xB8,0xDA,0x65,0x0B,0x4C,0x54,0x3E,0x83,0xF3,0x70,0x97,0xC9,0x22,0xC0,0x14,0x93,0xDA,0xCF,0x1B,0xEF,0x7A,0x7D,0xBB,0xF9,
+    0xAE,0xF8,0xDF,0xDA,0x9C,0x01,0xCE,0x52,0xE1,0x3A,0x36,0xB5,0xBE,0x9D,0xAE,0x72,0x20,0x33,0xCC,0xAA,0x24,0xC6,0x96,0x86,
+    0x11,0xEE,0xFD,0x29,0x4D,0x7A,0x6E,0x46,0xC9,0xC4,0x65,0xE3,0xEE,0xC9,0x97,0xEA,0x66,0xB6,0x2D,0x76,0x23,0x6B,0xB5,0xDA,
+    0x75,0x77,0x20,0x73,0x9E,0xB2,0x20,0xC1,0x29,0x36,0xD9,0xB1,0xB0,0xEC,0xBC,0x77,0xD8,0x37,0x4D,0x8C,0xF0,0x9F,0x73,0xB0,
+    0x47,0x9A,0xEF,0x9D,0xF1,0xDB,0x18,0x62,0x90,0x48,0x60,0x1D,0x41,0xFD,0x30,0x7C,0xB7,0x5D,0x50,0x20,0x44,0x26,0x76,0xDE,
+    0x9F,0xD0,0xCF,0x88,0xA9,0x39,0xB0,0xAB,0xE9,0x07,0x56,0xD8,0x09,0xCE,0x78,0x1A,0xB2,0x72,0x57,0x60,0x5C,0x00,0x13,0xC8,
+    0x40,0x2C,0x20,0xAC,0x03,0xB6,0x41,0xE0,0x86,0x83,0xA3,0x4B,0xBB,0xC3,0x43,0x5E,0x46,0x5B,0x23,0x37,0x23,0x16,0x8D,0xA0,
+    0x93,0x46,0xCF,0x54,0xE3,0x3A,0x95,0x78,0x42,0xE9,0xBD,0x0F,0x16,0x5F,0x2B,0x51,0xB2,0x6E,0x7D,0xF9,0xFA,0x2E,0xA5,0x49,
+    0x14,0x0B,0xA9,0x74,0x77,0x7A,0xD1,0xC2,0x1C,0x0B,0x14,0x51,0x58,0x1D,0xD4,0x2C,0x13,0x1D,0x9A,0x54,0x02,0xE9,0x8B,0xA3,
+    0x95,0xAE,0x0D,0x53,0x4B,0x1B,0x7B,0xCB,0x32,0x8E,0xE2,0xD3,0x4C,0x2C,0xB0,0xAF,0xF0,0x30,0x3C,0x79,0x40,0xC1,0x45,0x2C,
+    0xF1,0x3C,0x82,0x46,0x16,0x77,0x8B,0x58,0x61,0x6E,0x57,0x99,0xAB,0x9B,0x34,0xF8,0xB9,0x00,0xD2,0xFC,0x11,0x22,0x5E,0x24,
+    0xBA,0x88,0x4C,0x3A,0xD3,0x81,0x18,0xE7,0x13,0xA3,0x15,0x71,0xC4,0xB6,0xDB,0x2C,0x9F,0x4B,0xEB,0x8A,0xEA,0x9E,0xEE,0xD9,
+    0x58,0x2E,0xB5,0xB5,0xA1,0xB6,0xB2,0xFC,0xCA,0x0C,0xDB,0xCF,0x9F,0x75,0x28,0x7A,0x53,0xD5,0xEF,0xEA,0xFD,0x97,0x2E,0xA0,
+    0x65,0x8D,0xD3,0xCA,0x47,0x42,0x6A,0xBD,0xB7,0x68,0x8C,0x2E,0x0D,0x37,0x54,0xE7,0xBF,0xC4,0xA7,0x71,0x35,0x1C,0x98,0xE4,
+    0x0F,0x10,0xFA,0x0C,0x49,0x4A,0x21,0xA0,0x57,0x4C,0x65,0x3A,0x93,0xA9,0xD9,0xA4,0xA0,0xD0,0xEF,0xBD,0xEF,0xFB,0x8E,0x9D,
+    0x30,0x7D,0x3B,0xE9,0x7F,0xC0,0x43,0x63,0x1F,0xEE,0xA1,0xA3,0x6B,0xA9,0xAE,0x58,0x69,0xEC,0xC1,0x7D,0xC4,0xB4,0x77,0xEA,
+    0x06,0x37,0x4D,0x7B,0x43,0x4F,0x45,0x41,0xDB,0x75,0xE3,0xDF,0x06,0x22,0x50,0xA3,0xC1,0x03,0xB5,0x8A,0x17,0x34,0xBC,0x8A,
+    0x72,0x90,0x64,0xC1,0xFD,0xBF,0x8F,0xF3,0xA0,0xDA,0xE8,0x7B,0x50,0x5E,0xFB,0x24,0xD8,0xAD,0x96,0xBA,0xD1,0xF6,0xEB,0xC2,
+    0xAE,0x5E,0x52,0x46,0xAF,0xED,0x61,0x46,0x99,0x9A,0x03,0x71,0xA0,0xD1,0xAE,0x97,0xF9,0x36,0x0B,0xF5,0xC7,0xC4,0x84,0x5D,
+    0x72,0x35,0xF7,0x45,0x56,0x60,0x2F,0xD1,0x1D,0xEE,0x14,0x0B,0x47,0xB9,0xDB,0x7F,0xA4,0x78,0xEC,0x6B,0xFD,0x41,0x82,0x08,
+    0x69,0xDF,0x2F,0xBE,0x2D,0xDE,0x7C,0x40,0xF7,0xD7,0x0B,0x9D,0xB2,0x3F,0xF4,0x36,0x64,0x89,0xE6,0xB8,0x91,0x27,0xC7,0xF4,
+    0xFF,0xCD,0x99,0xD2,0xC0,0x7D,0x3D,0x51,0xCC,0x67,0x20,0x3A,0x7F,0xB9,0x09,0x6E,0xBD,0x70,0xF7,0xF8,0x6C,0x27,0x5F,0xF3,
+    0x82,0x4F,0xAC,0xF6,0x31,0x62,0x1A,0xBF,0x73,0x5C,0x87,0xC1,0x57,0x5C,0xE0,0x69,0x36,0x41,0xD8,0x3B,0x5C,0x09,0x9E,0x3B,
+    0x80,0x38,0xAA,0x8C,0x99,0xFD,0x8E,0x7D,0x1D,0x06,0x9C,0x6E,0xE8,0x5C,0x1D,0xA9,0xB4,0x3B,0x68,0x1C,0x93,0xF7,0xCD,0x98,
+    0xCB,0x05,0x10,0xEB,0x03,0xC7,0xD8,0xC2,0x75,0x3E,0xE0,0xD8,0x5E,0x65,0x05,0xAE,0x1C,0xF6,0x61,0xC9,0x71,0x96,0x61,0x8F,
+    0xB4,0x9E,0x0F,0x1D,0x8F,0x6C,0x5E,0x0B,0xA0,0xBC,0x86,0xB7,0xCD,0x8A,0xF3,0xC9,0xD8,0x20,0x66,0xD8,0x79,0xD9,0x75,0x02,
+    0x1C,0x57,0x84,0x25,0x8F,0x55,0x3D,0x6B,0xBF,0x64,0x05,0xB6,0xA1,0xD4,0x1B,0x61,0xB9,0x98,0x12,0x82,0xED,0x25,0x7B,0x3C,
+    0xF8,0x07,0x4E,0x50,0x72,0x81,0xA9,0x11,0x00,0x00,
+};
+const WebAsset webSetupJs = { "/setup.99f8bc1e.js", "application/javascript", webSetupJsData, 1282, "\"99f8bc1e\"", true };
+
+// style.css: 842 bytes -> gzip 425 bytes
+const uint8_t webStyleCssData[425] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x92,0x4D,0x6E,0xDB,0x30,0x10,0x85,0xF7,0x3D,0x85,0x80,0xA0,0x40,
+    0x0A,0x48,0x86,0x24,0xA7,0x46,0x41,0xA1,0x8B,0xEE,0x7A,0x87,0xC0,0x0B,0xFE,0x8C,0xA5,0x41,0xE8,0xA1,0x30,0xA4,0x2A,0x3B,
+    0x46,0xEE,0x1E,0x4A,0xA2,0x53,0x0B,0x4E,0x40,0x68,0xA1,0xC7,0xE1,0x37,0xEF,0x71,0xA8,0x9C,0x39,0x5F,0x0E,0x8E,0x42,0x71,
+    0x90,0x47,0xB4,0x67,0xF1,0x87,0x51,0xDA,0xFC,0x2F,0xD8,0x7F,0x10,0x50,0xCB,0xDC,0x4B,0xF2,0x85,0x07,0xC6,0x43,0xA3,0xA4,
+    0x7E,0x69,0xD9,0x0D,0x64,0x0A,0xED,0xAC,0x63,0xF1,0x70,0xA8,0xA7,0xD5,0x1C,0x25,0xB7,0x48,0xA2,0x6C,0x7A,0x69,0x0C,0x52,
+    0x2B,0xEA,0xB2,0x3F,0x35,0xA9,0x66,0xBB,0xDD,0x36,0x6F,0xDF,0x54,0xEC,0xB3,0xD1,0x40,0x01,0xF8,0x72,0xC7,0x19,0x3B,0x0C,
+    0xD0,0x04,0x38,0x85,0x42,0x5A,0x6C,0x49,0x2C,0x85,0xF1,0x58,0x57,0x5D,0x12,0xA6,0x2C,0x77,0x3B,0xAD,0x3F,0x2D,0xDA,0x68,
+    0xC9,0xE6,0x2B,0xAA,0x72,0xA7,0xC2,0x77,0xD2,0xB8,0x51,0x94,0xD9,0x53,0x7F,0xCA,0x7E,0xC5,0xAF,0xCC,0xB8,0x55,0xF2,0xB1,
+    0xCC,0xE7,0xB5,0xA9,0x7F,0xC4,0x32,0x36,0xC0,0x05,0x4B,0x83,0x83,0x17,0x3F,0xA3,0xFD,0x55,0x96,0x25,0x61,0xA1,0x5C,0x08,
+    0xEE,0xB8,0x48,0xB1,0xAF,0x1A,0xE2,0x2F,0xE5,0x1B,0x15,0xE8,0xBE,0xFD,0xD5,0xF1,0x42,0x16,0xE4,0x08,0x9A,0x5B,0x63,0x57,
+    0x7E,0x15,0x61,0xD9,0x4C,0xBC,0xCF,0x36,0x2B,0x06,0xB4,0x63,0x19,0xD0,0xD1,0x02,0x31,0xE8,0x7B,0x2B,0xCF,0x02,0xC9,0x22,
+    0x41,0xA1,0xAC,0xD3,0x2F,0xCD,0x3C,0x42,0x8F,0xAF,0x20,0xAA,0xDD,0x87,0x5F,0x31,0xE5,0xAD,0xA7,0x51,0x0C,0xEC,0x63,0xE3,
+    0xDE,0xE1,0x8C,0x5D,0x87,0x7D,0x4A,0x61,0x62,0x88,0x74,0xAC,0x5A,0xF2,0x21,0xF5,0x43,0x78,0x0E,0xE7,0x1E,0x7E,0x4F,0x46,
+    0xF6,0xF9,0x8D,0xD0,0x4B,0xEF,0xC7,0x88,0x59,0x89,0x34,0x1C,0x15,0xF0,0x3E,0xF7,0x60,0x41,0x87,0xCB,0x88,0x26,0x74,0x11,
+    0x56,0x7E,0xFF,0x1F,0xB6,0xBE,0x86,0x4D,0xAD,0xE6,0x69,0x7C,0x1E,0x29,0x5D,0x5C,0x15,0x2B,0xBC,0xB3,0x68,0xB2,0x07,0xFD,
+    0x71,0x9D,0xB7,0xDE,0xE7,0x09,0xE3,0xEB,0x84,0x4F,0x9B,0x51,0x89,0xF6,0xAD,0x54,0x60,0x97,0xB7,0x3D,0x02,0xB6,0x5D,0x88,
+    0xDB,0xD6,0xAC,0x73,0xB1,0xA4,0x16,0xF6,0xB7,0x4E,0x57,0xBE,0xE2,0xB5,0xF8,0x41,0x6B,0xF0,0x3E,0x3D,0xC3,0x96,0x01,0x68,
+    0x92,0x81,0xD9,0x71,0x12,0x19,0x26,0xEA,0x3B,0x2B,0x21,0x02,0x88,0x4A,0x03,0x00,0x00,
+};
+const WebAsset webStyleCss = { "/style.f827f6df.css", "text/css", webStyleCssData, 425, "\"f827f6df\"", true };
+
+// test.html: 266 bytes -> gzip 206 bytes
+const uint8_t webTestHtmlData[206] PROGMEM = {
+    0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x2D,0x4F,0xCB,0x0A,0xC2,0x40,0x0C,0xBC,0xF7,0x2B,0x62,0xCF,0xEA,0xA2,
+    0x5E,0x3C,0xAC,0xBD,0xF8,0x06,0x45,0xC1,0x15,0xF1,0x18,0x6B,0xB4,0xC5,0xB6,0x5B,0x76,0xA3,0xD2,0xBF,0x37,0xB5,0x0B,0x21,
+    0x81,0x99,0xCC,0x64,0xA2,0x7B,0x8B,0xC3,0xDC,0x5C,0x8F,0x4B,0xD8,0x98,0xFD,0x2E,0x89,0x74,0xC6,0x65,0xD1,0x0E,0xC2,0xBB,
+    0x8C,0x92,0x18,0x21,0xCD,0xD0,0x79,0xE2,0x59,0x7C,0x36,0xAB,0xC1,0x34,0x16,0x98,0x73,0x2E,0x28,0x59,0x9E,0x8E,0x93,0x31,
+    0x18,0xF2,0xAC,0x55,0x87,0x44,0x5A,0x05,0xE1,0xCD,0xDE,0x9B,0xD6,0x66,0x14,0xB6,0x2E,0x74,0x83,0x13,0xB9,0x0F,0xB9,0x20,
+    0x10,0x26,0xD2,0x75,0x62,0xB2,0xDC,0x83,0x14,0x02,0x0B,0x0C,0x35,0x3E,0x69,0xA8,0x55,0xFD,0xE7,0xB6,0x0F,0x68,0xEC,0x1B,
+    0x52,0xAC,0xC0,0x13,0x01,0xCB,0x6A,0x5F,0x3A,0xC1,0x57,0xCC,0x7C,0x67,0x26,0xD2,0xAF,0x75,0xAF,0xBC,0x7A,0x42,0x6A,0x9D,
+    0xA3,0x94,0x8B,0x26,0x18,0x20,0x64,0x8E,0x1E,0xB3,0x58,0xC5,0xC9,0xDA,0x02,0x5B,0x28,0x31,0xAF,0xFE,0x17,0xB4,0xC2,0x36,
+    0x6A,0xC8,0xA8,0xBA,0x97,0x7F,0x73,0x5A,0x8E,0x98,0x0A,0x01,0x00,0x00,
+};
+const WebAsset webTestHtml = { "/test.html", "text/html", webTestHtmlData, 206, "\"017bad16\"", false };
+
+// URLにハッシュを含むファイル（そのURLで登録する）
+const WebAsset* const webStaticAssets[] = { &webSetupJs, &webStyleCss };
+const int webStaticAssetCount = 2;
+
+#endif // WEB_ASSETS_H
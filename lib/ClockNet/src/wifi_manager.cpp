@@ -0,0 +1,391 @@
+#include "wifi_manager.h"
+#include <AsyncElegantOTA.h>
+#include <json_stream.h>
+#include <settings_api.h>
+#include "web_assets.h"
+
+// コンストラクタ
+WiFiManager::WiFiManager(const char* apSSID, const char* apPassword, const IPAddress& apIP)
+    : store(nullptr), apSSID(apSSID), apPassword(apPassword), apIP(apIP), currentMode(MODE_NORMAL), settingsApi(nullptr),
+      routesRegistered(false), serverRunning(false), linkState(LINK_IDLE), linkStateSince(0), retryDelayMs(RETRY_DELAY_MIN_MS), retryAt(0), failedAttempts(0),
+      reconnected(false), handleMaxUs(0), restartRequested(false), restartAt(0) {
+    // Webサーバーの初期化
+    server = new AsyncWebServer(80);
+}
+
+// 初期化
+void WiFiManager::begin(SettingsStore* settingsStore) {
+    // 設定は SettingsStore が起動時に読み込んである
+    store = settingsStore;
+    store->addListener(onSettingsChanged, this);
+    
+    // WiFiモードを初期化
+    WiFi.mode(WIFI_STA);
+    // 再接続は handleConnection() で間隔を空けて行う
+    WiFi.setAutoReconnect(false);
+    WiFi.disconnect();
+    delay(100);
+}
+
+// APモードを開始
+// STAと同時に動かすので、接続していれば時刻の同期も続く（APのチャンネルはSTAの接続先に合わせて変わる）
+void WiFiManager::startAPMode() {
+    WiFi.mode(WIFI_AP_STA);
+    WiFi.softAPConfig(apIP, apIP, IPAddress(255, 255, 255, 0));
+    WiFi.softAP(apSSID, apPassword);
+    currentMode = MODE_AP_SETUP;
+    
+    // 無線を止めていた時（省電力モード）は接続も始める
+    if (linkState == LINK_IDLE && getSSID().length() > 0) {
+        beginConnect();
+    }
+    Serial.println("APモードを開始しました");
+    Serial.printf("SSID: %s\n", apSSID);
+    Serial.printf("Password: %s\n", apPassword);
+    Serial.printf("IPアドレス: %s\n", apIP.toString().c_str());
+    
+    // Webサーバーを開く（ルートページは設定ページになる）
+    startWebServer();
+    Serial.println("  - ルートページ: http://192.168.4.1/");
+    Serial.println("  - テストページ: http://192.168.4.1/test");
+}
+
+// APモードを終了
+void WiFiManager::stopAPMode() {
+    WiFi.softAPdisconnect(true);
+    WiFi.mode(WIFI_STA);
+    currentMode = MODE_NORMAL;
+    
+    // WiFiを設定したばかりなら、ここで接続を始める（接続中・再接続待ちならそのまま handleConnection() で進める）
+    if (linkState == LINK_IDLE && getSSID().length() > 0) {
+        beginConnect();
+    }
+    Serial.println("APモードを終了しました");
+}
+
+// WiFiへの接続を始める（結果は handleConnection() で確認する）
+bool WiFiManager::startConnection() {
+    if (getSSID().length() == 0) {
+        Serial.println("WiFi設定がありません。APモードを開始します");
+        startAPMode();
+        return false;
+    }
+    
+    Serial.println("WiFiに接続中...");
+    
+    // WiFiモードをステーションモードに設定
+    WiFi.mode(WIFI_STA);
+    beginConnect();
+    return true;
+}
+
+// 状態を変更して、その時刻を記録
+void WiFiManager::setLinkState(LinkState state) {
+    linkState = state;
+    linkStateSince = millis();
+}
+
+// 接続を開始（結果は handleConnection() で確認する）
+void WiFiManager::beginConnect() {
+    ClockSettings current = store->get();
+    Serial.printf("WiFiネットワーク %s に接続を試みます...\n", current.ssid);
+    WiFi.disconnect();
+    WiFi.begin(current.ssid, current.password);
+    setLinkState(LINK_CONNECTING);
+}
+
+// 失敗したので待ち時間を空けて再接続する（待ち時間は失敗するたびに2倍、最大60秒）
+// 複数の機器が同時に再接続しないように、待ち時間の1/4までの揺らぎを加える
+void WiFiManager::scheduleRetry() {
+    WiFi.disconnect();
+    failedAttempts++;
+    uint32_t wait = retryDelayMs + random(retryDelayMs / 4 + 1);
+    retryAt = millis() + wait;
+    retryDelayMs = retryDelayMs * 2 > RETRY_DELAY_MAX_MS ? RETRY_DELAY_MAX_MS : retryDelayMs * 2;
+    setLinkState(LINK_BACKOFF);
+    Serial.printf("WiFi再接続まで %lu ms 待ちます（%u 回目の失敗）\n", (unsigned long)wait, failedAttempts);
+}
+
+// 無線を止める
+void WiFiManager::radioOff() {
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    failedAttempts = 0;
+    retryDelayMs = RETRY_DELAY_MIN_MS;
+    setLinkState(LINK_IDLE);
+    Serial.println("無線を止めました");
+}
+
+// 無線を入れ直して接続を始める
+void WiFiManager::radioOn() {
+    WiFi.mode(WIFI_STA);
+    beginConnect();
+}
+
+// WiFiの設定が変わったら接続し直す（無線を止めている時は、次に入れた時に新しい設定で接続する）
+void WiFiManager::onSettingsChanged(uint16_t changes, const ClockSettings& settings, void* context) {
+    WiFiManager* self = (WiFiManager*)context;
+    if (!(changes & SettingsStore::CHANGED_WIFI) || settings.ssid[0] == '\0' || WiFi.getMode() == WIFI_OFF) {
+        return;
+    }
+    self->failedAttempts = 0;
+    self->retryDelayMs = RETRY_DELAY_MIN_MS;
+    self->beginConnect();
+}
+
+// 接続状態を進める
+void WiFiManager::handleConnection() {
+    uint32_t start = micros();
+    uint32_t now = millis();
+    wl_status_t status = WiFi.status();
+    
+    switch (linkState) {
+    case LINK_IDLE:
+        break;
+        
+    case LINK_CONNECTING:
+        if (status == WL_CONNECTED) {
+            Serial.println("WiFi接続成功!");
+            Serial.printf("接続先SSID: %s\n", WiFi.SSID().c_str());
+            Serial.printf("IPアドレス: %s\n", WiFi.localIP().toString().c_str());
+            reconnected = failedAttempts > 0;
+            failedAttempts = 0;
+            retryDelayMs = RETRY_DELAY_MIN_MS;
+            setLinkState(LINK_CONNECTED);
+        } else if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL ||
+                   now - linkStateSince > CONNECT_TIMEOUT_MS) {
+            scheduleRetry();
+        }
+        break;
+        
+    case LINK_CONNECTED:
+        if (status != WL_CONNECTED) {
+            Serial.println("WiFi接続が切れました");
+            scheduleRetry();
+        }
+        break;
+        
+    case LINK_BACKOFF:
+        if ((int32_t)(now - retryAt) >= 0) {
+            beginConnect();
+        }
+        break;
+    }
+    
+    uint32_t elapsed = micros() - start;
+    if (elapsed > handleMaxUs) {
+        handleMaxUs = elapsed;
+    }
+}
+
+// 接続状態の名前
+const char* WiFiManager::getLinkStateName() {
+    switch (linkState) {
+    case LINK_CONNECTING: return "connecting";
+    case LINK_CONNECTED: return "connected";
+    case LINK_BACKOFF: return "backoff";
+    default: return "idle";
+    }
+}
+
+// 切断から復帰したか
+bool WiFiManager::takeReconnected() {
+    bool result = reconnected;
+    reconnected = false;
+    return result;
+}
+
+// handleConnection() の最長処理時間
+uint32_t WiFiManager::takeHandleMaxMicros() {
+    uint32_t result = handleMaxUs;
+    handleMaxUs = 0;
+    return result;
+}
+
+// OTAサーバーを初期化
+void WiFiManager::setupOTA() {
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("WiFi未接続のためOTAサーバーを開始できません");
+        return;
+    }
+    startWebServer();
+}
+
+// Webサーバーを開く
+void WiFiManager::startWebServer() {
+    if (!routesRegistered) {
+        registerRoutes();
+        routesRegistered = true;
+    }
+    if (!serverRunning) {
+        server->begin();
+        serverRunning = true;
+        Serial.println("Webサーバーを開始しました");
+    }
+}
+
+// Webサーバーを閉じる
+void WiFiManager::stopWebServer() {
+    if (serverRunning) {
+        server->end();
+        serverRunning = false;
+        Serial.println("Webサーバーを閉じました");
+    }
+}
+
+// すべてのページを登録
+// 1つのサーバーで両方のモードのページを受け付け、ルートページはモードで切り替え、
+// 設定モードだけのページ（テスト用）は setFilter() で通常モードでは404にする。
+// OTA更新ページ（AsyncElegantOTA）はどちらのモードでも、その時のOTAの認証情報で使える。
+void WiFiManager::registerRoutes() {
+    ArRequestFilterFunction setupOnly = [this](AsyncWebServerRequest *request) {
+        return currentMode == MODE_AP_SETUP;
+    };
+    
+    // 設定モードでAPから届いたリクエスト（設定の変更に認証が要らない。STA側のLANからは認証が要る）
+    ArRequestFilterFunction fromSetupAP = [this](AsyncWebServerRequest *request) {
+        return currentMode == MODE_AP_SETUP && request->client()->localIP() == apIP;
+    };
+    
+    // NOT FOUNDハンドラを設定
+    // 設定のAPIは同じオリジンのページからだけ使うので、CORSのヘッダーは付けない
+    server->onNotFound([](AsyncWebServerRequest *request) {
+        request->send(404, "text/plain", "Not found");
+    });
+    
+    // OTA更新ページの設定
+    // AsyncElegantOTA は begin() で渡した認証情報を持ち続けるので、認証は先に登録したハンドラで
+    // その時の設定と比べる（通らないリクエストだけを受けて401を返し、通れば AsyncElegantOTA が受ける）
+    server->on("/update", HTTP_ANY, [](AsyncWebServerRequest *request) {
+        request->requestAuthentication();
+    }).setFilter([this](AsyncWebServerRequest *request) {
+        ClockSettings current = store->get();
+        return !request->authenticate(current.otaUsername, current.otaPassword);
+    });
+    AsyncElegantOTA.begin(server);
+    
+    // ルートページ（通常モードはステータス、設定モードは設定ページ。値は /api/status・/api/settings から読み込む）
+    server->on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendAsset(request, currentMode == MODE_AP_SETUP ? webSetupHtml : webMainHtml);
+    });
+    
+    // 設定ページを追加
+    server->on("/setup", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendAsset(request, webSetupHtml);
+    }).setFilter(setupOnly);
+    
+    // 以前のURL（ルートページと同じ設定ページ）
+    server->on("/setup-template", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendAsset(request, webSetupHtml);
+    }).setFilter(setupOnly);
+    
+    // テストページ
+    server->on("/test", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendAsset(request, webTestHtml);
+    }).setFilter(setupOnly);
+    
+    // プレーンテキストテストページ
+    server->on("/plaintest", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(200, "text/plain", "ESP32 Web Server is working!");
+    }).setFilter(setupOnly);
+    
+    // ページから読み込むCSS・JSと値
+    registerStaticAssets();
+    server->on("/api/status", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendStatusJson(request);
+    });
+    
+    // 設定のREST API（以前の /save-wifi と /save-ota もここで登録する）
+    if (settingsApi != nullptr) {
+        settingsApi->registerRoutes(server, fromSetupAP);
+    }
+    
+    // 再起動ページ（設定の変更と同じく、設定モードでAPから届いたもの以外はOTAの認証情報が要る）
+    // このハンドラはWebサーバーのタスクで動くので、ここでは待たずに再起動の時刻だけを決め、再起動は handleRestart() で行う
+    server->on("/restart", HTTP_GET, [this, fromSetupAP](AsyncWebServerRequest *request) {
+        ClockSettings current = store->get();
+        if (!fromSetupAP(request) && !request->authenticate(current.otaUsername, current.otaPassword)) {
+            request->requestAuthentication();
+            return;
+        }
+        sendAsset(request, webRestartHtml);
+        restartAt = millis() + RESTART_DELAY_MS;
+        restartRequested = true;
+    });
+}
+
+// 再起動を頼まれていれば、応答を送り終えてから再起動する
+void WiFiManager::handleRestart() {
+    if (!restartRequested || (int32_t)(millis() - restartAt) < 0) {
+        return;
+    }
+    store->flush(); // 書いていない設定を保存してから再起動
+    Serial.println("再起動します");
+    ESP.restart();
+}
+
+// gzip圧縮済みのファイルを送る
+// HTMLはURLが変わらないので毎回ETagで確認させ、ハッシュ付きのURLのCSS・JSは1年間キャッシュさせる
+void WiFiManager::sendAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+    AsyncWebServerResponse* response;
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == asset.etag) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    request->send(response);
+}
+
+// URLにハッシュを含むファイルを登録
+void WiFiManager::registerStaticAssets() {
+    for (int i = 0; i < webStaticAssetCount; i++) {
+        const WebAsset* asset = webStaticAssets[i];
+        server->on(asset->path, HTTP_GET, [this, asset](AsyncWebServerRequest *request) {
+            sendAsset(request, *asset);
+        });
+    }
+}
+
+// メインページに表示する接続先とIPアドレス
+void WiFiManager::sendStatusJson(AsyncWebServerRequest* request) {
+    char ip[16];
+    uint32_t address = WiFi.localIP();
+    snprintf(ip, sizeof(ip), "%u.%u.%u.%u", (unsigned)(address & 0xFF), (unsigned)((address >> 8) & 0xFF),
+             (unsigned)((address >> 16) & 0xFF), (unsigned)(address >> 24));
+    char buffer[128];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.add("ssid", getSSID().c_str());
+    json.add("ip", ip);
+    json.endObject();
+    SettingsApi::sendJson(request, json);
+}
+
+// WiFi設定を保存
+void WiFiManager::saveWiFiSettings(const String& newSSID, const String& newPassword) {
+    ClockSettings next = store->get();
+    strncpy(next.ssid, newSSID.c_str(), sizeof(next.ssid) - 1);
+    next.ssid[sizeof(next.ssid) - 1] = '\0';
+    strncpy(next.password, newPassword.c_str(), sizeof(next.password) - 1);
+    next.password[sizeof(next.password) - 1] = '\0';
+    next.configured = 1;
+    store->update(next);
+    
+    Serial.println("WiFi設定を保存しました");
+    Serial.printf("SSID: %s\n", next.ssid);
+}
+
+// OTA設定を保存
+void WiFiManager::saveOTASettings(const String& newUsername, const String& newPassword) {
+    ClockSettings next = store->get();
+    strncpy(next.otaUsername, newUsername.c_str(), sizeof(next.otaUsername) - 1);
+    next.otaUsername[sizeof(next.otaUsername) - 1] = '\0';
+    strncpy(next.otaPassword, newPassword.c_str(), sizeof(next.otaPassword) - 1);
+    next.otaPassword[sizeof(next.otaPassword) - 1] = '\0';
+    store->update(next);
+    
+    Serial.println("OTA設定を保存しました");
+}
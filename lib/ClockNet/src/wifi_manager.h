@@ -0,0 +1,170 @@
+#ifndef WIFI_MANAGER_H
+#define WIFI_MANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#include <settings_store.h>
+#include "web_asset.h"
+
+// AsyncElegantOTAの前方宣言
+// 実際のインクルードはwifi_manager.cppで行う
+class AsyncElegantOtaClass;
+extern AsyncElegantOtaClass AsyncElegantOTA;
+
+class SettingsApi;
+
+class WiFiManager {
+public:
+    // 動作モード
+    enum OperationMode {
+        MODE_NORMAL,  // 通常モード（WiFi接続、時計表示）
+        MODE_AP_SETUP // 設定モード（APモードでWeb設定ページ提供。WiFiの接続と時計の表示はそのまま続ける）
+    };
+
+    // 接続状態（handleConnection() で進める）
+    enum LinkState {
+        LINK_IDLE,        // 接続していない（接続を開始していない、無線を止めている、またはAPモード）
+        LINK_CONNECTING,  // WiFi.begin() 後、接続待ち
+        LINK_CONNECTED,   // 接続中
+        LINK_BACKOFF      // 接続に失敗、または切断されて次の再接続を待っている
+    };
+    
+private:
+    // WiFi・OTAの設定（RAMに持っているので、使う時にその都度取り出す）
+    SettingsStore* store;
+    
+    // APモード設定
+    const char* apSSID;
+    const char* apPassword;
+    IPAddress apIP;
+    
+    OperationMode currentMode;
+    
+    // Webサーバー
+    AsyncWebServer* server;
+    
+    // 設定のREST API（/api/settings。最初にWebサーバーを開く時に登録する）
+    SettingsApi* settingsApi;
+    
+    // ページを登録した（1回だけ登録し、モードで使えるページを切り替える）
+    bool routesRegistered;
+    
+    // Webサーバーを開いている
+    bool serverRunning;
+    
+    // 接続のステートマシン
+    LinkState linkState;
+    uint32_t linkStateSince;       // 今の状態になった時刻（millis）
+    uint32_t retryDelayMs;         // 次に失敗した時の待ち時間（失敗するたびに2倍）
+    uint32_t retryAt;              // LINK_BACKOFF でこの時刻になったら再接続
+    uint16_t failedAttempts;       // 連続して失敗した回数
+    bool reconnected;              // 切断から復帰した（takeReconnected() で取得してリセット）
+    uint32_t handleMaxUs;          // handleConnection() の最長処理時間（統計用）
+
+    // /restart で頼まれた再起動（Webサーバーのタスクでは待たず、handleRestart() でこの時刻になったら再起動する）
+    volatile bool restartRequested;
+    volatile uint32_t restartAt;
+
+    // 接続待ちの上限と、再接続の待ち時間（最初の値と上限）
+    static const uint32_t CONNECT_TIMEOUT_MS = 10000;
+    static const uint32_t RETRY_DELAY_MIN_MS = 1000;
+    static const uint32_t RETRY_DELAY_MAX_MS = 60000;
+
+    // /restart の応答を送り終えるまで再起動を待つ時間
+    static const uint32_t RESTART_DELAY_MS = 1000;
+
+    void setLinkState(LinkState state);
+    void beginConnect();
+    void scheduleRetry();
+
+    // gzip圧縮済みのファイルを送る（If-None-Match がETagと同じなら304だけを返す）
+    void sendAsset(AsyncWebServerRequest* request, const WebAsset& asset);
+
+    // URLにハッシュを含むファイル（CSS・JS）をそれぞれのURLで登録
+    void registerStaticAssets();
+
+    // すべてのページを登録（設定モードだけのページはフィルタで切り替える）
+    void registerRoutes();
+    
+    // WiFiの設定が変わったら新しい設定で接続し直す
+    static void onSettingsChanged(uint16_t changes, const ClockSettings& settings, void* context);
+
+    // メインページに表示する値をJSONで送る
+    void sendStatusJson(AsyncWebServerRequest* request);
+
+public:
+    // コンストラクタ
+    WiFiManager(const char* apSSID = "ESP32-Clock-Setup", 
+                const char* apPassword = "12345678",
+                const IPAddress& apIP = IPAddress(192, 168, 4, 1));
+    
+    // 初期化（store は読み込み済みのもの）
+    void begin(SettingsStore* store);
+    
+    // 設定モードを開始（APを開き、STAの接続はそのまま保つ。Webサーバーも開く）
+    void startAPMode();
+    
+    // 設定モードを終えて通常モードに戻る（APを閉じる。再起動しない）
+    void stopAPMode();
+    
+    // WiFiへの接続を始める（起動時用。待たずに戻り、handleConnection() で接続を進める）
+    // 設定がなければAPモードを開始して false を返す
+    bool startConnection();
+
+    // 接続状態を進める（loop() から毎回呼ぶ。待たずにすぐ戻る）
+    // 切断されたら 1秒・2秒・4秒…（最大60秒）の間隔で再接続する
+    void handleConnection();
+
+    // 無線を止める・入れ直す（省電力モード。止めている間は再接続しない。入れ直すと handleConnection() で接続を進める）
+    void radioOff();
+    void radioOn();
+
+    // 接続状態
+    LinkState getLinkState() { return linkState; }
+    const char* getLinkStateName();
+
+    // /restart で頼まれていれば、応答を送り終えてから再起動する（loop() から毎回呼ぶ。待たずにすぐ戻る）
+    void handleRestart();
+
+    // 前回呼び出し以降に切断から復帰したか（取得してリセット）
+    bool takeReconnected();
+
+    // 前回呼び出し以降の handleConnection() の最長処理時間（us、取得してリセット）
+    uint32_t takeHandleMaxMicros();
+    
+    // WiFiに接続していればWebサーバー（OTA・状態・設定）を開く（stopWebServer() で閉じた後に呼ぶと開き直す）
+    void setupOTA();
+    
+    // Webサーバーを開く・閉じる（ページは最初に開く時に登録する）
+    void startWebServer();
+    void stopWebServer();
+    
+    // 設定のREST APIを使う（最初にWebサーバーを開くより前に設定）
+    void setSettingsApi(SettingsApi* api) { settingsApi = api; }
+    
+    // 現在のモードを取得
+    OperationMode getCurrentMode() { return currentMode; }
+    
+    // WiFi接続状態を取得
+    bool isConnected() { return WiFi.status() == WL_CONNECTED; }
+    
+    // 設定済みかどうかを取得
+    bool isWiFiConfigured() { return store->get().configured != 0; }
+    
+    // 設定を保存（NVSへの書き込みは SettingsStore がまとめて行う）
+    void saveWiFiSettings(const String& newSSID, const String& newPassword);
+    void saveOTASettings(const String& newUsername, const String& newPassword);
+    
+    // 設定値を取得
+    String getSSID() { return String(store->get().ssid); }
+    String getPassword() { return String(store->get().password); }
+    String getOTAUsername() { return String(store->get().otaUsername); }
+    String getOTAPassword() { return String(store->get().otaPassword); }
+    
+    // APモードのIPアドレスを取得
+    IPAddress getAPIP() { return apIP; }
+};
+
+#endif // WIFI_MANAGER_H
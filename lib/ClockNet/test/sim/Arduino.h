@@ -0,0 +1,91 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// ホストで動かすテスト用の Arduino（ESP32）の代わり
+// 時刻は仮想の時計で、millis()・micros() はテストが進めた分だけ進む。
+// delay() は仮想の時計を進めるので、待つ処理があればその分だけ1回の処理時間が延びて見える。
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+
+#define PROGMEM
+#define F(s) (s)
+
+typedef bool boolean;
+
+// 仮想の時計（us）
+class SimClock {
+public:
+    static uint64_t now();
+    static void advance(uint64_t us);
+    static void advanceMillis(uint32_t ms) { advance((uint64_t)ms * 1000); }
+};
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void yield();
+
+// 乱数（テストを繰り返せるように種は固定）
+void randomSeed(unsigned long seed);
+long random(long max);
+long random(long min, long max);
+
+class String : public std::string {
+public:
+    String() {}
+    String(const char* s) : std::string(s != nullptr ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    String(const char* s, size_t length) : std::string(s, length) {}
+    unsigned int length() const { return (unsigned int)size(); }
+    bool equals(const String& other) const { return *this == other; }
+};
+
+// シリアル出力（SimSerial::verbose が true の時だけ表示する）
+class SimSerial {
+public:
+    static bool verbose;
+    void begin(unsigned long) {}
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t println(const char* s = "");
+    size_t println(const String& s) { return println(s.c_str()); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+extern SimSerial Serial;
+
+class IPAddress {
+public:
+    IPAddress() : address(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : address((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+    IPAddress(uint32_t address) : address(address) {}
+    operator uint32_t() const { return address; }
+    bool operator==(const IPAddress& other) const { return address == other.address; }
+    uint8_t operator[](int index) const { return (uint8_t)(address >> (index * 8)); }
+    String toString() const;
+
+private:
+    uint32_t address;
+};
+
+// 再起動はテストでは回数を数えるだけ
+class EspClass {
+public:
+    int restartCount = 0;
+    void restart() { restartCount++; }
+    uint32_t getFreeHeap() { return 0; }
+};
+extern EspClass ESP;
+
+// ホストは1つのスレッドで動かすので、排他は何もしない
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,14 @@
+#ifndef SIM_ASYNC_ELEGANT_OTA_H
+#define SIM_ASYNC_ELEGANT_OTA_H
+
+// ホストで動かすテスト用の AsyncElegantOTA の代わり（ページを登録しない）
+#include <ESPAsyncWebServer.h>
+
+class AsyncElegantOtaClass {
+public:
+    void begin(AsyncWebServer*, const char* = "", const char* = "") {}
+};
+
+extern AsyncElegantOtaClass AsyncElegantOTA;
+
+#endif // SIM_ASYNC_ELEGANT_OTA_H
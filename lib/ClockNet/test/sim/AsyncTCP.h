@@ -0,0 +1,13 @@
+#ifndef SIM_ASYNC_TCP_H
+#define SIM_ASYNC_TCP_H
+
+// ホストで動かすテスト用の AsyncTCP の代わり（接続は作らない）
+#include <Arduino.h>
+
+class AsyncClient {
+public:
+    IPAddress localIP() { return IPAddress(); }
+    IPAddress remoteIP() { return IPAddress(); }
+};
+
+#endif // SIM_ASYNC_TCP_H
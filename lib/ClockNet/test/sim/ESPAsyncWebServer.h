@@ -0,0 +1,72 @@
+#ifndef SIM_ESP_ASYNC_WEB_SERVER_H
+#define SIM_ESP_ASYNC_WEB_SERVER_H
+
+// ホストで動かすテスト用の ESPAsyncWebServer の代わり
+// ページの登録は受け付けるだけで、リクエストは届かない（Webサーバーは WiFiManager のテストの対象外）。
+#include <Arduino.h>
+#include <functional>
+#include "AsyncTCP.h"
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerResponse {
+public:
+    void addHeader(const String&, const String&) {}
+};
+
+class AsyncWebServerRequest {
+public:
+    void* _tempObject = nullptr;
+
+    AsyncClient* client() { return &tcpClient; }
+    bool hasHeader(const String&) const { return false; }
+    String header(const char*) const { return String(); }
+    bool authenticate(const char*, const char*) { return false; }
+    void requestAuthentication() {}
+
+    AsyncWebServerResponse* beginResponse(int, const String& = String(), const String& = String()) { return &response; }
+    AsyncWebServerResponse* beginResponse_P(int, const String&, const uint8_t*, size_t) { return &response; }
+    void send(int, const String& = String(), const String& = String()) {}
+    void send(AsyncWebServerResponse*) {}
+
+private:
+    AsyncClient tcpClient;
+    AsyncWebServerResponse response;
+};
+
+typedef std::function<bool(AsyncWebServerRequest* request)> ArRequestFilterFunction;
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+
+class AsyncCallbackWebHandler {
+public:
+    AsyncCallbackWebHandler& setFilter(ArRequestFilterFunction) { return *this; }
+};
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t) {}
+    void begin() {}
+    void end() {}
+    AsyncCallbackWebHandler& on(const char*, WebRequestMethodComposite, ArRequestHandlerFunction,
+                                ArUploadHandlerFunction = nullptr, ArBodyHandlerFunction = nullptr) {
+        return handler;
+    }
+    void onNotFound(ArRequestHandlerFunction) {}
+
+private:
+    AsyncCallbackWebHandler handler;
+};
+
+#endif // SIM_ESP_ASYNC_WEB_SERVER_H
@@ -0,0 +1,39 @@
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+// ホストで動かすテスト用の Preferences（NVS）の代わり
+// 値はプロセスの間だけRAMに持つ（名前空間とキーで分ける）。
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end() { space = nullptr; }
+
+    bool isKey(const char* key);
+    bool remove(const char* key);
+    bool clear();
+
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+    size_t putBytes(const char* key, const void* value, size_t length);
+
+    size_t getString(const char* key, char* value, size_t maxLength);
+    size_t putString(const char* key, const char* value);
+    int32_t getInt(const char* key, int32_t defaultValue = 0);
+    size_t putInt(const char* key, int32_t value);
+    bool getBool(const char* key, bool defaultValue = false);
+    size_t putBool(const char* key, bool value);
+
+private:
+    typedef std::map<std::string, std::vector<uint8_t> > Space;
+    Space* space = nullptr;
+    bool readOnly = false;
+
+    const std::vector<uint8_t>* find(const char* key);
+    size_t put(const char* key, const void* value, size_t length);
+};
+
+#endif // SIM_PREFERENCES_H
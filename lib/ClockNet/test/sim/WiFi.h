@@ -0,0 +1,94 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+// ホストで動かすテスト用の WiFi（ESP32 の WiFiClass）の代わり
+// アクセスポイントを1つだけ持ち、テストから電波を止めたり応答しなくしたりする。
+// WiFi.begin() は実機と同じく待たずに戻り、接続の結果は仮想の時計が進むと status() に現れる。
+// WiFiの関数を呼ぶたびに CALL_US だけ仮想の時計を進める（ESP-IDFの呼び出しの処理時間の代わり）。
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+// シミュレーションのアクセスポイント
+struct SimAccessPoint {
+    const char* ssid = "sim-ap";
+    const char* password = "sim-password";
+    bool up = true;                 // 電波が出ている
+    bool responding = true;         // 認証に応答する（false なら接続待ちのまま何も起きない）
+    uint32_t associateMs = 1500;    // WiFi.begin() から接続するまでの時間
+    uint32_t rejectMs = 3000;       // パスワード違い・SSIDが見つからないと分かるまでの時間
+    uint32_t lossDetectMs = 6000;   // 電波が止まってから切断に気づくまでの時間（ビーコンのタイムアウト）
+};
+
+class WiFiClass {
+public:
+    // WiFiの関数1回の処理時間
+    static const uint32_t CALL_US = 50;
+
+    // テストから操作するアクセスポイント（電波は setApUp() で切り替える）
+    SimAccessPoint ap;
+
+    void setApUp(bool up);
+
+    // WiFi.begin() を呼んだ回数と、最後に呼んだ時刻（millis）
+    uint32_t getBeginCount() const { return beginCount; }
+    uint32_t getLastBeginAt() const { return lastBeginAt; }
+
+    // 状態を最初に戻す（アクセスポイントの設定も初期値に戻す）
+    void simReset();
+
+    bool mode(wifi_mode_t mode);
+    wifi_mode_t getMode();
+    bool setAutoReconnect(bool autoReconnect);
+    wl_status_t begin(const char* ssid, const char* password = nullptr);
+    bool disconnect(bool wifiOff = false, bool eraseAp = false);
+    wl_status_t status();
+    String SSID();
+    IPAddress localIP();
+
+    bool softAPConfig(IPAddress localIP, IPAddress gateway, IPAddress subnet);
+    bool softAP(const char* ssid, const char* password = nullptr);
+    bool softAPdisconnect(bool wifiOff = false);
+
+private:
+    // 接続の状態（status() を呼んだ時に仮想の時計に合わせて進める）
+    enum SimLink {
+        SIM_IDLE,           // 接続していない
+        SIM_JOINING,        // WiFi.begin() の後、結果が出るのを待っている
+        SIM_CONNECTED,
+        SIM_FAILED          // 結果（failStatus）が出た
+    };
+
+    wifi_mode_t currentMode = WIFI_OFF;
+    SimLink link = SIM_IDLE;
+    wl_status_t joinResult = WL_DISCONNECTED;  // SIM_JOINING の結果（WL_CONNECTED か失敗の理由）
+    bool joinSilent = false;        // 応答がないので結果が出ない
+    wl_status_t failStatus = WL_DISCONNECTED;  // SIM_FAILED の時の status()
+    uint32_t resultAt = 0;          // SIM_JOINING の結果が出る時刻、SIM_CONNECTED で切断に気づく時刻
+    bool lossPending = false;       // 接続中に電波が止まった
+    String joinedSsid;
+    uint32_t beginCount = 0;
+    uint32_t lastBeginAt = 0;
+
+    void call() { SimClock::advance(CALL_US); }
+    void update();
+};
+
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
@@ -0,0 +1,47 @@
+#ifndef SIM_WIFI_UDP_H
+#define SIM_WIFI_UDP_H
+
+// ホストで動かすテスト用の WiFiUDP の代わり
+// パケットはホストのループバック（127.0.0.1）のUDPで送る。端末から見たアドレスとポートは
+// SimNetwork::addRoute() でループバックのポートに置き換え、届いたパケットの送り元は元のアドレスに戻す。
+#include <Arduino.h>
+#include <vector>
+
+class SimNetwork {
+public:
+    // address:port に送ったパケットをループバックの loopbackPort に届ける
+    static void addRoute(IPAddress address, uint16_t port, uint16_t loopbackPort);
+    static void clear();
+
+    static bool findRoute(IPAddress address, uint16_t port, uint16_t& loopbackPort);
+    static bool findAddress(uint16_t loopbackPort, IPAddress& address, uint16_t& port);
+};
+
+class WiFiUDP {
+public:
+    ~WiFiUDP() { stop(); }
+
+    uint8_t begin(uint16_t port);
+    void stop();
+
+    int beginPacket(IPAddress ip, uint16_t port);
+    size_t write(const uint8_t* data, size_t size);
+    int endPacket();
+
+    // 届いたパケットを1つ取り出して長さを返す（無ければ 0。待たない）
+    int parsePacket();
+    int read(uint8_t* buffer, size_t size);
+    IPAddress remoteIP() { return remoteAddress; }
+    uint16_t remotePort() { return remotePortNumber; }
+
+private:
+    int fd = -1;
+    uint16_t sendPort = 0;             // 送り先のループバックのポート（0なら送らない）
+    std::vector<uint8_t> outgoing;
+    std::vector<uint8_t> incoming;
+    size_t readOffset = 0;
+    IPAddress remoteAddress;
+    uint16_t remotePortNumber = 0;
+};
+
+#endif // SIM_WIFI_UDP_H
@@ -0,0 +1,35 @@
+#ifndef SIM_LWIP_DNS_H
+#define SIM_LWIP_DNS_H
+
+// ホストで動かすテスト用の lwIP のDNSの代わり
+// 名前は SimDns::add() で登録したアドレスにすぐ解決する（キャッシュにある時と同じく ERR_OK を返す）。
+#include <Arduino.h>
+
+typedef int8_t err_t;
+#define ERR_OK 0
+#define ERR_INPROGRESS -5
+#define ERR_ARG -16
+
+typedef struct {
+    uint32_t addr;
+} ip4_addr_t;
+
+typedef struct {
+    ip4_addr_t u_addr;
+} ip_addr_t;
+
+#define IP_IS_V4(ipaddr) ((void)(ipaddr), 1)
+#define ip_2_ip4(ipaddr) (&((ipaddr)->u_addr))
+#define ip4_addr_get_u32(src_ipaddr) ((src_ipaddr)->addr)
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg);
+
+class SimDns {
+public:
+    static void add(const char* name, IPAddress address);
+    static void clear();
+};
+
+#endif // SIM_LWIP_DNS_H
@@ -0,0 +1,292 @@
+// ホストで動かすテスト用の Arduino・WiFi・Preferences の実装
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <AsyncElegantOTA.h>
+
+// 仮想の時計
+static uint64_t simNowUs = 0;
+
+uint64_t SimClock::now() { return simNowUs; }
+void SimClock::advance(uint64_t us) { simNowUs += us; }
+
+uint32_t millis() { return (uint32_t)(simNowUs / 1000); }
+uint32_t micros() { return (uint32_t)simNowUs; }
+void delay(uint32_t ms) { SimClock::advanceMillis(ms); }
+void yield() {}
+
+// 乱数（線形合同法）
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed) { randomState = (uint32_t)seed; }
+
+long random(long max) {
+    if (max <= 0) {
+        return 0;
+    }
+    randomState = randomState * 1103515245u + 12345u;
+    return (long)((randomState >> 8) % (uint32_t)max);
+}
+
+long random(long min, long max) { return min >= max ? min : min + random(max - min); }
+
+// シリアル出力
+bool SimSerial::verbose = false;
+SimSerial Serial;
+
+size_t SimSerial::print(const char* s) {
+    if (!verbose) {
+        return 0;
+    }
+    fputs(s, stdout);
+    return strlen(s);
+}
+
+size_t SimSerial::println(const char* s) {
+    return verbose ? ::printf("%s\n", s) : 0;
+}
+
+size_t SimSerial::printf(const char* format, ...) {
+    if (!verbose) {
+        return 0;
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vprintf(format, args);
+    va_end(args);
+    return length < 0 ? 0 : (size_t)length;
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(text);
+}
+
+EspClass ESP;
+AsyncElegantOtaClass AsyncElegantOTA;
+
+// Preferences（名前空間ごとのキーと値）
+static std::map<std::string, std::map<std::string, std::vector<uint8_t> > > simNvs;
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    space = &simNvs[name];
+    this->readOnly = readOnly;
+    return true;
+}
+
+const std::vector<uint8_t>* Preferences::find(const char* key) {
+    if (space == nullptr) {
+        return nullptr;
+    }
+    Space::const_iterator it = space->find(key);
+    return it == space->end() ? nullptr : &it->second;
+}
+
+size_t Preferences::put(const char* key, const void* value, size_t length) {
+    if (space == nullptr || readOnly) {
+        return 0;
+    }
+    const uint8_t* bytes = (const uint8_t*)value;
+    (*space)[key].assign(bytes, bytes + length);
+    return length;
+}
+
+bool Preferences::isKey(const char* key) { return find(key) != nullptr; }
+
+bool Preferences::remove(const char* key) {
+    return space != nullptr && !readOnly && space->erase(key) > 0;
+}
+
+bool Preferences::clear() {
+    if (space == nullptr || readOnly) {
+        return false;
+    }
+    space->clear();
+    return true;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    const std::vector<uint8_t>* value = find(key);
+    return value != nullptr ? value->size() : 0;
+}
+
+// 実機と同じく、値が入りきらなければ何も読まずに 0 を返す
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    const std::vector<uint8_t>* value = find(key);
+    if (value == nullptr || value->size() > maxLength) {
+        return 0;
+    }
+    memcpy(buffer, value->data(), value->size());
+    return value->size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    return put(key, value, length);
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLength) {
+    const std::vector<uint8_t>* stored = find(key);
+    if (stored == nullptr || stored->size() > maxLength) {
+        return 0;
+    }
+    memcpy(value, stored->data(), stored->size());
+    return stored->size();
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    return put(key, value, strlen(value) + 1);
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+    const std::vector<uint8_t>* value = find(key);
+    if (value == nullptr || value->size() != sizeof(int32_t)) {
+        return defaultValue;
+    }
+    int32_t result;
+    memcpy(&result, value->data(), sizeof(result));
+    return result;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) { return put(key, &value, sizeof(value)); }
+
+bool Preferences::getBool(const char* key, bool defaultValue) {
+    const std::vector<uint8_t>* value = find(key);
+    return value != nullptr && value->size() == 1 ? (*value)[0] != 0 : defaultValue;
+}
+
+size_t Preferences::putBool(const char* key, bool value) {
+    uint8_t byte = value ? 1 : 0;
+    return put(key, &byte, 1);
+}
+
+// WiFi
+WiFiClass WiFi;
+
+void WiFiClass::simReset() {
+    *this = WiFiClass();
+}
+
+void WiFiClass::setApUp(bool up) {
+    ap.up = up;
+    if (!up && link == SIM_JOINING && joinResult == WL_CONNECTED) {
+        joinResult = WL_NO_SSID_AVAIL;
+    } else if (!up && link == SIM_CONNECTED && !lossPending) {
+        // ビーコンが届かなくなってから気づくまで、接続中のまま
+        lossPending = true;
+        resultAt = millis() + ap.lossDetectMs;
+    } else if (up && link == SIM_CONNECTED) {
+        lossPending = false;
+    }
+}
+
+// 仮想の時計に合わせて接続の状態を進める
+void WiFiClass::update() {
+    uint32_t now = millis();
+    if (link == SIM_JOINING && !joinSilent && (int32_t)(now - resultAt) >= 0) {
+        if (joinResult == WL_CONNECTED) {
+            link = SIM_CONNECTED;
+            lossPending = false;
+        } else {
+            link = SIM_FAILED;
+            failStatus = joinResult;
+        }
+    } else if (link == SIM_CONNECTED && lossPending && (int32_t)(now - resultAt) >= 0) {
+        link = SIM_FAILED;
+        failStatus = WL_CONNECTION_LOST;
+    }
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    call();
+    if (!(mode & WIFI_STA)) {
+        link = SIM_IDLE;
+    }
+    currentMode = mode;
+    return true;
+}
+
+wifi_mode_t WiFiClass::getMode() {
+    call();
+    return currentMode;
+}
+
+bool WiFiClass::setAutoReconnect(bool) {
+    call();
+    return true;
+}
+
+// 結果はアクセスポイントのその時の状態で決め、associateMs・rejectMs の後に status() に現れる
+wl_status_t WiFiClass::begin(const char* ssid, const char* password) {
+    call();
+    beginCount++;
+    lastBeginAt = millis();
+    if (!(currentMode & WIFI_STA)) {
+        return WL_DISCONNECTED;
+    }
+    link = SIM_JOINING;
+    joinedSsid = ssid;
+    joinSilent = ap.up && !ap.responding;
+    if (!ap.up || strcmp(ssid, ap.ssid) != 0) {
+        joinResult = WL_NO_SSID_AVAIL;
+        resultAt = lastBeginAt + ap.rejectMs;
+    } else if (strcmp(password != nullptr ? password : "", ap.password) != 0) {
+        joinResult = WL_CONNECT_FAILED;
+        resultAt = lastBeginAt + ap.rejectMs;
+    } else {
+        joinResult = WL_CONNECTED;
+        resultAt = lastBeginAt + ap.associateMs;
+    }
+    return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool) {
+    call();
+    link = SIM_IDLE;
+    lossPending = false;
+    if (wifiOff) {
+        currentMode = WIFI_OFF;
+    }
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    call();
+    if (!(currentMode & WIFI_STA)) {
+        return WL_DISCONNECTED;
+    }
+    update();
+    switch (link) {
+    case SIM_CONNECTED: return WL_CONNECTED;
+    case SIM_FAILED: return failStatus;
+    default: return WL_DISCONNECTED;
+    }
+}
+
+String WiFiClass::SSID() {
+    call();
+    return link == SIM_CONNECTED ? joinedSsid : String();
+}
+
+IPAddress WiFiClass::localIP() {
+    call();
+    return link == SIM_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress();
+}
+
+bool WiFiClass::softAPConfig(IPAddress, IPAddress, IPAddress) {
+    call();
+    return true;
+}
+
+bool WiFiClass::softAP(const char*, const char*) {
+    call();
+    return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool wifiOff) {
+    call();
+    if (wifiOff) {
+        currentMode = (wifi_mode_t)(currentMode & ~WIFI_AP);
+    }
+    return true;
+}
@@ -0,0 +1,143 @@
+// ホストで動かすテスト用の WiFiUDP・DNS の実装（ループバックのUDP）
+#include <WiFiUdp.h>
+#include <lwip/dns.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+
+// 端末から見たアドレスとポート（アドレス << 16 | ポート）とループバックのポート
+static std::map<uint64_t, uint16_t> routes;
+
+static uint64_t routeKey(IPAddress address, uint16_t port) {
+    return ((uint64_t)(uint32_t)address << 16) | port;
+}
+
+void SimNetwork::addRoute(IPAddress address, uint16_t port, uint16_t loopbackPort) {
+    routes[routeKey(address, port)] = loopbackPort;
+}
+
+void SimNetwork::clear() { routes.clear(); }
+
+bool SimNetwork::findRoute(IPAddress address, uint16_t port, uint16_t& loopbackPort) {
+    std::map<uint64_t, uint16_t>::const_iterator it = routes.find(routeKey(address, port));
+    if (it == routes.end()) {
+        return false;
+    }
+    loopbackPort = it->second;
+    return true;
+}
+
+bool SimNetwork::findAddress(uint16_t loopbackPort, IPAddress& address, uint16_t& port) {
+    for (std::map<uint64_t, uint16_t>::const_iterator it = routes.begin(); it != routes.end(); ++it) {
+        if (it->second == loopbackPort) {
+            address = IPAddress((uint32_t)(it->first >> 16));
+            port = (uint16_t)(it->first & 0xFFFF);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- WiFiUDP ----
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+    stop();
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        return 0;
+    }
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    local.sin_port = htons(port);
+    if (bind(fd, (sockaddr*)&local, sizeof(local)) != 0) {
+        stop();
+        return 0;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return 1;
+}
+
+void WiFiUDP::stop() {
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+    incoming.clear();
+    readOffset = 0;
+}
+
+// 経路の無いアドレスに送ったパケットは、実機で届かなかった時と同じく捨てる
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+    outgoing.clear();
+    if (!SimNetwork::findRoute(ip, port, sendPort)) {
+        sendPort = 0;
+    }
+    return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t* data, size_t size) {
+    outgoing.insert(outgoing.end(), data, data + size);
+    return size;
+}
+
+int WiFiUDP::endPacket() {
+    if (fd < 0 || sendPort == 0) {
+        return 0;
+    }
+    sockaddr_in to = {};
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    to.sin_port = htons(sendPort);
+    ssize_t sent = sendto(fd, outgoing.data(), outgoing.size(), 0, (sockaddr*)&to, sizeof(to));
+    return sent == (ssize_t)outgoing.size() ? 1 : 0;
+}
+
+int WiFiUDP::parsePacket() {
+    if (fd < 0) {
+        return 0;
+    }
+    uint8_t buffer[1500];
+    sockaddr_in from = {};
+    socklen_t fromLength = sizeof(from);
+    ssize_t length = recvfrom(fd, buffer, sizeof(buffer), 0, (sockaddr*)&from, &fromLength);
+    if (length <= 0) {
+        return 0;
+    }
+    incoming.assign(buffer, buffer + length);
+    readOffset = 0;
+    if (!SimNetwork::findAddress(ntohs(from.sin_port), remoteAddress, remotePortNumber)) {
+        remoteAddress = IPAddress(127, 0, 0, 1);
+        remotePortNumber = ntohs(from.sin_port);
+    }
+    return (int)length;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t size) {
+    size_t available = incoming.size() - readOffset;
+    size_t length = size < available ? size : available;
+    memcpy(buffer, incoming.data() + readOffset, length);
+    readOffset += length;
+    return (int)length;
+}
+
+// ---- DNS ----
+
+static std::map<std::string, uint32_t> hosts;
+
+void SimDns::add(const char* name, IPAddress address) { hosts[name] = (uint32_t)address; }
+
+void SimDns::clear() { hosts.clear(); }
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback, void*) {
+    std::map<std::string, uint32_t>::const_iterator it = hosts.find(hostname);
+    if (it == hosts.end()) {
+        return ERR_ARG;
+    }
+    addr->u_addr.addr = it->second;
+    return ERR_OK;
+}
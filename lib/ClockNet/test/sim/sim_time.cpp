@@ -0,0 +1,84 @@
+// ホストで動かすテスト用の端末の時計の実装
+#include <Arduino.h>
+#include <sys/time.h>
+
+// 端末の時計 = 起動時の時刻 + 起動からの仮想の時間 × (1 + 水晶のずれ) + 合わせた分
+static int64_t bootUnixUs = 0;
+static uint64_t bootVirtualUs = 0;
+static double driftRatio = 0.0;
+static int64_t adjustUs = 0;
+static int64_t slewRemainingUs = 0;
+static uint64_t slewCheckedAt = 0;
+static uint32_t setCount = 0;
+
+static const int SLEW_SHIFT = 6;    // 経過時間の 1/64 の速さで合わせる
+
+static int64_t freeRunning() {
+    uint64_t elapsed = SimClock::now() - bootVirtualUs;
+    return bootUnixUs + (int64_t)elapsed + (int64_t)(elapsed * driftRatio);
+}
+
+// adjtime() で頼まれた分を、前回から経過した時間に応じて進める
+static void advanceSlew() {
+    uint64_t now = SimClock::now();
+    int64_t step = (int64_t)((now - slewCheckedAt) >> SLEW_SHIFT);
+    slewCheckedAt = now;
+    if (slewRemainingUs > 0) {
+        step = step < slewRemainingUs ? step : slewRemainingUs;
+    } else {
+        step = step < -slewRemainingUs ? -step : slewRemainingUs;
+    }
+    adjustUs += step;
+    slewRemainingUs -= step;
+}
+
+void SimSystemClock::reset(int64_t unixUs, double driftPpm) {
+    bootUnixUs = unixUs;
+    bootVirtualUs = SimClock::now();
+    driftRatio = driftPpm * 1e-6;
+    adjustUs = 0;
+    slewRemainingUs = 0;
+    slewCheckedAt = bootVirtualUs;
+    setCount = 0;
+}
+
+int64_t SimSystemClock::now() {
+    advanceSlew();
+    return freeRunning() + adjustUs;
+}
+
+int64_t SimSystemClock::pendingSlew() {
+    advanceSlew();
+    return slewRemainingUs;
+}
+
+uint32_t SimSystemClock::getSetCount() { return setCount; }
+
+int simGettimeofday(struct timeval* tv, void*) {
+    int64_t now = SimSystemClock::now();
+    tv->tv_sec = (time_t)(now / 1000000);
+    tv->tv_usec = (suseconds_t)(now % 1000000);
+    return 0;
+}
+
+// ESP-IDF と同じく、時計を合わせると adjtime() の残りは捨てる
+int simSettimeofday(const struct timeval* tv, const void*) {
+    advanceSlew();
+    int64_t target = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+    adjustUs = target - freeRunning();
+    slewRemainingUs = 0;
+    setCount++;
+    return 0;
+}
+
+int simAdjtime(const struct timeval* delta, struct timeval* olddelta) {
+    advanceSlew();
+    if (olddelta != nullptr) {
+        olddelta->tv_sec = (time_t)(slewRemainingUs / 1000000);
+        olddelta->tv_usec = (suseconds_t)(slewRemainingUs % 1000000);
+    }
+    if (delta != nullptr) {
+        slewRemainingUs = (int64_t)delta->tv_sec * 1000000 + delta->tv_usec;
+    }
+    return 0;
+}
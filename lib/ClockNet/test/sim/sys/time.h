@@ -0,0 +1,36 @@
+#ifndef SIM_SYS_TIME_H
+#define SIM_SYS_TIME_H
+
+// ホストで動かすテスト用の端末の時計
+// ホストの <sys/time.h> を読んだ上で、gettimeofday()・settimeofday()・adjtime() を端末の時計に置き換える
+// （テストするソースがホストの時計を合わせないように）。
+// 端末の時計は仮想の時計から作り、水晶の周波数のずれ（ppm）を含む。
+// adjtime() は ESP-IDF と同じく、経過時間の 1/64 の速さで少しずつ合わせる。
+#include_next <sys/time.h>
+#include <stdint.h>
+
+int simGettimeofday(struct timeval* tv, void* tz);
+int simSettimeofday(const struct timeval* tv, const void* tz);
+int simAdjtime(const struct timeval* delta, struct timeval* olddelta);
+
+#define gettimeofday simGettimeofday
+#define settimeofday simSettimeofday
+#define adjtime simAdjtime
+
+// テストから使う
+class SimSystemClock {
+public:
+    // 起動時の端末の時刻（UNIX時刻 us）と水晶のずれ（正なら進む）を決める（仮想の時計の今を起動時とする）
+    static void reset(int64_t bootUnixUs, double driftPpm);
+
+    // 端末の時計（UNIX時刻 us）
+    static int64_t now();
+
+    // まだ adjtime() で合わせていない分（us）
+    static int64_t pendingSlew();
+
+    // settimeofday() を呼んだ回数
+    static uint32_t getSetCount();
+};
+
+#endif // SIM_SYS_TIME_H
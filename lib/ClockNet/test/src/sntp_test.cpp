@@ -0,0 +1,340 @@
+// SntpClient のホスト用テスト
+// ループバックのUDPで動くNTPサーバーの代わり（NtpStandIn）を同じプロセスに置き、SntpClient から
+// 本物のUDPで問い合わせる。サーバーは片道ごとの遅れの揺らぎ（ジッタ）・まれな大きな遅れ・時計のずれ・
+// 応答の欠落を加えて返す。時刻は仮想の時計で、端末の時計（sim/sys/time.h）は水晶のずれを含めて
+// そこから作るので、何日分の動作でもすぐに終わる。
+// 最初の同期が一致する2つの応答を待ってから合わせること、おかしなサーバーを除くこと、
+// 周波数のずれを求めて同期の間隔を伸ばすことを確かめる。
+#include <stdio.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <random>
+#include <vector>
+#include <lwip/dns.h>
+#include <sys/time.h>
+#include <sntp_client.h>
+
+// 本当の時刻（仮想の時計の0を 2026-01-01 00:00:00 UTC とする）
+static const int64_t TRUE_EPOCH_US = 1767225600LL * 1000000;
+
+static int64_t trueNow() {
+    return TRUE_EPOCH_US + (int64_t)SimClock::now();
+}
+
+// 端末の時計の誤差（us）
+static int64_t clockError() {
+    return SimSystemClock::now() - trueNow();
+}
+
+static const uint32_t NTP_UNIX_DELTA = 2208988800UL;
+static const uint16_t NTP_PORT = 123;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %s %s\n", ok ? "OK" : "NG", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+static void write32(uint8_t* p, uint32_t value) {
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+static void writeNtpTime(uint8_t* p, int64_t unixUs) {
+    write32(p, (uint32_t)(unixUs / 1000000 + NTP_UNIX_DELTA));
+    write32(p + 4, (uint32_t)(((uint64_t)(unixUs % 1000000) << 32) / 1000000));
+}
+
+// ループバックのUDPで動くNTPサーバーの代わり
+// 問い合わせは届いた時（仮想の時計）に片道の遅れを足して受け取ったことにし、応答は帰りの遅れの後に送る。
+class NtpStandIn {
+public:
+    // 加える遅れ・ずれ
+    int64_t offsetUs = 0;           // サーバーの時計のずれ（正なら進んでいる）
+    uint32_t baseDelayUs = 10000;   // 片道の遅れ
+    uint32_t jitterUs = 20000;      // 片道ごとに 0〜jitterUs を足す
+    uint32_t spikePercent = 0;      // 帰りだけが spikeUs 遅れる確率
+    uint32_t spikeUs = 400000;
+    int spikeFirst = 0;             // 最初のこの数の応答は必ず帰りだけが spikeUs 遅れる
+    uint32_t dropPercent = 0;       // 応答しない確率
+    int replyLimit = -1;            // この数だけ応答したら以後は応答しない（-1 なら制限なし）
+
+    uint32_t requests = 0;
+    uint32_t replies = 0;
+
+    NtpStandIn(const char* name, IPAddress address, uint32_t seed) : rng(seed) {
+        fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in local = {};
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        local.sin_port = 0;
+        bind(fd, (sockaddr*)&local, sizeof(local));
+        socklen_t length = sizeof(local);
+        getsockname(fd, (sockaddr*)&local, &length);
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        SimDns::add(name, address);
+        SimNetwork::addRoute(address, NTP_PORT, ntohs(local.sin_port));
+    }
+
+    ~NtpStandIn() { close(fd); }
+
+    bool hasPending() const { return !pending.empty(); }
+
+    // 届いた問い合わせを受け取り、送る時刻になった応答を送る
+    void poll() {
+        uint8_t request[64];
+        sockaddr_in from = {};
+        socklen_t fromLength = sizeof(from);
+        ssize_t length;
+        while ((length = recvfrom(fd, request, sizeof(request), 0, (sockaddr*)&from, &fromLength)) > 0) {
+            requests++;
+            if (length < 48 || (replyLimit >= 0 && (int)replies >= replyLimit) || percent(dropPercent)) {
+                continue;
+            }
+            replies++;
+            uint64_t receivedAt = SimClock::now() + oneWay();
+            uint64_t sentAt = receivedAt + 50;
+            Reply reply;
+            memset(reply.packet, 0, sizeof(reply.packet));
+            reply.packet[0] = (0 << 6) | (4 << 3) | 4;     // LI=0, バージョン4, サーバー
+            reply.packet[1] = 2;                           // stratum
+            reply.packet[2] = 6;
+            reply.packet[3] = (uint8_t)-20;
+            write32(reply.packet + 4, 0x0000028F);         // root delay 10ms
+            write32(reply.packet + 8, 0x00000148);         // root dispersion 5ms
+            memcpy(reply.packet + 12, "SIM", 4);
+            writeNtpTime(reply.packet + 16, TRUE_EPOCH_US + offsetUs);
+            memcpy(reply.packet + 24, request + 40, 8);    // originate = 問い合わせの transmit
+            writeNtpTime(reply.packet + 32, TRUE_EPOCH_US + (int64_t)receivedAt + offsetUs);
+            writeNtpTime(reply.packet + 40, TRUE_EPOCH_US + (int64_t)sentAt + offsetUs);
+            uint64_t back = oneWay();
+            if (spikeFirst > 0 || percent(spikePercent)) {
+                back += spikeUs;
+                spikeFirst = spikeFirst > 0 ? spikeFirst - 1 : 0;
+            }
+            reply.deliverAt = sentAt + back;
+            reply.to = from;
+            pending.push_back(reply);
+        }
+
+        for (size_t i = 0; i < pending.size();) {
+            if (pending[i].deliverAt <= SimClock::now()) {
+                sendto(fd, pending[i].packet, sizeof(pending[i].packet), 0, (sockaddr*)&pending[i].to, sizeof(pending[i].to));
+                pending.erase(pending.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+
+private:
+    struct Reply {
+        uint64_t deliverAt;
+        uint8_t packet[48];
+        sockaddr_in to;
+    };
+
+    int fd;
+    std::mt19937 rng;
+    std::vector<Reply> pending;
+
+    bool percent(uint32_t p) { return p > 0 && std::uniform_int_distribution<uint32_t>(0, 99)(rng) < p; }
+    uint64_t oneWay() { return baseDelayUs + std::uniform_int_distribution<uint32_t>(0, jitterUs)(rng); }
+};
+
+// 時計の loop() の代わり（問い合わせ中は1msごと、待っている間は1秒ごとに handle() を呼ぶ）
+struct Harness {
+    SntpClient client;
+    std::vector<NtpStandIn*> servers;
+    uint32_t repliesAtFirstStep = 0;    // 最初に時計を合わせた時までに届いた応答の数
+    int64_t errorAtFirstStep = 0;
+    uint32_t firstStepAt = 0;           // 最初に時計を合わせた時刻（begin() からの ms）
+    uint32_t startedAt = 0;
+
+    Harness(double driftPpm) {
+        SimDns::clear();
+        SimNetwork::clear();
+        WiFi.simReset();
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(WiFi.ap.ssid, WiFi.ap.password);
+        SimClock::advanceMillis(WiFi.ap.associateMs);
+        // 起動時の端末の時計は1970年
+        SimSystemClock::reset(0, driftPpm);
+    }
+
+    ~Harness() {
+        for (NtpStandIn* server : servers) {
+            delete server;
+        }
+    }
+
+    NtpStandIn& addServer(const char* name, IPAddress address) {
+        servers.push_back(new NtpStandIn(name, address, 1000 + (uint32_t)servers.size()));
+        return *servers.back();
+    }
+
+    void begin(const char* list) {
+        client.setServers(list);
+        client.begin();
+        startedAt = millis();
+    }
+
+    void runFor(uint32_t ms) {
+        uint64_t end = SimClock::now() + (uint64_t)ms * 1000;
+        while (SimClock::now() < end) {
+            for (NtpStandIn* server : servers) {
+                server->poll();
+            }
+            uint32_t setCount = SimSystemClock::getSetCount();
+            client.handle();
+            if (setCount == 0 && SimSystemClock::getSetCount() > 0) {
+                repliesAtFirstStep = client.getReplyCount();
+                errorAtFirstStep = clockError();
+                firstStepAt = millis() - startedAt;
+            }
+            bool busy = client.getState() == SntpClient::STATE_ROUND;
+            for (NtpStandIn* server : servers) {
+                server->poll();
+                busy = busy || server->hasPending();
+            }
+            uint32_t wait = busy ? 1 : client.getMillisUntilNextSync();
+            wait = wait < 1 ? 1 : (wait > 1000 ? 1000 : wait);
+            SimClock::advanceMillis(wait);
+        }
+    }
+
+    // 今のラウンドが終わるまで
+    void finishRound() {
+        uint32_t rounds = client.getRoundCount();
+        while (client.getRoundCount() == rounds) {
+            runFor(1);
+        }
+    }
+};
+
+static double us2ms(int64_t us) { return us / 1000.0; }
+
+// ジッタのある3つのサーバーで最初の同期
+static void testInitialSync() {
+    printf("最初の同期（3つのサーバー、片道 10〜30ms）\n");
+    Harness harness(0.0);
+    harness.addServer("a.ntp.test", IPAddress(10, 0, 0, 1));
+    harness.addServer("b.ntp.test", IPAddress(10, 0, 0, 2));
+    harness.addServer("c.ntp.test", IPAddress(10, 0, 0, 3));
+    harness.begin("a.ntp.test,b.ntp.test,c.ntp.test");
+    harness.finishRound();
+    printf("  最初に合わせた時: 応答 %u 個, %u ms, 誤差 %.2f ms / ラウンドの後: 誤差 %.2f ms\n",
+           (unsigned)harness.repliesAtFirstStep, (unsigned)harness.firstStepAt,
+           us2ms(harness.errorAtFirstStep), us2ms(clockError() + SimSystemClock::pendingSlew()));
+    check(harness.client.isSynchronized() && harness.client.getStepCount() == 1, "1回のステップで合わせる");
+    check(harness.repliesAtFirstStep >= 2, "2つ以上の応答がそろってから合わせる");
+    check(harness.firstStepAt < 1000, "最初の応答が届いた後すぐに合わせる（ラウンドの終わりを待たない）");
+    check(llabs(harness.errorAtFirstStep) < 20000, "最初に合わせた誤差は片道の揺らぎの半分以内");
+}
+
+// 最初の応答の帰りだけが大きく遅れる（1つの応答で合わせると 300ms ずれる）
+static void testDelayedFirstReply() {
+    printf("最初の応答の帰りだけが600ms遅れる\n");
+    Harness harness(0.0);
+    NtpStandIn& server = harness.addServer("ntp.test", IPAddress(10, 0, 0, 1));
+    server.jitterUs = 2000;
+    server.spikeFirst = 1;
+    server.spikeUs = 600000;
+    harness.begin("ntp.test");
+    harness.finishRound();
+    printf("  最初に合わせた時: 応答 %u 個, 誤差 %.2f ms\n",
+           (unsigned)harness.repliesAtFirstStep, us2ms(harness.errorAtFirstStep));
+    check(harness.client.isSynchronized() && harness.client.getStepCount() == 1, "1回のステップで合わせる");
+    check(llabs(harness.errorAtFirstStep) < 5000, "遅れた応答ではなく往復時間の短い応答で合わせる");
+}
+
+// 時刻が1時間ずれたサーバーが一番早く答える
+static void testFalseticker() {
+    printf("1時間ずれたサーバーが一番早く答える\n");
+    Harness harness(0.0);
+    NtpStandIn& wrong = harness.addServer("wrong.ntp.test", IPAddress(10, 0, 0, 1));
+    wrong.offsetUs = 3600LL * 1000000;
+    wrong.baseDelayUs = 1000;
+    wrong.jitterUs = 1000;
+    harness.addServer("b.ntp.test", IPAddress(10, 0, 0, 2)).baseDelayUs = 20000;
+    harness.addServer("c.ntp.test", IPAddress(10, 0, 0, 3)).baseDelayUs = 20000;
+    harness.begin("wrong.ntp.test,b.ntp.test,c.ntp.test");
+    harness.finishRound();
+    printf("  最初に合わせた時: 誤差 %.2f ms\n", us2ms(harness.errorAtFirstStep));
+    check(llabs(harness.errorAtFirstStep) < 20000, "ずれたサーバー同士の応答では合わせない");
+    harness.runFor(3600 * 1000);
+    printf("  1時間後: 誤差 %.2f ms, ステップ %u 回\n", us2ms(clockError()), (unsigned)harness.client.getStepCount());
+    check(harness.client.getStepCount() == 1 && llabs(clockError()) < 50000, "ずれたサーバーを除いて合わせ続ける");
+}
+
+// 1つしか応答が届かないラウンドでは合わせない
+static void testNoAgreement() {
+    printf("1つしか応答が届かない\n");
+    Harness harness(0.0);
+    NtpStandIn& server = harness.addServer("ntp.test", IPAddress(10, 0, 0, 1));
+    server.replyLimit = 1;
+    harness.begin("ntp.test");
+    harness.finishRound();
+    check(!harness.client.isSynchronized() && SimSystemClock::getSetCount() == 0, "1つの応答では合わせない");
+    uint32_t retry = harness.client.getMillisUntilNextSync();
+    check(retry <= SntpClient::RETRY_MIN_S * 1000, "失敗として早めに再試行する");
+
+    server.replyLimit = -1;
+    harness.runFor(retry + 1000);
+    harness.finishRound();
+    check(harness.client.isSynchronized() && harness.client.getStepCount() == 1, "応答がそろえば合わせる");
+}
+
+// 水晶が +50ppm 進む端末を3日間動かす
+static void testDrift() {
+    printf("+50ppm の水晶で3日間（ジッタ 片道 0〜20ms、5%% は帰りが 400ms 遅れる、5%% は応答なし）\n");
+    Harness harness(50.0);
+    for (int i = 0; i < 3; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "%c.ntp.test", 'a' + i);
+        NtpStandIn& server = harness.addServer(name, IPAddress(10, 0, 0, 1 + i));
+        server.spikePercent = 5;
+        server.dropPercent = 5;
+    }
+    harness.begin("a.ntp.test,b.ntp.test,c.ntp.test");
+
+    int64_t maxError = 0;
+    for (int hour = 0; hour < 72; hour++) {
+        harness.runFor(3600 * 1000);
+        // 最初の12時間は周波数のずれを求めている途中なので数えない
+        if (hour >= 12 && llabs(clockError()) > maxError) {
+            maxError = llabs(clockError());
+        }
+    }
+    SntpClient& client = harness.client;
+    printf("  周波数 %.2f ppm, 同期の間隔 %u 秒, ラウンド %u 回, 問い合わせ %u 回, 無線 %u ms, 12時間後からの最大誤差 %.2f ms\n",
+           client.getFrequencyPpm(), (unsigned)client.getPollSeconds(), (unsigned)client.getRoundCount(),
+           (unsigned)client.getQueryCount(), (unsigned)client.getRadioMillis(), us2ms(maxError));
+    check(client.getFrequencyPpm() > -55.0f && client.getFrequencyPpm() < -45.0f, "周波数のずれ（-50ppm の補正）を求める");
+    check(client.getPollSeconds() > SntpClient::MIN_POLL_S, "同期の間隔を伸ばす");
+    check(client.getStepCount() == 1, "最初の1回の後はステップしない");
+    check(maxError < 50000, "12時間後からの誤差は50ms以内");
+}
+
+int main() {
+    testInitialSync();
+    testDelayedFirstReply();
+    testFalseticker();
+    testNoAgreement();
+    testDrift();
+
+    if (failures > 0) {
+        printf("%d 件の失敗\n", failures);
+        return 1;
+    }
+    printf("すべて成功\n");
+    return 0;
+}
@@ -0,0 +1,260 @@
+// WiFiManager の再接続のホスト用テスト
+// 時計の loop() と同じく、30fpsの1フレームごとに settingsStore.handle()・handleConnection() と描画を行い、
+// シミュレーションのWiFi（sim/WiFi.h）でアクセスポイントを止めたり戻したりする。
+// 再接続の間もフレームの時間が予算（33ms）に収まること、再接続の間隔が 1秒・2秒・4秒…（最大60秒）に
+// 揺らぎを加えたものになること、電波が戻ったら接続し直すことを確かめる。
+// 時刻は仮想の時計なので、何分間の動作でもすぐに終わり、結果は毎回同じになる。
+#include <stdio.h>
+#include <vector>
+#include <settings_store.h>
+#include <wifi_manager.h>
+
+// 1フレームの予算（30fps）と描画にかかる時間
+static const uint32_t FRAME_US = 33333;
+static const uint32_t RENDER_US = 20000;
+
+// handleConnection() 1回に許す時間（WiFiの関数を数回呼ぶ分）
+static const uint32_t HANDLE_BUDGET_US = 1000;
+
+// WiFiManager の再接続の待ち時間（wifi_manager.h と同じ値）
+static const uint32_t RETRY_DELAY_MIN_MS = 1000;
+static const uint32_t RETRY_DELAY_MAX_MS = 60000;
+static const uint32_t CONNECT_TIMEOUT_MS = 10000;
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %s %s\n", ok ? "OK" : "NG", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+// 時計の loop() の代わり
+struct ClockLoop {
+    SettingsStore store;
+    WiFiManager wifi;
+    uint32_t frames = 0;
+    uint32_t maxFrameUs = 0;        // 1フレームの処理時間（描画を含む）の最長
+    uint32_t maxHandleUs = 0;       // handleConnection() 1回の最長
+    uint32_t overruns = 0;          // 予算を超えたフレーム
+    std::vector<uint32_t> attempts; // WiFi.begin() を呼んだ時刻（ms）
+    int reconnects = 0;             // takeReconnected() が true を返した回数
+
+    // 設定を書き込み、WiFiManager を初期化して接続を始める
+    void boot(const char* ssid, const char* password) {
+        store.begin("ntp.nict.jp", "Asia/Tokyo", 128);
+        ClockSettings settings = store.get();
+        strncpy(settings.ssid, ssid, sizeof(settings.ssid) - 1);
+        strncpy(settings.password, password, sizeof(settings.password) - 1);
+        settings.configured = 1;
+        store.update(settings);
+        store.handle();
+        wifi.begin(&store);
+        wifi.startConnection();
+    }
+
+    void run(uint32_t ms) {
+        uint64_t end = SimClock::now() + (uint64_t)ms * 1000;
+        while (SimClock::now() < end) {
+            uint64_t start = SimClock::now();
+            uint32_t beginCount = WiFi.getBeginCount();
+
+            store.handle();
+            uint64_t handleStart = SimClock::now();
+            wifi.handleConnection();
+            uint32_t handleUs = (uint32_t)(SimClock::now() - handleStart);
+            if (wifi.takeReconnected()) {
+                reconnects++;
+            }
+            SimClock::advance(RENDER_US);
+
+            if (WiFi.getBeginCount() != beginCount) {
+                attempts.push_back(WiFi.getLastBeginAt());
+            }
+            uint32_t frameUs = (uint32_t)(SimClock::now() - start);
+            maxFrameUs = frameUs > maxFrameUs ? frameUs : maxFrameUs;
+            maxHandleUs = handleUs > maxHandleUs ? handleUs : maxHandleUs;
+            if (frameUs > FRAME_US) {
+                overruns++;
+            } else {
+                SimClock::advance(FRAME_US - frameUs);
+            }
+            frames++;
+        }
+    }
+
+    // 最後の WiFi.begin() から、接続の状態が state になるまで
+    bool runUntil(WiFiManager::LinkState state, uint32_t limitMs) {
+        uint32_t start = millis();
+        while (wifi.getLinkState() != state) {
+            if (millis() - start > limitMs) {
+                return false;
+            }
+            run(FRAME_US / 1000);
+        }
+        return true;
+    }
+
+    void checkFrameBudget() {
+        printf("  %u フレーム, 最長 %u us, handleConnection() 最長 %u us, 超過 %u\n",
+               (unsigned)frames, (unsigned)maxFrameUs, (unsigned)maxHandleUs, (unsigned)overruns);
+        check(overruns == 0, "すべてのフレームが予算に収まる");
+        check(maxHandleUs <= HANDLE_BUDGET_US, "handleConnection() は待たずに戻る");
+        check(wifi.takeHandleMaxMicros() <= HANDLE_BUDGET_US, "takeHandleMaxMicros() も同じ");
+    }
+};
+
+// 待ち時間（揺らぎを含む）が、失敗した回数に合った範囲にあるか
+// interval は WiFi.begin() の間隔、attemptMs はその間の接続の試みにかかった時間
+static bool inBackoffRange(uint32_t interval, uint32_t attemptMs, uint32_t delayMs) {
+    uint32_t frameMs = FRAME_US / 1000 + 1;
+    return interval >= attemptMs + delayMs && interval <= attemptMs + delayMs + delayMs / 4 + 2 * frameMs;
+}
+
+static uint32_t nextDelay(uint32_t delayMs) {
+    return delayMs * 2 > RETRY_DELAY_MAX_MS ? RETRY_DELAY_MAX_MS : delayMs * 2;
+}
+
+// 起動して接続する
+static void testBoot() {
+    printf("起動して接続\n");
+    WiFi.simReset();
+    ClockLoop clock;
+    clock.boot(WiFi.ap.ssid, WiFi.ap.password);
+    check(clock.runUntil(WiFiManager::LINK_CONNECTED, WiFi.ap.associateMs + 100), "associateMs のうちに接続する");
+    clock.run(5000);
+    check(WiFi.getBeginCount() == 1, "WiFi.begin() は1回だけ");
+    check(clock.reconnects == 0, "起動時の接続は再接続として数えない");
+    clock.checkFrameBudget();
+}
+
+// アクセスポイントが5分間止まり、戻ってくる
+static void testOutage() {
+    printf("アクセスポイントが5分間止まる\n");
+    WiFi.simReset();
+    ClockLoop clock;
+    clock.boot(WiFi.ap.ssid, WiFi.ap.password);
+    clock.runUntil(WiFiManager::LINK_CONNECTED, 5000);
+    clock.run(10000);
+    clock.attempts.clear();
+
+    uint32_t downAt = millis();
+    WiFi.setApUp(false);
+    check(clock.runUntil(WiFiManager::LINK_BACKOFF, WiFi.ap.lossDetectMs + 100), "ビーコンのタイムアウトで切断に気づく");
+    clock.run(300000 - (millis() - downAt));
+    uint32_t upAt = millis();
+    WiFi.setApUp(true);
+    // 最長の待ち時間（揺らぎを含む）と、その前の試みの時間のうちに接続し直す
+    uint32_t limit = RETRY_DELAY_MAX_MS + RETRY_DELAY_MAX_MS / 4 + WiFi.ap.rejectMs + WiFi.ap.associateMs + 100;
+    check(clock.runUntil(WiFiManager::LINK_CONNECTED, limit), "電波が戻ったら接続し直す");
+    printf("  電波が戻ってから %u ms で接続, 再接続の試み %u 回\n",
+           (unsigned)(millis() - upAt), (unsigned)clock.attempts.size());
+
+    // 切断に気づいてから最初の試みまでは1秒、その後は失敗するたびに2倍（SSIDが見つからず rejectMs で失敗する）
+    bool ordered = clock.attempts.size() >= 8;
+    uint32_t delayMs = RETRY_DELAY_MIN_MS;
+    uint32_t last = downAt + WiFi.ap.lossDetectMs;
+    printf("  試みた時刻（電波が止まってからの秒）:");
+    for (size_t i = 0; i < clock.attempts.size(); i++) {
+        uint32_t interval = clock.attempts[i] - last;
+        uint32_t attemptMs = i == 0 ? 0 : WiFi.ap.rejectMs;
+        if (clock.attempts[i] < upAt && !inBackoffRange(interval, attemptMs, delayMs)) {
+            ordered = false;
+        }
+        printf(" %.1f", (clock.attempts[i] - downAt) / 1000.0);
+        last = clock.attempts[i];
+        delayMs = nextDelay(delayMs);
+    }
+    printf("\n");
+    check(ordered, "再接続の間隔は 1秒・2秒・4秒…（最大60秒）と揺らぎ（1/4まで）");
+
+    clock.run(5000);
+    check(clock.reconnects == 1, "takeReconnected() は1回だけ true");
+    clock.checkFrameBudget();
+}
+
+// パスワードが違う設定から、Webで正しいパスワードに直す
+static void testWrongPassword() {
+    printf("パスワード違いから設定の変更\n");
+    WiFi.simReset();
+    ClockLoop clock;
+    clock.boot(WiFi.ap.ssid, "wrong-password");
+    clock.run(30000);
+    uint32_t failedAttempts = (uint32_t)clock.attempts.size();
+    check(failedAttempts >= 3 && clock.wifi.getLinkState() != WiFiManager::LINK_CONNECTED, "接続に失敗して再接続を続ける");
+
+    // 待ち時間の途中でも、設定が変わればすぐに新しい設定で接続する
+    ClockSettings settings = clock.store.get();
+    strncpy(settings.password, WiFi.ap.password, sizeof(settings.password) - 1);
+    clock.store.update(settings);
+    uint32_t changedAt = millis();
+    check(clock.runUntil(WiFiManager::LINK_CONNECTED, WiFi.ap.associateMs + 100), "新しい設定ですぐに接続する");
+    check(clock.attempts.size() == failedAttempts + 1 && clock.attempts.back() - changedAt < FRAME_US / 1000 + 1,
+          "次のフレームで WiFi.begin() を呼ぶ");
+
+    // 待ち時間は最初の値に戻っている
+    clock.attempts.clear();
+    uint32_t downAt = millis();
+    WiFi.setApUp(false);
+    clock.runUntil(WiFiManager::LINK_BACKOFF, WiFi.ap.lossDetectMs + 100);
+    clock.run(5000);
+    check(!clock.attempts.empty() &&
+          inBackoffRange(clock.attempts[0] - downAt, WiFi.ap.lossDetectMs, RETRY_DELAY_MIN_MS),
+          "接続に成功すると待ち時間は1秒に戻る");
+    clock.checkFrameBudget();
+}
+
+// 認証に応答しないアクセスポイント（接続待ちのタイムアウト）
+static void testSilentAccessPoint() {
+    printf("応答しないアクセスポイント\n");
+    WiFi.simReset();
+    WiFi.ap.responding = false;
+    ClockLoop clock;
+    clock.boot(WiFi.ap.ssid, WiFi.ap.password);
+    uint32_t bootAt = millis();
+    clock.run(60000);
+    check(clock.attempts.size() >= 2 &&
+          inBackoffRange(clock.attempts[0] - bootAt, CONNECT_TIMEOUT_MS, RETRY_DELAY_MIN_MS),
+          "10秒で接続待ちをやめ、1秒待って再接続する");
+
+    WiFi.ap.responding = true;
+    uint32_t limit = CONNECT_TIMEOUT_MS + RETRY_DELAY_MAX_MS + RETRY_DELAY_MAX_MS / 4 + WiFi.ap.associateMs + 100;
+    check(clock.runUntil(WiFiManager::LINK_CONNECTED, limit), "応答するようになったら接続する");
+    clock.checkFrameBudget();
+}
+
+// 無線を止めている間（省電力モード）は再接続しない
+static void testRadioOff() {
+    printf("無線を止める・入れ直す\n");
+    WiFi.simReset();
+    ClockLoop clock;
+    clock.boot(WiFi.ap.ssid, WiFi.ap.password);
+    clock.runUntil(WiFiManager::LINK_CONNECTED, 5000);
+
+    clock.wifi.radioOff();
+    uint32_t beginCount = WiFi.getBeginCount();
+    clock.run(120000);
+    check(WiFi.getBeginCount() == beginCount && clock.wifi.getLinkState() == WiFiManager::LINK_IDLE,
+          "止めている間は WiFi.begin() を呼ばない");
+
+    clock.wifi.radioOn();
+    check(clock.runUntil(WiFiManager::LINK_CONNECTED, WiFi.ap.associateMs + 100), "入れ直すとすぐに接続する");
+    check(clock.reconnects == 0, "無線を止めたのは切断として数えない");
+    clock.checkFrameBudget();
+}
+
+int main() {
+    testBoot();
+    testOutage();
+    testWrongPassword();
+    testSilentAccessPoint();
+    testRadioOff();
+
+    if (failures > 0) {
+        printf("%d 件の失敗\n", failures);
+        return 1;
+    }
+    printf("すべて成功\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+# 設定用Webページ（lib/ClockNet/web/ 以下）を縮小・gzip圧縮して lib/ClockNet/src/web_assets.h に変換する
+#
+# 使い方（lib/ClockNet で）:
+#   python tools/build_web_assets.py web src/web_assets.h
+#
+# 3つの時計の platformio.ini の extra_scripts に pre スクリプトとして登録してあり、
+# ビルド時に web/ のファイルが新しければ src/web_assets.h を再生成する（3つの時計で同じファイルを使う）。
+#
+# - .css / .js は内容のハッシュをファイル名に含めたURL（/style.1a2b3c4d.css）にして、
+#   ブラウザに長期間キャッシュさせる。HTML中の {{style.css}} はそのURLに置き換える
+# - .html はURLが変わらないので、ETag（内容のハッシュ）で毎回確認させる
+# - 時刻など変わる値はページに埋め込まず、JSON（/api/status など）から読み込む
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+
+def minify(name, text):
+    """行頭・行末の空白、空行、行全体のコメントを除く（改行は残すのでJSの解釈は変わらない）"""
+    ext = os.path.splitext(name)[1]
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line:
+            continue
+        if ext == ".js" and line.startswith("//"):
+            continue
+        if ext == ".css":
+            line = re.sub(r"\s*([{};:,])\s*", r"\1", line)
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def symbol(name):
+    """style.css -> webStyleCss"""
+    parts = re.split(r"[^0-9A-Za-z]+", name)
+    return "web" + "".join(p[:1].upper() + p[1:] for p in parts if p)
+
+
+def load_assets(source_dir):
+    names = sorted(n for n in os.listdir(source_dir) if os.path.splitext(n)[1] in CONTENT_TYPES)
+    texts = {n: minify(n, open(os.path.join(source_dir, n), encoding="utf-8").read()) for n in names}
+
+    # ハッシュ付きのURLを先に決めてから、HTMLの参照を置き換える
+    paths = {}
+    for name in names:
+        base, ext = os.path.splitext(name)
+        if ext != ".html":
+            digest = hashlib.sha256(texts[name].encode("utf-8")).hexdigest()[:8]
+            paths[name] = "/%s.%s%s" % (base, digest, ext)
+
+    def replace(match):
+        ref = match.group(1)
+        if ref not in paths:
+            raise ValueError("unknown asset reference {{%s}}" % ref)
+        return paths[ref]
+
+    assets = []
+    for name in names:
+        base, ext = os.path.splitext(name)
+        text = re.sub(r"\{\{([^}]+)\}\}", replace, texts[name])
+        raw = text.encode("utf-8")
+        data = gzip.compress(raw, 9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:8]
+        immutable = ext != ".html"
+        path = paths[name] if immutable else "/" + name
+        assets.append((name, path, CONTENT_TYPES[ext], raw, data, etag, immutable))
+    return assets
+
+
+def format_bytes(data, per_line=24):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("    " + ",".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(path, assets):
+    raw_total = sum(len(a[3]) for a in assets)
+    gz_total = sum(len(a[4]) for a in assets)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("// このファイルは tools/build_web_assets.py で生成（直接編集しない）\n")
+        f.write("// %d ファイル: %d bytes -> gzip %d bytes\n" % (len(assets), raw_total, gz_total))
+        f.write("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n")
+        f.write("#include \"web_asset.h\"\n\n")
+        for name, url, content_type, raw, data, etag, immutable in assets:
+            sym = symbol(name)
+            f.write("// %s: %d bytes -> gzip %d bytes\n" % (name, len(raw), len(data)))
+            f.write("const uint8_t %sData[%d] PROGMEM = {\n" % (sym, len(data)))
+            f.write(format_bytes(data) + "\n};\n")
+            f.write("const WebAsset %s = { \"%s\", \"%s\", %sData, %d, \"\\\"%s\\\"\", %s };\n\n" %
+                    (sym, url, content_type, sym, len(data), etag, "true" if immutable else "false"))
+        statics = [symbol(a[0]) for a in assets if a[6]]
+        f.write("// URLにハッシュを含むファイル（そのURLで登録する）\n")
+        f.write("const WebAsset* const webStaticAssets[] = { %s };\n" % ", ".join("&" + s for s in statics))
+        f.write("const int webStaticAssetCount = %d;\n\n" % len(statics))
+        f.write("#endif // WEB_ASSETS_H\n")
+    return raw_total, gz_total
+
+
+def build(source_dir, output):
+    assets = load_assets(source_dir)
+    raw_total, gz_total = write_header(output, assets)
+    print("build_web_assets: %s -> %s: %d -> %d bytes (%d files)" %
+          (source_dir, output, raw_total, gz_total, len(assets)))
+
+
+def newest_mtime(directory):
+    return max(os.path.getmtime(os.path.join(directory, n)) for n in os.listdir(directory))
+
+
+try:
+    Import("env")  # noqa: F821  PlatformIO の extra_scripts から実行された場合
+    # lib_extra_dirs（../../lib）にある ClockNet の web/ から生成する
+    project_dir = env.subst("$PROJECT_DIR")  # noqa: F821
+    library_dir = os.path.normpath(os.path.join(project_dir, "..", "..", "lib", "ClockNet"))
+    source = os.path.join(library_dir, "web")
+    output = os.path.join(library_dir, "src", "web_assets.h")
+    if not os.path.exists(output) or newest_mtime(source) > os.path.getmtime(output):
+        build(source, output)
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) != 3:
+            print("usage: build_web_assets.py <web dir> <output.h>")
+            sys.exit(1)
+        build(sys.argv[1], sys.argv[2])
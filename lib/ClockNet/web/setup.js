@@ -0,0 +1,135 @@
+// 読み込んだ時のSSID（変えた時だけ空のパスワードを送る）
+let loadedSsid = '';
+
+// 設定をフォームに入れる（パスワードは返ってこないので、設定してあれば空のまま「変えない」と表示する）
+function showSettings(settings) {
+  loadedSsid = settings.ssid;
+  document.getElementById('ssid').value = settings.ssid;
+  document.getElementById('password').placeholder = settings.passwordSet ? '(unchanged)' : '';
+  document.getElementById('otaUsername').value = settings.otaUsername;
+  document.getElementById('otaPassword').placeholder = settings.otaPasswordSet ? '(unchanged)' : '';
+  document.getElementById('ntpServer').value = settings.ntpServer;
+  document.getElementById('gmtOffset').value = settings.gmtOffset / 3600;
+  document.getElementById('daylightOffset').value = settings.daylightOffset / 60;
+  // 一覧にないPOSIXの規則もそのまま選べるようにする。空は時差を直接指定する
+  const timeZone = document.getElementById('timeZone');
+  timeZone.innerHTML = '';
+  const zones = [''].concat(settings.timeZones);
+  if (zones.indexOf(settings.timeZone) < 0) {
+    zones.push(settings.timeZone);
+  }
+  zones.forEach(function(name) {
+    const option = document.createElement('option');
+    option.value = name;
+    option.textContent = name === '' ? 'Custom UTC offset' : name;
+    timeZone.appendChild(option);
+  });
+  timeZone.value = settings.timeZone;
+  showCustomOffset();
+  document.getElementById('brightness').value = settings.brightness;
+  const face = document.getElementById('face');
+  face.innerHTML = '';
+  settings.faces.forEach(function(name) {
+    const option = document.createElement('option');
+    option.value = name;
+    option.textContent = name;
+    face.appendChild(option);
+  });
+  face.value = settings.face;
+}
+
+// 時差の入力はタイムゾーンを選んでいない時だけ表示する
+function showCustomOffset() {
+  const custom = document.getElementById('timeZone').value === '';
+  document.getElementById('customOffset').style.display = custom ? '' : 'none';
+}
+
+// 現在の設定を読み込む
+function loadSettings() {
+  const xhr = new XMLHttpRequest();
+  xhr.open('GET', '/api/settings');
+  xhr.onload = function() {
+    if (xhr.status === 200) {
+      showSettings(JSON.parse(xhr.responseText));
+    }
+  };
+  xhr.send();
+}
+
+// 変更する項目だけをPUTして結果を表示する（応答は変更後のすべての設定）
+function putSettings(body, messageId, successText) {
+  const xhr = new XMLHttpRequest();
+  xhr.open('PUT', '/api/settings');
+  xhr.setRequestHeader('Content-Type', 'application/json');
+  xhr.onload = function() {
+    const message = document.getElementById(messageId);
+    if (xhr.status === 200) {
+      message.innerHTML = '<span class="success">' + successText + '</span>';
+      showSettings(JSON.parse(xhr.responseText));
+    } else if (xhr.status === 401) {
+      message.innerHTML = '<span class="error">Error: the OTA username and password are required</span>';
+    } else {
+      let error = xhr.responseText;
+      if (xhr.getResponseHeader('Content-Type') === 'application/json') {
+        error = JSON.parse(xhr.responseText).error;
+      }
+      message.innerHTML = '<span class="error"></span>';
+      message.firstChild.textContent = 'Error: ' + error;
+    }
+  };
+  xhr.send(JSON.stringify(body));
+}
+
+document.getElementById('wifiForm').addEventListener('submit', function(e) {
+  e.preventDefault();
+  // パスワードが空なら今のままにする（SSIDを変えた時はパスワードなしのネットワーク）
+  const body = { ssid: document.getElementById('ssid').value };
+  const password = document.getElementById('password').value;
+  if (password !== '' || body.ssid !== loadedSsid) {
+    body.password = password;
+  }
+  putSettings(body, 'wifiMessage', 'WiFi settings saved. Connecting to the new network...');
+});
+
+document.getElementById('otaForm').addEventListener('submit', function(e) {
+  e.preventDefault();
+  // パスワードが空なら今のままにする
+  const body = { otaUsername: document.getElementById('otaUsername').value };
+  const otaPassword = document.getElementById('otaPassword').value;
+  if (otaPassword !== '') {
+    body.otaPassword = otaPassword;
+  }
+  putSettings(body, 'otaMessage', 'OTA settings saved.');
+});
+
+document.getElementById('clockForm').addEventListener('submit', function(e) {
+  e.preventDefault();
+  const body = {
+    ntpServer: document.getElementById('ntpServer').value,
+    timeZone: document.getElementById('timeZone').value,
+    face: document.getElementById('face').value
+  };
+  if (body.timeZone === '') {
+    body.gmtOffset = Math.round(parseFloat(document.getElementById('gmtOffset').value) * 3600);
+    body.daylightOffset = Math.round(parseFloat(document.getElementById('daylightOffset').value) * 60);
+  }
+  putSettings(body, 'clockMessage', 'Clock settings saved.');
+});
+
+document.getElementById('timeZone').addEventListener('change', showCustomOffset);
+
+// 明るさはスライダーを動かすとすぐに変える（保存はしない）
+document.getElementById('brightness').addEventListener('change', function(e) {
+  putSettings({ brightness: parseInt(e.target.value, 10) }, 'clockMessage', 'Brightness changed.');
+});
+
+document.getElementById('restartBtn').addEventListener('click', function() {
+  if (confirm('Are you sure you want to restart?')) {
+    document.getElementById('restartMessage').innerHTML = '<span class="success">Restarting... Please wait</span>';
+    const xhr = new XMLHttpRequest();
+    xhr.open('GET', '/restart');
+    xhr.send();
+  }
+});
+
+loadSettings();
@@ -0,0 +1,482 @@
+#include "json_stream.h"
+#include <stdio.h>
+
+static bool isJsonSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// ---- JsonTokenizer ----
+
+void JsonTokenizer::reset() {
+    state = ST_VALUE;
+    numberState = NUM_INT;
+    containers = 0;
+    depth = 0;
+    stringIsKey = false;
+    literal = nullptr;
+    literalIndex = 0;
+    hexDigits = 0;
+    codePoint = 0;
+    highSurrogate = 0;
+    offset = 0;
+    error = nullptr;
+    text[0] = '\0';
+    textLength = 0;
+}
+
+bool JsonTokenizer::fail(const char* message) {
+    if (state != ST_ERROR) {
+        state = ST_ERROR;
+        error = message;
+    }
+    return false;
+}
+
+bool JsonTokenizer::appendText(char c) {
+    if (textLength >= MAX_TEXT) {
+        return fail("string too long");
+    }
+    text[textLength++] = c;
+    text[textLength] = '\0';
+    return true;
+}
+
+// UTF-8にして追加
+bool JsonTokenizer::appendCodePoint(uint32_t value) {
+    if (value < 0x80) {
+        return appendText((char)value);
+    }
+    if (value < 0x800) {
+        return appendText((char)(0xC0 | (value >> 6))) &&
+               appendText((char)(0x80 | (value & 0x3F)));
+    }
+    if (value < 0x10000) {
+        return appendText((char)(0xE0 | (value >> 12))) &&
+               appendText((char)(0x80 | ((value >> 6) & 0x3F))) &&
+               appendText((char)(0x80 | (value & 0x3F)));
+    }
+    return appendText((char)(0xF0 | (value >> 18))) &&
+           appendText((char)(0x80 | ((value >> 12) & 0x3F))) &&
+           appendText((char)(0x80 | ((value >> 6) & 0x3F))) &&
+           appendText((char)(0x80 | (value & 0x3F)));
+}
+
+bool JsonTokenizer::emit(JsonTokenHandler& handler, JsonToken::Type type) {
+    JsonToken token;
+    token.type = type;
+    token.text = text;
+    token.length = textLength;
+    token.depth = depth;
+    if (!handler.onToken(token)) {
+        return fail("rejected by handler");
+    }
+    return true;
+}
+
+// 値を1つ読み終えた
+bool JsonTokenizer::endValue() {
+    state = depth == 0 ? ST_DONE : ST_COMMA_OR_END;
+    return true;
+}
+
+// 値の最初の文字
+bool JsonTokenizer::beginValue(char c, JsonTokenHandler& handler) {
+    switch (c) {
+    case '{':
+    case '[': {
+        if (depth >= MAX_DEPTH) {
+            return fail("nested too deeply");
+        }
+        bool isArray = c == '[';
+        if (!emit(handler, isArray ? JsonToken::ARRAY_BEGIN : JsonToken::OBJECT_BEGIN)) {
+            return false;
+        }
+        if (isArray) {
+            containers |= (uint16_t)(1u << depth);
+        } else {
+            containers &= (uint16_t)~(1u << depth);
+        }
+        depth++;
+        state = isArray ? ST_VALUE_OR_END : ST_KEY_OR_END;
+        return true;
+    }
+    case '"':
+        stringIsKey = false;
+        textLength = 0;
+        text[0] = '\0';
+        state = ST_STRING;
+        return true;
+    case 't':
+        literal = "true";
+        break;
+    case 'f':
+        literal = "false";
+        break;
+    case 'n':
+        literal = "null";
+        break;
+    default:
+        if (c == '-' || isDigit(c)) {
+            textLength = 0;
+            numberState = c == '-' ? NUM_SIGN : (c == '0' ? NUM_ZERO : NUM_INT);
+            state = ST_NUMBER;
+            return appendText(c);
+        }
+        return fail("unexpected character");
+    }
+    literalIndex = 1;
+    state = ST_LITERAL;
+    return true;
+}
+
+bool JsonTokenizer::closeContainer(bool isArray, JsonTokenHandler& handler) {
+    bool openIsArray = (containers >> (depth - 1)) & 1;
+    if (openIsArray != isArray) {
+        return fail("mismatched bracket");
+    }
+    depth--;
+    if (!emit(handler, isArray ? JsonToken::ARRAY_END : JsonToken::OBJECT_END)) {
+        return false;
+    }
+    return endValue();
+}
+
+// 数値の続きの文字か。数値が終わっていればここで渡す（consumed が false なら c は次の字句）
+bool JsonTokenizer::stepNumber(char c, JsonTokenHandler& handler, bool& consumed) {
+    NumberState next = numberState;
+    bool accept = true;
+    switch (numberState) {
+    case NUM_SIGN:
+        if (c == '0') next = NUM_ZERO;
+        else if (isDigit(c)) next = NUM_INT;
+        else accept = false;
+        break;
+    case NUM_ZERO:
+    case NUM_INT:
+        if (isDigit(c) && numberState == NUM_INT) next = NUM_INT;
+        else if (c == '.') next = NUM_POINT;
+        else if (c == 'e' || c == 'E') next = NUM_EXP;
+        else accept = false;
+        break;
+    case NUM_POINT:
+    case NUM_FRACTION:
+        if (isDigit(c)) next = NUM_FRACTION;
+        else if ((c == 'e' || c == 'E') && numberState == NUM_FRACTION) next = NUM_EXP;
+        else accept = false;
+        break;
+    case NUM_EXP:
+        if (c == '+' || c == '-') next = NUM_EXP_SIGN;
+        else if (isDigit(c)) next = NUM_EXP_DIGITS;
+        else accept = false;
+        break;
+    case NUM_EXP_SIGN:
+    case NUM_EXP_DIGITS:
+        if (isDigit(c)) next = NUM_EXP_DIGITS;
+        else accept = false;
+        break;
+    }
+
+    if (accept) {
+        consumed = true;
+        numberState = next;
+        return appendText(c);
+    }
+
+    // 数値が終わった（途中で終わっていれば誤り）
+    consumed = false;
+    if (numberState != NUM_ZERO && numberState != NUM_INT &&
+        numberState != NUM_FRACTION && numberState != NUM_EXP_DIGITS) {
+        return fail("invalid number");
+    }
+    return emit(handler, JsonToken::NUMBER) && endValue();
+}
+
+// 1文字進める
+bool JsonTokenizer::step(char c, JsonTokenHandler& handler) {
+    switch (state) {
+    case ST_VALUE:
+        if (isJsonSpace(c)) return true;
+        return beginValue(c, handler);
+
+    case ST_VALUE_OR_END:
+        if (isJsonSpace(c)) return true;
+        if (c == ']') return closeContainer(true, handler);
+        return beginValue(c, handler);
+
+    case ST_KEY_OR_END:
+        if (isJsonSpace(c)) return true;
+        if (c == '}') return closeContainer(false, handler);
+        // fall through
+    case ST_KEY:
+        if (isJsonSpace(c)) return true;
+        if (c != '"') return fail("expected key");
+        stringIsKey = true;
+        textLength = 0;
+        text[0] = '\0';
+        state = ST_STRING;
+        return true;
+
+    case ST_COLON:
+        if (isJsonSpace(c)) return true;
+        if (c != ':') return fail("expected ':'");
+        state = ST_VALUE;
+        return true;
+
+    case ST_COMMA_OR_END:
+        if (isJsonSpace(c)) return true;
+        if (c == ',') {
+            state = ((containers >> (depth - 1)) & 1) ? ST_VALUE : ST_KEY;
+            return true;
+        }
+        if (c == ']') return closeContainer(true, handler);
+        if (c == '}') return closeContainer(false, handler);
+        return fail("expected ',' or closing bracket");
+
+    case ST_STRING:
+        if (highSurrogate != 0 && c != '\\') {
+            return fail("unpaired surrogate");
+        }
+        if (c == '"') {
+            if (stringIsKey) {
+                state = ST_COLON;
+                return emit(handler, JsonToken::KEY);
+            }
+            return emit(handler, JsonToken::STRING) && endValue();
+        }
+        if (c == '\\') {
+            state = ST_ESCAPE;
+            return true;
+        }
+        if ((unsigned char)c < 0x20) {
+            return fail("control character in string");
+        }
+        return appendText(c);
+
+    case ST_ESCAPE: {
+        if (c == 'u') {
+            hexDigits = 0;
+            codePoint = 0;
+            state = ST_UNICODE;
+            return true;
+        }
+        if (highSurrogate != 0) {
+            return fail("unpaired surrogate");
+        }
+        char decoded;
+        switch (c) {
+        case '"': decoded = '"'; break;
+        case '\\': decoded = '\\'; break;
+        case '/': decoded = '/'; break;
+        case 'b': decoded = '\b'; break;
+        case 'f': decoded = '\f'; break;
+        case 'n': decoded = '\n'; break;
+        case 'r': decoded = '\r'; break;
+        case 't': decoded = '\t'; break;
+        default: return fail("invalid escape");
+        }
+        state = ST_STRING;
+        return appendText(decoded);
+    }
+
+    case ST_UNICODE: {
+        int value = hexValue(c);
+        if (value < 0) {
+            return fail("invalid \\u escape");
+        }
+        codePoint = (codePoint << 4) | (uint32_t)value;
+        if (++hexDigits < 4) {
+            return true;
+        }
+        state = ST_STRING;
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+            if (highSurrogate != 0) {
+                return fail("unpaired surrogate");
+            }
+            highSurrogate = codePoint;
+            return true;
+        }
+        if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+            if (highSurrogate == 0) {
+                return fail("unpaired surrogate");
+            }
+            codePoint = 0x10000 + ((highSurrogate - 0xD800) << 10) + (codePoint - 0xDC00);
+            highSurrogate = 0;
+        } else if (highSurrogate != 0) {
+            return fail("unpaired surrogate");
+        }
+        // text は '\0' 終端で渡すので、途中の '\0' は受け付けない
+        if (codePoint == 0) {
+            return fail("\\u0000 is not supported");
+        }
+        return appendCodePoint(codePoint);
+    }
+
+    case ST_NUMBER: {
+        bool consumed;
+        if (!stepNumber(c, handler, consumed)) {
+            return false;
+        }
+        // 数値の直後の文字（',' や '}'）は次の状態で読み直す
+        return consumed || step(c, handler);
+    }
+
+    case ST_LITERAL:
+        if (c != literal[literalIndex]) {
+            return fail("invalid literal");
+        }
+        if (literal[++literalIndex] != '\0') {
+            return true;
+        }
+        textLength = 0;
+        text[0] = '\0';
+        if (!emit(handler, literal[0] == 't' ? JsonToken::TRUE_VALUE :
+                           (literal[0] == 'f' ? JsonToken::FALSE_VALUE : JsonToken::NULL_VALUE))) {
+            return false;
+        }
+        return endValue();
+
+    case ST_DONE:
+        if (isJsonSpace(c)) return true;
+        return fail("unexpected data after JSON");
+
+    case ST_ERROR:
+        break;
+    }
+    return false;
+}
+
+JsonTokenizer::Result JsonTokenizer::feed(const char* data, size_t length, JsonTokenHandler& handler) {
+    if (state == ST_ERROR) {
+        return RESULT_ERROR;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (!step(data[i], handler)) {
+            return RESULT_ERROR;
+        }
+        offset++;
+    }
+    return state == ST_DONE ? RESULT_DONE : RESULT_MORE;
+}
+
+JsonTokenizer::Result JsonTokenizer::finish(JsonTokenHandler& handler) {
+    if (state == ST_NUMBER && depth == 0) {
+        // 一番外の値が数値の時は、終わりの文字が来ないのでここで渡す
+        bool consumed;
+        if (!stepNumber(' ', handler, consumed)) {
+            return RESULT_ERROR;
+        }
+    }
+    if (state == ST_ERROR) {
+        return RESULT_ERROR;
+    }
+    if (state != ST_DONE) {
+        fail("unexpected end of data");
+        return RESULT_ERROR;
+    }
+    return RESULT_DONE;
+}
+
+// ---- JsonWriter ----
+
+JsonWriter::JsonWriter(char* buffer, size_t size)
+    : buffer(buffer), size(size), length(0), first(true), overflow(size == 0) {
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+}
+
+void JsonWriter::append(char c) {
+    if (length + 1 < size) {
+        buffer[length++] = c;
+        buffer[length] = '\0';
+    } else {
+        overflow = true;
+    }
+}
+
+// " と \ と制御文字をエスケープして "..." で囲む
+void JsonWriter::appendString(const char* value) {
+    append('"');
+    for (const char* p = value; *p != '\0'; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\') {
+            append('\\');
+            append((char)c);
+        } else if (c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            for (const char* e = escaped; *e != '\0'; e++) {
+                append(*e);
+            }
+        } else {
+            append((char)c);
+        }
+    }
+    append('"');
+}
+
+// 要素の区切りとキー
+void JsonWriter::appendKey(const char* key) {
+    if (!first) {
+        append(',');
+    }
+    first = false;
+    if (key != nullptr) {
+        appendString(key);
+        append(':');
+    }
+}
+
+void JsonWriter::beginObject(const char* key) {
+    appendKey(key);
+    append('{');
+    first = true;
+}
+
+void JsonWriter::endObject() {
+    append('}');
+    first = false;
+}
+
+void JsonWriter::beginArray(const char* key) {
+    appendKey(key);
+    append('[');
+    first = true;
+}
+
+void JsonWriter::endArray() {
+    append(']');
+    first = false;
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+    appendKey(key);
+    appendString(value);
+}
+
+void JsonWriter::addNumber(const char* key, long value) {
+    appendKey(key);
+    char digits[24];
+    snprintf(digits, sizeof(digits), "%ld", value);
+    for (const char* p = digits; *p != '\0'; p++) {
+        append(*p);
+    }
+}
+
+void JsonWriter::addBool(const char* key, bool value) {
+    appendKey(key);
+    for (const char* p = value ? "true" : "false"; *p != '\0'; p++) {
+        append(*p);
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// JSONの字句（JsonTokenizer が1つずつ JsonTokenHandler に渡す）
+struct JsonToken {
+    enum Type {
+        OBJECT_BEGIN,
+        OBJECT_END,
+        ARRAY_BEGIN,
+        ARRAY_END,
+        KEY,            // オブジェクトのキー（text はエスケープを戻した文字列）
+        STRING,         // 文字列の値（同上）
+        NUMBER,         // 数値（text は書かれたままの数字）
+        TRUE_VALUE,
+        FALSE_VALUE,
+        NULL_VALUE
+    };
+
+    Type type;
+    const char* text;   // KEY / STRING / NUMBER の時だけ有効（'\0' 終端。次の字句までの間だけ使える）
+    size_t length;
+    int depth;          // 一番外の値とその括弧は0、そのオブジェクトのキーと値は1
+};
+
+// 字句を受け取る側（false を返すとそこで解析を止めてエラーにする）
+class JsonTokenHandler {
+public:
+    virtual bool onToken(const JsonToken& token) = 0;
+};
+
+// 分割して届くJSONを少しずつ読む字句解析器
+// 受け取ったデータは保持せず、1文字ずつ状態を進めて字句ができたところで handler に渡す。
+// メモリは確保しない（文字列と数値は text の固定長バッファに入る長さまで、入れ子は MAX_DEPTH まで）。
+class JsonTokenizer {
+public:
+    enum Result {
+        RESULT_MORE,    // 続きのデータが必要
+        RESULT_DONE,    // 値を最後まで読んだ（後ろは空白だけ許す）
+        RESULT_ERROR    // 文法の誤り、長すぎる文字列、または handler が止めた
+    };
+
+    static const int MAX_DEPTH = 8;
+    static const size_t MAX_TEXT = 96;     // 文字列・数値の最大バイト数
+
+private:
+    enum State {
+        ST_VALUE,           // 値
+        ST_VALUE_OR_END,    // '[' の直後（値か ']'）
+        ST_KEY,             // ',' の後のキー
+        ST_KEY_OR_END,      // '{' の直後（キーか '}'）
+        ST_COLON,
+        ST_COMMA_OR_END,    // 値の後（',' か閉じ括弧）
+        ST_STRING,
+        ST_ESCAPE,          // '\' の直後
+        ST_UNICODE,         // '\u' の後の16進数4桁
+        ST_NUMBER,
+        ST_LITERAL,         // true / false / null
+        ST_DONE,
+        ST_ERROR
+    };
+
+    // 数値の文法（JSONの number）
+    enum NumberState {
+        NUM_SIGN,           // '-' の後
+        NUM_ZERO,           // 先頭の0（後に数字は続けられない）
+        NUM_INT,
+        NUM_POINT,          // '.' の後
+        NUM_FRACTION,
+        NUM_EXP,            // 'e' の後
+        NUM_EXP_SIGN,       // 'e+' / 'e-' の後
+        NUM_EXP_DIGITS
+    };
+
+    State state;
+    NumberState numberState;
+    uint16_t containers;        // 開いている括弧（ビットが1なら配列）
+    int depth;
+    bool stringIsKey;
+    const char* literal;        // 読んでいるリテラル（"true" など）
+    uint8_t literalIndex;
+    uint8_t hexDigits;          // \uXXXX の読んだ桁数
+    uint32_t codePoint;
+    uint32_t highSurrogate;     // サロゲートペアの前半（0なら無し）
+    size_t offset;              // これまでに読んだバイト数（エラー位置の表示用）
+    const char* error;
+
+    char text[MAX_TEXT + 1];
+    size_t textLength;
+
+    bool fail(const char* message);
+    bool appendText(char c);
+    bool appendCodePoint(uint32_t value);
+    bool emit(JsonTokenHandler& handler, JsonToken::Type type);
+    bool endValue();
+    bool beginValue(char c, JsonTokenHandler& handler);
+    bool closeContainer(bool isArray, JsonTokenHandler& handler);
+    bool step(char c, JsonTokenHandler& handler);
+    bool stepNumber(char c, JsonTokenHandler& handler, bool& consumed);
+
+public:
+    JsonTokenizer() { reset(); }
+
+    // 最初の状態に戻す（次のJSONを読む前に呼ぶ）
+    void reset();
+
+    // 届いた分を読む（何回に分けて渡してもよい）
+    Result feed(const char* data, size_t length, JsonTokenHandler& handler);
+
+    // データの終わり（最後が数値の時はここで handler に渡す）
+    Result finish(JsonTokenHandler& handler);
+
+    // エラーの内容と、それまでに読んだバイト数
+    const char* getError() const { return error; }
+    size_t getOffset() const { return offset; }
+};
+
+// 固定長のバッファにJSONを書く
+// 入りきらない時は isValid() が false になる（c_str() は途中までの文字列）
+class JsonWriter {
+private:
+    char* buffer;
+    size_t size;
+    size_t length;
+    bool first;                 // 括弧を開いた直後（次の要素の前に ',' が要らない）
+    bool overflow;
+
+    void append(char c);
+    void appendString(const char* value);
+    void appendKey(const char* key);
+
+public:
+    JsonWriter(char* buffer, size_t size);
+
+    void beginObject(const char* key = nullptr);
+    void endObject();
+    void beginArray(const char* key = nullptr);
+    void endArray();
+
+    // key を nullptr にすると配列の要素
+    void add(const char* key, const char* value);
+    void addNumber(const char* key, long value);
+    void addBool(const char* key, bool value);
+
+    bool isValid() const { return !overflow; }
+    const char* c_str() const { return buffer; }
+    size_t getLength() const { return length; }
+};
+
+#endif // JSON_STREAM_H
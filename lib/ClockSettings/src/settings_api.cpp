@@ -0,0 +1,421 @@
+#include "settings_api.h"
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+// PUT の本文の項目
+enum SettingsField {
+    FIELD_SSID,
+    FIELD_PASSWORD,
+    FIELD_OTA_USERNAME,
+    FIELD_OTA_PASSWORD,
+    FIELD_NTP_SERVER,
+    FIELD_GMT_OFFSET,
+    FIELD_DAYLIGHT_OFFSET,
+    FIELD_TIME_ZONE,
+    FIELD_BRIGHTNESS,
+    FIELD_FACE,
+    FIELD_COUNT
+};
+
+static const char* const fieldNames[FIELD_COUNT] = {
+    "ssid", "password", "otaUsername", "otaPassword",
+    "ntpServer", "gmtOffset", "daylightOffset", "timeZone", "brightness", "face"
+};
+
+// PUT の本文から読んだ値（present のビットが立っている項目だけを変更する）
+struct SettingsUpdate {
+    uint16_t present;
+    char ssid[33];
+    char password[64];
+    char otaUsername[33];
+    char otaPassword[65];
+    char ntpServer[64];
+    long gmtOffset;
+    long daylightOffset;
+    char timeZone[TimeZone::RULE_SIZE];
+    long brightness;
+    int face;
+
+    bool has(SettingsField field) const { return (present & (1u << field)) != 0; }
+};
+
+// 1つのリクエストの本文を読む状態（request->_tempObject に置き、リクエストと一緒に free() される）
+class SettingsRequest : public JsonTokenHandler {
+public:
+    JsonTokenizer tokenizer;
+    SettingsUpdate update;
+    SettingsTarget* clock;  // 文字盤の名前を確かめる
+    int field;              // 読んでいる値の項目（-1なら知らないキーなので読み飛ばす）
+    const char* error;      // 値の誤り
+    bool tooLarge;
+    bool complete;          // 最後まで読んだ
+
+    SettingsRequest(SettingsTarget* clock) : clock(clock), field(-1), error(nullptr), tooLarge(false), complete(false) {
+        memset(&update, 0, sizeof(update));
+    }
+
+    bool onToken(const JsonToken& token) override;
+
+private:
+    bool fail(const char* message) { error = message; return false; }
+    bool readString(const JsonToken& token, char* dst, size_t size, size_t minLength);
+    bool readInteger(const JsonToken& token, long minValue, long maxValue, long& value);
+};
+
+// 文字列の値を受け取る（長さが範囲外なら誤り）
+bool SettingsRequest::readString(const JsonToken& token, char* dst, size_t size, size_t minLength) {
+    if (token.type != JsonToken::STRING) {
+        return fail("value must be a string");
+    }
+    if (token.length < minLength || token.length >= size) {
+        return fail("string length out of range");
+    }
+    memcpy(dst, token.text, token.length + 1);
+    return true;
+}
+
+// 整数の値を受け取る（小数や範囲外は誤り）
+bool SettingsRequest::readInteger(const JsonToken& token, long minValue, long maxValue, long& value) {
+    if (token.type != JsonToken::NUMBER) {
+        return fail("value must be a number");
+    }
+    char* end;
+    long parsed = strtol(token.text, &end, 10);
+    if (*end != '\0') {
+        return fail("value must be an integer");
+    }
+    if (parsed < minValue || parsed > maxValue) {
+        return fail("value out of range");
+    }
+    value = parsed;
+    return true;
+}
+
+// ホスト名（カンマ区切りで複数）に使える文字か
+static bool isHostList(const char* name) {
+    for (const char* p = name; *p != '\0'; p++) {
+        char c = *p;
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+              c == '-' || c == '.' || c == ',' || c == ' ')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SettingsRequest::onToken(const JsonToken& token) {
+    if (token.depth == 0) {
+        // 一番外はオブジェクトだけ受け付ける
+        if (token.type != JsonToken::OBJECT_BEGIN && token.type != JsonToken::OBJECT_END) {
+            return fail("body must be a JSON object");
+        }
+        return true;
+    }
+    if (token.depth > 1) {
+        return true;                    // 知らないキーの値の中身
+    }
+    if (token.type == JsonToken::KEY) {
+        field = -1;
+        for (int i = 0; i < FIELD_COUNT; i++) {
+            if (strcmp(token.text, fieldNames[i]) == 0) {
+                field = i;
+                break;
+            }
+        }
+        return true;
+    }
+    if (field < 0 || token.type == JsonToken::OBJECT_END || token.type == JsonToken::ARRAY_END) {
+        return true;
+    }
+
+    bool ok;
+    switch (field) {
+    case FIELD_SSID:
+        ok = readString(token, update.ssid, sizeof(update.ssid), 1);
+        break;
+    case FIELD_PASSWORD:
+        // WPA2のパスワードは8文字以上（空ならパスワードなし）
+        ok = readString(token, update.password, sizeof(update.password), 0);
+        if (ok && token.length > 0 && token.length < 8) {
+            ok = fail("password must be empty or at least 8 characters");
+        }
+        break;
+    case FIELD_OTA_USERNAME:
+        ok = readString(token, update.otaUsername, sizeof(update.otaUsername), 1);
+        break;
+    case FIELD_OTA_PASSWORD:
+        ok = readString(token, update.otaPassword, sizeof(update.otaPassword), 1);
+        break;
+    case FIELD_NTP_SERVER:
+        ok = readString(token, update.ntpServer, sizeof(update.ntpServer), 1);
+        if (ok && !isHostList(update.ntpServer)) {
+            ok = fail("invalid NTP server name");
+        }
+        break;
+    case FIELD_GMT_OFFSET:
+        ok = readInteger(token, -12 * 3600L, 14 * 3600L, update.gmtOffset);
+        break;
+    case FIELD_DAYLIGHT_OFFSET:
+        ok = readInteger(token, 0, 2 * 3600L, update.daylightOffset);
+        break;
+    case FIELD_TIME_ZONE:
+        // 一覧にある名前か、解析できるPOSIXの規則（空なら gmtOffset・daylightOffset を使う）
+        ok = readString(token, update.timeZone, sizeof(update.timeZone), 0);
+        if (ok && update.timeZone[0] != '\0' && TimeZone::findZone(update.timeZone) < 0) {
+            TimeZone zone;
+            if (!zone.setRule(update.timeZone)) {
+                ok = fail("unknown time zone");
+            }
+        }
+        break;
+    case FIELD_BRIGHTNESS:
+        ok = readInteger(token, 0, 255, update.brightness);
+        break;
+    case FIELD_FACE:
+        ok = token.type == JsonToken::STRING || fail("value must be a string");
+        if (ok) {
+            update.face = -1;
+            for (int i = 0; i < clock->getFaceCount(); i++) {
+                if (strcmp(token.text, clock->getFaceName(i)) == 0) {
+                    update.face = i;
+                    break;
+                }
+            }
+            if (update.face < 0) {
+                ok = fail("unknown face");
+            }
+        }
+        break;
+    default:
+        ok = true;
+        break;
+    }
+    if (ok) {
+        update.present |= (uint16_t)(1u << field);
+    }
+    field = -1;
+    return ok;
+}
+
+// ---- SettingsApi ----
+
+SettingsApi::SettingsApi(SettingsStore* store, SettingsTarget* clock, BrightnessSetter setBrightness)
+    : store(store), clock(clock), setBrightness(setBrightness) {
+}
+
+// 保存してある設定を時計に反映（明るさは起動直後に main.cpp で反映している）
+void SettingsApi::begin() {
+    ClockSettings current = store->get();
+    if (clock->getFaceName(current.face) == nullptr) {
+        current.face = 0;
+        store->update(current);
+    }
+    apply(SettingsStore::CHANGED_NTP_SERVER | SettingsStore::CHANGED_TIME_ZONE | SettingsStore::CHANGED_FACE, current);
+    store->addListener(onSettingsChanged, this);
+}
+
+void SettingsApi::registerRoutes(AsyncWebServer* server, ArRequestFilterFunction access) {
+    setupAccess = access;
+    server->on("/api/settings", HTTP_GET, [this](AsyncWebServerRequest *request) {
+        sendSettings(request);
+    });
+
+    ArBodyHandlerFunction onBody = [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+        handleBody(request, data, len, index, total);
+    };
+    server->on("/api/settings", HTTP_PUT, [this](AsyncWebServerRequest *request) {
+        handlePut(request);
+    }, NULL, onBody);
+
+    // 以前のURL（本文は PUT /api/settings と同じで、含まれる項目だけを変更する）
+    server->on("/save-wifi", HTTP_POST, [this](AsyncWebServerRequest *request) {
+        handlePut(request);
+    }, NULL, onBody);
+    server->on("/save-ota", HTTP_POST, [this](AsyncWebServerRequest *request) {
+        handlePut(request);
+    }, NULL, onBody);
+}
+
+// 本文の一部が届いた（index はこの部分の先頭の位置、total は本文全体の長さ）
+void SettingsApi::handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+    SettingsRequest* parser = (SettingsRequest*)request->_tempObject;
+    if (index == 0 && parser == nullptr) {
+        void* memory = malloc(sizeof(SettingsRequest));
+        if (memory == nullptr) {
+            return;
+        }
+        parser = new (memory) SettingsRequest(clock);
+        request->_tempObject = parser;
+        parser->tooLarge = total > MAX_BODY;
+    }
+    if (parser == nullptr || parser->tooLarge) {
+        return;
+    }
+
+    // 値を読み終えた後も、残りが空白だけか確かめるために最後まで読む
+    bool last = index + len >= total;
+    JsonTokenizer::Result result = parser->tokenizer.feed((const char*)data, len, *parser);
+    if (result != JsonTokenizer::RESULT_ERROR && last) {
+        result = parser->tokenizer.finish(*parser);
+    }
+    parser->complete = last && result == JsonTokenizer::RESULT_DONE;
+}
+
+// 変更してよいリクエストか（設定モードでAPから届いたもの以外はOTAの認証情報で確かめ、違えば401を返す）
+bool SettingsApi::authorize(AsyncWebServerRequest* request) {
+    if (setupAccess && setupAccess(request)) {
+        return true;
+    }
+    ClockSettings current = store->get();
+    if (request->authenticate(current.otaUsername, current.otaPassword)) {
+        return true;
+    }
+    Serial.println("[DEBUG] 設定の変更を拒否しました（認証なし）");
+    request->requestAuthentication();
+    return false;
+}
+
+// 本文を読み終えた。認証を確かめ、すべての値が正しければ反映する
+void SettingsApi::handlePut(AsyncWebServerRequest* request) {
+    if (!authorize(request)) {
+        return;
+    }
+    SettingsRequest* parser = (SettingsRequest*)request->_tempObject;
+    if (parser == nullptr) {
+        sendError(request, 400, "empty body", 0);
+        return;
+    }
+    if (parser->tooLarge) {
+        sendError(request, 413, "body too large", 0);
+        return;
+    }
+    if (!parser->complete) {
+        const char* message = parser->error != nullptr ? parser->error : parser->tokenizer.getError();
+        sendError(request, 400, message != nullptr ? message : "incomplete body", parser->tokenizer.getOffset());
+        return;
+    }
+
+    // 変更後の設定を作ってまとめて渡す（NVSへの書き込みと時計への反映は SettingsStore が後で行う）
+    const SettingsUpdate& update = parser->update;
+    ClockSettings next = store->get();
+    if (update.has(FIELD_SSID)) {
+        memcpy(next.ssid, update.ssid, sizeof(next.ssid));
+    }
+    if (update.has(FIELD_PASSWORD)) {
+        memcpy(next.password, update.password, sizeof(next.password));
+    }
+    if (update.has(FIELD_SSID) || update.has(FIELD_PASSWORD)) {
+        next.configured = 1;
+    }
+    if (update.has(FIELD_OTA_USERNAME)) {
+        memcpy(next.otaUsername, update.otaUsername, sizeof(next.otaUsername));
+    }
+    if (update.has(FIELD_OTA_PASSWORD)) {
+        memcpy(next.otaPassword, update.otaPassword, sizeof(next.otaPassword));
+    }
+    if (update.has(FIELD_NTP_SERVER)) {
+        memcpy(next.ntpServer, update.ntpServer, sizeof(next.ntpServer));
+    }
+    if (update.has(FIELD_GMT_OFFSET)) {
+        next.gmtOffset = update.gmtOffset;
+    }
+    if (update.has(FIELD_DAYLIGHT_OFFSET)) {
+        next.daylightOffset = update.daylightOffset;
+    }
+    if (update.has(FIELD_TIME_ZONE)) {
+        memcpy(next.timeZone, update.timeZone, sizeof(next.timeZone));
+    } else if (update.has(FIELD_GMT_OFFSET) || update.has(FIELD_DAYLIGHT_OFFSET)) {
+        // 時差だけを指定したらその時差を使う
+        next.timeZone[0] = '\0';
+    }
+    if (update.has(FIELD_BRIGHTNESS)) {
+        next.brightness = (uint8_t)update.brightness;
+    }
+    if (update.has(FIELD_FACE)) {
+        next.face = (uint8_t)update.face;
+    }
+    uint16_t changes = store->update(next);
+
+    Serial.printf("[DEBUG] 設定を変更しました（%u bytes, 変更 0x%02x）\n", (unsigned)parser->tokenizer.getOffset(), changes);
+    sendSettings(request);
+}
+
+// すべての設定をJSONで送る（パスワードは設定してあるかだけ）
+void SettingsApi::sendSettings(AsyncWebServerRequest* request) {
+    ClockSettings current = store->get();
+
+    char buffer[1536];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.add("ssid", current.ssid);
+    json.addBool("passwordSet", current.password[0] != '\0');
+    json.add("otaUsername", current.otaUsername);
+    json.addBool("otaPasswordSet", current.otaPassword[0] != '\0');
+    json.add("ntpServer", current.ntpServer);
+    json.addNumber("gmtOffset", current.gmtOffset);
+    json.addNumber("daylightOffset", current.daylightOffset);
+    json.add("timeZone", current.timeZone);
+    json.beginArray("timeZones");
+    for (int i = 0; i < TimeZone::getZoneCount(); i++) {
+        json.add(nullptr, TimeZone::getZoneName(i));
+    }
+    json.endArray();
+    json.addNumber("brightness", current.brightness);
+    json.add("face", clock->getFaceName(current.face));
+    json.beginArray("faces");
+    for (int i = 0; i < clock->getFaceCount(); i++) {
+        json.add(nullptr, clock->getFaceName(i));
+    }
+    json.endArray();
+    json.endObject();
+    sendJson(request, json);
+}
+
+// JSONを送る
+void SettingsApi::sendJson(AsyncWebServerRequest* request, const JsonWriter& json, int code) {
+    if (!json.isValid()) {
+        request->send(500, "text/plain", "JSON buffer overflow");
+        return;
+    }
+    AsyncWebServerResponse* response = request->beginResponse(code, "application/json", json.c_str());
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+// 誤りの内容と、本文の何バイト目で分かったかを返す
+void SettingsApi::sendError(AsyncWebServerRequest* request, int code, const char* message, size_t offset) {
+    char buffer[128];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.add("error", message);
+    json.addNumber("offset", (long)offset);
+    json.endObject();
+    sendJson(request, json, code);
+}
+
+// 変わった設定を反映
+void SettingsApi::apply(uint16_t changes, const ClockSettings& settings) {
+    if (changes & SettingsStore::CHANGED_NTP_SERVER) {
+        clock->setNtpServer(settings.ntpServer);
+    }
+    if (changes & SettingsStore::CHANGED_TIME_ZONE) {
+        if (settings.timeZone[0] != '\0') {
+            clock->setTimeZone(settings.timeZone);
+        } else {
+            char rule[TimeZone::RULE_SIZE];
+            TimeZone::formatOffsetRule(rule, sizeof(rule), settings.gmtOffset, settings.daylightOffset);
+            clock->setTimeZone(rule);
+        }
+    }
+    if ((changes & SettingsStore::CHANGED_BRIGHTNESS) && setBrightness != nullptr) {
+        setBrightness(settings.brightness);
+    }
+    if (changes & SettingsStore::CHANGED_FACE) {
+        clock->setFace(settings.face);
+    }
+}
+
+void SettingsApi::onSettingsChanged(uint16_t changes, const ClockSettings& settings, void* context) {
+    ((SettingsApi*)context)->apply(changes, settings);
+}
@@ -0,0 +1,55 @@
+#ifndef SETTINGS_API_H
+#define SETTINGS_API_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "json_stream.h"
+#include "settings_store.h"
+#include "settings_target.h"
+
+// 設定のREST API
+//   GET /api/settings  すべての設定をJSONで返す
+//   PUT /api/settings  JSONに含まれる項目だけを変更し、変更後のすべての設定を返す
+// 本文は分割して届いてもよい（届いた分ずつ JsonTokenizer で読み、本文全体は保持しない）。
+// すべての値を確かめてから SettingsStore にまとめて渡すので、1つでも誤りがあれば何も変えずに400を返す。
+// 時計とバックライトへの反映は SettingsStore::handle() から呼ばれる（描画中の時計を別のタスクから変更しない）。
+// GET はパスワードを返さず、設定してあるかだけを返す（passwordSet・otaPasswordSet）。
+// 変更（PUT と以前の POST）はOTAの認証情報によるBasic認証が要る（設定モードでAPから届いたリクエストだけは不要）。
+class SettingsApi {
+public:
+    typedef void (*BrightnessSetter)(uint8_t brightness);
+
+    // 本文の上限（設定のJSONはこれより十分小さい）
+    static const size_t MAX_BODY = 1024;
+
+private:
+    SettingsStore* store;
+    SettingsTarget* clock;
+    BrightnessSetter setBrightness;
+    ArRequestFilterFunction setupAccess;  // 認証なしで変更できるリクエストか
+
+    void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
+    void handlePut(AsyncWebServerRequest* request);
+    bool authorize(AsyncWebServerRequest* request);
+    void sendSettings(AsyncWebServerRequest* request);
+    void sendError(AsyncWebServerRequest* request, int code, const char* message, size_t offset);
+
+    // 変わった設定を時計とバックライトに反映
+    void apply(uint16_t changes, const ClockSettings& settings);
+    static void onSettingsChanged(uint16_t changes, const ClockSettings& settings, void* context);
+
+public:
+    SettingsApi(SettingsStore* store, SettingsTarget* clock, BrightnessSetter setBrightness);
+
+    // 保存してあるNTPサーバー・タイムゾーン・文字盤を時計に反映し、以後の変更を受け取る
+    void begin();
+
+    // URLを登録（WiFiManager がWebサーバーを設定する時に呼ぶ）
+    // setupAccess が true を返すリクエスト（設定モードでAPから届いたもの）は認証なしで変更できる
+    void registerRoutes(AsyncWebServer* server, ArRequestFilterFunction setupAccess);
+
+    // JSONを送る（値は変わるのでキャッシュさせない。JSONがバッファに入りきらなければ500）
+    static void sendJson(AsyncWebServerRequest* request, const JsonWriter& json, int code = 200);
+};
+
+#endif // SETTINGS_API_H
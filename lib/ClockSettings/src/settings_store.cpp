@@ -0,0 +1,263 @@
+#include "settings_store.h"
+#include <stddef.h>
+#include <string.h>
+
+// Webサーバーのタスクと loop() の間で settings を受け渡す
+static portMUX_TYPE storeLock = portMUX_INITIALIZER_UNLOCKED;
+
+// NVSの名前空間とキー
+static const char* const NAMESPACE = "clock";
+static const char* const BLOB_KEY = "settings";
+
+// 以前の形式で項目ごとに保存していたキー
+static const char* const legacyKeys[] = {
+    "ssid", "password", "configured", "otaUser", "otaPwd",
+    "ntpServer", "gmtOffset", "dstOffset", "face"
+};
+static const int LEGACY_KEY_COUNT = sizeof(legacyKeys) / sizeof(legacyKeys[0]);
+
+// NVSに書く値（版と設定の長さを前に付ける）
+struct SettingsBlob {
+    uint16_t version;
+    uint16_t length;            // settings の長さ（前の版では短い）
+    ClockSettings settings;
+};
+
+static void copyString(char* dst, size_t size, const char* src) {
+    strncpy(dst, src, size - 1);
+    dst[size - 1] = '\0';
+}
+
+// 2つの設定で違う項目
+static uint16_t diffSettings(const ClockSettings& a, const ClockSettings& b) {
+    uint16_t changes = 0;
+    if (strcmp(a.ssid, b.ssid) != 0 || strcmp(a.password, b.password) != 0 || a.configured != b.configured) {
+        changes |= SettingsStore::CHANGED_WIFI;
+    }
+    if (strcmp(a.otaUsername, b.otaUsername) != 0 || strcmp(a.otaPassword, b.otaPassword) != 0) {
+        changes |= SettingsStore::CHANGED_OTA;
+    }
+    if (strcmp(a.ntpServer, b.ntpServer) != 0) {
+        changes |= SettingsStore::CHANGED_NTP_SERVER;
+    }
+    if (a.gmtOffset != b.gmtOffset || a.daylightOffset != b.daylightOffset || strcmp(a.timeZone, b.timeZone) != 0) {
+        changes |= SettingsStore::CHANGED_TIME_ZONE;
+    }
+    if (a.brightness != b.brightness) {
+        changes |= SettingsStore::CHANGED_BRIGHTNESS;
+    }
+    if (a.face != b.face) {
+        changes |= SettingsStore::CHANGED_FACE;
+    }
+    return changes;
+}
+
+SettingsStore::SettingsStore()
+    : pendingChanges(0), dirty(false), removeLegacyKeys(false), firstChangeAt(0), lastChangeAt(0),
+      listenerCount(0), loadSource("default"), loadMicros(0), commitCount(0), lastCommitMicros(0) {
+    memset(&settings, 0, sizeof(settings));
+}
+
+void SettingsStore::begin(const char* ntpServer, const char* timeZone, uint8_t brightness) {
+    uint32_t start = micros();
+
+    ClockSettings defaults;
+    memset(&defaults, 0, sizeof(defaults));
+    copyString(defaults.otaUsername, sizeof(defaults.otaUsername), "admin");
+    copyString(defaults.otaPassword, sizeof(defaults.otaPassword), "admin");
+    copyString(defaults.ntpServer, sizeof(defaults.ntpServer), ntpServer);
+    copyString(defaults.timeZone, sizeof(defaults.timeZone), timeZone);
+    defaults.brightness = brightness;
+    settings = defaults;
+
+    // 1回の読み出しで全部を読む（保存した値が今の版より長ければ 0 が返るので初期値のまま）
+    Preferences preferences;
+    SettingsBlob blob;
+    size_t length = 0;
+    if (preferences.begin(NAMESPACE, true)) {
+        length = preferences.getBytes(BLOB_KEY, &blob, sizeof(blob));
+        preferences.end();
+    }
+    size_t header = offsetof(SettingsBlob, settings);
+    if (length > header && blob.version == VERSION && blob.length == length - header) {
+        memcpy(&settings, &blob.settings, blob.length);
+        if (blob.length < offsetof(ClockSettings, timeZone) + sizeof(settings.timeZone)) {
+            // タイムゾーンを保存する前の版（保存してある時差を使う）
+            settings.timeZone[0] = '\0';
+        }
+        loadSource = "blob";
+    } else if (loadLegacy()) {
+        // 次の handle() で新しい形式で書き直す
+        loadSource = "legacy";
+        dirty = true;
+        removeLegacyKeys = true;
+        firstChangeAt = lastChangeAt = millis() - COMMIT_MAX_DELAY_MS;
+    }
+    sanitize(defaults);
+
+    loadMicros = micros() - start;
+    Serial.printf("[DEBUG] 設定読み込み: %lu us (%s, %u bytes)\n",
+                  (unsigned long)loadMicros, loadSource, (unsigned)length);
+    Serial.printf("SSID: %s\n", settings.ssid);
+    Serial.printf("設定済み: %s\n", settings.configured ? "はい" : "いいえ");
+}
+
+bool SettingsStore::loadLegacy() {
+    Preferences preferences;
+    if (!preferences.begin(NAMESPACE, true)) {
+        return false;
+    }
+    bool found = false;
+    for (int i = 0; i < LEGACY_KEY_COUNT && !found; i++) {
+        found = preferences.isKey(legacyKeys[i]);
+    }
+    if (found) {
+        preferences.getString("ssid", settings.ssid, sizeof(settings.ssid));
+        preferences.getString("password", settings.password, sizeof(settings.password));
+        settings.configured = preferences.getBool("configured", false) ? 1 : 0;
+        if (preferences.isKey("otaUser")) {
+            preferences.getString("otaUser", settings.otaUsername, sizeof(settings.otaUsername));
+            preferences.getString("otaPwd", settings.otaPassword, sizeof(settings.otaPassword));
+        }
+        if (preferences.isKey("ntpServer")) {
+            preferences.getString("ntpServer", settings.ntpServer, sizeof(settings.ntpServer));
+        }
+        if (preferences.isKey("gmtOffset")) {
+            // 保存してある時差を使う
+            settings.gmtOffset = preferences.getInt("gmtOffset", 0);
+            settings.daylightOffset = preferences.getInt("dstOffset", 0);
+            settings.timeZone[0] = '\0';
+        }
+        settings.face = (uint8_t)preferences.getInt("face", settings.face);
+    }
+    preferences.end();
+    return found;
+}
+
+void SettingsStore::sanitize(const ClockSettings& defaults) {
+    settings.ssid[sizeof(settings.ssid) - 1] = '\0';
+    settings.password[sizeof(settings.password) - 1] = '\0';
+    settings.otaUsername[sizeof(settings.otaUsername) - 1] = '\0';
+    settings.otaPassword[sizeof(settings.otaPassword) - 1] = '\0';
+    settings.ntpServer[sizeof(settings.ntpServer) - 1] = '\0';
+    settings.timeZone[sizeof(settings.timeZone) - 1] = '\0';
+    if (settings.ntpServer[0] == '\0') {
+        memcpy(settings.ntpServer, defaults.ntpServer, sizeof(settings.ntpServer));
+    }
+    if (settings.otaUsername[0] == '\0' || settings.otaPassword[0] == '\0') {
+        memcpy(settings.otaUsername, defaults.otaUsername, sizeof(settings.otaUsername));
+        memcpy(settings.otaPassword, defaults.otaPassword, sizeof(settings.otaPassword));
+    }
+}
+
+ClockSettings SettingsStore::get() {
+    portENTER_CRITICAL(&storeLock);
+    ClockSettings current = settings;
+    portEXIT_CRITICAL(&storeLock);
+    return current;
+}
+
+uint16_t SettingsStore::update(const ClockSettings& next) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&storeLock);
+    uint16_t changes = diffSettings(settings, next);
+    if (changes != 0) {
+        settings = next;
+        pendingChanges |= changes;
+        if (!dirty) {
+            firstChangeAt = now;
+        }
+        lastChangeAt = now;
+        dirty = true;
+    }
+    portEXIT_CRITICAL(&storeLock);
+    return changes;
+}
+
+uint16_t SettingsStore::setBrightness(uint8_t brightness) {
+    ClockSettings next = get();
+    next.brightness = brightness;
+    return update(next);
+}
+
+bool SettingsStore::addListener(Listener listener, void* context) {
+    if (listenerCount >= MAX_LISTENERS) {
+        return false;
+    }
+    listeners[listenerCount] = listener;
+    listenerContexts[listenerCount] = context;
+    listenerCount++;
+    return true;
+}
+
+void SettingsStore::handle() {
+    if (pendingChanges != 0) {
+        portENTER_CRITICAL(&storeLock);
+        uint16_t changes = pendingChanges;
+        pendingChanges = 0;
+        ClockSettings current = settings;
+        portEXIT_CRITICAL(&storeLock);
+
+        for (int i = 0; i < listenerCount; i++) {
+            listeners[i](changes, current, listenerContexts[i]);
+        }
+    }
+
+    if (dirty) {
+        uint32_t now = millis();
+        if (now - lastChangeAt >= COMMIT_DELAY_MS || now - firstChangeAt >= COMMIT_MAX_DELAY_MS) {
+            commit();
+        }
+    }
+}
+
+void SettingsStore::flush() {
+    if (dirty) {
+        commit();
+    }
+}
+
+void SettingsStore::commit() {
+    uint32_t start = micros();
+
+    SettingsBlob blob;
+    memset(&blob, 0, sizeof(blob));
+    blob.version = VERSION;
+    blob.length = sizeof(ClockSettings);
+    portENTER_CRITICAL(&storeLock);
+    blob.settings = settings;
+    dirty = false;
+    portEXIT_CRITICAL(&storeLock);
+
+    // Webサーバーのタスクの flush() と重なっても良いように、呼び出しごとに開く
+    Preferences preferences;
+    size_t written = 0;
+    if (preferences.begin(NAMESPACE, false)) {
+        written = preferences.putBytes(BLOB_KEY, &blob, sizeof(blob));
+        if (written == sizeof(blob) && removeLegacyKeys) {
+            for (int i = 0; i < LEGACY_KEY_COUNT; i++) {
+                preferences.remove(legacyKeys[i]);
+            }
+            removeLegacyKeys = false;
+        }
+        preferences.end();
+    }
+
+    if (written != sizeof(blob)) {
+        // 書けなかった。しばらくしてからもう一度書く
+        portENTER_CRITICAL(&storeLock);
+        if (!dirty) {
+            firstChangeAt = millis();
+        }
+        lastChangeAt = millis();
+        dirty = true;
+        portEXIT_CRITICAL(&storeLock);
+        Serial.println("[ERROR] 設定を保存できませんでした");
+        return;
+    }
+
+    commitCount++;
+    lastCommitMicros = micros() - start;
+    Serial.printf("[DEBUG] 設定を保存しました（%u bytes, %lu us, %lu回目）\n",
+                  (unsigned)written, (unsigned long)lastCommitMicros, (unsigned long)commitCount);
+}
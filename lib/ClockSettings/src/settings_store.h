@@ -0,0 +1,115 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "time_zone.h"
+
+// 保存する設定（NVSには SettingsStore がこの構造体を1つの値としてそのまま書く）
+// 項目は最後に追加する（前の版で保存した値は、保存されていた長さの分だけ読み、残りは初期値になる）。
+// 並びや型を変える時は SettingsStore::VERSION を上げる（前の版の値は使わず初期値に戻る）。
+struct ClockSettings {
+    char ssid[33];
+    char password[64];
+    char otaUsername[33];
+    char otaPassword[65];
+    char ntpServer[64];
+    int32_t gmtOffset;          // UTCとの時差（秒）
+    int32_t daylightOffset;     // 夏時間で進める時間（秒）
+    uint8_t brightness;         // バックライトの明るさ（0-255）
+    uint8_t face;               // 文字盤の番号（名前は NTPClock::getFaceName()）
+    uint8_t configured;         // WiFiを設定済みか（0以外なら設定済み）
+    char timeZone[TimeZone::RULE_SIZE]; // タイムゾーンの名前かPOSIXの規則（空なら gmtOffset・daylightOffset を使う）
+};
+
+// 設定の保存
+// すべての設定をRAMに持ち、起動時に1回だけNVSから読む。変更はRAMにだけ反映し、
+// 変更が COMMIT_DELAY_MS 続けて無かった時（変更が続く場合でも最初の変更から COMMIT_MAX_DELAY_MS 後）に
+// まとめて1つの値としてNVSに書く。明るさのスライダーのように続けて変わる値でもフラッシュの書き込みは1回で済む。
+// 変わった項目は handle() で登録した関数に知らせる（loop() から呼ぶので、描画中の時計を別のタスクから変更しない）。
+// get() と update() はWebサーバーのタスクからも呼べる。
+class SettingsStore {
+public:
+    // 変わった項目
+    enum Change {
+        CHANGED_WIFI = 1 << 0,
+        CHANGED_OTA = 1 << 1,
+        CHANGED_NTP_SERVER = 1 << 2,
+        CHANGED_TIME_ZONE = 1 << 3,
+        CHANGED_BRIGHTNESS = 1 << 4,
+        CHANGED_FACE = 1 << 5
+    };
+
+    // 変わった項目（changes）と変更後の設定を受け取る関数
+    typedef void (*Listener)(uint16_t changes, const ClockSettings& settings, void* context);
+
+    // 保存する値の版
+    static const uint16_t VERSION = 1;
+
+    // 最後の変更からNVSに書くまでの時間と、最初の変更から書くまでの上限
+    static const uint32_t COMMIT_DELAY_MS = 2000;
+    static const uint32_t COMMIT_MAX_DELAY_MS = 10000;
+
+    static const int MAX_LISTENERS = 4;
+
+private:
+    ClockSettings settings;
+
+    volatile uint16_t pendingChanges;  // まだ知らせていない項目
+    volatile bool dirty;               // まだNVSに書いていない変更がある
+    bool removeLegacyKeys;             // 次に書く時に以前の形式のキーを消す
+    uint32_t firstChangeAt;            // 書いていない最初の変更の時刻（millis）
+    uint32_t lastChangeAt;             // 最後の変更の時刻（millis）
+
+    Listener listeners[MAX_LISTENERS];
+    void* listenerContexts[MAX_LISTENERS];
+    int listenerCount;
+
+    // 統計
+    const char* loadSource;            // 起動時に読んだ所（"blob"・"legacy"・"default"）
+    uint32_t loadMicros;
+    uint32_t commitCount;
+    uint32_t lastCommitMicros;
+
+    // 以前の形式（項目ごとのキー）で保存された設定を読む（無ければ false）
+    bool loadLegacy();
+
+    // 文字列を終端し、空の値を初期値に戻す
+    void sanitize(const ClockSettings& defaults);
+
+    // 変更をNVSに書く
+    void commit();
+
+public:
+    SettingsStore();
+
+    // 保存してある設定を読み込む（無ければ引数の値とWiFi未設定・OTAは admin/admin）
+    // タイムゾーンを保存する前の版の値なら、保存してある時差をそのまま使う
+    void begin(const char* ntpServer, const char* timeZone, uint8_t brightness);
+
+    // 今の設定（コピーを返す）
+    ClockSettings get();
+
+    // 設定を変更する（変わった項目を返す。0なら何も変わっていないので書き込みも起きない）
+    uint16_t update(const ClockSettings& next);
+
+    // 明るさだけを変更する
+    uint16_t setBrightness(uint8_t brightness);
+
+    // 変わった項目を知らせる関数を登録（MAX_LISTENERS個まで）
+    bool addListener(Listener listener, void* context);
+
+    // 変更を知らせ、時間が来たらNVSに書く（loop() から毎回呼ぶ）
+    void handle();
+
+    // 書いていない変更をすぐにNVSに書く（再起動の前に呼ぶ）
+    void flush();
+
+    // 統計
+    const char* getLoadSource() { return loadSource; }
+    uint32_t getLoadMicros() { return loadMicros; }
+    uint32_t getCommitCount() { return commitCount; }
+    uint32_t getLastCommitMicros() { return lastCommitMicros; }
+};
+
+#endif // SETTINGS_STORE_H
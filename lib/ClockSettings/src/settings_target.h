@@ -0,0 +1,22 @@
+#ifndef SETTINGS_TARGET_H
+#define SETTINGS_TARGET_H
+
+// 設定を反映する時計（各時計の NTPClock が実装する）
+// SettingsApi は文字盤の名前の確認と、変わった設定の反映にだけ使う。
+class SettingsTarget {
+public:
+    virtual ~SettingsTarget() {}
+
+    // NTPサーバー（カンマ区切りで複数指定できる）
+    virtual void setNtpServer(const char* server) = 0;
+
+    // タイムゾーンは TimeZone の表にある名前かPOSIXの規則（解析できなければ false で、今のまま）
+    virtual bool setTimeZone(const char* nameOrRule) = 0;
+
+    // 文字盤の種類（0が最初の文字盤。名前はWeb設定のAPIで使い、範囲外なら nullptr）
+    virtual int getFaceCount() = 0;
+    virtual const char* getFaceName(int index) = 0;
+    virtual bool setFace(int index) = 0;
+};
+
+#endif // SETTINGS_TARGET_H
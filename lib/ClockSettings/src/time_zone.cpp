@@ -0,0 +1,358 @@
+#include "time_zone.h"
+#include <string.h>
+#include <ctype.h>
+
+// 選べるタイムゾーン（名前はIANAの名前、規則はPOSIX形式。増やす時はここに追加する）
+struct ZoneEntry {
+    const char* name;
+    const char* rule;
+};
+static const ZoneEntry zones[] = {
+    { "Asia/Tokyo", "JST-9" },                                  // 最初の設定
+    { "UTC", "UTC0" },
+    { "Asia/Seoul", "KST-9" },
+    { "Asia/Shanghai", "CST-8" },
+    { "Asia/Singapore", "<+08>-8" },
+    { "Asia/Bangkok", "<+07>-7" },
+    { "Asia/Kolkata", "IST-5:30" },
+    { "Asia/Dubai", "<+04>-4" },
+    { "Europe/Moscow", "MSK-3" },
+    { "Europe/Helsinki", "EET-2EEST,M3.5.0/3,M10.5.0/4" },
+    { "Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3" },
+    { "Europe/London", "GMT0BST,M3.5.0/1,M10.5.0" },
+    { "America/Sao_Paulo", "<-03>3" },
+    { "America/New_York", "EST5EDT,M3.2.0,M11.1.0" },
+    { "America/Chicago", "CST6CDT,M3.2.0,M11.1.0" },
+    { "America/Denver", "MST7MDT,M3.2.0,M11.1.0" },
+    { "America/Phoenix", "MST7" },
+    { "America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0" },
+    { "America/Anchorage", "AKST9AKDT,M3.2.0,M11.1.0" },
+    { "Pacific/Honolulu", "HST10" },
+    { "Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3" },
+    { "Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Adelaide", "ACST-9:30ACDT,M10.1.0,M4.1.0/3" },
+    { "Australia/Brisbane", "AEST-10" },
+};
+static const int ZONE_COUNT = sizeof(zones) / sizeof(zones[0]);
+
+static const int32_t SECONDS_PER_DAY = 86400;
+
+// 切り替わりの時刻を書かなかった時（02:00）
+static const int32_t DEFAULT_TRANSITION_TIME = 2 * 3600;
+
+// 1970-01-01 からの日数（グレゴリオ暦）
+static int64_t daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t yearOfEra = year - era * 400;
+    int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// 1970-01-01 からの日数を年月日にする
+static void civilFromDays(int64_t days, int* year, int* month, int* day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t dayOfEra = days - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t mp = (5 * dayOfYear + 2) / 153;
+    *day = (int)(dayOfYear - (153 * mp + 2) / 5 + 1);
+    *month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *year = (int)(yearOfEra + era * 400 + (*month <= 2));
+}
+
+static bool isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// 負の値でも切り捨てる割り算
+static int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+int TimeZone::getZoneCount() {
+    return ZONE_COUNT;
+}
+
+const char* TimeZone::getZoneName(int index) {
+    return (index >= 0 && index < ZONE_COUNT) ? zones[index].name : nullptr;
+}
+
+const char* TimeZone::getZoneRule(int index) {
+    return (index >= 0 && index < ZONE_COUNT) ? zones[index].rule : nullptr;
+}
+
+int TimeZone::findZone(const char* name) {
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        if (strcmp(zones[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 時差から規則を作る（POSIX形式は東が負。夏時間の期間は、書かない時の既定の期間をそのまま書く。
+// 書かないとCライブラリによって期間が違う）
+void TimeZone::formatOffsetRule(char* rule, size_t size, long gmtOffset, int daylightOffset) {
+    long offset = -gmtOffset;
+    char sign = offset < 0 ? '-' : '+';
+    long value = offset < 0 ? -offset : offset;
+    int length = snprintf(rule, size, "UTC%c%02ld:%02ld:%02ld", sign, value / 3600, (value / 60) % 60, value % 60);
+    if (daylightOffset != 0 && length > 0 && (size_t)length < size) {
+        offset -= daylightOffset;
+        sign = offset < 0 ? '-' : '+';
+        value = offset < 0 ? -offset : offset;
+        snprintf(rule + length, size - length, "DST%c%02ld:%02ld:%02ld,M3.2.0,M11.1.0", sign, value / 3600,
+                 (value / 60) % 60, value % 60);
+    }
+}
+
+TimeZone::TimeZone()
+    : stdOffset(0), dstOffset(0), hasDst(false), cachedYearBegin(0), cachedYearEnd(0), cachedStartUtc(0),
+      cachedEndUtc(0), cachedSecond(0), cacheValid(false) {
+    rule[0] = '\0';
+    memset(&dstStart, 0, sizeof(dstStart));
+    memset(&dstEnd, 0, sizeof(dstEnd));
+    memset(&cachedTm, 0, sizeof(cachedTm));
+    setRule("UTC0");
+}
+
+// 名前（英字3文字以上か <...>）を読み飛ばす
+const char* TimeZone::parseName(const char* p) {
+    if (*p == '<') {
+        const char* end = strchr(p, '>');
+        return (end != nullptr && end - p >= 4) ? end + 1 : nullptr;
+    }
+    const char* start = p;
+    while (isalpha((unsigned char)*p)) {
+        p++;
+    }
+    return p - start >= 3 ? p : nullptr;
+}
+
+// [+-]hh[:mm[:ss]] を秒にする
+const char* TimeZone::parseTime(const char* p, int32_t* seconds) {
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+        sign = *p == '-' ? -1 : 1;
+        p++;
+    }
+    int32_t value = 0;
+    for (int part = 0; part < 3; part++) {
+        if (part > 0) {
+            if (*p != ':') {
+                break;
+            }
+            p++;
+        }
+        if (!isdigit((unsigned char)*p)) {
+            return nullptr;
+        }
+        int32_t number = 0;
+        while (isdigit((unsigned char)*p)) {
+            number = number * 10 + (*p++ - '0');
+            if (number > 167) {
+                return nullptr;
+            }
+        }
+        if (part > 0 && number > 59) {
+            return nullptr;
+        }
+        value += number * (part == 0 ? 3600 : (part == 1 ? 60 : 1));
+    }
+    *seconds = sign * value;
+    return p;
+}
+
+// Jn・n・Mm.w.d[/time] を読む
+const char* TimeZone::parseTransition(const char* p, Transition* transition) {
+    memset(transition, 0, sizeof(*transition));
+    int values[3] = { 0, 0, 0 };
+    int count = 1;
+    if (*p == 'M') {
+        transition->kind = 'M';
+        count = 3;
+        p++;
+    } else if (*p == 'J') {
+        transition->kind = 'J';
+        p++;
+    } else {
+        transition->kind = 'D';
+    }
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && *p++ != '.') {
+            return nullptr;
+        }
+        if (!isdigit((unsigned char)*p)) {
+            return nullptr;
+        }
+        while (isdigit((unsigned char)*p)) {
+            values[i] = values[i] * 10 + (*p++ - '0');
+            if (values[i] > 365) {
+                return nullptr;
+            }
+        }
+    }
+    if (transition->kind == 'M') {
+        if (values[0] < 1 || values[0] > 12 || values[1] < 1 || values[1] > 5 || values[2] > 6) {
+            return nullptr;
+        }
+        transition->month = values[0];
+        transition->week = values[1];
+        transition->weekday = values[2];
+    } else if (transition->kind == 'J' && values[0] < 1) {
+        return nullptr;
+    } else {
+        transition->day = values[0];
+    }
+
+    transition->time = DEFAULT_TRANSITION_TIME;
+    if (*p == '/') {
+        p = parseTime(p + 1, &transition->time);
+    }
+    return p;
+}
+
+bool TimeZone::setRule(const char* text) {
+    if (strlen(text) >= sizeof(rule)) {
+        return false;
+    }
+
+    // 標準時の名前と時差（POSIX形式は西が正）
+    const char* p = parseName(text);
+    int32_t offset;
+    if (p == nullptr || (p = parseTime(p, &offset)) == nullptr) {
+        return false;
+    }
+    int32_t nextStd = -offset;
+    int32_t nextDst = nextStd;
+    bool nextHasDst = false;
+    // 夏時間の期間を書かなければ3月の第2日曜から11月の第1日曜まで
+    Transition nextStart = { 'M', 3, 2, 0, 0, DEFAULT_TRANSITION_TIME };
+    Transition nextEnd = { 'M', 11, 1, 0, 0, DEFAULT_TRANSITION_TIME };
+
+    if (*p != '\0') {
+        // 夏時間の名前と時差（書かなければ標準時の1時間先）
+        if ((p = parseName(p)) == nullptr) {
+            return false;
+        }
+        nextHasDst = true;
+        nextDst = nextStd + 3600;
+        if (*p != '\0' && *p != ',') {
+            if ((p = parseTime(p, &offset)) == nullptr) {
+                return false;
+            }
+            nextDst = -offset;
+        }
+        if (*p == ',') {
+            if ((p = parseTransition(p + 1, &nextStart)) == nullptr || *p != ',' ||
+                (p = parseTransition(p + 1, &nextEnd)) == nullptr) {
+                return false;
+            }
+        }
+        if (*p != '\0') {
+            return false;
+        }
+    }
+
+    strcpy(rule, text);
+    stdOffset = nextStd;
+    dstOffset = nextDst;
+    hasDst = nextHasDst;
+    dstStart = nextStart;
+    dstEnd = nextEnd;
+    cachedYearBegin = cachedYearEnd = 0;
+    cacheValid = false;
+    return true;
+}
+
+bool TimeZone::setZone(const char* nameOrRule) {
+    int index = findZone(nameOrRule);
+    return setRule(index >= 0 ? zones[index].rule : nameOrRule);
+}
+
+int64_t TimeZone::transitionDay(const Transition& transition, int year) {
+    int64_t yearStart = daysFromCivil(year, 1, 1);
+    if (transition.kind == 'J') {
+        // 2月29日は数えない
+        int day = transition.day - 1;
+        if (isLeapYear(year) && transition.day >= 60) {
+            day++;
+        }
+        return yearStart + day;
+    }
+    if (transition.kind == 'D') {
+        return yearStart + transition.day;
+    }
+
+    // m月の第w週のd曜日（5は最後のd曜日）。1970-01-01は木曜
+    int64_t first = daysFromCivil(year, transition.month, 1);
+    int firstWeekday = (int)((first % 7 + 11) % 7);
+    int64_t day = first + (transition.weekday - firstWeekday + 7) % 7 + (transition.week - 1) * 7;
+    int64_t nextMonth = transition.month == 12 ? daysFromCivil(year + 1, 1, 1)
+                                               : daysFromCivil(year, transition.month + 1, 1);
+    while (day >= nextMonth) {
+        day -= 7;
+    }
+    return day;
+}
+
+void TimeZone::computeYear(int64_t utc) {
+    int year, month, day;
+    civilFromDays(floorDiv(utc + stdOffset, SECONDS_PER_DAY), &year, &month, &day);
+    cachedYearBegin = daysFromCivil(year, 1, 1) * SECONDS_PER_DAY - stdOffset;
+    cachedYearEnd = daysFromCivil(year + 1, 1, 1) * SECONDS_PER_DAY - stdOffset;
+    // 開始は標準時、終了は夏時間で書いてある
+    cachedStartUtc = transitionDay(dstStart, year) * SECONDS_PER_DAY + dstStart.time - stdOffset;
+    cachedEndUtc = transitionDay(dstEnd, year) * SECONDS_PER_DAY + dstEnd.time - dstOffset;
+}
+
+bool TimeZone::isDst(time_t utc) {
+    if (!hasDst) {
+        return false;
+    }
+    if (utc < cachedYearBegin || utc >= cachedYearEnd) {
+        computeYear(utc);
+    }
+    if (cachedStartUtc < cachedEndUtc) {
+        return utc >= cachedStartUtc && utc < cachedEndUtc;
+    }
+    // 南半球（年の初めと終わりが夏時間）
+    return utc >= cachedStartUtc || utc < cachedEndUtc;
+}
+
+int32_t TimeZone::getOffset(time_t utc) {
+    return isDst(utc) ? dstOffset : stdOffset;
+}
+
+void TimeZone::toLocal(time_t utc, struct tm* local) {
+    if (cacheValid && utc == cachedSecond) {
+        *local = cachedTm;
+        return;
+    }
+
+    bool dst = isDst(utc);
+    int64_t seconds = (int64_t)utc + (dst ? dstOffset : stdOffset);
+    int64_t days = floorDiv(seconds, SECONDS_PER_DAY);
+    int32_t secondOfDay = (int32_t)(seconds - days * SECONDS_PER_DAY);
+    int year, month, day;
+    civilFromDays(days, &year, &month, &day);
+
+    struct tm& tm = cachedTm;
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = secondOfDay / 3600;
+    tm.tm_min = (secondOfDay / 60) % 60;
+    tm.tm_sec = secondOfDay % 60;
+    tm.tm_wday = (int)((days % 7 + 11) % 7);
+    tm.tm_yday = (int)(days - daysFromCivil(year, 1, 1));
+    tm.tm_isdst = dst ? 1 : 0;
+    cachedSecond = utc;
+    cacheValid = true;
+    *local = tm;
+}
@@ -0,0 +1,86 @@
+#ifndef TIME_ZONE_H
+#define TIME_ZONE_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// タイムゾーン（POSIX形式の規則、例: "EST5EDT,M3.2.0,M11.1.0"）
+// 規則は setRule() の時に1回だけ解析し、夏時間の開始・終了の時刻（UTC）を1年分だけ覚えておく。
+// 変換は2回の比較と足し算・割り算だけで済み（年が変わった時だけ切り替わりの時刻を計算し直す）、
+// 同じ秒の間は前回の結果をそのまま返す。
+// 選べるタイムゾーンは time_zone.cpp の表（名前とPOSIXの規則）にある。
+class TimeZone {
+public:
+    // 規則の文字列の最大長（終端を含む）
+    static const int RULE_SIZE = 48;
+
+    // 表にあるタイムゾーンの数と名前・規則（見つからなければ findZone() は -1）
+    static int getZoneCount();
+    static const char* getZoneName(int index);
+    static const char* getZoneRule(int index);
+    static int findZone(const char* name);
+
+    // UTCとの時差と夏時間で進める時間（秒）からPOSIXの規則を作る（夏時間の期間は標準の規則）
+    static void formatOffsetRule(char* rule, size_t size, long gmtOffset, int daylightOffset);
+
+private:
+    // 夏時間の切り替わりの日（POSIXの Jn・n・Mm.w.d）と時刻（その時点の地方時、秒）
+    struct Transition {
+        uint8_t kind;           // 'J'・'D'（0始まりの通算日）・'M'
+        uint8_t month;          // 1-12
+        uint8_t week;           // 1-5（5は最後の週）
+        uint8_t weekday;        // 0-6（日曜が0）
+        uint16_t day;           // 'J' は1-365、'D' は0-365
+        int32_t time;
+    };
+
+    char rule[RULE_SIZE];
+    int32_t stdOffset;          // 標準時のUTCとの時差（東が正、秒）
+    int32_t dstOffset;          // 夏時間のUTCとの時差
+    bool hasDst;
+    Transition dstStart;
+    Transition dstEnd;
+
+    // 切り替わりの時刻を計算した年の範囲と、その年の夏時間の開始・終了の時刻（UTC。年は標準時で数える）
+    int64_t cachedYearBegin;
+    int64_t cachedYearEnd;
+    int64_t cachedStartUtc;
+    int64_t cachedEndUtc;
+
+    // 前回変換した秒と結果
+    time_t cachedSecond;
+    struct tm cachedTm;
+    bool cacheValid;
+
+    static const char* parseName(const char* p);
+    static const char* parseTime(const char* p, int32_t* seconds);
+    static const char* parseTransition(const char* p, Transition* transition);
+
+    // その年の切り替わりの日（1970-01-01からの日数、地方時）
+    static int64_t transitionDay(const Transition& transition, int year);
+
+    // utc を含む年の切り替わりの時刻を計算する
+    void computeYear(int64_t utc);
+
+public:
+    TimeZone();
+
+    // 規則を設定する（解析できなければ false を返し、今の規則のまま）
+    bool setRule(const char* rule);
+    const char* getRule() { return rule; }
+
+    // 名前（表にあるもの）か規則で設定する
+    bool setZone(const char* nameOrRule);
+
+    // UTCの時刻を地方時にする（同じ秒なら前回の結果を返す）
+    void toLocal(time_t utc, struct tm* local);
+
+    // UTCの時刻での時差（東が正、秒）と夏時間か
+    int32_t getOffset(time_t utc);
+    bool isDst(time_t utc);
+
+    // 規則が夏時間を持つか
+    bool hasDaylightSaving() { return hasDst; }
+};
+
+#endif // TIME_ZONE_H
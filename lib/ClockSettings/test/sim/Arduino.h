@@ -0,0 +1,13 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// ホストで動かすテスト用の Arduino の代わり（ClockSettings のソースが使う分だけ）
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,679 @@
+// JsonTokenizer のホスト用テスト
+// 乱数で作ったJSONと、それを途中で切ったもの・1バイトを変えたものを、1回で渡した時と
+// 乱数の位置で分けて渡した時とで読み、受け付けるかどうかと字句の列が別に書いた厳密な読み取り
+// （このファイルの Reference）と同じになること、分け方で結果が変わらないことを確かめる。
+// 最後に設定のPUTの本文を読む速さを、分けて渡す大きさごとに表示する。
+//
+// 乱数の種は引数で変えられる（省略すると毎回同じ）: program [種] [文書の数]
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <json_stream.h>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %s %s\n", ok ? "OK" : "NG", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+// 字句を1行ずつの文字列にして記録する（種類・深さ・文字列）
+static void appendToken(std::string& log, char type, int depth, const char* text, size_t length) {
+    log += type;
+    log += (char)('0' + depth);
+    log += ':';
+    log.append(text, length);
+    log += '\n';
+}
+
+static char tokenTypeChar(JsonToken::Type type) {
+    switch (type) {
+    case JsonToken::OBJECT_BEGIN: return '{';
+    case JsonToken::OBJECT_END: return '}';
+    case JsonToken::ARRAY_BEGIN: return '[';
+    case JsonToken::ARRAY_END: return ']';
+    case JsonToken::KEY: return 'K';
+    case JsonToken::STRING: return 'S';
+    case JsonToken::NUMBER: return 'N';
+    case JsonToken::TRUE_VALUE: return 't';
+    case JsonToken::FALSE_VALUE: return 'f';
+    default: return 'n';
+    }
+}
+
+class RecordingHandler : public JsonTokenHandler {
+public:
+    std::string log;
+
+    bool onToken(const JsonToken& token) override {
+        bool hasText = token.type == JsonToken::KEY || token.type == JsonToken::STRING || token.type == JsonToken::NUMBER;
+        appendToken(log, tokenTypeChar(token.type), token.depth, hasText ? token.text : "", hasText ? token.length : 0);
+        return true;
+    }
+};
+
+// 厳密なJSONの読み取り（再帰下降）
+// JsonTokenizer と同じ制限（入れ子は MAX_DEPTH まで、文字列・数値は MAX_TEXT バイトまで、\u0000 は不可）で
+// 受け付けるかどうかを決め、受け付けた時は同じ形式の字句の列を作る。
+class Reference {
+public:
+    explicit Reference(const std::string& doc) : doc(doc), pos(0) {}
+
+    bool parse() {
+        if (!value(0)) {
+            return false;
+        }
+        skipSpace();
+        return pos == doc.size();
+    }
+
+    std::string log;
+
+private:
+    const std::string& doc;
+    size_t pos;
+
+    int peek() const { return pos < doc.size() ? (unsigned char)doc[pos] : -1; }
+
+    void skipSpace() {
+        while (peek() == ' ' || peek() == '\t' || peek() == '\n' || peek() == '\r') {
+            pos++;
+        }
+    }
+
+    bool value(int depth) {
+        skipSpace();
+        int c = peek();
+        if (c == '{' || c == '[') {
+            return container(depth, c == '[');
+        }
+        if (c == '"') {
+            std::string text;
+            if (!string(text)) {
+                return false;
+            }
+            appendToken(log, 'S', depth, text.data(), text.size());
+            return true;
+        }
+        if (c == '-' || (c >= '0' && c <= '9')) {
+            return number(depth);
+        }
+        static const char* const literals[] = { "true", "false", "null" };
+        for (const char* literal : literals) {
+            size_t length = strlen(literal);
+            if (doc.compare(pos, length, literal) == 0) {
+                pos += length;
+                appendToken(log, literal[0], depth, "", 0);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool container(int depth, bool isArray) {
+        if (depth >= JsonTokenizer::MAX_DEPTH) {
+            return false;
+        }
+        pos++;
+        appendToken(log, isArray ? '[' : '{', depth, "", 0);
+        skipSpace();
+        char close = isArray ? ']' : '}';
+        if (peek() == close) {
+            pos++;
+            appendToken(log, close, depth, "", 0);
+            return true;
+        }
+        while (true) {
+            if (!isArray) {
+                skipSpace();
+                std::string key;
+                if (peek() != '"' || !string(key)) {
+                    return false;
+                }
+                appendToken(log, 'K', depth + 1, key.data(), key.size());
+                skipSpace();
+                if (peek() != ':') {
+                    return false;
+                }
+                pos++;
+            }
+            if (!value(depth + 1)) {
+                return false;
+            }
+            skipSpace();
+            if (peek() == ',') {
+                pos++;
+            } else if (peek() == close) {
+                pos++;
+                appendToken(log, close, depth, "", 0);
+                return true;
+            } else {
+                return false;
+            }
+        }
+    }
+
+    bool hex4(uint32_t& value) {
+        if (pos + 4 > doc.size()) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < 4; i++) {
+            char c = doc[pos++];
+            int digit = isdigit((unsigned char)c) ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 :
+                        (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+            if (digit < 0) {
+                return false;
+            }
+            value = (value << 4) | (uint32_t)digit;
+        }
+        return true;
+    }
+
+    static void appendUtf8(std::string& text, uint32_t cp) {
+        if (cp < 0x80) {
+            text += (char)cp;
+        } else if (cp < 0x800) {
+            text += (char)(0xC0 | (cp >> 6));
+            text += (char)(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            text += (char)(0xE0 | (cp >> 12));
+            text += (char)(0x80 | ((cp >> 6) & 0x3F));
+            text += (char)(0x80 | (cp & 0x3F));
+        } else {
+            text += (char)(0xF0 | (cp >> 18));
+            text += (char)(0x80 | ((cp >> 12) & 0x3F));
+            text += (char)(0x80 | ((cp >> 6) & 0x3F));
+            text += (char)(0x80 | (cp & 0x3F));
+        }
+    }
+
+    bool string(std::string& text) {
+        pos++;
+        while (true) {
+            int c = peek();
+            if (c < 0 || c < 0x20) {
+                return false;
+            }
+            pos++;
+            if (c == '"') {
+                return text.size() <= JsonTokenizer::MAX_TEXT;
+            }
+            if (c != '\\') {
+                text += (char)c;
+                continue;
+            }
+            static const char escapes[] = "\"\\/bfnrt";
+            static const char decoded[] = "\"\\/\b\f\n\r\t";
+            c = peek();
+            pos++;
+            const char* simple = c > 0 ? strchr(escapes, c) : nullptr;
+            if (simple != nullptr) {
+                text += decoded[simple - escapes];
+                continue;
+            }
+            uint32_t cp;
+            if (c != 'u' || !hex4(cp)) {
+                return false;
+            }
+            if (cp >= 0xD800 && cp <= 0xDBFF) {
+                uint32_t low;
+                if (doc.compare(pos, 2, "\\u") != 0) {
+                    return false;
+                }
+                pos += 2;
+                if (!hex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                    return false;
+                }
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+            } else if ((cp >= 0xDC00 && cp <= 0xDFFF) || cp == 0) {
+                return false;
+            }
+            appendUtf8(text, cp);
+        }
+    }
+
+    bool digits() {
+        size_t start = pos;
+        while (peek() >= '0' && peek() <= '9') {
+            pos++;
+        }
+        return pos > start;
+    }
+
+    bool number(int depth) {
+        size_t start = pos;
+        if (peek() == '-') {
+            pos++;
+        }
+        if (peek() == '0') {
+            pos++;
+        } else if (!digits()) {
+            return false;
+        }
+        if (peek() == '.') {
+            pos++;
+            if (!digits()) {
+                return false;
+            }
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            pos++;
+            if (peek() == '+' || peek() == '-') {
+                pos++;
+            }
+            if (!digits()) {
+                return false;
+            }
+        }
+        if (pos - start > JsonTokenizer::MAX_TEXT) {
+            return false;
+        }
+        appendToken(log, 'N', depth, doc.data() + start, pos - start);
+        return true;
+    }
+};
+
+// 乱数でJSONを作る（ほとんどは制限の内側、まれに制限を超える長さ・深さにする）
+class Generator {
+public:
+    explicit Generator(uint32_t seed) : rng(seed) {}
+
+    std::string document() {
+        std::string doc;
+        space(doc);
+        // 一番外は主にオブジェクト（設定のPUTの本文と同じ）
+        int kind = pick(10);
+        if (kind < 7) {
+            object(doc, 0);
+        } else if (kind < 9) {
+            array(doc, 0);
+        } else {
+            value(doc, 0);
+        }
+        space(doc);
+        return doc;
+    }
+
+    uint32_t pick(uint32_t n) { return std::uniform_int_distribution<uint32_t>(0, n - 1)(rng); }
+    std::mt19937& engine() { return rng; }
+
+private:
+    std::mt19937 rng;
+
+    void space(std::string& doc) {
+        static const char spaces[] = " \t\n\r";
+        if (pick(3) == 0) {
+            for (uint32_t i = pick(3) + 1; i > 0; i--) {
+                doc += spaces[pick(4)];
+            }
+        }
+    }
+
+    void value(std::string& doc, int depth) {
+        uint32_t limit = depth >= 6 ? (pick(20) == 0 ? 9 : 6) : 9;
+        switch (pick(limit)) {
+        case 0: case 1: case 2: string(doc); break;
+        case 3: case 4: number(doc); break;
+        case 5: doc += pick(2) ? "true" : (pick(2) ? "false" : "null"); break;
+        case 6: case 7: object(doc, depth + 1); break;
+        default: array(doc, depth + 1); break;
+        }
+    }
+
+    void object(std::string& doc, int depth) {
+        doc += '{';
+        uint32_t count = pick(5);
+        for (uint32_t i = 0; i < count; i++) {
+            if (i > 0) {
+                doc += ',';
+            }
+            space(doc);
+            key(doc);
+            space(doc);
+            doc += ':';
+            space(doc);
+            value(doc, depth);
+            space(doc);
+        }
+        if (count == 0) {
+            space(doc);
+        }
+        doc += '}';
+    }
+
+    void array(std::string& doc, int depth) {
+        doc += '[';
+        uint32_t count = pick(5);
+        for (uint32_t i = 0; i < count; i++) {
+            if (i > 0) {
+                doc += ',';
+            }
+            space(doc);
+            value(doc, depth);
+            space(doc);
+        }
+        doc += ']';
+    }
+
+    void key(std::string& doc) {
+        static const char* const keys[] = {
+            "ssid", "password", "otaUsername", "otaPassword", "ntpServer", "timeZone", "brightness", "face"
+        };
+        if (pick(2) == 0) {
+            doc += '"';
+            doc += keys[pick(8)];
+            doc += '"';
+        } else {
+            string(doc);
+        }
+    }
+
+    void string(std::string& doc) {
+        static const char* const pieces[] = {
+            "a", "Z", "0", " ", "-", "/", "\xE3\x81\x82", "\xF0\x9F\x98\x80", "\\\"", "\\\\", "\\/", "\\b", "\\f",
+            "\\n", "\\r", "\\t", "\\u00e9", "\\u3042", "\\uD83D\\uDE00", "\\u0041"
+        };
+        doc += '"';
+        // まれに MAX_TEXT 付近の長さにする
+        uint32_t count = pick(30) == 0 ? 90 + pick(12) : pick(12);
+        for (uint32_t i = 0; i < count; i++) {
+            doc += pick(3) == 0 ? pieces[pick(20)] : pieces[pick(4)];
+        }
+        doc += '"';
+    }
+
+    void number(std::string& doc) {
+        if (pick(2) == 0) {
+            doc += '-';
+        }
+        if (pick(4) == 0) {
+            doc += '0';
+        } else {
+            doc += (char)('1' + pick(9));
+            for (uint32_t i = pick(30) == 0 ? 100 : pick(6); i > 0; i--) {
+                doc += (char)('0' + pick(10));
+            }
+        }
+        if (pick(3) == 0) {
+            doc += '.';
+            for (uint32_t i = pick(4) + 1; i > 0; i--) {
+                doc += (char)('0' + pick(10));
+            }
+        }
+        if (pick(4) == 0) {
+            doc += pick(2) ? 'e' : 'E';
+            if (pick(2) == 0) {
+                doc += pick(2) ? '+' : '-';
+            }
+            for (uint32_t i = pick(3) + 1; i > 0; i--) {
+                doc += (char)('0' + pick(10));
+            }
+        }
+    }
+};
+
+// 読んだ結果（受け付けたか・字句の列・エラーの位置）
+struct Outcome {
+    bool accepted;
+    std::string log;
+    size_t offset;
+
+    bool operator==(const Outcome& other) const {
+        return accepted == other.accepted && log == other.log && offset == other.offset;
+    }
+};
+
+// cuts の位置で分けて渡す（WebサーバーがPUTの本文を分けて渡すのと同じく、最後に finish() を呼ぶ）
+static Outcome tokenize(const std::string& doc, const std::vector<size_t>& cuts) {
+    JsonTokenizer tokenizer;
+    RecordingHandler handler;
+    JsonTokenizer::Result result = JsonTokenizer::RESULT_MORE;
+    size_t start = 0;
+    for (size_t i = 0; i <= cuts.size() && result != JsonTokenizer::RESULT_ERROR; i++) {
+        size_t end = i < cuts.size() ? cuts[i] : doc.size();
+        result = tokenizer.feed(doc.data() + start, end - start, handler);
+        start = end;
+    }
+    if (result != JsonTokenizer::RESULT_ERROR) {
+        result = tokenizer.finish(handler);
+    }
+    Outcome outcome = { result == JsonTokenizer::RESULT_DONE, handler.log, tokenizer.getOffset() };
+    return outcome;
+}
+
+static std::vector<size_t> randomCuts(Generator& generator, size_t length) {
+    std::vector<size_t> cuts;
+    if (length == 0) {
+        return cuts;
+    }
+    for (uint32_t i = generator.pick(8); i > 0; i--) {
+        cuts.push_back(generator.pick((uint32_t)length + 1));
+    }
+    std::sort(cuts.begin(), cuts.end());
+    return cuts;
+}
+
+static std::vector<size_t> everyByte(size_t length) {
+    std::vector<size_t> cuts;
+    for (size_t i = 1; i < length; i++) {
+        cuts.push_back(i);
+    }
+    return cuts;
+}
+
+// 1つの入力を確かめる（Reference と同じ結果か、1回で渡しても分けて渡しても同じか）
+struct FuzzStats {
+    uint32_t inputs = 0;
+    uint32_t accepted = 0;
+    uint32_t referenceMismatches = 0;
+    uint32_t chunkMismatches = 0;
+    std::string firstMismatch;
+};
+
+static void fuzzOne(const std::string& doc, Generator& generator, FuzzStats& stats) {
+    stats.inputs++;
+    Reference reference(doc);
+    bool expected = reference.parse();
+    Outcome whole = tokenize(doc, std::vector<size_t>());
+    if (whole.accepted != expected || (expected && whole.log != reference.log)) {
+        stats.referenceMismatches++;
+        if (stats.firstMismatch.empty()) {
+            stats.firstMismatch = doc;
+        }
+    }
+    if (!(tokenize(doc, randomCuts(generator, doc.size())) == whole) ||
+        (doc.size() <= 256 && !(tokenize(doc, everyByte(doc.size())) == whole))) {
+        stats.chunkMismatches++;
+        if (stats.firstMismatch.empty()) {
+            stats.firstMismatch = doc;
+        }
+    }
+    if (whole.accepted) {
+        stats.accepted++;
+    }
+}
+
+static void reportFuzz(const char* name, const FuzzStats& stats) {
+    printf("  %s: %u 件（受け付けた %u 件）, Reference との違い %u, 分け方による違い %u\n",
+           name, (unsigned)stats.inputs, (unsigned)stats.accepted,
+           (unsigned)stats.referenceMismatches, (unsigned)stats.chunkMismatches);
+    if (!stats.firstMismatch.empty()) {
+        printf("  最初に違った入力: %s\n", stats.firstMismatch.c_str());
+    }
+    check(stats.referenceMismatches == 0 && stats.chunkMismatches == 0, name);
+}
+
+// 1バイトを変える・消す・足す
+static std::string mutate(const std::string& doc, Generator& generator) {
+    static const char interesting[] = "{}[]:,\"\\ -+.eE0123456789tfnu\x01\x7f";
+    std::string result = doc;
+    size_t at = generator.pick((uint32_t)doc.size() + 1);
+    char c = generator.pick(4) == 0 ? (char)generator.pick(256) : interesting[generator.pick(sizeof(interesting) - 1)];
+    switch (generator.pick(3)) {
+    case 0:
+        if (at < result.size()) {
+            result[at] = c;
+        }
+        break;
+    case 1:
+        if (at < result.size()) {
+            result.erase(at, 1);
+        }
+        break;
+    default:
+        result.insert(at, 1, c);
+        break;
+    }
+    return result;
+}
+
+static void testFuzz(uint32_t seed, uint32_t count) {
+    printf("乱数のJSON（種 %u、%u 件）\n", (unsigned)seed, (unsigned)count);
+    Generator generator(seed);
+    FuzzStats valid, truncated, malformed;
+    for (uint32_t i = 0; i < count; i++) {
+        std::string doc = generator.document();
+        fuzzOne(doc, generator, valid);
+
+        // 途中で切ったもの（一番外が数値なら、切っても正しいJSONのことがある）
+        if (!doc.empty()) {
+            fuzzOne(doc.substr(0, generator.pick((uint32_t)doc.size())), generator, truncated);
+        }
+
+        // 1バイトを変えたもの（何か所か）
+        std::string broken = doc;
+        for (uint32_t n = generator.pick(3) + 1; n > 0; n--) {
+            broken = mutate(broken, generator);
+        }
+        fuzzOne(broken, generator, malformed);
+    }
+    reportFuzz("正しいJSON", valid);
+    reportFuzz("途中で切ったJSON", truncated);
+    reportFuzz("壊したJSON", malformed);
+}
+
+// 決まった入力（制限の境目と、よくある誤り）
+static void testEdgeCases() {
+    printf("制限の境目とよくある誤り\n");
+    struct Case {
+        std::string doc;
+        bool accepted;
+    };
+    std::string deepOk = std::string(8, '[') + std::string(8, ']');
+    std::string deepNg = std::string(9, '[') + std::string(9, ']');
+    std::string longOk = "\"" + std::string(JsonTokenizer::MAX_TEXT, 'a') + "\"";
+    std::string longNg = "\"" + std::string(JsonTokenizer::MAX_TEXT + 1, 'a') + "\"";
+    std::string numberOk = std::string(JsonTokenizer::MAX_TEXT, '1');
+    std::string numberNg = std::string(JsonTokenizer::MAX_TEXT + 1, '1');
+    const Case cases[] = {
+        { deepOk, true }, { deepNg, false }, { longOk, true }, { longNg, false },
+        { numberOk, true }, { numberNg, false },
+        { "{\"brightness\":200}", true }, { " {} ", true }, { "[]", true }, { "0", true }, { "-0.5e+3", true },
+        { "\"\\uD83D\\uDE00\"", true }, { "\"\\uD83D\"", false }, { "\"\\uDE00\"", false }, { "\"\\u0000\"", false },
+        { "\"\\uD83D\\n\"", false }, { "\"\\x\"", false }, { "\"a\tb\"", false },
+        { "01", false }, { "1.", false }, { "-", false }, { "1e", false }, { ".5", false }, { "+1", false },
+        { "[1,]", false }, { "{\"a\":1,}", false }, { "{\"a\" 1}", false }, { "{1:2}", false }, { "[1}", false },
+        { "{\"a\":1} x", false }, { "tru", false }, { "nul", false }, { "True", false }, { "", false }, { "  ", false },
+        { "{\"a\":", false }, { "[\"abc", false },
+    };
+    int mismatches = 0;
+    for (const Case& c : cases) {
+        Outcome whole = tokenize(c.doc, std::vector<size_t>());
+        Outcome bytes = tokenize(c.doc, everyByte(c.doc.size()));
+        Reference reference(c.doc);
+        if (whole.accepted != c.accepted || !(bytes == whole) || reference.parse() != c.accepted) {
+            printf("  違い: %s（期待 %s）\n", c.doc.c_str(), c.accepted ? "受け付ける" : "誤り");
+            mismatches++;
+        }
+    }
+    check(mismatches == 0, "すべて期待どおり（1バイトずつ渡しても同じ）");
+
+    // エラーの位置は、誤りと分かった文字の前までに読んだバイト数
+    Outcome error = tokenize("{\"ssid\":\"a\",,}", std::vector<size_t>());
+    check(!error.accepted && error.offset == 12, "エラーの位置");
+
+    // 字句を受け取る側が止めたらエラーにする
+    class Rejecting : public JsonTokenHandler {
+    public:
+        bool onToken(const JsonToken& token) override { return token.type != JsonToken::NUMBER; }
+    } rejecting;
+    JsonTokenizer tokenizer;
+    const char* doc = "{\"face\":1}";
+    check(tokenizer.feed(doc, strlen(doc), rejecting) == JsonTokenizer::RESULT_ERROR &&
+          strcmp(tokenizer.getError(), "rejected by handler") == 0, "受け取る側が止めるとエラー");
+}
+
+// 設定のPUTの本文を読む速さ（分けて渡す大きさごと）
+class CountingHandler : public JsonTokenHandler {
+public:
+    size_t tokens = 0;
+    size_t bytes = 0;
+
+    bool onToken(const JsonToken& token) override {
+        tokens++;
+        bytes += token.length;
+        return true;
+    }
+};
+
+static void testThroughput() {
+    printf("読む速さ（ホスト）\n");
+    static const char body[] =
+        "{\"ssid\":\"MyHomeNetwork-5G\",\"password\":\"correct horse battery staple\","
+        "\"otaUsername\":\"admin\",\"otaPassword\":\"s3cret-pass\",\"ntpServer\":\"ntp.nict.jp\","
+        "\"timeZone\":\"Europe/London\",\"brightness\":200,\"face\":1}";
+    const size_t length = sizeof(body) - 1;
+    const int repeat = 200000;
+    const size_t chunks[] = { 1, 16, 64, 536, 1460 };
+
+    printf("  本文 %u bytes, sizeof(JsonTokenizer) = %u bytes\n", (unsigned)length, (unsigned)sizeof(JsonTokenizer));
+    printf("  %8s %12s %10s\n", "chunk", "us/本文", "MB/s");
+    bool allDone = true;
+    for (size_t chunk : chunks) {
+        CountingHandler handler;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; i++) {
+            JsonTokenizer tokenizer;
+            JsonTokenizer::Result result = JsonTokenizer::RESULT_MORE;
+            for (size_t offset = 0; offset < length; offset += chunk) {
+                size_t size = length - offset < chunk ? length - offset : chunk;
+                result = tokenizer.feed(body + offset, size, handler);
+            }
+            if (tokenizer.finish(handler) != JsonTokenizer::RESULT_DONE || result != JsonTokenizer::RESULT_DONE) {
+                allDone = false;
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("  %8u %12.3f %10.1f\n", (unsigned)chunk, seconds * 1e6 / repeat,
+               (double)length * repeat / seconds / 1e6);
+        if (handler.tokens != (size_t)repeat * 18) {
+            allDone = false;
+        }
+    }
+    check(allDone, "どの大きさで分けても最後まで読めた");
+}
+
+int main(int argc, char** argv) {
+    uint32_t seed = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 0) : 20240601;
+    uint32_t count = argc > 2 ? (uint32_t)strtoul(argv[2], nullptr, 0) : 20000;
+
+    testEdgeCases();
+    testFuzz(seed, count);
+    testThroughput();
+
+    if (failures > 0) {
+        printf("%d 件の失敗\n", failures);
+        return 1;
+    }
+    printf("すべて成功\n");
+    return 0;
+}
@@ -0,0 +1,253 @@
+// TimeZone のホスト用テスト
+// 表にあるすべてのタイムゾーンと、南半球・30分の夏時間・Mm.w.d/time の端の値（/0・/24・/26・/-1、
+// 分や秒まで書いた時刻、第5週、Jn・n）の規則で、1970年から2150年までを6時間ごとに
+// ホストのCライブラリの localtime_r() と比べる（glibc は1970年より前には規則の夏時間を当てはめない）。
+// Cライブラリで時差が変わったところは1秒単位で探し、すべての切り替わりの前後の秒も比べる。
+// 最後に変換の速さを、同じ秒・1秒ずつ・ばらばらの時刻のそれぞれで localtime_r() と並べて表示する。
+//
+// 比べる年の範囲は引数で変えられる: program [最初の年] [最後の年]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <time_zone.h>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("  %s %s\n", ok ? "OK" : "NG", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+// 表にない規則（名前は説明）
+struct EdgeRule {
+    const char* rule;
+    const char* note;
+};
+static const EdgeRule edgeRules[] = {
+    { "<-03>3<-02>,M10.3.0/0,M2.3.0/0", "南半球、0時に切り替わる" },
+    { "<-04>4<-03>,M9.1.6/24,M4.1.6/24", "南半球、/24" },
+    { "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", "南半球、30分の夏時間" },
+    { "<+13>-13<+14>,M9.5.0/3,M4.1.0/4", "南半球、UTC+13" },
+    { "IST-2IDT,M3.4.4/26,M10.5.0", "/26（木曜の26時）" },
+    { "<-02>2<-01>,M3.5.0/-1,M10.5.0/0", "/-1（土曜の23時）" },
+    { "<-01>1<+00>,M3.5.0/0,M10.5.0/1", "UTC-1 から UTC+0" },
+    { "EST5EDT,M3.2.0/0:30:15,M11.1.0/1:45", "分・秒まで書いた時刻" },
+    { "AAA3BBB,M2.5.6/23,M10.5.6/23", "2月の第5週（うるう年だけ29日）" },
+    { "AAA3BBB1,M3.2.0,M11.1.0", "夏時間が2時間" },
+    { "<+0330>-3:30<+0430>,J79/24,J263/24", "Jn（2月29日を数えない）" },
+    { "<+01>-1<+02>,J60/0,J300", "J60（うるう年でも3月1日）" },
+    { "XXX5YYY,59/3,300", "n（0始まり、うるう年は2月29日）" },
+    { "<-10>10<-09>,M12.1.0,M1.5.0", "12月から1月（年をまたぐ夏時間）" },
+};
+static const int EDGE_RULE_COUNT = sizeof(edgeRules) / sizeof(edgeRules[0]);
+
+static void useLibcRule(const char* rule) {
+    setenv("TZ", rule, 1);
+    tzset();
+}
+
+static time_t yearStart(int year) {
+    struct tm tm = {};
+    tm.tm_year = year - 1900;
+    tm.tm_mday = 1;
+    return timegm(&tm);
+}
+
+// 1つの規則の比べた結果
+struct SweepResult {
+    int samples = 0;
+    int transitions = 0;
+    int mismatches = 0;
+};
+
+static void printTm(const char* label, const struct tm& tm, long offset) {
+    printf("      %s %04d-%02d-%02d %02d:%02d:%02d 曜日%d 通算%d 夏時間%d 時差%ld\n", label, tm.tm_year + 1900,
+           tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, tm.tm_wday, tm.tm_yday, tm.tm_isdst, offset);
+}
+
+// utc の地方時を localtime_r() と比べる
+static bool compareAt(TimeZone& zone, time_t utc, SweepResult& result, const char* rule) {
+    struct tm expected;
+    struct tm actual;
+    localtime_r(&utc, &expected);
+    zone.toLocal(utc, &actual);
+    int32_t offset = zone.getOffset(utc);
+    result.samples++;
+    bool same = actual.tm_year == expected.tm_year && actual.tm_mon == expected.tm_mon &&
+                actual.tm_mday == expected.tm_mday && actual.tm_hour == expected.tm_hour &&
+                actual.tm_min == expected.tm_min && actual.tm_sec == expected.tm_sec &&
+                actual.tm_wday == expected.tm_wday && actual.tm_yday == expected.tm_yday &&
+                actual.tm_isdst == expected.tm_isdst && offset == expected.tm_gmtoff &&
+                zone.isDst(utc) == (expected.tm_isdst > 0);
+    if (!same) {
+        if (result.mismatches < 3) {
+            printf("    %s: UTC %lld で違う\n", rule, (long long)utc);
+            printTm("localtime_r", expected, expected.tm_gmtoff);
+            printTm("TimeZone   ", actual, offset);
+        }
+        result.mismatches++;
+    }
+    return same;
+}
+
+// firstYear 年から lastYear 年の終わりまでを比べる
+static SweepResult sweepRule(const char* rule, int firstYear, int lastYear) {
+    static const time_t STEP = 6 * 3600;
+    SweepResult result;
+    useLibcRule(rule);
+    TimeZone zone;
+    if (!zone.setRule(rule)) {
+        printf("    %s: 解析できない\n", rule);
+        result.mismatches++;
+        return result;
+    }
+
+    time_t end = yearStart(lastYear + 1);
+    time_t previous = yearStart(firstYear);
+    struct tm tm;
+    localtime_r(&previous, &tm);
+    long previousOffset = tm.tm_gmtoff;
+    compareAt(zone, previous, result, rule);
+    for (time_t t = previous + STEP; t < end; previous = t, t += STEP) {
+        compareAt(zone, t, result, rule);
+        localtime_r(&t, &tm);
+        if (tm.tm_gmtoff == previousOffset) {
+            continue;
+        }
+        // 時差が変わった最初の秒を探す
+        time_t low = previous;
+        time_t high = t;
+        while (high - low > 1) {
+            time_t middle = low + (high - low) / 2;
+            localtime_r(&middle, &tm);
+            if (tm.tm_gmtoff == previousOffset) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        compareAt(zone, high - 1, result, rule);
+        compareAt(zone, high, result, rule);
+        compareAt(zone, high + 1, result, rule);
+        result.transitions++;
+        localtime_r(&t, &tm);
+        previousOffset = tm.tm_gmtoff;
+    }
+    return result;
+}
+
+static void testRules(int firstYear, int lastYear) {
+    printf("localtime_r() との比較（%d年から%d年、6時間ごとと切り替わりの前後の秒）\n", firstYear, lastYear);
+    int years = lastYear - firstYear + 1;
+
+    std::vector<const char*> rules;
+    std::vector<const char*> notes;
+    for (int i = 0; i < TimeZone::getZoneCount(); i++) {
+        rules.push_back(TimeZone::getZoneRule(i));
+        notes.push_back(TimeZone::getZoneName(i));
+    }
+    for (int i = 0; i < EDGE_RULE_COUNT; i++) {
+        rules.push_back(edgeRules[i].rule);
+        notes.push_back(edgeRules[i].note);
+    }
+
+    for (size_t i = 0; i < rules.size(); i++) {
+        SweepResult result = sweepRule(rules[i], firstYear, lastYear);
+        TimeZone zone;
+        zone.setRule(rules[i]);
+        // 夏時間のある規則は毎年2回切り替わる
+        int expectedTransitions = zone.hasDaylightSaving() ? years * 2 : 0;
+        char what[160];
+        snprintf(what, sizeof(what), "%s（%s）: %d 点, 切り替わり %d 回", rules[i], notes[i], result.samples,
+                 result.transitions);
+        check(result.mismatches == 0 && result.transitions >= expectedTransitions - 1 &&
+              result.transitions <= expectedTransitions + 1, what);
+    }
+}
+
+// 時差から作った規則（formatOffsetRule）も localtime_r() で同じに読める
+static void testOffsetRules(int firstYear, int lastYear) {
+    printf("formatOffsetRule() の規則\n");
+    static const long offsets[] = { -36000, -12600, 0, 3600, 19800, 34200, 45900 };
+    bool allSame = true;
+    for (long offset : offsets) {
+        for (int daylight = 0; daylight <= 3600; daylight += 3600) {
+            char rule[TimeZone::RULE_SIZE];
+            TimeZone::formatOffsetRule(rule, sizeof(rule), offset, daylight);
+            SweepResult result = sweepRule(rule, firstYear, lastYear);
+            if (result.mismatches > 0 || (daylight != 0 && result.transitions == 0)) {
+                allSame = false;
+            }
+        }
+    }
+    check(allSame, "時差と夏時間の有無の14通り");
+}
+
+// 変換の速さ
+static void testThroughput() {
+    printf("変換の速さ（ホスト、Europe/London）\n");
+    const char* rule = TimeZone::getZoneRule(TimeZone::findZone("Europe/London"));
+    useLibcRule(rule);
+    TimeZone zone;
+    zone.setRule(rule);
+
+    const int count = 2000000;
+    const time_t base = yearStart(2026) + 86 * 86400;    // 3月の終わり（夏時間の始まりをまたぐ）
+    std::vector<time_t> randomTimes(count);
+    std::mt19937 rng(20240601);
+    std::uniform_int_distribution<int64_t> pick(yearStart(1970), yearStart(2100) - 1);
+    for (time_t& t : randomTimes) {
+        t = (time_t)pick(rng);
+    }
+
+    printf("  %-16s %14s %14s\n", "", "TimeZone ns/回", "localtime_r ns/回");
+    bool allSame = true;
+    for (int pattern = 0; pattern < 3; pattern++) {
+        static const char* names[] = { "同じ秒", "1秒ずつ", "ばらばらの時刻" };
+        double nanoseconds[2];
+        long sums[2];
+        for (int library = 0; library < 2; library++) {
+            long sum = 0;
+            struct tm tm;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < count; i++) {
+                time_t t = pattern == 0 ? base : (pattern == 1 ? base + i : randomTimes[i]);
+                if (library == 0) {
+                    zone.toLocal(t, &tm);
+                } else {
+                    localtime_r(&t, &tm);
+                }
+                sum += tm.tm_sec + tm.tm_hour + tm.tm_mday + tm.tm_isdst;
+            }
+            nanoseconds[library] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / count;
+            sums[library] = sum;
+        }
+        printf("  %-16s %14.1f %14.1f\n", names[pattern], nanoseconds[0], nanoseconds[1]);
+        if (sums[0] != sums[1]) {
+            allSame = false;
+        }
+    }
+    check(allSame, "速さを測った変換の結果も localtime_r() と同じ");
+}
+
+int main(int argc, char** argv) {
+    int firstYear = argc > 1 ? atoi(argv[1]) : 1970;
+    int lastYear = argc > 2 ? atoi(argv[2]) : 2150;
+
+    testRules(firstYear, lastYear);
+    testOffsetRules(firstYear, lastYear);
+    testThroughput();
+
+    if (failures > 0) {
+        printf("%d 件の失敗\n", failures);
+        return 1;
+    }
+    printf("すべて成功\n");
+    return 0;
+}